@@ -9,6 +9,7 @@
 #include "ns3/network-module.h"
 #include "ns3/wifi-module.h"
 #include "ns3/obstacle.h"
+#include "ns3/simulation-checkpoint.h"
 #include "common-functions.h"
 #include <string>
 #include <math.h>
@@ -32,6 +33,8 @@
  * Running Simulation:
  * ./waf --run "TGad_performance_evaluation_living_room --humanBlock=false"  (LoS channel)
  * ./waf --run "TGad_performance_evaluation_living_room --humanBlock=true"  (NLoS channel)
+ * ./waf --run "TGad_performance_evaluation_living_room --whatIf=true"  (baseline and moved TV,
+ *   both run from the same state at the start of the traffic)
  *
  * Simulation Output:
  * 1. LoS/NLoS status (LoS -- 0; NLoS -- 1)
@@ -50,6 +53,38 @@ uint64_t totalRx = 0;
 double throughput = 0;
 uint32_t allocationType = 0;               /* The type of channel access scheme during DTI (CBAP is the default) */
 
+/**  What-if Branch Variables **/
+double branchEndTime;                      /* End of the simulation in the what-if branches */
+ApplicationContainer branchSinks;          /* Sinks reported by the what-if branches */
+Ptr<MobilityModel> branchStaMobility;      /* Mobility of the TV, moved by the what-if branch */
+
+void
+BaselineBranch (void)
+{
+  Simulator::Stop (Seconds (branchEndTime) - Simulator::Now ());
+}
+
+void
+MovedStaBranch (void)
+{
+  Vector position = branchStaMobility->GetPosition ();
+  position.x -= 1.0;
+  branchStaMobility->SetPosition (position);
+  Simulator::Stop (Seconds (branchEndTime) - Simulator::Now ());
+}
+
+int
+ReportBranch (void)
+{
+  for (unsigned index = 0; index < branchSinks.GetN (); ++index)
+    {
+      uint64_t totalPacketsThrough = StaticCast<PacketSink> (branchSinks.Get (index))->GetTotalRx ();
+      std::cerr << ((totalPacketsThrough * 8) / ((branchEndTime - 2) * 1000000.0)) << " ";
+    }
+  std::cerr << std::endl;
+  return 0;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -78,6 +113,7 @@ main(int argc, char *argv[])
   double depSD = 1;
   uint32_t clientNo = 1; // number of sta, must fixed at 1 for this script
   uint16_t obsNumber = 20; // 22, 43, obstacles
+  bool whatIf = false; // true -- run a baseline and a moved-TV branch from the state at the start of the traffic
   double human_obs_ratio = 0; // if no human blockage, set as 0. NOTE: only used for RORC mode
   bool TGad_channel = true; // enable TGad_channel
   int reflectorDenseMode = 2; // 1/2/3 -> lower/medium/higher density of highly-reflective objects in the room
@@ -113,6 +149,7 @@ main(int argc, char *argv[])
   cmd.AddValue ("depSD", "random seed for dependent distribution", depSD);
   cmd.AddValue ("clientNo", "Number of client", clientNo);
   cmd.AddValue ("obsNumber", "obstacle Number", obsNumber);  
+  cmd.AddValue ("whatIf", "Run a baseline and a moved-TV branch from the state at the start of the traffic", whatIf);
   cmd.Parse (argc, argv);
 
 
@@ -454,6 +491,21 @@ main(int argc, char *argv[])
       wifiPhy.EnablePcap ("Traces/Station", staDevice, false);
     }
 
+  if (whatIf)
+    {
+      /* Warm up once, then run each variant from the state at the start of the traffic */
+      branchEndTime = simulationTime + 1;
+      branchSinks = sinkApplications;
+      branchStaMobility = staWifiNode.Get (0)->GetObject<MobilityModel> ();
+      Simulator::Stop (Seconds (1.0));
+      Simulator::Run ();
+      SimulationCheckpoint checkpoint;
+      checkpoint.AddBranch ("baseline", MakeCallback (&BaselineBranch), MakeCallback (&ReportBranch));
+      checkpoint.AddBranch ("moved-sta", MakeCallback (&MovedStaBranch), MakeCallback (&ReportBranch));
+      checkpoint.Run ();
+      Simulator::Destroy ();
+      return 0;
+    }
 
   Simulator::Stop (Seconds (simulationTime + 1));
   Simulator::Run ();
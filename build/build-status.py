@@ -0,0 +1,8 @@
+#! /usr/bin/env python3
+
+# Programs that are runnable.
+ns3_runnable_programs = ['build/scratch/ns3-dev-MultiAP_doubleRoom_withSmallOpen_simpleCase-optimized', 'build/scratch/ns3-dev-evaluate_talon_throughput-optimized', 'build/scratch/ns3-dev-evaluate_achievable_throughput-optimized', 'build/scratch/ns3-dev-evaluate_service_period_udp-optimized', 'build/scratch/ns3-dev-evaluate_predictive_rate_adaptation-optimized', 'build/scratch/ns3-dev-evaluate_11ay_mu_mimo-optimized', 'build/scratch/ns3-dev-evaluate_beamforming_cbap-optimized', 'build/scratch/ns3-dev-evaluate_11ay_channel_bonding-optimized', 'build/scratch/ns3-dev-evaluate_beam_refinement_protocol-optimized', 'build/scratch/ns3-dev-evaluate_multi_antenna_bft-optimized', 'build/scratch/ns3-dev-evaluate_per_vs_snr_11ad-optimized', 'build/scratch/ns3-dev-evaluate_beacon_interval-optimized', 'build/scratch/ns3-dev-evaluate_simple_service_period-optimized', 'build/scratch/ns3-dev-evaluate_multi_channel_scenario-optimized', 'build/scratch/ns3-dev-evaluate_11ay_su_mimo-optimized', 'build/scratch/ns3-dev-evaluate_spatial_sharing-optimized', 'build/scratch/ns3-dev-evaluate_qd_channel_lroom_scenario-optimized', 'build/scratch/ns3-dev-compare_access_schemes-optimized', 'build/scratch/ns3-dev-evaluate_beamforming_sp-optimized', 'build/scratch/ns3-dev-evaluate_edmg_error_model-optimized', 'build/scratch/ns3-dev-evaluate_bti_beamforming-optimized', 'build/scratch/subdir/ns3-dev-subdir-optimized', 'build/scratch/ns3-dev-test_beamformedlink_maintenance-optimized', 'build/scratch/ns3-dev-evaluate_service_period_tcp-optimized', 'build/scratch/ns3-dev-evaluate_beamforming_itxss_rtxss-optimized', 'build/scratch/ns3-dev-evaluate_dmg_adhoc-optimized', 'build/scratch/ns3-dev-evaluate_beamforming_sp2-optimized', 'build/scratch/ns3-dev-evaluate_trafficstream_allocation-optimized', 'build/scratch/ns3-dev-evaluate_multi_service_period-optimized', 'build/scratch/ns3-dev-evaluate_qd_channel_spatial_sharing-optimized', 'build/scratch/ns3-dev-evaluate_codebook_parametric-optimized', 'build/scratch/ns3-dev-evaluate_qd_dense_scenario_single_ap-optimized', 'build/scratch/ns3-dev-evaluate_numerical_codebook-optimized', 'build/scratch/ns3-dev-evaluate_codebook_analytical-optimized']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = []
+
@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ASYNC_TRACE_WRITER_H
+#define ASYNC_TRACE_WRITER_H
+
+#include "ns3/core-config.h"
+#include "ns3/ptr.h"
+#include <atomic>
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace ns3 {
+
+class SystemThread;
+class SystemCondition;
+
+/**
+ * \ingroup network
+ *
+ * \brief A stream buffer which writes a trace file from a background thread.
+ *
+ * Trace sinks write to an std::ostream over this buffer as they would to
+ * an std::ofstream, and every flush of the stream (std::endl, std::flush)
+ * ends a record. A record is copied whole into a ring buffer shared,
+ * without locks, with a writer thread, which moves the contents of the
+ * ring to the file in large sequential writes: the simulation thread only
+ * pays for a copy in memory.
+ *
+ * When a record does not fit in the ring, the overflow policy decides
+ * whether the simulation thread waits for the writer thread (BLOCK), or
+ * the record is dropped whole and counted (DROP), so that the file never
+ * holds a partial record. A record longer than a quarter of the ring is
+ * handed over in pieces before its end: if its first piece is dropped, so
+ * are the others, and once a piece is in the ring the simulation thread
+ * waits for room for the others, whatever the policy.
+ *
+ * The writer is used for all pcap files opened for writing and all ascii
+ * trace streams when the global value TraceAsyncWrite is true; the
+ * global values TraceAsyncBufferSize and TraceAsyncOverflowPolicy set the
+ * size of the ring and the overflow policy. Without thread support, the
+ * records are written synchronously.
+ */
+class AsyncTraceWriter : public std::streambuf
+{
+public:
+  /// What to do with a record which does not fit in the ring
+  enum OverflowPolicy
+  {
+    BLOCK, //!< Wait for the writer thread to make room
+    DROP   //!< Drop the record and count it
+  };
+
+  /**
+   * Open a file and start its writer thread.
+   *
+   * \param filename the name of the file
+   * \param mode the mode of the file (std::ios::out or std::ios::app, ored
+   * with std::ios::binary if needed)
+   * \param bufferSize the size of the ring, rounded up to a power of two
+   * \param policy the overflow policy
+   */
+  AsyncTraceWriter (std::string const &filename, std::ios::openmode mode,
+                    uint32_t bufferSize, OverflowPolicy policy);
+  /**
+   * Write the pending records and close the file.
+   */
+  ~AsyncTraceWriter ();
+
+  /**
+   * \returns true if the file was opened successfully
+   */
+  bool IsOpen (void) const;
+  /**
+   * Wait until all the records written so far are in the file.
+   */
+  void Flush (void);
+  /**
+   * Write the pending records, stop the writer thread and close the file.
+   */
+  void Close (void);
+  /**
+   * \returns the number of records dropped because the ring was full
+   */
+  uint64_t GetDroppedRecords (void) const;
+  /**
+   * \returns the number of bytes dropped because the ring was full
+   */
+  uint64_t GetDroppedBytes (void) const;
+
+  /**
+   * \returns the value of the global value TraceAsyncWrite
+   */
+  static bool IsEnabled (void);
+  /**
+   * Open a file with the ring size and overflow policy of the global values.
+   *
+   * \param filename the name of the file
+   * \param mode the mode of the file
+   * \returns the writer
+   */
+  static AsyncTraceWriter * Open (std::string const &filename, std::ios::openmode mode);
+
+protected:
+  /**
+   * Grow the pending record, which always fits in the put area, up to a
+   * quarter of the ring; longer records are handed over in pieces.
+   * \param c the character which did not fit
+   * \returns c, or eof on error
+   */
+  virtual int_type overflow (int_type c);
+  /**
+   * End the pending record and hand it to the writer thread.
+   * \returns 0, or -1 if the file could not be written
+   */
+  virtual int sync (void);
+
+private:
+  /**
+   * Copy a record, or a piece of a long record, into the ring, or write it
+   * if there is no writer thread.
+   * \param data the record
+   * \param size the size of the record
+   * \param end whether this is the end of the record
+   */
+  void Commit (const char *data, uint64_t size, bool end);
+  /**
+   * Copy bytes into the ring at the producer position, which must have room.
+   * \param data the bytes
+   * \param size the number of bytes
+   */
+  void CopyIn (const char *data, uint64_t size);
+  /// Wake the writer thread up
+  void Wake (void);
+  /// Main loop of the writer thread
+  void Run (void);
+
+  std::ofstream m_file;                //!< the file
+  std::vector<char> m_record;          //!< the pending record, used as put area
+  std::vector<char> m_ring;            //!< the ring, a power of two
+  uint64_t m_mask;                     //!< the size of the ring minus one
+  std::atomic<uint64_t> m_head;        //!< bytes copied into the ring, by the producer
+  char m_padding[64 - sizeof (std::atomic<uint64_t>)]; //!< keep the ends on separate cache lines
+  std::atomic<uint64_t> m_tail;        //!< bytes written to the file, by the writer thread
+  std::atomic<bool> m_stop;            //!< the writer thread must exit once the ring is empty
+  std::atomic<bool> m_error;           //!< a write to the file failed
+  OverflowPolicy m_policy;             //!< the overflow policy
+  uint64_t m_droppedRecords;           //!< number of dropped records
+  uint64_t m_droppedBytes;             //!< number of dropped bytes
+  uint64_t m_maxRecord;                //!< longest record handed over whole
+  bool m_partial;                      //!< a piece of the pending record is in the ring
+  bool m_dropping;                     //!< a piece of the pending record was dropped
+  bool m_closed;                       //!< Close has been called
+#ifdef HAVE_PTHREAD_H
+  Ptr<SystemThread> m_thread;          //!< the writer thread
+  SystemCondition *m_wakeup;           //!< wakes the writer thread up
+#endif /* HAVE_PTHREAD_H */
+};
+
+} // namespace ns3
+
+#endif /* ASYNC_TRACE_WRITER_H */
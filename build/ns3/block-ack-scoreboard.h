@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BLOCK_ACK_SCOREBOARD_H
+#define BLOCK_ACK_SCOREBOARD_H
+
+#include <vector>
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+class WifiMacQueueItem;
+
+/**
+ * \ingroup wifi
+ * \brief The MPDUs transmitted under a Block Ack agreement and not yet acknowledged
+ *
+ * The MPDUs are stored in a circular array of slots indexed by sequence
+ * number, whose size is a power of two not less than the transmit window.
+ * A bitmap tells which slots hold MPDUs, hence the MPDUs are stored and
+ * removed in constant time, and they are visited in increasing order of
+ * sequence number (with respect to the starting sequence number of the
+ * agreement) by skipping the empty slots 64 at a time. The fragments of
+ * an MSDU share the slot of its sequence number.
+ *
+ * The slots double in number whenever an MPDU beyond the last slot is
+ * stored, so that any MPDU which is not old can be stored.
+ */
+class BlockAckScoreboard
+{
+public:
+  BlockAckScoreboard ();
+
+  /**
+   * Size the scoreboard for the given transmit window. The scoreboard
+   * keeps the MPDUs it holds.
+   *
+   * \param winSize the size of the transmit window
+   */
+  void Init (std::size_t winSize);
+  /**
+   * Store an MPDU, unless an MPDU with the same sequence control is stored
+   * already. The MPDU must not be old with respect to the given starting
+   * sequence number.
+   *
+   * \param mpdu the MPDU
+   * \param startingSeq the starting sequence number of the agreement
+   * \return true if the MPDU has been stored
+   */
+  bool Insert (Ptr<WifiMacQueueItem> mpdu, uint16_t startingSeq);
+  /**
+   * Remove all the MPDUs with the given sequence number.
+   *
+   * \param seq the sequence number
+   */
+  void Remove (uint16_t seq);
+  /**
+   * Remove the given MPDU.
+   *
+   * \param mpdu the MPDU
+   */
+  void Remove (Ptr<const WifiMacQueueItem> mpdu);
+  /**
+   * Remove the MPDUs whose distance from the given starting sequence
+   * number does not exceed the distance of the given sequence number.
+   *
+   * \param startingSeq the starting sequence number of the agreement
+   * \param lastSeq the last sequence number to remove
+   */
+  void RemoveUpTo (uint16_t startingSeq, uint16_t lastSeq);
+  /**
+   * Remove all the MPDUs.
+   */
+  void Clear (void);
+
+  /**
+   * \return true if no MPDU is stored
+   */
+  bool IsEmpty (void) const;
+  /**
+   * \return the number of sequence numbers of the MPDUs stored, where all
+   *         the fragments of an MSDU count as one
+   */
+  std::size_t GetNSequenceNumbers (void) const;
+  /**
+   * \return the number of slots
+   */
+  std::size_t GetNSlots (void) const;
+  /**
+   * Get the first MPDU, in increasing order of sequence number with respect
+   * to the given starting sequence number.
+   *
+   * \param startingSeq the starting sequence number of the agreement
+   * \return the first MPDU, or a null pointer if no MPDU is stored
+   */
+  Ptr<WifiMacQueueItem> Peek (uint16_t startingSeq) const;
+  /**
+   * Append the MPDUs stored to the given vector, in increasing order of
+   * sequence number with respect to the given starting sequence number
+   * and of fragment number.
+   *
+   * \param startingSeq the starting sequence number of the agreement
+   * \param mpdus the vector
+   */
+  void GetMpdus (uint16_t startingSeq, std::vector<Ptr<WifiMacQueueItem>> &mpdus) const;
+
+private:
+  /**
+   * \param seq a sequence number
+   * \return the index of the slot of the given sequence number
+   */
+  std::size_t GetSlot (uint16_t seq) const;
+  /**
+   * \param slot the index of a slot
+   * \return whether the slot holds MPDUs
+   */
+  bool IsUsed (std::size_t slot) const;
+  /**
+   * Empty a slot.
+   *
+   * \param slot the index of the slot
+   */
+  void Free (std::size_t slot);
+  /**
+   * Double the number of slots.
+   */
+  void Grow (void);
+  /**
+   * Find the index of the first slot holding MPDUs, starting from the given
+   * slot and going around the array, but not beyond the given number of
+   * slots.
+   *
+   * \param slot the index of the first slot to look at
+   * \param count the number of slots to look at
+   * \return the number of slots skipped, or count if none holds MPDUs
+   */
+  std::size_t FindUsed (std::size_t slot, std::size_t count) const;
+
+  /// the MPDUs with the sequence number of each slot, sorted by fragment number
+  std::vector<std::vector<Ptr<WifiMacQueueItem>>> m_slots;
+  std::vector<uint64_t> m_used;  ///< a bit per slot, set if the slot holds MPDUs
+  std::size_t m_nUsed;           ///< the number of slots holding MPDUs
+};
+
+} //namespace ns3
+
+#endif /* BLOCK_ACK_SCOREBOARD_H */
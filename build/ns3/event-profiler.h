@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3 {
+
+class EventImpl;
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Attribute the wall-clock time of a simulation to the functions
+ * run by its events.
+ *
+ * The simulator hands each event to Invoke, which runs it between two
+ * reads of a steady clock and adds the elapsed time and one event to the
+ * function or method called by the event (see EventImpl::GetFunction).
+ * Events whose function is unknown are attributed to their type.
+ * The names of the functions are only looked up, in the symbol table of
+ * the program, when the results are printed.
+ *
+ * The DefaultSimulatorImpl uses a profiler when its EventProfile
+ * attribute is true, and prints its results at Simulator::Destroy.
+ */
+class EventProfiler
+{
+public:
+  /// The time spent in a function
+  struct Record
+  {
+    std::string name;       //!< the demangled name of the function
+    uint64_t count;         //!< the number of events
+    uint64_t nanoseconds;   //!< the wall-clock time spent in the events
+  };
+
+  EventProfiler ();
+
+  /**
+   * Run an event and attribute its wall-clock time.
+   * \param [in] event The event.
+   */
+  void Invoke (EventImpl *event);
+  /**
+   * \returns The time spent in each function, from the most expensive.
+   */
+  std::vector<Record> GetRecords (void) const;
+  /**
+   * \returns The total number of events run.
+   */
+  uint64_t GetEventCount (void) const;
+  /**
+   * Print a table of the time spent in each function, from the most
+   * expensive, with its share of the total and its mean time per event.
+   * \param [in] os The output stream.
+   */
+  void PrintReport (std::ostream &os) const;
+  /**
+   * Print the time spent in each function as folded stacks (one line per
+   * function, its name and its time in microseconds), the input format
+   * of flame graph tools.
+   * \param [in] os The output stream.
+   */
+  void PrintFolded (std::ostream &os) const;
+
+private:
+  /// The accumulated cost of a function
+  struct Entry
+  {
+    const void *function;         //!< the address of the function, or 0
+    const std::type_info *type;   //!< the type of the first event seen
+    uint64_t count;               //!< the number of events
+    uint64_t nanoseconds;         //!< the wall-clock time spent in the events
+  };
+
+  /**
+   * \param [in] entry The entry.
+   * \returns The demangled name of the function of the entry.
+   */
+  static std::string GetName (const Entry &entry);
+
+  /// The entries, by address of the function, or of the type of the event
+  std::unordered_map<const void *, Entry> m_entries;
+  uint64_t m_count;   //!< the total number of events
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
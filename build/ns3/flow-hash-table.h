@@ -0,0 +1,246 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation;
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#ifndef FLOW_HASH_TABLE_H
+#define FLOW_HASH_TABLE_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup flow-monitor
+ * \brief Mix the bits of a 64-bit value (the finalizer of SplitMix64).
+ * \param x the value
+ * \returns the mixed value
+ */
+inline uint64_t
+FlowHashMix (uint64_t x)
+{
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+/**
+ * \ingroup flow-monitor
+ * \brief An open-addressed hash table, for the per-packet lookups of the
+ * flow monitor.
+ *
+ * The entries are stored inline in a single array, probed linearly from
+ * the hash of the key, and the array is doubled whenever it becomes half
+ * full. Removal shifts the following entries back, so that lookups never
+ * have to skip deleted entries. A lookup is therefore one hash and, in the
+ * common case, one or two adjacent cache lines, instead of a walk down a
+ * balanced tree.
+ *
+ * Pointers to values are invalidated by Insert and Erase.
+ *
+ * \tparam Key the key type, which must be default constructible, copyable
+ * and comparable with operator==
+ * \tparam Value the value type, which must be default constructible and copyable
+ * \tparam Hash a function object returning the uint64_t hash of a key
+ */
+template <typename Key, typename Value, typename Hash>
+class FlowHashTable
+{
+public:
+  FlowHashTable ();
+
+  /**
+   * Find a key.
+   * \param key the key
+   * \returns the value of the key, or 0 if the key is not in the table
+   */
+  Value * Find (const Key &key);
+  /**
+   * Find a key, inserting it with a default constructed value if it is
+   * not in the table.
+   * \param key the key
+   * \param inserted set to true if the key was inserted, false otherwise
+   * \returns the value of the key
+   */
+  Value & Insert (const Key &key, bool *inserted);
+  /**
+   * Remove a key.
+   * \param key the key
+   * \returns true if the key was in the table
+   */
+  bool Erase (const Key &key);
+  /**
+   * \returns the number of keys in the table
+   */
+  std::size_t GetSize (void) const;
+  /**
+   * Remove all the keys.
+   */
+  void Clear (void);
+
+private:
+  /// An entry of the table
+  struct Entry
+  {
+    Key key;     //!< the key
+    Value value; //!< the value
+    bool used;   //!< the entry holds a key
+  };
+
+  /**
+   * \param key the key
+   * \returns the index of the key, or of the free entry where it belongs
+   */
+  std::size_t Probe (const Key &key) const;
+  /// Double the size of the table and insert all the keys again
+  void Grow (void);
+
+  std::vector<Entry> m_entries; //!< the entries, a power of two
+  std::size_t m_mask;           //!< the number of entries minus one
+  std::size_t m_size;           //!< the number of keys
+  Hash m_hash;                  //!< the hash function
+};
+
+} // namespace ns3
+
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3 {
+
+template <typename Key, typename Value, typename Hash>
+FlowHashTable<Key, Value, Hash>::FlowHashTable ()
+  : m_entries (16),
+    m_mask (15),
+    m_size (0)
+{
+}
+
+template <typename Key, typename Value, typename Hash>
+std::size_t
+FlowHashTable<Key, Value, Hash>::Probe (const Key &key) const
+{
+  std::size_t i = m_hash (key) & m_mask;
+  while (m_entries[i].used && !(m_entries[i].key == key))
+    {
+      i = (i + 1) & m_mask;
+    }
+  return i;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value *
+FlowHashTable<Key, Value, Hash>::Find (const Key &key)
+{
+  std::size_t i = Probe (key);
+  return m_entries[i].used ? &m_entries[i].value : 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+Value &
+FlowHashTable<Key, Value, Hash>::Insert (const Key &key, bool *inserted)
+{
+  std::size_t i = Probe (key);
+  if (m_entries[i].used)
+    {
+      *inserted = false;
+      return m_entries[i].value;
+    }
+  if (2 * (m_size + 1) > m_entries.size ())
+    {
+      Grow ();
+      i = Probe (key);
+    }
+  m_entries[i].key = key;
+  m_entries[i].value = Value ();
+  m_entries[i].used = true;
+  m_size++;
+  *inserted = true;
+  return m_entries[i].value;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool
+FlowHashTable<Key, Value, Hash>::Erase (const Key &key)
+{
+  std::size_t i = Probe (key);
+  if (!m_entries[i].used)
+    {
+      return false;
+    }
+  m_entries[i].used = false;
+  m_size--;
+  // Shift back the following entries which cannot be reached from their
+  // home index anymore.
+  std::size_t j = i;
+  while (true)
+    {
+      j = (j + 1) & m_mask;
+      if (!m_entries[j].used)
+        {
+          break;
+        }
+      std::size_t home = m_hash (m_entries[j].key) & m_mask;
+      bool reachable = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+      if (!reachable)
+        {
+          m_entries[i] = m_entries[j];
+          m_entries[j].used = false;
+          i = j;
+        }
+    }
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+std::size_t
+FlowHashTable<Key, Value, Hash>::GetSize (void) const
+{
+  return m_size;
+}
+
+template <typename Key, typename Value, typename Hash>
+void
+FlowHashTable<Key, Value, Hash>::Clear (void)
+{
+  m_entries.assign (16, Entry ());
+  m_mask = 15;
+  m_size = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+void
+FlowHashTable<Key, Value, Hash>::Grow (void)
+{
+  std::vector<Entry> old (2 * m_entries.size ());
+  old.swap (m_entries);
+  m_mask = m_entries.size () - 1;
+  for (typename std::vector<Entry>::const_iterator it = old.begin (); it != old.end (); ++it)
+    {
+      if (it->used)
+        {
+          m_entries[Probe (it->key)] = *it;
+        }
+    }
+}
+
+} // namespace ns3
+
+#endif /* FLOW_HASH_TABLE_H */
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef RADIX_HEAP_SCHEDULER_H
+#define RADIX_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::RadixHeapScheduler declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup scheduler
+ * \brief a radix heap event scheduler
+ *
+ * A radix heap is a monotone priority queue: it relies on the fact that
+ * the simulator never schedules an event in the past, that is, every new
+ * timestamp is greater than or equal to the timestamp of the last event
+ * removed.
+ *
+ * Events are stored in 65 buckets, each one a plain array. Bucket 0 holds
+ * the events whose timestamp equals the last removed timestamp, sorted by
+ * uid; bucket \f$i > 0\f$ holds the events whose timestamp differs from it
+ * in bit \f$i-1\f$ at most. Insertion is therefore an xor, a count of
+ * leading zeros and an append. When bucket 0 is exhausted, the lowest
+ * non-empty bucket is scanned for its minimum timestamp and its events are
+ * redistributed to lower buckets. Every event moves at most 64 times over
+ * its lifetime, so that removal is amortised O(1) in the number of events;
+ * in practice, the many near-future events of a simulation (inter-frame
+ * spaces, sub-field durations) land in low buckets and move only a few times.
+ *
+ * PeekNext may advance the reference timestamp before the event is removed.
+ * An event scheduled in between with an earlier timestamp (as the realtime
+ * and distributed simulators can do) is still handled correctly, by
+ * rebuilding the heap around it, which costs a pass over all the events.
+ *
+ * Removing a specific event scans its bucket only.
+ */
+class RadixHeapScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  RadixHeapScheduler ();
+  /** Destructor. */
+  virtual ~RadixHeapScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /** Number of buckets: one per bit of the timestamp, plus bucket 0. */
+  static const uint32_t N_BUCKETS = 65;
+  /** Bucket type: a vector of Events. */
+  typedef std::vector<Scheduler::Event> Bucket;
+
+  /**
+   * Get the bucket of a timestamp, relative to the reference timestamp.
+   *
+   * \param [in] ts The timestamp.
+   * \returns The bucket index.
+   */
+  inline uint32_t GetBucket (uint64_t ts) const;
+  /**
+   * Append an event to the bucket of its timestamp.
+   *
+   * \param [in] ev The event.
+   */
+  void Push (const Scheduler::Event &ev);
+  /**
+   * Make sure bucket 0 holds the next events, if any, by advancing the
+   * reference timestamp to the lowest timestamp of the lowest non-empty bucket.
+   */
+  void Refill (void) const;
+  /**
+   * Lower the reference timestamp and redistribute all the events.
+   *
+   * \param [in] ts The new reference timestamp.
+   */
+  void Rebuild (uint64_t ts);
+
+  /** The buckets. The reference timestamp is advanced lazily by PeekNext. */
+  mutable Bucket m_buckets[N_BUCKETS];
+  /** Index of the first event of bucket 0 which has not been removed. */
+  mutable std::size_t m_head;
+  /** Bit i is set if bucket i (i > 0) is not empty. */
+  mutable uint64_t m_occupied;
+  /** The reference timestamp. */
+  mutable uint64_t m_last;
+  /** Number of events in the heap. */
+  std::size_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* RADIX_HEAP_SCHEDULER_H */
@@ -0,0 +1,236 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TGAD_TRAFFIC_GENERATOR_H
+#define TGAD_TRAFFIC_GENERATOR_H
+
+#include "ns3/application.h"
+#include "ns3/address.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/traced-callback.h"
+#include <deque>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup applications
+ * \defgroup tgadtraffic TgadTraffic
+ *
+ * Generator and sink of the traffic of the usage models of IEEE 802.11ad
+ * (uncompressed and lightly compressed video, file transfer, and traces of
+ * any of them), with latency, jitter and deadline statistics.
+ */
+
+class Socket;
+class Packet;
+class RandomVariableStream;
+
+/**
+ * \ingroup tgadtraffic
+ * \brief Generate the traffic of the IEEE 802.11ad usage models
+ *
+ * The traffic is made of frames, each one sent as one or more bursts of
+ * packets:
+ *
+ * \li FRAMES: a frame of FrameSize bytes every 1/FrameRate seconds, split
+ * into BurstsPerFrame bursts evenly spread over the frame period. With one
+ * burst per frame the video is sent a frame at a time, and with as many
+ * bursts as lines it is sent a line at a time, as an uncompressed video
+ * interface does. A constant FrameSize models uncompressed video, and a
+ * random one lightly compressed video.
+ * \li FILE_TRANSFER: MaxBytes bytes (without limit if zero) as fast as the
+ * socket accepts them, which needs a stream socket to be paced.
+ * \li TRACE: the frames of the trace file TraceFilename, each one sent as
+ * one burst at its time.
+ *
+ * All the packets of a burst are handed to the socket in the same event,
+ * instead of scheduling an event per packet as OnOffApplication does; at
+ * gigabit rates the events of the generator would otherwise outnumber
+ * those of the network. A datagram socket receives them in one call to
+ * Socket::SendBurst. The packets the socket does not accept (because
+ * the buffer of a stream socket is full) wait in the application, with
+ * the time stamp of their burst, and are sent when the socket has room.
+ *
+ * Every packet carries a TgadTrafficHeader, so that a TgadTrafficSink can
+ * measure the latency and jitter of the packets, and whether the frames
+ * meet their deadline.
+ *
+ * A trace file has one frame per line: the time the frame is generated,
+ * in microseconds from the start of the application, and the size of the
+ * frame in bytes. Lines starting with '#' are ignored. The file is read
+ * in one piece when it is loaded, and kept in memory as an array of
+ * frames.
+ */
+class TgadTrafficGenerator : public Application
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /// The model of the traffic
+  enum TrafficModel
+  {
+    FRAMES,
+    FILE_TRANSFER,
+    TRACE
+  };
+
+  TgadTrafficGenerator ();
+  virtual ~TgadTrafficGenerator ();
+
+  /**
+   * TracedCallback signature for the frames generated.
+   *
+   * \param [in] frame The number of the frame.
+   * \param [in] size The size of the frame in bytes.
+   */
+  typedef void (* FrameTracedCallback)(uint32_t frame, uint32_t size);
+
+  /**
+   * \brief Load the frames of a trace file
+   * \param filename the path of the trace file, or an empty string to
+   * unload the trace
+   */
+  void SetTraceFile (std::string filename);
+  /**
+   * \return the number of frames of the trace loaded
+   */
+  uint32_t GetTraceFrames (void) const;
+
+  /**
+   * \return the number of bytes handed to the socket
+   */
+  uint64_t GetTotalTx (void) const;
+  /**
+   * \return the number of packets handed to the socket
+   */
+  uint64_t GetTotalTxPackets (void) const;
+  /**
+   * \return the number of frames generated
+   */
+  uint32_t GetTotalFrames (void) const;
+  /**
+   * \return the number of packets waiting for room in the socket
+   */
+  uint32_t GetPendingPackets (void) const;
+
+ /**
+  * Assign a fixed random variable stream number to the random variables
+  * used by this model.  Return the number of streams (possibly zero) that
+  * have been assigned.
+  *
+  * \param stream first stream index to use
+  * \return the number of stream indices assigned by this model
+  */
+  int64_t AssignStreams (int64_t stream);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual void StartApplication (void);
+  virtual void StopApplication (void);
+
+  /**
+   * \brief Generate the next frame, and schedule its bursts
+   */
+  void StartFrame (void);
+  /**
+   * \brief Create the packets of a burst and send them
+   * \param frame the number of the frame
+   * \param packets the number of packets of the burst
+   * \param lastSize the size of the last packet of the burst
+   * \param framePackets the number of packets of the frame
+   */
+  void SendBurst (uint32_t frame, uint32_t packets, uint32_t lastSize, uint32_t framePackets);
+  /**
+   * \brief Send the packets waiting for room in the socket, and more of the
+   * file transfer, until the socket is full
+   */
+  void SendPending (void);
+  /**
+   * \brief Create a packet of a frame
+   * \param frame the number of the frame
+   * \param size the size of the packet, with its header
+   * \param framePackets the number of packets of the frame
+   * \return the packet
+   */
+  Ptr<Packet> CreatePacket (uint32_t frame, uint32_t size, uint32_t framePackets);
+  /**
+   * \brief Connection succeeded
+   * \param socket the connected socket
+   */
+  void ConnectionSucceeded (Ptr<Socket> socket);
+  /**
+   * \brief Connection failed
+   * \param socket the socket that failed to connect
+   */
+  void ConnectionFailed (Ptr<Socket> socket);
+  /**
+   * \brief The socket has room for more data
+   * \param socket the socket
+   * \param available the number of bytes available
+   */
+  void DataSend (Ptr<Socket> socket, uint32_t available);
+
+  /// A frame of a trace
+  struct TraceFrame
+  {
+    Time time;      //!< Time of the frame, from the start of the trace
+    uint32_t size;  //!< Size of the frame in bytes
+  };
+
+  Ptr<Socket> m_socket;                 //!< Socket
+  Address m_peer;                       //!< Remote address
+  Address m_local;                      //!< Local address to bind to
+  TypeId m_tid;                         //!< Type of the socket factory
+  bool m_connected;                     //!< Whether the socket is connected
+  bool m_sending;                       //!< Whether SendPending is running, as Send may call it back
+  TrafficModel m_model;                 //!< Model of the traffic
+  uint32_t m_packetSize;                //!< Size of the packets, with their header
+  double m_frameRate;                   //!< Frames per second
+  Ptr<RandomVariableStream> m_frameSize; //!< Size of the frames in bytes
+  uint32_t m_burstsPerFrame;            //!< Bursts per frame period
+  uint64_t m_maxBytes;                  //!< Bytes to send, no limit if zero
+  bool m_traceLoop;                     //!< Replay the trace once it is over
+  std::vector<TraceFrame> m_trace;      //!< Frames of the trace
+
+  Time m_start;                         //!< Start of the current pass of the trace or of the frames
+  uint32_t m_frame;                     //!< Number of the next frame
+  uint32_t m_traceFrame;                //!< Index of the next frame of the trace
+  uint32_t m_seq;                       //!< Sequence number of the next packet
+  uint64_t m_totBytes;                  //!< Bytes handed to the socket or pending
+  uint64_t m_txBytes;                   //!< Bytes handed to the socket
+  uint64_t m_txPackets;                 //!< Packets handed to the socket
+  std::deque<Ptr<Packet> > m_pending;   //!< Packets waiting for room in the socket
+  EventId m_frameEvent;                 //!< Event of the next frame
+  std::vector<EventId> m_burstEvents;   //!< Events of the bursts of the current frame
+
+  /// Traced Callback: transmitted packets
+  TracedCallback<Ptr<const Packet> > m_txTrace;
+  /// Traced Callback: frame number and size in bytes of each frame generated
+  TracedCallback<uint32_t, uint32_t> m_frameTrace;
+};
+
+} // namespace ns3
+
+#endif /* TGAD_TRAFFIC_GENERATOR_H */
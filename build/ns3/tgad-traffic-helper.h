@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TGAD_TRAFFIC_HELPER_H
+#define TGAD_TRAFFIC_HELPER_H
+
+#include <stdint.h>
+#include <string>
+#include "ns3/address.h"
+#include "ns3/application-container.h"
+#include "ns3/node-container.h"
+#include "ns3/object-factory.h"
+#include "ns3/data-rate.h"
+#include "ns3/tgad-traffic-generator.h"
+#include "ns3/tgad-traffic-sink.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup tgadtraffic
+ * \brief A helper to make it easier to instantiate an ns3::TgadTrafficGenerator
+ * on a set of nodes, with the traffic of one of the IEEE 802.11ad usage models.
+ */
+class TgadTrafficHelper
+{
+public:
+  /**
+   * Create a TgadTrafficHelper to make it easier to work with TgadTrafficGenerators
+   *
+   * \param protocol the name of the protocol to use to send traffic
+   *        by the applications. This string identifies the socket
+   *        factory type used to create sockets for the applications.
+   *        A typical value would be ns3::UdpSocketFactory.
+   * \param address the address of the remote node to send traffic
+   *        to.
+   */
+  TgadTrafficHelper (std::string protocol, Address address);
+
+  /**
+   * Helper function used to set the underlying application attributes.
+   *
+   * \param name the name of the application attribute to set
+   * \param value the value of the application attribute to set
+   */
+  void SetAttribute (std::string name, const AttributeValue &value);
+
+  /**
+   * Send uncompressed video a line at a time: a constant frame of
+   * width x height pixels of the given depth, as many bursts per frame as
+   * lines.
+   *
+   * \param width the number of pixels per line
+   * \param height the number of lines
+   * \param bitsPerPixel the color depth
+   * \param frameRate the number of frames per second
+   */
+  void SetUncompressedVideo (uint32_t width = 1920, uint32_t height = 1080,
+                             uint32_t bitsPerPixel = 24, double frameRate = 60);
+  /**
+   * Send lightly compressed video a frame at a time: frames whose size is
+   * normally distributed around the mean size for the given rate.
+   *
+   * \param dataRate the mean rate of the video
+   * \param frameRate the number of frames per second
+   * \param variation the standard deviation of the size of the frames,
+   *        relative to their mean size
+   */
+  void SetCompressedVideo (DataRate dataRate, double frameRate = 60, double variation = 0.1);
+  /**
+   * Transfer a file as fast as the socket accepts it.
+   *
+   * \param size the size of the file in bytes, without limit if zero
+   */
+  void SetFileTransfer (uint64_t size);
+  /**
+   * Replay the frames of a trace file.
+   *
+   * \param filename the path of the trace file
+   * \param loop whether to replay the trace once it is over
+   */
+  void SetTrace (std::string filename, bool loop = true);
+
+  /**
+   * Install an ns3::TgadTrafficGenerator on each node of the input container
+   * configured with all the attributes set with SetAttribute.
+   *
+   * \param c NodeContainer of the set of nodes on which a TgadTrafficGenerator
+   * will be installed.
+   * \returns Container of Ptr to the applications installed.
+   */
+  ApplicationContainer Install (NodeContainer c) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this model.  Return the number of streams (possibly zero) that
+   * have been assigned.  The Install() method should have previously been
+   * called by the user.
+   *
+   * \param stream first stream index to use
+   * \param c NodeContainer of the set of nodes for which the TgadTrafficGenerator
+   *          should be modified to use a fixed stream
+   * \return the number of stream indices assigned by this helper
+   */
+  int64_t AssignStreams (NodeContainer c, int64_t stream);
+
+private:
+  ObjectFactory m_factory; //!< Object factory.
+};
+
+/**
+ * \ingroup tgadtraffic
+ * \brief A helper to make it easier to instantiate an ns3::TgadTrafficSink
+ * on a set of nodes.
+ */
+class TgadTrafficSinkHelper
+{
+public:
+  /**
+   * Create a TgadTrafficSinkHelper to make it easier to work with TgadTrafficSinks
+   *
+   * \param protocol the name of the protocol to use to receive traffic
+   *        This string identifies the socket factory type used to create
+   *        sockets for the applications.  A typical value would be
+   *        ns3::UdpSocketFactory.
+   * \param address the address of the sink,
+   */
+  TgadTrafficSinkHelper (std::string protocol, Address address);
+
+  /**
+   * Helper function used to set the underlying application attributes.
+   *
+   * \param name the name of the application attribute to set
+   * \param value the value of the application attribute to set
+   */
+  void SetAttribute (std::string name, const AttributeValue &value);
+
+  /**
+   * Install an ns3::TgadTrafficSink on each node of the input container
+   * configured with all the attributes set with SetAttribute.
+   *
+   * \param c NodeContainer of the set of nodes on which a TgadTrafficSink
+   * will be installed.
+   * \returns Container of Ptr to the applications installed.
+   */
+  ApplicationContainer Install (NodeContainer c) const;
+
+private:
+  ObjectFactory m_factory; //!< Object factory.
+};
+
+} // namespace ns3
+
+#endif /* TGAD_TRAFFIC_HELPER_H */
@@ -0,0 +1,298 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ */
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "common-functions.h"
+
+#include <string>
+/**
+ * Simulation Objective:
+ * This script compares the rate adaptation algorithms for DMG in a room with people in it: the ideal
+ * algorithm, which uses the SNR reported for the last transmission, CBTRAA, and the predictive algorithm,
+ * which also looks at the obstacles of the room to lower the MCS before the link is blocked.
+ *
+ * Network Topology:
+ * A DMG AD-HOC station is mounted on a wall of the room. A second DMG AD-HOC station walks across the
+ * room and sends UDP traffic to the first one. People stand (living room) or sit around a table
+ * (conference room) in the way, and block the line of sight from time to time. The TGad channel adds
+ * a 10 dB loss to the NLoS links.
+ *
+ *    Living room (7m x 5m)                       Conference room (10m x 6m)
+ *    |-------------------------|                 |-------------------------------|
+ *    |              H          |                 |        P    P    P    P   <-- |
+ *    |   H                    ^|                 |     |-------------------|     |
+ *    AP                       ||                 AP    |       table       |     |
+ *    |        H               ||                 |     |-------------------|     |
+ *    |        [   sofa  ]     ||                 |        P    P    P    P       |
+ *    |-------------------------|                 |-------------------------------|
+ *
+ * Running Simulation:
+ * ./waf --run "evaluate_predictive_rate_adaptation --scenario=living --manager=ns3::PredictiveDmgWifiManager"
+ * ./waf --run "evaluate_predictive_rate_adaptation --scenario=conference --manager=ns3::IdealDmgWifiManager"
+ *
+ * Simulation Output:
+ * The throughput every 100 ms, then the average throughput, the number of MCS changes, the number of
+ * failed data transmissions and, for the predictive algorithm, the number of blockages predicted.
+ */
+
+NS_LOG_COMPONENT_DEFINE ("EvaluatePredictiveRateAdaptation");
+
+using namespace ns3;
+using namespace std;
+
+/*** Application Layer Variables ***/
+Ptr<PacketSink> sink;
+uint64_t lastTotalRx = 0;
+double averageThroughput = 0;
+
+/*** MAC Layer Statistics ***/
+uint32_t mcsChanges = 0;
+uint32_t dataFailures = 0;
+uint32_t blockagesPredicted = 0;
+
+void
+CalculateThroughput (void)
+{
+  double thr = CalculateSingleStreamThroughput (sink, lastTotalRx, averageThroughput);
+  std::cout << Simulator::Now ().GetSeconds () << '\t' << thr << std::endl;
+  Simulator::Schedule (MilliSeconds (100), &CalculateThroughput);
+}
+
+void
+McsChanged (Mac48Address address, uint16_t mcs)
+{
+  mcsChanges++;
+}
+
+void
+DataFailed (Mac48Address address)
+{
+  dataFailures++;
+}
+
+void
+BlockagePredicted (Mac48Address address, double drop, Time delay)
+{
+  NS_LOG_INFO ("Blockage of " << drop << " dB predicted in " << delay.As (Time::MS));
+  blockagesPredicted++;
+}
+
+/**
+ * A person, standing or seated, as an obstacle of the room.
+ * \param x The x coordinate of the person.
+ * \param y The y coordinate of the person.
+ * \param height The height of the person.
+ * \return The obstacle.
+ */
+Box
+Person (double x, double y, double height)
+{
+  return Box (x - 0.25, x + 0.25, y - 0.15, y + 0.15, 0, height);
+}
+
+/**
+ * Add the DMG SC modes to the modes supported by the peer of an ad-hoc station: the ad-hoc MAC does not
+ * learn them from an association, and the rate managers select the MCS among these modes.
+ * \param device The device of the station.
+ * \param peer The MAC address of the peer.
+ */
+void
+AddScSupportedModes (Ptr<WifiNetDevice> device, Mac48Address peer)
+{
+  for (uint8_t mcs = 1; mcs <= 12; mcs++)
+    {
+      device->GetRemoteStationManager ()->AddSupportedMode (peer, device->GetPhy ()->GetMode (mcs));
+    }
+}
+
+void
+SetAntennaConfigurations (Ptr<DmgAdhocWifiMac> apWifiMac, Ptr<DmgAdhocWifiMac> staWifiMac)
+{
+  apWifiMac->AddAntennaConfig (1, 1, 1, 1, staWifiMac->GetAddress ());
+  staWifiMac->AddAntennaConfig (5, 1, 5, 1, apWifiMac->GetAddress ());
+  apWifiMac->SteerAntennaToward (staWifiMac->GetAddress ());
+  staWifiMac->SteerAntennaToward (apWifiMac->GetAddress ());
+}
+
+int
+main (int argc, char *argv[])
+{
+  string scenario = "living";                     /* The room: living or conference. */
+  string manager = "ns3::PredictiveDmgWifiManager"; /* The rate adaptation algorithm. */
+  string dataRate = "4Gbps";                      /* The data rate of the on-off application. */
+  uint32_t payloadSize = 1448;                    /* Transport Layer Payload size in bytes. */
+  string queueSize = "10000p";                    /* Wifi MAC Queue Size. */
+  double speed = 0.5;                             /* The walking speed of the moving station in m/s. */
+  double txPower = 10.0;                          /* The transmit power of the stations in dBm. */
+  bool verbose = false;                           /* Print Logging Information. */
+
+  CommandLine cmd;
+  cmd.AddValue ("scenario", "The room: living or conference", scenario);
+  cmd.AddValue ("manager", "The type of the remote station manager", manager);
+  cmd.AddValue ("dataRate", "The data rate of the on-off application", dataRate);
+  cmd.AddValue ("payloadSize", "Payload size in bytes", payloadSize);
+  cmd.AddValue ("queueSize", "The maximum size of the Wifi MAC Queue", queueSize);
+  cmd.AddValue ("speed", "The walking speed of the moving station in m/s", speed);
+  cmd.AddValue ("txPower", "The transmit power of the stations in dBm", txPower);
+  cmd.AddValue ("verbose", "Turn on all WifiNetDevice log components", verbose);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::WifiRemoteStationManager::FragmentationThreshold", StringValue ("999999"));
+  Config::SetDefault ("ns3::WifiRemoteStationManager::RtsCtsThreshold", StringValue ("999999"));
+  ChangeQueueSize (queueSize);
+  /* The stations of the ad-hoc network use fixed sectors with the maximum gain */
+  Config::SetDefault ("ns3::PredictiveDmgWifiManager::BeamRetraining", BooleanValue (false));
+
+  /**** Room layout ****/
+  Vector apPosition;
+  Vector staStart;
+  Vector staEnd;
+  std::vector<Box> obstacles;
+  if (scenario == "living")
+    {
+      apPosition = Vector (0.2, 2.5, 1.2);
+      staStart = Vector (6.5, 0.5, 1.0);
+      staEnd = Vector (6.5, 4.5, 1.0);
+      obstacles.push_back (Box (4.0, 6.0, 0.2, 1.0, 0, 0.8));   // sofa
+      obstacles.push_back (Person (2.0, 3.5, 1.8));
+      obstacles.push_back (Person (3.5, 1.8, 1.7));
+      obstacles.push_back (Person (5.0, 4.2, 1.8));
+    }
+  else if (scenario == "conference")
+    {
+      apPosition = Vector (0.2, 3.0, 2.5);
+      staStart = Vector (9.5, 5.5, 1.0);
+      staEnd = Vector (9.5, 0.5, 1.0);
+      obstacles.push_back (Box (2.0, 8.0, 2.2, 3.8, 0, 0.75)); // table
+      for (double x = 2.75; x < 8.0; x += 1.5)
+        {
+          obstacles.push_back (Person (x, 1.8, 1.3));
+          obstacles.push_back (Person (x, 4.2, 1.3));
+        }
+    }
+  else
+    {
+      NS_FATAL_ERROR ("Unknown scenario: " << scenario);
+    }
+  double simulationTime = CalculateDistance (staStart, staEnd) / speed;
+
+  Ptr<Obstacle> room = CreateObject<Obstacle> ();
+  room->SetObstacleNumber (obstacles.size ());
+  room->SetPenetrationLossMode (room->m_obstaclePenetrationLoss_medium);
+  room->AllocateObstacle_KnownBox (obstacles);
+
+  /**** WifiHelper is a meta-helper: it helps creates helpers ****/
+  DmgWifiHelper wifi;
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+  if (verbose)
+    {
+      wifi.EnableLogComponents ();
+      LogComponentEnable ("EvaluatePredictiveRateAdaptation", LOG_LEVEL_ALL);
+    }
+
+  /**** Set up Channel ****/
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  Ptr<DmgWifiChannel> channel = wifiChannel.Create ();
+  channel->SetScenarioModel (room);
+  channel->SetAdHocMode (true);
+  channel->SetTGadChannelEnabler (true);
+
+  /**** Setup physical layer ****/
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (channel);
+  wifiPhy.Set ("TxPowerStart", DoubleValue (txPower));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (txPower));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("ChannelNumber", UintegerValue (2));
+  wifi.SetRemoteStationManager (manager);
+
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+
+  NodeContainer wifiNodes;
+  wifiNodes.Create (2);
+  Ptr<Node> apWifiNode = wifiNodes.Get (0);
+  Ptr<Node> staWifiNode = wifiNodes.Get (1);
+
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac",
+                   "BE_MaxAmpduSize", UintegerValue (262143),
+                   "BE_MaxAmsduSize", UintegerValue (7935));
+  NetDeviceContainer apDevice = wifi.Install (wifiPhy, wifiMac, apWifiNode);
+  NetDeviceContainer staDevice = wifi.Install (wifiPhy, wifiMac, staWifiNode);
+
+  Ptr<WifiNetDevice> apWifiNetDevice = DynamicCast<WifiNetDevice> (apDevice.Get (0));
+  Ptr<WifiNetDevice> staWifiNetDevice = DynamicCast<WifiNetDevice> (staDevice.Get (0));
+  Ptr<DmgAdhocWifiMac> apWifiMac = DynamicCast<DmgAdhocWifiMac> (apWifiNetDevice->GetMac ());
+  Ptr<DmgAdhocWifiMac> staWifiMac = DynamicCast<DmgAdhocWifiMac> (staWifiNetDevice->GetMac ());
+  /* The codebooks are only usable once the nodes are initialized */
+  Simulator::ScheduleNow (&SetAntennaConfigurations, apWifiMac, staWifiMac);
+  AddScSupportedModes (apWifiNetDevice, staWifiMac->GetAddress ());
+  AddScSupportedModes (staWifiNetDevice, apWifiMac->GetAddress ());
+
+  /* The access point is on the wall, the station walks across the room */
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (apWifiNode);
+  apWifiNode->GetObject<MobilityModel> ()->SetPosition (apPosition);
+  mobility.SetMobilityModel ("ns3::ConstantVelocityMobilityModel");
+  mobility.Install (staWifiNode);
+  Ptr<ConstantVelocityMobilityModel> staMobility = staWifiNode->GetObject<ConstantVelocityMobilityModel> ();
+  staMobility->SetPosition (staStart);
+  staMobility->SetVelocity (Vector ((staEnd.x - staStart.x) * speed / CalculateDistance (staStart, staEnd),
+                                    (staEnd.y - staStart.y) * speed / CalculateDistance (staStart, staEnd),
+                                    0));
+
+  /* Install Internet Stack */
+  InternetStackHelper stack;
+  stack.Install (wifiNodes);
+  Ipv4AddressHelper address;
+  address.SetBase ("10.0.0.0", "255.255.255.0");
+  Ipv4InterfaceContainer apInterface = address.Assign (apDevice);
+  address.Assign (staDevice);
+  PopulateArpCache ();
+
+  PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9999));
+  ApplicationContainer sinkApp = sinkHelper.Install (apWifiNode);
+  sink = StaticCast<PacketSink> (sinkApp.Get (0));
+  sinkApp.Start (Seconds (0.0));
+
+  OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (apInterface.GetAddress (0), 9999));
+  src.SetAttribute ("MaxBytes", UintegerValue (0));
+  src.SetAttribute ("PacketSize", UintegerValue (payloadSize));
+  src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1e6]"));
+  src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+  src.SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+  ApplicationContainer srcApp = src.Install (staWifiNode);
+  srcApp.Start (Seconds (0.0));
+
+  /* Statistics of the rate adaptation of the moving station */
+  Ptr<WifiRemoteStationManager> stationManager = staWifiNetDevice->GetRemoteStationManager ();
+  stationManager->TraceConnectWithoutContext ("Rate", MakeCallback (&McsChanged));
+  stationManager->TraceConnectWithoutContext ("MacTxDataFailed", MakeCallback (&DataFailed));
+  stationManager->TraceConnectWithoutContext ("BlockagePredicted", MakeCallback (&BlockagePredicted));
+
+  Simulator::Schedule (MilliSeconds (100), &CalculateThroughput);
+  Simulator::Stop (Seconds (simulationTime));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  std::cout << "Scenario: " << scenario << ", manager: " << manager << std::endl;
+  std::cout << "  Average throughput [Mbps]: " << averageThroughput / ((simulationTime - 0.1) * 10) << std::endl;
+  std::cout << "  MCS changes: " << mcsChanges << std::endl;
+  std::cout << "  Failed data transmissions: " << dataFailures << std::endl;
+  std::cout << "  Blockages predicted: " << blockagesPredicted << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "tgad-traffic-helper.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+#include <sstream>
+
+namespace ns3 {
+
+TgadTrafficHelper::TgadTrafficHelper (std::string protocol, Address address)
+{
+  m_factory.SetTypeId ("ns3::TgadTrafficGenerator");
+  m_factory.Set ("Protocol", StringValue (protocol));
+  m_factory.Set ("Remote", AddressValue (address));
+}
+
+void
+TgadTrafficHelper::SetAttribute (std::string name, const AttributeValue &value)
+{
+  m_factory.Set (name, value);
+}
+
+void
+TgadTrafficHelper::SetUncompressedVideo (uint32_t width, uint32_t height,
+                                         uint32_t bitsPerPixel, double frameRate)
+{
+  std::ostringstream frameSize;
+  frameSize << "ns3::ConstantRandomVariable[Constant="
+            << static_cast<uint64_t> (width) * height * bitsPerPixel / 8 << "]";
+  m_factory.Set ("TrafficModel", EnumValue (TgadTrafficGenerator::FRAMES));
+  m_factory.Set ("FrameSize", StringValue (frameSize.str ()));
+  m_factory.Set ("FrameRate", DoubleValue (frameRate));
+  m_factory.Set ("BurstsPerFrame", UintegerValue (height));
+}
+
+void
+TgadTrafficHelper::SetCompressedVideo (DataRate dataRate, double frameRate, double variation)
+{
+  double mean = dataRate.GetBitRate () / 8.0 / frameRate;
+  double deviation = variation * mean;
+  std::ostringstream frameSize;
+  frameSize << "ns3::NormalRandomVariable[Mean=" << mean
+            << "|Variance=" << deviation * deviation
+            << "|Bound=" << std::min (3 * deviation, mean) << "]";
+  m_factory.Set ("TrafficModel", EnumValue (TgadTrafficGenerator::FRAMES));
+  m_factory.Set ("FrameSize", StringValue (frameSize.str ()));
+  m_factory.Set ("FrameRate", DoubleValue (frameRate));
+  m_factory.Set ("BurstsPerFrame", UintegerValue (1));
+}
+
+void
+TgadTrafficHelper::SetFileTransfer (uint64_t size)
+{
+  m_factory.Set ("TrafficModel", EnumValue (TgadTrafficGenerator::FILE_TRANSFER));
+  m_factory.Set ("MaxBytes", UintegerValue (size));
+}
+
+void
+TgadTrafficHelper::SetTrace (std::string filename, bool loop)
+{
+  m_factory.Set ("TrafficModel", EnumValue (TgadTrafficGenerator::TRACE));
+  m_factory.Set ("TraceFilename", StringValue (filename));
+  m_factory.Set ("TraceLoop", BooleanValue (loop));
+}
+
+ApplicationContainer
+TgadTrafficHelper::Install (NodeContainer c) const
+{
+  ApplicationContainer apps;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      Ptr<Application> app = m_factory.Create<Application> ();
+      (*i)->AddApplication (app);
+      apps.Add (app);
+    }
+  return apps;
+}
+
+int64_t
+TgadTrafficHelper::AssignStreams (NodeContainer c, int64_t stream)
+{
+  int64_t currentStream = stream;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      Ptr<Node> node = *i;
+      for (uint32_t j = 0; j < node->GetNApplications (); j++)
+        {
+          Ptr<TgadTrafficGenerator> generator = DynamicCast<TgadTrafficGenerator> (node->GetApplication (j));
+          if (generator)
+            {
+              currentStream += generator->AssignStreams (currentStream);
+            }
+        }
+    }
+  return (currentStream - stream);
+}
+
+TgadTrafficSinkHelper::TgadTrafficSinkHelper (std::string protocol, Address address)
+{
+  m_factory.SetTypeId ("ns3::TgadTrafficSink");
+  m_factory.Set ("Protocol", StringValue (protocol));
+  m_factory.Set ("Local", AddressValue (address));
+}
+
+void
+TgadTrafficSinkHelper::SetAttribute (std::string name, const AttributeValue &value)
+{
+  m_factory.Set (name, value);
+}
+
+ApplicationContainer
+TgadTrafficSinkHelper::Install (NodeContainer c) const
+{
+  ApplicationContainer apps;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      Ptr<Application> app = m_factory.Create<Application> ();
+      (*i)->AddApplication (app);
+      apps.Add (app);
+    }
+  return apps;
+}
+
+} // namespace ns3
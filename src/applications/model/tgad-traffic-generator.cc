@@ -0,0 +1,523 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/address.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/inet6-socket-address.h"
+#include "ns3/node.h"
+#include "ns3/socket.h"
+#include "ns3/socket-factory.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/enum.h"
+#include "ns3/string.h"
+#include "ns3/pointer.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/udp-socket-factory.h"
+#include "tgad-traffic-generator.h"
+#include "tgad-traffic-header.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TgadTrafficGenerator");
+
+NS_OBJECT_ENSURE_REGISTERED (TgadTrafficGenerator);
+
+TypeId
+TgadTrafficGenerator::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TgadTrafficGenerator")
+    .SetParent<Application> ()
+    .SetGroupName ("Applications")
+    .AddConstructor<TgadTrafficGenerator> ()
+    .AddAttribute ("Remote", "The address of the destination",
+                   AddressValue (),
+                   MakeAddressAccessor (&TgadTrafficGenerator::m_peer),
+                   MakeAddressChecker ())
+    .AddAttribute ("Local",
+                   "The Address on which to bind the socket. If not set, it is generated automatically.",
+                   AddressValue (),
+                   MakeAddressAccessor (&TgadTrafficGenerator::m_local),
+                   MakeAddressChecker ())
+    .AddAttribute ("Protocol", "The type of protocol to use. This should be "
+                   "a subclass of ns3::SocketFactory",
+                   TypeIdValue (UdpSocketFactory::GetTypeId ()),
+                   MakeTypeIdAccessor (&TgadTrafficGenerator::m_tid),
+                   MakeTypeIdChecker ())
+    .AddAttribute ("TrafficModel", "The model of the traffic.",
+                   EnumValue (TgadTrafficGenerator::FRAMES),
+                   MakeEnumAccessor (&TgadTrafficGenerator::m_model),
+                   MakeEnumChecker (TgadTrafficGenerator::FRAMES, "Frames",
+                                    TgadTrafficGenerator::FILE_TRANSFER, "FileTransfer",
+                                    TgadTrafficGenerator::TRACE, "Trace"))
+    .AddAttribute ("PacketSize",
+                   "The size of the packets, including the TgadTrafficHeader (28 bytes). "
+                   "The last packet of a frame may be smaller.",
+                   UintegerValue (1472),
+                   MakeUintegerAccessor (&TgadTrafficGenerator::m_packetSize),
+                   MakeUintegerChecker<uint32_t> (28))
+    .AddAttribute ("FrameRate", "The number of frames per second.",
+                   DoubleValue (60),
+                   MakeDoubleAccessor (&TgadTrafficGenerator::m_frameRate),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("FrameSize",
+                   "A RandomVariableStream used to pick the size of the frames in bytes. "
+                   "The default is a 1920x1080 frame with 24 bits per pixel.",
+                   StringValue ("ns3::ConstantRandomVariable[Constant=6220800]"),
+                   MakePointerAccessor (&TgadTrafficGenerator::m_frameSize),
+                   MakePointerChecker<RandomVariableStream> ())
+    .AddAttribute ("BurstsPerFrame",
+                   "The number of bursts a frame is split into, evenly spread over the frame period.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&TgadTrafficGenerator::m_burstsPerFrame),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxBytes",
+                   "The total number of bytes to send. Once these bytes are sent, "
+                   "no frame is generated again. The value zero means that there is no limit.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&TgadTrafficGenerator::m_maxBytes),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("TraceFilename",
+                   "Name of the file to load the frames of the Trace model from.",
+                   StringValue (""),
+                   MakeStringAccessor (&TgadTrafficGenerator::SetTraceFile),
+                   MakeStringChecker ())
+    .AddAttribute ("TraceLoop",
+                   "Replay the trace once it is over, one frame period (1/FrameRate) "
+                   "after its last frame.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&TgadTrafficGenerator::m_traceLoop),
+                   MakeBooleanChecker ())
+    .AddTraceSource ("Tx", "A new packet is created and is sent",
+                     MakeTraceSourceAccessor (&TgadTrafficGenerator::m_txTrace),
+                     "ns3::Packet::TracedCallback")
+    .AddTraceSource ("Frame", "A new frame is generated: its number and its size in bytes",
+                     MakeTraceSourceAccessor (&TgadTrafficGenerator::m_frameTrace),
+                     "ns3::TgadTrafficGenerator::FrameTracedCallback")
+  ;
+  return tid;
+}
+
+TgadTrafficGenerator::TgadTrafficGenerator ()
+  : m_socket (0),
+    m_connected (false),
+    m_sending (false),
+    m_frame (0),
+    m_traceFrame (0),
+    m_seq (0),
+    m_totBytes (0),
+    m_txBytes (0),
+    m_txPackets (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TgadTrafficGenerator::~TgadTrafficGenerator ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+TgadTrafficGenerator::SetTraceFile (std::string filename)
+{
+  NS_LOG_FUNCTION (this << filename);
+  m_trace.clear ();
+  if (filename.empty ())
+    {
+      return;
+    }
+
+  std::ifstream file (filename.c_str (), std::ios::in | std::ios::binary);
+  NS_ABORT_MSG_IF (!file.good (), "Cannot open the trace file " << filename);
+  std::string contents ((std::istreambuf_iterator<char> (file)), std::istreambuf_iterator<char> ());
+
+  const char *pos = contents.c_str ();
+  uint32_t line = 1;
+  while (*pos != '\0')
+    {
+      if (*pos == '\n')
+        {
+          line++;
+          pos++;
+          continue;
+        }
+      if (*pos == ' ' || *pos == '\t' || *pos == '\r')
+        {
+          pos++;
+          continue;
+        }
+      if (*pos != '#')
+        {
+          char *end;
+          TraceFrame frame;
+          frame.time = MicroSeconds (std::strtoull (pos, &end, 10));
+          NS_ABORT_MSG_IF (end == pos, "Missing time at line " << line << " of " << filename);
+          pos = end;
+          while (*pos == ' ' || *pos == '\t')
+            {
+              pos++;
+            }
+          frame.size = std::strtoul (pos, &end, 10);
+          NS_ABORT_MSG_IF (end == pos || *pos == '\n', "Missing size at line " << line << " of " << filename);
+          pos = end;
+          NS_ABORT_MSG_IF (!m_trace.empty () && frame.time < m_trace.back ().time,
+                           "The time goes back at line " << line << " of " << filename);
+          m_trace.push_back (frame);
+        }
+      // skip the rest of the line
+      while (*pos != '\0' && *pos != '\n')
+        {
+          pos++;
+        }
+    }
+  NS_LOG_DEBUG ("Loaded " << m_trace.size () << " frames from " << filename);
+}
+
+uint32_t
+TgadTrafficGenerator::GetTraceFrames (void) const
+{
+  return m_trace.size ();
+}
+
+uint64_t
+TgadTrafficGenerator::GetTotalTx (void) const
+{
+  return m_txBytes;
+}
+
+uint64_t
+TgadTrafficGenerator::GetTotalTxPackets (void) const
+{
+  return m_txPackets;
+}
+
+uint32_t
+TgadTrafficGenerator::GetTotalFrames (void) const
+{
+  return m_frame;
+}
+
+uint32_t
+TgadTrafficGenerator::GetPendingPackets (void) const
+{
+  return m_pending.size ();
+}
+
+int64_t
+TgadTrafficGenerator::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+  m_frameSize->SetStream (stream);
+  return 1;
+}
+
+void
+TgadTrafficGenerator::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_socket = 0;
+  m_pending.clear ();
+  m_frameSize = 0;
+  Application::DoDispose ();
+}
+
+void
+TgadTrafficGenerator::StartApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (!m_socket)
+    {
+      m_socket = Socket::CreateSocket (GetNode (), m_tid);
+      NS_ABORT_MSG_IF (m_model == FILE_TRANSFER && m_socket->GetSocketType () != Socket::NS3_SOCK_STREAM,
+                       "The file transfer needs a stream socket to be paced");
+      int ret = -1;
+      if (!m_local.IsInvalid ())
+        {
+          NS_ABORT_MSG_IF ((Inet6SocketAddress::IsMatchingType (m_peer) && InetSocketAddress::IsMatchingType (m_local)) ||
+                           (InetSocketAddress::IsMatchingType (m_peer) && Inet6SocketAddress::IsMatchingType (m_local)),
+                           "Incompatible peer and local address IP version");
+          ret = m_socket->Bind (m_local);
+        }
+      else if (Inet6SocketAddress::IsMatchingType (m_peer))
+        {
+          ret = m_socket->Bind6 ();
+        }
+      else
+        {
+          ret = m_socket->Bind ();
+        }
+      if (ret == -1)
+        {
+          NS_FATAL_ERROR ("Failed to bind socket");
+        }
+
+      // a datagram socket connects at once, hence the callbacks come first
+      m_socket->SetConnectCallback (MakeCallback (&TgadTrafficGenerator::ConnectionSucceeded, this),
+                                    MakeCallback (&TgadTrafficGenerator::ConnectionFailed, this));
+      m_socket->SetSendCallback (MakeCallback (&TgadTrafficGenerator::DataSend, this));
+      m_socket->Connect (m_peer);
+      m_socket->SetAllowBroadcast (true);
+      m_socket->ShutdownRecv ();
+    }
+
+  NS_ABORT_MSG_IF (m_model != FILE_TRANSFER && m_frameRate <= 0, "The frame rate must be positive");
+  m_start = Simulator::Now ();
+  m_traceFrame = 0;
+  if (m_model == FRAMES)
+    {
+      m_frameEvent = Simulator::ScheduleNow (&TgadTrafficGenerator::StartFrame, this);
+    }
+  else if (m_model == TRACE)
+    {
+      NS_ABORT_MSG_IF (m_trace.empty (), "No trace loaded");
+      m_frameEvent = Simulator::Schedule (m_trace.front ().time, &TgadTrafficGenerator::StartFrame, this);
+    }
+  else
+    {
+      SendPending ();
+    }
+}
+
+void
+TgadTrafficGenerator::StopApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_frameEvent.Cancel ();
+  for (auto &event : m_burstEvents)
+    {
+      event.Cancel ();
+    }
+  m_burstEvents.clear ();
+  m_pending.clear ();
+  if (m_socket)
+    {
+      m_socket->Close ();
+      m_connected = false;
+    }
+}
+
+void
+TgadTrafficGenerator::StartFrame (void)
+{
+  NS_LOG_FUNCTION (this);
+  uint64_t size;
+  Time next;
+  if (m_model == TRACE)
+    {
+      size = m_trace[m_traceFrame++].size;
+      if (m_traceFrame == m_trace.size () && m_traceLoop)
+        {
+          m_start += m_trace.back ().time + Seconds (1 / m_frameRate);
+          m_traceFrame = 0;
+        }
+      next = (m_traceFrame < m_trace.size () ? m_start + m_trace[m_traceFrame].time : Time::Max ());
+    }
+  else
+    {
+      size = m_frameSize->GetInteger ();
+      next = m_start + Seconds ((m_frame + 1) / m_frameRate);
+    }
+
+  if (m_maxBytes > 0)
+    {
+      size = std::min (size, m_maxBytes - m_totBytes);
+      if (m_totBytes + size >= m_maxBytes)
+        {
+          next = Time::Max ();
+        }
+    }
+  if (next != Time::Max ())
+    {
+      m_frameEvent = Simulator::Schedule (next - Simulator::Now (), &TgadTrafficGenerator::StartFrame, this);
+    }
+
+  uint32_t frame = m_frame++;
+  m_frameTrace (frame, size);
+  if (size == 0)
+    {
+      return;
+    }
+
+  // the frame is cut into packets of m_packetSize bytes, the last one
+  // holding the rest of the frame (and at least a header)
+  uint32_t headerSize = TgadTrafficHeader ().GetSerializedSize ();
+  uint32_t framePackets = (size + m_packetSize - 1) / m_packetSize;
+  uint32_t lastSize = std::max<uint32_t> (size - (framePackets - 1) * m_packetSize, headerSize);
+  uint32_t bursts = (m_model == FRAMES ? m_burstsPerFrame : 1);
+  Time period = Seconds (1 / m_frameRate);
+  NS_LOG_DEBUG ("Frame " << frame << " of " << size << " bytes in " << framePackets
+                         << " packets and " << bursts << " bursts");
+
+  m_burstEvents.clear ();
+  uint32_t first = 0;
+  for (uint32_t burst = 0; burst < bursts; burst++)
+    {
+      uint32_t end = static_cast<uint64_t> (framePackets) * (burst + 1) / bursts;
+      if (end == first)
+        {
+          continue;
+        }
+      uint32_t burstLastSize = (end == framePackets ? lastSize : m_packetSize);
+      if (burst == 0)
+        {
+          SendBurst (frame, end - first, burstLastSize, framePackets);
+        }
+      else
+        {
+          m_burstEvents.push_back (Simulator::Schedule (period * burst / bursts, &TgadTrafficGenerator::SendBurst,
+                                                        this, frame, end - first, burstLastSize, framePackets));
+        }
+      first = end;
+    }
+}
+
+Ptr<Packet>
+TgadTrafficGenerator::CreatePacket (uint32_t frame, uint32_t size, uint32_t framePackets)
+{
+  TgadTrafficHeader header;
+  header.SetSeq (m_seq++);
+  header.SetSize (size);
+  header.SetFrame (frame);
+  header.SetFramePackets (framePackets);
+  Ptr<Packet> packet = Create<Packet> (size - header.GetSerializedSize ());
+  packet->AddHeader (header);
+  return packet;
+}
+
+void
+TgadTrafficGenerator::SendBurst (uint32_t frame, uint32_t packets, uint32_t lastSize, uint32_t framePackets)
+{
+  NS_LOG_FUNCTION (this << frame << packets << lastSize << framePackets);
+  for (uint32_t i = 0; i < packets; i++)
+    {
+      uint32_t size = (i + 1 == packets ? lastSize : m_packetSize);
+      m_pending.push_back (CreatePacket (frame, size, framePackets));
+      m_totBytes += size;
+    }
+  SendPending ();
+}
+
+void
+TgadTrafficGenerator::SendPending (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_connected || m_sending)
+    {
+      return;
+    }
+
+  m_sending = true;
+  bool datagram = (m_socket->GetSocketType () != Socket::NS3_SOCK_STREAM);
+  uint32_t headerSize = TgadTrafficHeader ().GetSerializedSize ();
+  if (datagram && !m_pending.empty ())
+    {
+      // hand the whole burst over to the socket at once
+      std::vector<Ptr<Packet> > burst (m_pending.begin (), m_pending.end ());
+      m_pending.clear ();
+      std::size_t next = 0;
+      while (next < burst.size ())
+        {
+          int sent = std::max (m_socket->SendBurst (burst, next, burst.size (), 0), 0);
+          for (int i = 0; i < sent; i++, next++)
+            {
+              m_txBytes += burst[next]->GetSize ();
+              m_txPackets++;
+              m_txTrace (burst[next]);
+            }
+          if (next < burst.size ())
+            {
+              // a datagram which cannot be sent now never will
+              NS_LOG_DEBUG ("Error " << m_socket->GetErrno () << " while sending " << *burst[next]);
+              next++;
+            }
+        }
+    }
+  while (true)
+    {
+      if (m_pending.empty ())
+        {
+          if (m_model != FILE_TRANSFER || (m_maxBytes > 0 && m_totBytes >= m_maxBytes))
+            {
+              break;
+            }
+          uint64_t size = m_packetSize;
+          if (m_maxBytes > 0)
+            {
+              size = std::max<uint64_t> (std::min (size, m_maxBytes - m_totBytes), headerSize);
+            }
+          m_pending.push_back (CreatePacket (0, size, 0));
+          m_totBytes += size;
+        }
+
+      Ptr<Packet> packet = m_pending.front ();
+      if (m_socket->GetTxAvailable () < packet->GetSize ())
+        {
+          // DataSend will resume once the socket has room
+          break;
+        }
+      if (m_socket->Send (packet) < 0)
+        {
+          NS_LOG_DEBUG ("Error " << m_socket->GetErrno () << " while sending " << *packet);
+          if (!datagram)
+            {
+              break;
+            }
+          // a datagram which cannot be sent now never will
+          m_pending.pop_front ();
+          continue;
+        }
+      m_pending.pop_front ();
+      m_txBytes += packet->GetSize ();
+      m_txPackets++;
+      m_txTrace (packet);
+    }
+  m_sending = false;
+}
+
+void
+TgadTrafficGenerator::ConnectionSucceeded (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+  m_connected = true;
+  SendPending ();
+}
+
+void
+TgadTrafficGenerator::ConnectionFailed (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+  NS_LOG_WARN ("TgadTrafficGenerator, connection failed");
+}
+
+void
+TgadTrafficGenerator::DataSend (Ptr<Socket> socket, uint32_t available)
+{
+  NS_LOG_FUNCTION (this << socket << available);
+  SendPending ();
+}
+
+} // namespace ns3
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "tgad-traffic-header.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TgadTrafficHeader");
+
+NS_OBJECT_ENSURE_REGISTERED (TgadTrafficHeader);
+
+TgadTrafficHeader::TgadTrafficHeader ()
+  : E2eStatsHeader (),
+    m_frame (0),
+    m_framePackets (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TypeId
+TgadTrafficHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TgadTrafficHeader")
+    .SetParent<E2eStatsHeader> ()
+    .SetGroupName ("Applications")
+    .AddConstructor<TgadTrafficHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+TgadTrafficHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+void
+TgadTrafficHeader::SetFrame (uint32_t frame)
+{
+  m_frame = frame;
+}
+
+uint32_t
+TgadTrafficHeader::GetFrame (void) const
+{
+  return m_frame;
+}
+
+void
+TgadTrafficHeader::SetFramePackets (uint32_t packets)
+{
+  m_framePackets = packets;
+}
+
+uint32_t
+TgadTrafficHeader::GetFramePackets (void) const
+{
+  return m_framePackets;
+}
+
+void
+TgadTrafficHeader::Print (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this << &os);
+  os << "(frame=" << m_frame << " framePackets=" << m_framePackets << ") AND ";
+  E2eStatsHeader::Print (os);
+}
+
+uint32_t
+TgadTrafficHeader::GetSerializedSize (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return E2eStatsHeader::GetSerializedSize () + 8;
+}
+
+void
+TgadTrafficHeader::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+  // the size comes first, as the receiver of a stream peeks it
+  Buffer::Iterator i = start;
+  E2eStatsHeader::Serialize (i);
+  i.Next (E2eStatsHeader::GetSerializedSize ());
+  i.WriteHtonU32 (m_frame);
+  i.WriteHtonU32 (m_framePackets);
+}
+
+uint32_t
+TgadTrafficHeader::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  Buffer::Iterator i = start;
+  E2eStatsHeader::Deserialize (i);
+  i.Next (E2eStatsHeader::GetSerializedSize ());
+  m_frame = i.ReadNtohU32 ();
+  m_framePackets = i.ReadNtohU32 ();
+  return GetSerializedSize ();
+}
+
+} // namespace ns3
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TGAD_TRAFFIC_HEADER_H
+#define TGAD_TRAFFIC_HEADER_H
+
+#include "e2e-stats-header.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup tgadtraffic
+ * \brief Header of the packets of the TgadTrafficGenerator application
+ *
+ * The header extends E2eStatsHeader (size, sequence number and time
+ * stamp, so that the packets can be found again in a TCP stream) with
+ * the number of the frame the packet belongs to and the number of packets
+ * of that frame, so that the receiver can tell when a frame is complete.
+ * A frame made of zero packets means that the traffic is not made of
+ * frames (e.g. a file transfer).
+ */
+class TgadTrafficHeader : public E2eStatsHeader
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  TgadTrafficHeader ();
+
+  /**
+   * \param frame the number of the frame of the packet
+   */
+  void SetFrame (uint32_t frame);
+  /**
+   * \return the number of the frame of the packet
+   */
+  uint32_t GetFrame (void) const;
+  /**
+   * \param packets the number of packets of the frame
+   */
+  void SetFramePackets (uint32_t packets);
+  /**
+   * \return the number of packets of the frame, or zero if the traffic is
+   * not made of frames
+   */
+  uint32_t GetFramePackets (void) const;
+
+  // Inherited
+  virtual TypeId GetInstanceTypeId (void) const override;
+  virtual void Print (std::ostream &os) const override;
+  virtual uint32_t GetSerializedSize (void) const override;
+  virtual void Serialize (Buffer::Iterator start) const override;
+  virtual uint32_t Deserialize (Buffer::Iterator start) override;
+
+private:
+  uint32_t m_frame;         //!< Number of the frame
+  uint32_t m_framePackets;  //!< Number of packets of the frame
+};
+
+} // namespace ns3
+
+#endif /* TGAD_TRAFFIC_HEADER_H */
@@ -0,0 +1,345 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/address.h"
+#include "ns3/node.h"
+#include "ns3/socket.h"
+#include "ns3/socket-factory.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/udp-socket-factory.h"
+#include "tgad-traffic-sink.h"
+#include "tgad-traffic-header.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("TgadTrafficSink");
+
+NS_OBJECT_ENSURE_REGISTERED (TgadTrafficSink);
+
+TypeId
+TgadTrafficSink::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TgadTrafficSink")
+    .SetParent<Application> ()
+    .SetGroupName ("Applications")
+    .AddConstructor<TgadTrafficSink> ()
+    .AddAttribute ("Local",
+                   "The Address on which to Bind the rx socket.",
+                   AddressValue (),
+                   MakeAddressAccessor (&TgadTrafficSink::m_local),
+                   MakeAddressChecker ())
+    .AddAttribute ("Protocol",
+                   "The type id of the protocol to use for the rx socket.",
+                   TypeIdValue (UdpSocketFactory::GetTypeId ()),
+                   MakeTypeIdAccessor (&TgadTrafficSink::m_tid),
+                   MakeTypeIdChecker ())
+    .AddAttribute ("Deadline",
+                   "The largest latency of a packet received on time.",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&TgadTrafficSink::m_deadline),
+                   MakeTimeChecker ())
+    .AddTraceSource ("Rx",
+                     "A packet has been received",
+                     MakeTraceSourceAccessor (&TgadTrafficSink::m_rxTrace),
+                     "ns3::Packet::AddressTracedCallback")
+    .AddTraceSource ("Latency",
+                     "The latency of a packet received",
+                     MakeTraceSourceAccessor (&TgadTrafficSink::m_latencyTrace),
+                     "ns3::TgadTrafficSink::LatencyTracedCallback")
+    .AddTraceSource ("Frame",
+                     "A frame has been received or lost",
+                     MakeTraceSourceAccessor (&TgadTrafficSink::m_frameTrace),
+                     "ns3::TgadTrafficSink::FrameTracedCallback")
+  ;
+  return tid;
+}
+
+TgadTrafficSink::TgadTrafficSink ()
+  : m_socket (0),
+    m_totalRx (0),
+    m_packets (0),
+    m_latePackets (0),
+    m_frames (0),
+    m_lateFrames (0),
+    m_lostFrames (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+TgadTrafficSink::~TgadTrafficSink ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint64_t
+TgadTrafficSink::GetTotalRx (void) const
+{
+  return m_totalRx;
+}
+
+uint64_t
+TgadTrafficSink::GetReceivedPackets (void) const
+{
+  return m_packets;
+}
+
+uint64_t
+TgadTrafficSink::GetLatePackets (void) const
+{
+  return m_latePackets;
+}
+
+Time
+TgadTrafficSink::GetAverageLatency (void) const
+{
+  if (m_packets == 0)
+    {
+      return Seconds (0);
+    }
+  return m_latencySum / m_packets;
+}
+
+Time
+TgadTrafficSink::GetMaxLatency (void) const
+{
+  return m_maxLatency;
+}
+
+Time
+TgadTrafficSink::GetJitter (void) const
+{
+  if (m_flows.empty ())
+    {
+      return Seconds (0);
+    }
+  Time jitter;
+  for (const auto &flow : m_flows)
+    {
+      jitter += flow.second.jitter;
+    }
+  return jitter / m_flows.size ();
+}
+
+uint32_t
+TgadTrafficSink::GetReceivedFrames (void) const
+{
+  return m_frames;
+}
+
+uint32_t
+TgadTrafficSink::GetLateFrames (void) const
+{
+  return m_lateFrames;
+}
+
+uint32_t
+TgadTrafficSink::GetLostFrames (void) const
+{
+  return m_lostFrames;
+}
+
+void
+TgadTrafficSink::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_socket = 0;
+  m_socketList.clear ();
+  m_flows.clear ();
+  Application::DoDispose ();
+}
+
+void
+TgadTrafficSink::StartApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_socket)
+    {
+      m_socket = Socket::CreateSocket (GetNode (), m_tid);
+      if (m_socket->Bind (m_local) == -1)
+        {
+          NS_FATAL_ERROR ("Failed to bind socket");
+        }
+      m_socket->Listen ();
+      m_socket->ShutdownSend ();
+    }
+  m_socket->SetRecvCallback (MakeCallback (&TgadTrafficSink::HandleRead, this));
+  m_socket->SetAcceptCallback (MakeNullCallback<bool, Ptr<Socket>, const Address &> (),
+                               MakeCallback (&TgadTrafficSink::HandleAccept, this));
+}
+
+void
+TgadTrafficSink::StopApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_socketList.empty ())
+    {
+      Ptr<Socket> acceptedSocket = m_socketList.front ();
+      m_socketList.pop_front ();
+      acceptedSocket->Close ();
+    }
+  if (m_socket)
+    {
+      m_socket->Close ();
+      m_socket->SetRecvCallback (MakeNullCallback<void, Ptr<Socket> > ());
+    }
+}
+
+void
+TgadTrafficSink::HandleAccept (Ptr<Socket> socket, const Address &from)
+{
+  NS_LOG_FUNCTION (this << socket << from);
+  socket->SetRecvCallback (MakeCallback (&TgadTrafficSink::HandleRead, this));
+  m_socketList.push_back (socket);
+}
+
+void
+TgadTrafficSink::HandleRead (Ptr<Socket> socket)
+{
+  NS_LOG_FUNCTION (this << socket);
+  Ptr<Packet> packet;
+  Address from;
+  bool stream = (socket->GetSocketType () == Socket::NS3_SOCK_STREAM);
+  while ((packet = socket->RecvFrom (from)))
+    {
+      if (packet->GetSize () == 0)
+        { //EOF
+          break;
+        }
+      m_totalRx += packet->GetSize ();
+      m_rxTrace (packet, from);
+
+      TgadTrafficHeader header;
+      if (!stream)
+        {
+          packet->RemoveHeader (header);
+          PacketReceived (packet, header, from);
+          continue;
+        }
+
+      // cut the stream into the packets sent
+      Ptr<Packet> &buffer = m_flows[from].buffer;
+      if (!buffer)
+        {
+          buffer = packet;
+        }
+      else
+        {
+          buffer->AddAtEnd (packet);
+        }
+      while (buffer->GetSize () >= header.GetSerializedSize ())
+        {
+          buffer->PeekHeader (header);
+          NS_ABORT_IF (header.GetSize () < header.GetSerializedSize ());
+          if (buffer->GetSize () < header.GetSize ())
+            {
+              break;
+            }
+          Ptr<Packet> complete = buffer->CreateFragment (0, static_cast<uint32_t> (header.GetSize ()));
+          buffer->RemoveAtStart (static_cast<uint32_t> (header.GetSize ()));
+          complete->RemoveHeader (header);
+          PacketReceived (complete, header, from);
+        }
+    }
+}
+
+void
+TgadTrafficSink::PacketReceived (Ptr<Packet> packet, const TgadTrafficHeader &header, const Address &from)
+{
+  NS_LOG_FUNCTION (this << packet << header << from);
+  Flow &flow = m_flows[from];
+  Time latency = Simulator::Now () - header.GetTs ();
+  bool late = (latency > m_deadline);
+
+  m_packets++;
+  m_latencySum += latency;
+  m_maxLatency = Max (m_maxLatency, latency);
+  if (late)
+    {
+      m_latePackets++;
+    }
+  if (flow.started)
+    {
+      // RFC 3550, section 6.4.1
+      flow.jitter += (Abs (latency - flow.lastLatency) - flow.jitter) / 16;
+    }
+  flow.lastLatency = latency;
+  m_latencyTrace (packet, from, latency);
+
+  if (header.GetFramePackets () == 0)
+    {
+      flow.started = true;
+      return;
+    }
+
+  int32_t ahead = static_cast<int32_t> (header.GetFrame () - flow.frame);
+  if (!flow.started)
+    {
+      flow.frame = header.GetFrame ();
+    }
+  else if (ahead < 0)
+    {
+      NS_LOG_DEBUG ("Packet of frame " << header.GetFrame () << " received after the frame was closed");
+      return;
+    }
+  else if (ahead > 0)
+    {
+      // the frames in between had no packet received
+      m_lostFrames += ahead - (flow.packets > 0 ? 1 : 0);
+      if (flow.packets > 0)
+        {
+          EndFrame (flow, from, false);
+        }
+      flow.frame = header.GetFrame ();
+    }
+  flow.started = true;
+
+  flow.packets++;
+  flow.frameLatency = Max (flow.frameLatency, latency);
+  flow.frameLate = flow.frameLate || late;
+  if (flow.packets == header.GetFramePackets ())
+    {
+      EndFrame (flow, from, true);
+      flow.frame++;
+    }
+}
+
+void
+TgadTrafficSink::EndFrame (Flow &flow, const Address &from, bool received)
+{
+  NS_LOG_FUNCTION (this << from << flow.frame << received);
+  if (received)
+    {
+      m_frames++;
+      if (flow.frameLate)
+        {
+          m_lateFrames++;
+        }
+    }
+  else
+    {
+      m_lostFrames++;
+    }
+  m_frameTrace (from, flow.frame, flow.frameLatency, received && !flow.frameLate);
+  flow.packets = 0;
+  flow.frameLatency = Seconds (0);
+  flow.frameLate = false;
+}
+
+} // namespace ns3
@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TGAD_TRAFFIC_SINK_H
+#define TGAD_TRAFFIC_SINK_H
+
+#include "ns3/application.h"
+#include "ns3/address.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/traced-callback.h"
+#include <list>
+#include <map>
+
+namespace ns3 {
+
+class Socket;
+class Packet;
+class TgadTrafficHeader;
+
+/**
+ * \ingroup tgadtraffic
+ * \brief Receive the traffic of TgadTrafficGenerator applications
+ *
+ * The sink measures, for each packet, the latency from the time stamp of
+ * its burst, and the interarrival jitter of RFC 3550 (the mean deviation
+ * of the difference of the latencies of consecutive packets). A packet is
+ * late if its latency exceeds the Deadline. A frame is received when all
+ * its packets are; it is late if any of its packets is, and lost if a
+ * packet of a later frame from the same sender arrives before it is
+ * received.
+ *
+ * The traffic of a stream socket is cut into packets again with the size
+ * carried by their TgadTrafficHeader, as PacketSink does. The frames are
+ * followed separately for each sender.
+ */
+class TgadTrafficSink : public Application
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  TgadTrafficSink ();
+  virtual ~TgadTrafficSink ();
+
+  /**
+   * TracedCallback signature for the latency of the packets.
+   *
+   * \param [in] packet The packet, without its header.
+   * \param [in] from The address of the sender.
+   * \param [in] latency The latency of the packet.
+   */
+  typedef void (* LatencyTracedCallback)(Ptr<const Packet> packet, const Address &from, Time latency);
+  /**
+   * TracedCallback signature for the frames received or lost.
+   *
+   * \param [in] from The address of the sender.
+   * \param [in] frame The number of the frame.
+   * \param [in] latency The largest latency of the packets of the frame.
+   * \param [in] onTime Whether all the packets of the frame were received
+   *             before the deadline.
+   */
+  typedef void (* FrameTracedCallback)(const Address &from, uint32_t frame, Time latency, bool onTime);
+
+  /**
+   * \return the number of bytes received, headers included
+   */
+  uint64_t GetTotalRx (void) const;
+  /**
+   * \return the number of packets received
+   */
+  uint64_t GetReceivedPackets (void) const;
+  /**
+   * \return the number of packets received after their deadline
+   */
+  uint64_t GetLatePackets (void) const;
+  /**
+   * \return the mean latency of the packets
+   */
+  Time GetAverageLatency (void) const;
+  /**
+   * \return the largest latency of the packets
+   */
+  Time GetMaxLatency (void) const;
+  /**
+   * \return the interarrival jitter of the packets, averaged over the senders
+   */
+  Time GetJitter (void) const;
+  /**
+   * \return the number of frames received
+   */
+  uint32_t GetReceivedFrames (void) const;
+  /**
+   * \return the number of frames received after their deadline
+   */
+  uint32_t GetLateFrames (void) const;
+  /**
+   * \return the number of frames lost
+   */
+  uint32_t GetLostFrames (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual void StartApplication (void);
+  virtual void StopApplication (void);
+
+  /**
+   * \brief Handle a packet received by the application
+   * \param socket the receiving socket
+   */
+  void HandleRead (Ptr<Socket> socket);
+  /**
+   * \brief Handle an incoming connection
+   * \param socket the incoming connection socket
+   * \param from the address the connection is from
+   */
+  void HandleAccept (Ptr<Socket> socket, const Address &from);
+  /**
+   * \brief Account for a packet of a TgadTrafficGenerator
+   * \param packet the packet, without its header
+   * \param header the header of the packet
+   * \param from the address of the sender
+   */
+  void PacketReceived (Ptr<Packet> packet, const TgadTrafficHeader &header, const Address &from);
+
+  /// The state of the traffic of a sender
+  struct Flow
+  {
+    Ptr<Packet> buffer;       //!< Bytes of a stream not making a packet yet
+    bool started {false};     //!< Whether a packet has been received
+    Time lastLatency;         //!< Latency of the last packet
+    Time jitter;              //!< Interarrival jitter
+    uint32_t frame {0};       //!< Number of the current frame
+    uint32_t packets {0};     //!< Packets of the current frame received
+    Time frameLatency;        //!< Largest latency of the packets of the current frame
+    bool frameLate {false};   //!< Whether a packet of the current frame was late
+  };
+
+  /**
+   * \brief Close the current frame of a flow
+   * \param flow the flow
+   * \param from the address of the sender
+   * \param received whether the frame has been received
+   */
+  void EndFrame (Flow &flow, const Address &from, bool received);
+
+  Ptr<Socket> m_socket;                 //!< Listening socket
+  std::list<Ptr<Socket> > m_socketList; //!< Accepted sockets
+  Address m_local;                      //!< Local address to bind to
+  TypeId m_tid;                         //!< Protocol TypeId
+  Time m_deadline;                      //!< Deadline of the packets
+  std::map<Address, Flow> m_flows;      //!< Traffic of each sender
+
+  uint64_t m_totalRx;                   //!< Bytes received
+  uint64_t m_packets;                   //!< Packets received
+  uint64_t m_latePackets;               //!< Packets received after their deadline
+  Time m_latencySum;                    //!< Sum of the latencies of the packets
+  Time m_maxLatency;                    //!< Largest latency of the packets
+  uint32_t m_frames;                    //!< Frames received
+  uint32_t m_lateFrames;                //!< Frames received after their deadline
+  uint32_t m_lostFrames;                //!< Frames lost
+
+  /// Traced Callback: received packets, source address
+  TracedCallback<Ptr<const Packet>, const Address &> m_rxTrace;
+  /// Traced Callback: latency of the received packets
+  TracedCallback<Ptr<const Packet>, const Address &, Time> m_latencyTrace;
+  /// Traced Callback: frames received or lost
+  TracedCallback<const Address &, uint32_t, Time, bool> m_frameTrace;
+};
+
+} // namespace ns3
+
+#endif /* TGAD_TRAFFIC_SINK_H */
@@ -0,0 +1,333 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <fstream>
+#include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/error-model.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/packet-socket-address.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/tgad-traffic-helper.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simple-channel.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief Send the traffic of a TgadTrafficGenerator to a TgadTrafficSink
+ * over a link of two nodes.
+ */
+class TgadTrafficTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param name the name of the test case
+   */
+  TgadTrafficTestCase (std::string name);
+
+protected:
+  /**
+   * Create the two nodes and the link between them.
+   * \param delay the delay of the link
+   */
+  void CreateLink (Time delay);
+  /**
+   * Install packet sockets on the nodes, so that no address has to be
+   * resolved before the first packet is sent.
+   * \param sinkAddress the address of the sink
+   * \param remoteAddress the address of the sink as seen by the sender
+   */
+  void InstallPacketSockets (PacketSocketAddress &sinkAddress, PacketSocketAddress &remoteAddress);
+  /**
+   * Install the Internet stack on the nodes.
+   * \return the address of the receiver
+   */
+  Ipv4Address InstallInternet (void);
+
+  NodeContainer m_nodes;             //!< The sender and the receiver
+  Ptr<SimpleNetDevice> m_txDev;      //!< The device of the sender
+  Ptr<SimpleNetDevice> m_rxDev;      //!< The device of the receiver
+};
+
+TgadTrafficTestCase::TgadTrafficTestCase (std::string name)
+  : TestCase (name)
+{
+}
+
+void
+TgadTrafficTestCase::CreateLink (Time delay)
+{
+  m_nodes.Create (2);
+  m_txDev = CreateObject<SimpleNetDevice> ();
+  m_rxDev = CreateObject<SimpleNetDevice> ();
+  m_txDev->SetAddress (Mac48Address::Allocate ());
+  m_rxDev->SetAddress (Mac48Address::Allocate ());
+  m_nodes.Get (0)->AddDevice (m_txDev);
+  m_nodes.Get (1)->AddDevice (m_rxDev);
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (delay));
+  m_txDev->SetChannel (channel);
+  m_rxDev->SetChannel (channel);
+}
+
+void
+TgadTrafficTestCase::InstallPacketSockets (PacketSocketAddress &sinkAddress, PacketSocketAddress &remoteAddress)
+{
+  PacketSocketHelper packetSocket;
+  packetSocket.Install (m_nodes);
+
+  sinkAddress.SetSingleDevice (m_rxDev->GetIfIndex ());
+  sinkAddress.SetProtocol (1);
+  remoteAddress.SetSingleDevice (m_txDev->GetIfIndex ());
+  remoteAddress.SetPhysicalAddress (m_rxDev->GetAddress ());
+  remoteAddress.SetProtocol (1);
+}
+
+Ipv4Address
+TgadTrafficTestCase::InstallInternet (void)
+{
+  InternetStackHelper internet;
+  internet.Install (m_nodes);
+  NetDeviceContainer devices;
+  devices.Add (m_txDev);
+  devices.Add (m_rxDev);
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+  return ipv4.Assign (devices).GetAddress (1);
+}
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief Check the frames of uncompressed video sent a line at a time,
+ * and the latency and deadline statistics of the sink.
+ */
+class TgadTrafficVideoTestCase : public TgadTrafficTestCase
+{
+public:
+  TgadTrafficVideoTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TgadTrafficVideoTestCase::TgadTrafficVideoTestCase ()
+  : TgadTrafficTestCase ("Uncompressed video, a line at a time")
+{
+}
+
+void
+TgadTrafficVideoTestCase::DoRun (void)
+{
+  CreateLink (MilliSeconds (15));
+  PacketSocketAddress sinkAddress;
+  PacketSocketAddress remoteAddress;
+  InstallPacketSockets (sinkAddress, remoteAddress);
+  // drop the second packet of the first frame
+  Ptr<ReceiveListErrorModel> errorModel = CreateObject<ReceiveListErrorModel> ();
+  errorModel->SetList ({1});
+  m_rxDev->SetReceiveErrorModel (errorModel);
+
+  TgadTrafficSinkHelper sinkHelper ("ns3::PacketSocketFactory", sinkAddress);
+  sinkHelper.SetAttribute ("Deadline", TimeValue (MilliSeconds (10)));
+  ApplicationContainer apps = sinkHelper.Install (m_nodes.Get (1));
+  Ptr<TgadTrafficSink> sink = DynamicCast<TgadTrafficSink> (apps.Get (0));
+  apps.Start (Seconds (0.5));
+
+  // 64x36 pixels of 24 bits, i.e. 6912 bytes in 5 packets, sent in 36 bursts
+  TgadTrafficHelper helper ("ns3::PacketSocketFactory", remoteAddress);
+  helper.SetUncompressedVideo (64, 36, 24, 60);
+  apps = helper.Install (m_nodes.Get (0));
+  Ptr<TgadTrafficGenerator> generator = DynamicCast<TgadTrafficGenerator> (apps.Get (0));
+  apps.Start (Seconds (1));
+  apps.Stop (Seconds (2));
+
+  Simulator::Stop (Seconds (3));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (generator->GetTotalFrames (), 60, "Wrong number of frames generated");
+  NS_TEST_ASSERT_MSG_EQ (generator->GetTotalTxPackets (), 300, "Wrong number of packets sent");
+  NS_TEST_ASSERT_MSG_EQ (generator->GetTotalTx (), 60 * 6912, "Wrong number of bytes sent");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetReceivedPackets (), 299, "Wrong number of packets received");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetLostFrames (), 1, "The frame of the packet dropped is not lost");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetReceivedFrames (), 59, "Wrong number of frames received");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetLateFrames (), 59, "The frames should miss their deadline");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetLatePackets (), 299, "The packets should miss their deadline");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetAverageLatency (), MilliSeconds (15), "Wrong latency");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetJitter (), Seconds (0), "There should be no jitter");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief Check the replay of a trace file.
+ */
+class TgadTrafficTraceTestCase : public TgadTrafficTestCase
+{
+public:
+  TgadTrafficTraceTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Record a frame generated.
+   * \param frame the number of the frame
+   * \param size the size of the frame
+   */
+  void FrameGenerated (uint32_t frame, uint32_t size);
+
+  std::vector<Time> m_frameTimes;     //!< The times of the frames generated
+  std::vector<uint32_t> m_frameSizes; //!< The sizes of the frames generated
+};
+
+TgadTrafficTraceTestCase::TgadTrafficTraceTestCase ()
+  : TgadTrafficTestCase ("Replay of a trace file")
+{
+}
+
+void
+TgadTrafficTraceTestCase::FrameGenerated (uint32_t frame, uint32_t size)
+{
+  NS_TEST_EXPECT_MSG_EQ (frame, m_frameTimes.size (), "Wrong frame number");
+  m_frameTimes.push_back (Simulator::Now ());
+  m_frameSizes.push_back (size);
+}
+
+void
+TgadTrafficTraceTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("tgad-trace.txt");
+  std::ofstream trace (filename.c_str ());
+  trace << "# time (us) size (bytes)\n0 3000\n10000 100\n\n20000\t5000\n";
+  trace.close ();
+
+  CreateLink (Seconds (0));
+  PacketSocketAddress sinkAddress;
+  PacketSocketAddress remoteAddress;
+  InstallPacketSockets (sinkAddress, remoteAddress);
+  TgadTrafficSinkHelper sinkHelper ("ns3::PacketSocketFactory", sinkAddress);
+  ApplicationContainer apps = sinkHelper.Install (m_nodes.Get (1));
+  Ptr<TgadTrafficSink> sink = DynamicCast<TgadTrafficSink> (apps.Get (0));
+
+  TgadTrafficHelper helper ("ns3::PacketSocketFactory", remoteAddress);
+  helper.SetTrace (filename, false);
+  apps = helper.Install (m_nodes.Get (0));
+  Ptr<TgadTrafficGenerator> generator = DynamicCast<TgadTrafficGenerator> (apps.Get (0));
+  generator->TraceConnectWithoutContext ("Frame", MakeCallback (&TgadTrafficTraceTestCase::FrameGenerated, this));
+  apps.Start (Seconds (1));
+
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (generator->GetTraceFrames (), 3, "Wrong number of frames loaded");
+  NS_TEST_ASSERT_MSG_EQ (m_frameTimes.size (), 3, "Wrong number of frames generated");
+  NS_TEST_EXPECT_MSG_EQ (m_frameTimes[0], Seconds (1), "Wrong time of the first frame");
+  NS_TEST_EXPECT_MSG_EQ (m_frameTimes[1], Seconds (1.01), "Wrong time of the second frame");
+  NS_TEST_EXPECT_MSG_EQ (m_frameTimes[2], Seconds (1.02), "Wrong time of the third frame");
+  NS_TEST_EXPECT_MSG_EQ (m_frameSizes[2], 5000, "Wrong size of the third frame");
+  // 3000 bytes in 3 packets, 100 bytes in 1 and 5000 bytes in 4
+  NS_TEST_ASSERT_MSG_EQ (generator->GetTotalTxPackets (), 8, "Wrong number of packets sent");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetTotalRx (), 8100, "Wrong number of bytes received");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetReceivedFrames (), 3, "Wrong number of frames received");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetLateFrames (), 0, "No frame should be late");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief Check a file transfer over TCP, whose packets wait in the
+ * generator until the socket has room for them.
+ */
+class TgadTrafficFileTransferTestCase : public TgadTrafficTestCase
+{
+public:
+  TgadTrafficFileTransferTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+TgadTrafficFileTransferTestCase::TgadTrafficFileTransferTestCase ()
+  : TgadTrafficTestCase ("File transfer over TCP")
+{
+}
+
+void
+TgadTrafficFileTransferTestCase::DoRun (void)
+{
+  CreateLink (MicroSeconds (100));
+  Ipv4Address address = InstallInternet ();
+  uint16_t port = 4000;
+  TgadTrafficSinkHelper sinkHelper ("ns3::TcpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), port));
+  ApplicationContainer apps = sinkHelper.Install (m_nodes.Get (1));
+  Ptr<TgadTrafficSink> sink = DynamicCast<TgadTrafficSink> (apps.Get (0));
+
+  TgadTrafficHelper helper ("ns3::TcpSocketFactory", InetSocketAddress (address, port));
+  helper.SetFileTransfer (1000000);
+  apps = helper.Install (m_nodes.Get (0));
+  Ptr<TgadTrafficGenerator> generator = DynamicCast<TgadTrafficGenerator> (apps.Get (0));
+  apps.Start (Seconds (1));
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (generator->GetTotalTx (), 1000000, "Wrong number of bytes sent");
+  NS_TEST_ASSERT_MSG_EQ (generator->GetPendingPackets (), 0, "Packets still pending");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetTotalRx (), 1000000, "Wrong number of bytes received");
+  // 679 packets of 1472 bytes and one of 512 bytes
+  NS_TEST_ASSERT_MSG_EQ (sink->GetReceivedPackets (), 680, "Wrong number of packets received");
+  NS_TEST_ASSERT_MSG_EQ (sink->GetReceivedFrames (), 0, "A file transfer has no frame");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief TgadTraffic TestSuite
+ */
+class TgadTrafficTestSuite : public TestSuite
+{
+public:
+  TgadTrafficTestSuite ();
+};
+
+TgadTrafficTestSuite::TgadTrafficTestSuite ()
+  : TestSuite ("tgad-traffic", UNIT)
+{
+  AddTestCase (new TgadTrafficVideoTestCase, TestCase::QUICK);
+  AddTestCase (new TgadTrafficTraceTestCase, TestCase::QUICK);
+  AddTestCase (new TgadTrafficFileTransferTestCase, TestCase::QUICK);
+}
+
+static TgadTrafficTestSuite tgadTrafficTestSuite; //!< Static variable for test initialization
@@ -26,6 +26,7 @@
 #include "pointer.h"
 #include "log.h"
 
+#include <atomic>
 #include <sstream>
 
 /**
@@ -178,7 +179,6 @@ MatchContainer::DisconnectWithoutContext (std::string name, const CallbackBase &
     }
 }
 
-
 /**
  * \ingroup config-impl
  * Helper to test if an array entry matches a config path specification.
@@ -302,11 +302,11 @@ class Resolver
 {
 public:
   /**
-   * Construct from a base Config path.
+   * Construct from a parsed Config path.
    *
    * \param [in] path The Config path.
    */
-  Resolver (std::string path);
+  Resolver (const CompiledPath &path);
   /** Destructor. */
   virtual ~Resolver ();
 
@@ -320,23 +320,21 @@ public:
   void Resolve (Ptr<Object> root);
 
 private:
-  /** Ensure the Config path starts and ends with a '/'. */
-  void Canonicalize (void);
   /**
    * Parse the next element in the Config path.
    *
-   * \param [in] path The remaining portion of the Config path.
+   * \param [in] i The index of the next element of the Config path.
    * \param [in] root The object corresponding to the current position
    *                  in the Config path.
    */
-  void DoResolve (std::string path, Ptr<Object> root);
+  void DoResolve (std::size_t i, Ptr<Object> root);
   /**
    * Parse an index on the Config path.
    *
-   * \param [in] path The remaining Config path.
+   * \param [in] i The index of the next element of the Config path.
    * \param [in,out] vector The resulting list of matching objects.
    */
-  void DoArrayResolve (std::string path, const ObjectPtrContainerValue &vector);
+  void DoArrayResolve (std::size_t i, const ObjectPtrContainerValue &vector);
   /**
    * Handle one object found on the path.
    *
@@ -349,6 +347,13 @@ private:
    * \returns The current Config path.
    */
   std::string GetResolvedPath (void) const;
+  /**
+   * Get the remaining Config path, for logging.
+   *
+   * \param [in] i The index of the next element of the Config path.
+   * \returns The remaining Config path.
+   */
+  std::string GetPathLeft (std::size_t i) const;
   /**
    * Handle one found object.
    *
@@ -359,47 +364,27 @@ private:
 
   /** Current list of path tokens. */
   std::vector<std::string> m_workStack;
-  /** The Config path. */
-  std::string m_path;
+  /** The parsed Config path. */
+  const std::vector<CompiledPath::Element> &m_elements;
 
 };  // class Resolver
 
-Resolver::Resolver (std::string path)
-  : m_path (path)
+Resolver::Resolver (const CompiledPath &path)
+  : m_elements (path.m_elements)
 {
-  NS_LOG_FUNCTION (this << path);
-  Canonicalize ();
+  NS_LOG_FUNCTION (this << path.GetPath ());
 }
 Resolver::~Resolver ()
 {
   NS_LOG_FUNCTION (this);
 }
-void
-Resolver::Canonicalize (void)
-{
-  NS_LOG_FUNCTION (this);
-
-  // ensure that we start and end with a '/'
-  std::string::size_type tmp = m_path.find ("/");
-  if (tmp != 0)
-    {
-      // no slash at start
-      m_path = "/" + m_path;
-    }
-  tmp = m_path.find_last_of ("/");
-  if (tmp != (m_path.size () - 1))
-    {
-      // no slash at end
-      m_path = m_path + "/";
-    }
-}
 
 void
 Resolver::Resolve (Ptr<Object> root)
 {
   NS_LOG_FUNCTION (this << root);
 
-  DoResolve (m_path, root);
+  DoResolve (0, root);
 }
 
 std::string
@@ -415,6 +400,17 @@ Resolver::GetResolvedPath (void) const
   return fullPath;
 }
 
+std::string
+Resolver::GetPathLeft (std::size_t i) const
+{
+  std::string pathLeft = "/";
+  for (; i < m_elements.size (); i++)
+    {
+      pathLeft += m_elements[i].name + "/";
+    }
+  return pathLeft;
+}
+
 void
 Resolver::DoResolveOne (Ptr<Object> object)
 {
@@ -425,13 +421,11 @@ Resolver::DoResolveOne (Ptr<Object> object)
 }
 
 void
-Resolver::DoResolve (std::string path, Ptr<Object> root)
+Resolver::DoResolve (std::size_t i, Ptr<Object> root)
 {
-  NS_LOG_FUNCTION (this << path << root);
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
+  NS_LOG_FUNCTION (this << GetPathLeft (i) << root);
 
-  if (next == std::string::npos)
+  if (i == m_elements.size ())
     {
       //
       // If root is zero, we're beginning to see if we can use the object name
@@ -447,8 +441,8 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
         }
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
+  const CompiledPath::Element &element = m_elements[i];
+  const std::string &item = element.name;
 
   //
   // If root is zero, we're beginning to see if we can use the object name
@@ -459,11 +453,10 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   //
   if (root == 0)
     {
-      std::string::size_type offset = path.find ("/Names");
-      if (offset == 0)
+      if (element.isNames)
         {
           m_workStack.push_back (item);
-          DoResolve (pathLeft, root);
+          DoResolve (i + 1, root);
           m_workStack.pop_back ();
           return;
         }
@@ -480,7 +473,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       NS_LOG_DEBUG ("Name system resolved item = " << item << " to " << namedObject);
       m_workStack.push_back (item);
-      DoResolve (pathLeft, namedObject);
+      DoResolve (i + 1, namedObject);
       m_workStack.pop_back ();
       return;
     }
@@ -496,13 +489,13 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       return;
     }
-  std::string::size_type dollarPos = item.find ("$");
-  if (dollarPos == 0)
+  if (element.isTypeId)
     {
       // This is a call to GetObject
       std::string tidString = item.substr (1, item.size () - 1);
       NS_LOG_DEBUG ("GetObject=" << tidString << " on path=" << GetResolvedPath ());
-      TypeId tid = TypeId::LookupByName (tidString);
+      // An unknown TypeId is only an error if the path gets this far.
+      TypeId tid = (element.tid == TypeId ()) ? TypeId::LookupByName (tidString) : element.tid;
       Ptr<Object> object = root->GetObject<Object> (tid);
       if (object == 0)
         {
@@ -510,7 +503,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
           return;
         }
       m_workStack.push_back (item);
-      DoResolve (pathLeft, object);
+      DoResolve (i + 1, object);
       m_workStack.pop_back ();
     }
   else
@@ -524,10 +517,10 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
         {
           tid = nextTid;
 
-          for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+          for (uint32_t j = 0; j < tid.GetAttributeN (); j++)
             {
               struct TypeId::AttributeInformation info;
-              info = tid.GetAttribute (i);
+              info = tid.GetAttribute (j);
               if (info.name != item && item != "*")
                 {
                   continue;
@@ -549,7 +542,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
                     }
                   foundMatch = true;
                   m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
+                  DoResolve (i + 1, object);
                   m_workStack.pop_back ();
                 }
               // attempt to cast to an object vector.
@@ -557,12 +550,12 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
                 dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
               if (vectorChecker != 0)
                 {
-                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << pathLeft);
+                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << GetPathLeft (i + 1));
                   foundMatch = true;
                   ObjectPtrContainerValue vector;
                   root->GetAttribute (info.name, vector);
                   m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
+                  DoArrayResolve (i + 1, vector);
                   m_workStack.pop_back ();
                 }
               // this could be anything else and we don't know what to do with it.
@@ -582,20 +575,15 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
 }
 
 void
-Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &container)
+Resolver::DoArrayResolve (std::size_t i, const ObjectPtrContainerValue &container)
 {
-  NS_LOG_FUNCTION (this << path << &container);
-  NS_ASSERT (path != "");
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
-  if (next == std::string::npos)
+  NS_LOG_FUNCTION (this << GetPathLeft (i) << &container);
+  if (i == m_elements.size ())
     {
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
 
-  ArrayMatcher matcher = ArrayMatcher (item);
+  ArrayMatcher matcher = ArrayMatcher (m_elements[i].name);
   ObjectPtrContainerValue::Iterator it;
   for (it = container.Begin (); it != container.End (); ++it)
     {
@@ -604,7 +592,7 @@ Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &conta
           std::ostringstream oss;
           oss << (*it).first;
           m_workStack.push_back (oss.str ());
-          DoResolve (pathLeft, (*it).second);
+          DoResolve (i + 1, (*it).second);
           m_workStack.pop_back ();
         }
     }
@@ -633,6 +621,14 @@ public:
   void Disconnect (std::string path, const CallbackBase &cb);
   /** \copydoc Config::LookupMatches() */
   MatchContainer LookupMatches (std::string path);
+  /**
+   * Resolve a parsed Config path.
+   *
+   * \param [in] path The parsed path to perform a match against.
+   * \returns A container which contains all the objects which match
+   *          the input path.
+   */
+  MatchContainer LookupMatches (const CompiledPath &path);
 
   /** \copydoc Config::RegisterRootNamespaceObject() */
   void RegisterRootNamespaceObject (Ptr<Object> obj);
@@ -751,10 +747,17 @@ MatchContainer
 ConfigImpl::LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (this << path);
+  return LookupMatches (CompiledPath (path));
+}
+
+MatchContainer
+ConfigImpl::LookupMatches (const CompiledPath &path)
+{
+  NS_LOG_FUNCTION (this << path.GetPath ());
   class LookupMatchesResolver : public Resolver
   {
 public:
-    LookupMatchesResolver (std::string path)
+    LookupMatchesResolver (const CompiledPath &path)
       : Resolver (path)
     {
     }
@@ -778,7 +781,7 @@ public:
   //
   resolver.Resolve (0);
 
-  return MatchContainer (resolver.m_objects, resolver.m_contexts, path);
+  return MatchContainer (resolver.m_objects, resolver.m_contexts, path.GetPath ());
 }
 
 void
@@ -786,6 +789,7 @@ ConfigImpl::RegisterRootNamespaceObject (Ptr<Object> obj)
 {
   NS_LOG_FUNCTION (this << obj);
   m_roots.push_back (obj);
+  InvalidateCompiledPaths ();
 }
 
 void
@@ -798,6 +802,7 @@ ConfigImpl::UnregisterRootNamespaceObject (Ptr<Object> obj)
       if (*i == obj)
         {
           m_roots.erase (i);
+          InvalidateCompiledPaths ();
           return;
         }
     }
@@ -817,6 +822,120 @@ ConfigImpl::GetRootNamespaceObject (std::size_t i) const
 }
 
 
+/**
+ * \ingroup config-impl
+ * The generation of the object graph: incremented by
+ * Config::InvalidateCompiledPaths, compared by CompiledPath.
+ */
+static std::atomic<uint64_t> g_generation (1);
+
+CompiledPath::CompiledPath ()
+  : m_generation (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+CompiledPath::CompiledPath (std::string path)
+  : m_path (path),
+    m_generation (0)
+{
+  NS_LOG_FUNCTION (this << path);
+
+  // ensure that we start and end with a '/'
+  std::string canonical = path;
+  if (canonical.find ("/") != 0)
+    {
+      canonical = "/" + canonical;
+    }
+  if (canonical.find_last_of ("/") != canonical.size () - 1)
+    {
+      canonical = canonical + "/";
+    }
+
+  std::string::size_type cur = 0;
+  std::string::size_type next;
+  while ((next = canonical.find ("/", cur + 1)) != std::string::npos)
+    {
+      Element element;
+      element.name = canonical.substr (cur + 1, next - (cur + 1));
+      element.isTypeId = element.name.find ("$") == 0;
+      element.isNames = canonical.compare (cur, 6, "/Names") == 0;
+      if (element.isTypeId)
+        {
+          TypeId::LookupByNameFailSafe (element.name.substr (1), &element.tid);
+        }
+      m_elements.push_back (element);
+      cur = next;
+    }
+}
+std::string
+CompiledPath::GetPath (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_path;
+}
+MatchContainer
+CompiledPath::GetMatches (void) const
+{
+  NS_LOG_FUNCTION (this);
+  uint64_t generation = g_generation.load ();
+  if (m_generation != generation)
+    {
+      NS_LOG_DEBUG ("resolve " << m_path);
+      m_matches = ConfigImpl::Get ()->LookupMatches (*this);
+      m_generation = generation;
+    }
+  return m_matches;
+}
+void
+CompiledPath::Set (std::string name, const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << name << &value);
+  GetMatches ().Set (name, value);
+}
+bool
+CompiledPath::SetFailSafe (std::string name, const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << name << &value);
+  return GetMatches ().SetFailSafe (name, value);
+}
+void
+CompiledPath::Connect (std::string name, const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << name << &cb);
+  GetMatches ().Connect (name, cb);
+}
+bool
+CompiledPath::ConnectFailSafe (std::string name, const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << name << &cb);
+  return GetMatches ().ConnectFailSafe (name, cb);
+}
+void
+CompiledPath::ConnectWithoutContext (std::string name, const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << name << &cb);
+  GetMatches ().ConnectWithoutContext (name, cb);
+}
+bool
+CompiledPath::ConnectWithoutContextFailSafe (std::string name, const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << name << &cb);
+  return GetMatches ().ConnectWithoutContextFailSafe (name, cb);
+}
+void
+CompiledPath::Disconnect (std::string name, const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << name << &cb);
+  GetMatches ().Disconnect (name, cb);
+}
+void
+CompiledPath::DisconnectWithoutContext (std::string name, const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << name << &cb);
+  GetMatches ().DisconnectWithoutContext (name, cb);
+}
+
+
 void Reset (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
@@ -962,6 +1081,11 @@ Ptr<Object> GetRootNamespaceObject (uint32_t i)
   return ConfigImpl::Get ()->GetRootNamespaceObject (i);
 }
 
+void InvalidateCompiledPaths (void)
+{
+  g_generation++;
+}
+
 } // namespace Config
 
 } // namespace ns3
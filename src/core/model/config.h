@@ -21,6 +21,7 @@
 #define CONFIG_H
 
 #include "ptr.h"
+#include "type-id.h"
 #include <string>
 #include <vector>
 
@@ -288,6 +289,105 @@ private:
  */
 MatchContainer LookupMatches (std::string path);
 
+class Resolver;
+
+/**
+ * \ingroup config
+ * \brief a Config path parsed once, whose matching objects are cached.
+ *
+ * Config::Set and Config::Connect parse their path and walk the object
+ * graph below it on every call. A CompiledPath parses the path once and
+ * keeps the objects which match it until the object graph changes, so that
+ * setting several attributes or connecting several trace sources below the
+ * same path resolves it only once:
+ *
+ * \code
+ *   Config::CompiledPath phy ("/NodeList/ * /DeviceList/ * /$ns3::WifiNetDevice/Phy");
+ *   phy.Connect ("PhyTxBegin", MakeCallback (&PhyTxBegin));
+ *   phy.Connect ("PhyRxEnd", MakeCallback (&PhyRxEnd));
+ * \endcode
+ *
+ * (without the spaces around the wildcards).
+ *
+ * The matching objects are resolved again after Config::InvalidateCompiledPaths
+ * has been called, which happens whenever an Object is aggregated,
+ * initialized or disposed, a pointer attribute is set, a root namespace
+ * object or a name is registered, and a node, device, application or channel
+ * is added to its list. Creating an Object does not invalidate the matches:
+ * a new object is not reachable until it is attached in one of these ways.
+ * Code which attaches an existing object to another one in any other way
+ * (for example, through a plain setter) must call
+ * Config::InvalidateCompiledPaths itself.
+ */
+class CompiledPath
+{
+public:
+  CompiledPath ();
+  /**
+   * Parse a Config path.
+   *
+   * \param [in] path The path to match objects against.
+   */
+  CompiledPath (std::string path);
+
+  /**
+   * \returns The path used to perform the object matching.
+   */
+  std::string GetPath (void) const;
+  /**
+   * \returns A container which contains all the objects which match the
+   *          path, resolved again only if the object graph has changed.
+   */
+  MatchContainer GetMatches (void) const;
+
+  /** \copydoc MatchContainer::Set() */
+  void Set (std::string name, const AttributeValue &value) const;
+  /** \copydoc MatchContainer::SetFailSafe() */
+  bool SetFailSafe (std::string name, const AttributeValue &value) const;
+  /** \copydoc MatchContainer::Connect() */
+  void Connect (std::string name, const CallbackBase &cb) const;
+  /** \copydoc MatchContainer::ConnectFailSafe() */
+  bool ConnectFailSafe (std::string name, const CallbackBase &cb) const;
+  /** \copydoc MatchContainer::ConnectWithoutContext() */
+  void ConnectWithoutContext (std::string name, const CallbackBase &cb) const;
+  /** \copydoc MatchContainer::ConnectWithoutContextFailSafe() */
+  bool ConnectWithoutContextFailSafe (std::string name, const CallbackBase &cb) const;
+  /** \copydoc MatchContainer::Disconnect() */
+  void Disconnect (std::string name, const CallbackBase &cb) const;
+  /** \copydoc MatchContainer::DisconnectWithoutContext() */
+  void DisconnectWithoutContext (std::string name, const CallbackBase &cb) const;
+
+private:
+  /** Resolver walks the parsed elements. */
+  friend class Resolver;
+
+  /** An element of the path, between two slashes. */
+  struct Element
+  {
+    std::string name;  //!< The element
+    bool isTypeId;     //!< The element is a "$" element (a call to GetObject)
+    bool isNames;      //!< The remaining path starts with "/Names"
+    TypeId tid;        //!< The TypeId of a "$" element, if registered
+  };
+
+  /** The path used to perform the object matching. */
+  std::string m_path;
+  /** The parsed path. */
+  std::vector<Element> m_elements;
+  /** The objects which matched the path when it was last resolved. */
+  mutable MatchContainer m_matches;
+  /** The generation of the object graph when the path was last resolved. */
+  mutable uint64_t m_generation;
+};
+
+/**
+ * \ingroup config
+ * Notify the Config system that the object graph reachable from the root
+ * namespace objects may have changed, so that every CompiledPath resolves
+ * its objects again.
+ */
+void InvalidateCompiledPaths (void);
+
 /**
  * \ingroup config
  * \param [in] obj A new root object
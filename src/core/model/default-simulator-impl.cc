@@ -22,13 +22,19 @@
 #include "default-simulator-impl.h"
 #include "scheduler.h"
 #include "event-impl.h"
+#include "event-profiler.h"
 
 #include "ptr.h"
 #include "pointer.h"
+#include "boolean.h"
+#include "string.h"
+#include "enum.h"
 #include "assert.h"
 #include "log.h"
 
 #include <cmath>
+#include <fstream>
+#include <iostream>
 
 
 /**
@@ -46,6 +52,15 @@ NS_LOG_COMPONENT_DEFINE ("DefaultSimulatorImpl");
 
 NS_OBJECT_ENSURE_REGISTERED (DefaultSimulatorImpl);
 
+/**
+ * \ingroup simulator
+ * The maximum number of events from other threads moved into the main
+ * event queue at once, so that producers which keep scheduling cannot
+ * hold the simulator thread in ProcessEventsWithContext: the remaining
+ * events are moved after the next event has been processed.
+ */
+static const uint32_t g_maxEventsWithContext = 1024;
+
 TypeId
 DefaultSimulatorImpl::GetTypeId (void)
 {
@@ -53,6 +68,24 @@ DefaultSimulatorImpl::GetTypeId (void)
     .SetParent<SimulatorImpl> ()
     .SetGroupName ("Core")
     .AddConstructor<DefaultSimulatorImpl> ()
+    .AddAttribute ("EventProfile",
+                   "Measure the wall-clock time spent in each function run by the events, "
+                   "and print it at Simulator::Destroy.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DefaultSimulatorImpl::m_profileEnabled),
+                   MakeBooleanChecker ())
+    .AddAttribute ("EventProfileFile",
+                   "The file to print the event profile to; the standard output if empty.",
+                   StringValue (""),
+                   MakeStringAccessor (&DefaultSimulatorImpl::m_profileFile),
+                   MakeStringChecker ())
+    .AddAttribute ("EventProfileFormat",
+                   "The format of the event profile: a table sorted by time, "
+                   "or folded stacks for flame graph tools.",
+                   EnumValue (DefaultSimulatorImpl::PROFILE_REPORT),
+                   MakeEnumAccessor (&DefaultSimulatorImpl::m_profileFormat),
+                   MakeEnumChecker (DefaultSimulatorImpl::PROFILE_REPORT, "Report",
+                                    DefaultSimulatorImpl::PROFILE_FOLDED, "Folded"))
   ;
   return tid;
 }
@@ -72,20 +105,25 @@ DefaultSimulatorImpl::DefaultSimulatorImpl ()
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
   m_eventCount = 0;
-  m_eventsWithContextEmpty = true;
+  m_profiler = 0;
   m_main = SystemThread::Self ();
 }
 
 DefaultSimulatorImpl::~DefaultSimulatorImpl ()
 {
   NS_LOG_FUNCTION (this);
+  delete m_profiler;
 }
 
 void
 DefaultSimulatorImpl::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
-  ProcessEventsWithContext ();
+  EventWithContext event;
+  while (m_eventsWithContext.Pop (event))
+    {
+      event.event->Unref ();
+    }
 
   while (!m_events->IsEmpty ())
     {
@@ -109,6 +147,36 @@ DefaultSimulatorImpl::Destroy ()
           ev->Invoke ();
         }
     }
+  if (m_profiler != 0)
+    {
+      PrintEventProfile ();
+      delete m_profiler;
+      m_profiler = 0;
+    }
+}
+
+void
+DefaultSimulatorImpl::PrintEventProfile (void) const
+{
+  NS_LOG_FUNCTION (this);
+  std::ofstream file;
+  if (!m_profileFile.empty ())
+    {
+      file.open (m_profileFile.c_str ());
+      if (!file.is_open ())
+        {
+          NS_LOG_WARN ("Cannot open " << m_profileFile << ": printing the event profile to the standard output");
+        }
+    }
+  std::ostream &os = file.is_open () ? file : std::cout;
+  if (m_profileFormat == PROFILE_FOLDED)
+    {
+      m_profiler->PrintFolded (os);
+    }
+  else
+    {
+      m_profiler->PrintReport (os);
+    }
 }
 
 void
@@ -148,7 +216,14 @@ DefaultSimulatorImpl::ProcessOneEvent (void)
   m_currentTs = next.key.m_ts;
   m_currentContext = next.key.m_context;
   m_currentUid = next.key.m_uid;
-  next.impl->Invoke ();
+  if (m_profiler == 0)
+    {
+      next.impl->Invoke ();
+    }
+  else
+    {
+      m_profiler->Invoke (next.impl);
+    }
   next.impl->Unref ();
 
   ProcessEventsWithContext ();
@@ -163,22 +238,14 @@ DefaultSimulatorImpl::IsFinished (void) const
 void
 DefaultSimulatorImpl::ProcessEventsWithContext (void)
 {
-  if (m_eventsWithContextEmpty)
+  if (m_eventsWithContext.IsEmpty ())
     {
       return;
     }
 
-  // swap queues
-  EventsWithContext eventsWithContext;
-  {
-    CriticalSection cs (m_eventsWithContextMutex);
-    m_eventsWithContext.swap (eventsWithContext);
-    m_eventsWithContextEmpty = true;
-  }
-  while (!eventsWithContext.empty ())
+  EventWithContext event;
+  for (uint32_t n = 0; n < g_maxEventsWithContext && m_eventsWithContext.Pop (event); n++)
     {
-      EventWithContext event = eventsWithContext.front ();
-      eventsWithContext.pop_front ();
       Scheduler::Event ev;
       ev.impl = event.event;
       ev.key.m_ts = m_currentTs + event.timestamp;
@@ -198,6 +265,11 @@ DefaultSimulatorImpl::Run (void)
   m_main = SystemThread::Self ();
   ProcessEventsWithContext ();
   m_stop = false;
+  // The attributes are set after construction: start profiling here.
+  if (m_profileEnabled && m_profiler == 0)
+    {
+      m_profiler = new EventProfiler ();
+    }
 
   while (!m_events->IsEmpty () && !m_stop)
     {
@@ -270,11 +342,7 @@ DefaultSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay,
       // Current time added in ProcessEventsWithContext()
       ev.timestamp = delay.GetTimeStep ();
       ev.event = event;
-      {
-        CriticalSection cs (m_eventsWithContextMutex);
-        m_eventsWithContext.push_back (ev);
-        m_eventsWithContextEmpty = false;
-      }
+      m_eventsWithContext.Push (ev);
     }
 }
 
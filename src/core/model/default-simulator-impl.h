@@ -25,11 +25,12 @@
 #include "scheduler.h"
 #include "event-impl.h"
 #include "system-thread.h"
-#include "system-mutex.h"
+#include "mpsc-queue.h"
 
 #include "ptr.h"
 
 #include <list>
+#include <string>
 
 /**
  * \file
@@ -39,6 +40,8 @@
 
 namespace ns3 {
 
+class EventProfiler;
+
 /**
  * \ingroup simulator
  *
@@ -47,6 +50,13 @@ namespace ns3 {
 class DefaultSimulatorImpl : public SimulatorImpl
 {
 public:
+  /** The formats of the event profile. */
+  enum EventProfileFormat
+  {
+    PROFILE_REPORT,  //!< A table of the functions, sorted by time
+    PROFILE_FOLDED   //!< Folded stacks, for flame graph tools
+  };
+
   /**
    *  Register this type.
    *  \return The object TypeId.
@@ -86,6 +96,8 @@ private:
   void ProcessOneEvent (void);
   /** Move events from a different context into the main event queue. */
   void ProcessEventsWithContext (void);
+  /** Print the event profile to its file, or the standard output. */
+  void PrintEventProfile (void) const;
 
   /** Wrap an event with its execution context. */
   struct EventWithContext
@@ -98,16 +110,12 @@ private:
     EventImpl *event;
   };
   /** Container type for the events from a different context. */
-  typedef std::list<struct EventWithContext> EventsWithContext;
-  /** The container of events from a different context. */
-  EventsWithContext m_eventsWithContext;
+  typedef MpscQueue<struct EventWithContext> EventsWithContext;
   /**
-   * Flag \c true if all events with context have been moved to the
-   * primary event queue.
+   * The container of events from other threads, filled without locking
+   * and drained by the main thread.
    */
-  bool m_eventsWithContextEmpty;
-  /** Mutex to control access to the list of events with context. */
-  SystemMutex m_eventsWithContextMutex;
+  EventsWithContext m_eventsWithContext;
 
   /** Container type for the events to run at Simulator::Destroy() */
   typedef std::list<EventId> DestroyEvents;
@@ -136,6 +144,15 @@ private:
 
   /** Main execution thread. */
   SystemThread::ThreadId m_main;
+
+  /** Profile the events. */
+  bool m_profileEnabled;
+  /** The file of the event profile, or empty for the standard output. */
+  std::string m_profileFile;
+  /** The format of the event profile. */
+  enum EventProfileFormat m_profileFormat;
+  /** The event profiler, while profiling. */
+  EventProfiler *m_profiler;
 };
 
 } // namespace ns3
@@ -66,4 +66,41 @@ EventImpl::IsCancelled (void)
   return m_cancel;
 }
 
+const void *
+EventImpl::GetFunction (void) const
+{
+  return 0;
+}
+
+const void *
+EventImpl::GetMemberFunctionAddress (const void *memberPointer, std::size_t size,
+                                     const void *object)
+{
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+  // Itanium C++ ABI: a pointer to member function is the address of the
+  // function and an adjustment of the object pointer; for a virtual
+  // function, the address is 1 plus the offset of the function in the
+  // virtual table of the adjusted object.
+  struct
+  {
+    uintptr_t address;
+    ptrdiff_t adjustment;
+  } rep;
+  if (size != sizeof (rep))
+    {
+      return 0;
+    }
+  std::memcpy (&rep, memberPointer, sizeof (rep));
+  if ((rep.address & 1) == 0)
+    {
+      return reinterpret_cast<const void *> (rep.address);
+    }
+  const char *self = static_cast<const char *> (object) + rep.adjustment;
+  const char *vtable = *reinterpret_cast<const char * const *> (self);
+  return *reinterpret_cast<const void * const *> (vtable + rep.address - 1);
+#else
+  return 0;
+#endif
+}
+
 } // namespace ns3
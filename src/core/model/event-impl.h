@@ -21,6 +21,8 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
+#include <cstring>
 #include "simple-ref-count.h"
 
 /**
@@ -65,8 +67,41 @@ public:
    * Checked by the simulation engine before calling Invoke().
    */
   bool IsCancelled (void);
+  /**
+   * Get the address of the function or method run by this event, which
+   * the event profiler uses to attribute the time spent in the event.
+   *
+   * \returns The address of the function, or 0 if it is unknown.
+   */
+  virtual const void * GetFunction (void) const;
 
 protected:
+  /**
+   * Get the address of a function, for GetFunction().
+   *
+   * \tparam F \deduced The function pointer type.
+   * \param [in] f The function pointer.
+   * \returns The address of the function.
+   */
+  template <typename F>
+  static const void * GetFunctionAddress (F f)
+  {
+    const void *address = 0;
+    std::memcpy (&address, &f, sizeof (f) < sizeof (address) ? sizeof (f) : sizeof (address));
+    return address;
+  }
+  /**
+   * Get the address of the code called through a pointer to member
+   * function, for GetFunction().
+   *
+   * \param [in] memberPointer The pointer to member function.
+   * \param [in] size The size of the pointer to member function.
+   * \param [in] object The object the method is called on.
+   * \returns The address of the method, or 0 if it cannot be known.
+   */
+  static const void * GetMemberFunctionAddress (const void *memberPointer, std::size_t size,
+                                                const void *object);
+
   /**
    * Implementation for Invoke().
    *
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-profiler.h"
+#include "event-impl.h"
+#include "log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#if (__GNUC__ >= 3)
+#include <cxxabi.h>
+#endif
+
+// dladdr is in the C library of glibc 2.34 and later, and of macOS.
+#if defined (__APPLE__) || (defined (__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34)))
+#define EVENT_PROFILER_DLADDR 1
+#include <dlfcn.h>
+#endif
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("EventProfiler");
+
+/**
+ * \ingroup simulator
+ * Demangle a C++ symbol or type name.
+ * \param [in] mangled The mangled name.
+ * \returns The demangled name, or the mangled name if it cannot be demangled.
+ */
+static std::string
+Demangle (const char *mangled)
+{
+  std::string name = mangled;
+#if (__GNUC__ >= 3)
+  int status;
+  char *demangled = abi::__cxa_demangle (mangled, NULL, NULL, &status);
+  if (status == 0)
+    {
+      name = demangled;
+    }
+  std::free (demangled);
+#endif
+  return name;
+}
+
+EventProfiler::EventProfiler ()
+  : m_count (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+EventProfiler::Invoke (EventImpl *event)
+{
+  // The object of a cancelled event may be gone: do not look at its function.
+  if (event->IsCancelled ())
+    {
+      return;
+    }
+  const void *function = event->GetFunction ();
+  const std::type_info *type = &typeid (*event);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now ();
+  event->Invoke ();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ();
+  Entry &entry = m_entries[function != 0 ? function : type];
+  if (entry.count == 0)
+    {
+      entry.function = function;
+      entry.type = type;
+    }
+  entry.count++;
+  entry.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds> (end - start).count ();
+  m_count++;
+}
+
+uint64_t
+EventProfiler::GetEventCount (void) const
+{
+  return m_count;
+}
+
+std::string
+EventProfiler::GetName (const Entry &entry)
+{
+#ifdef EVENT_PROFILER_DLADDR
+  Dl_info info;
+  if (entry.function != 0 && dladdr (entry.function, &info) != 0
+      && info.dli_sname != 0 && info.dli_saddr == entry.function)
+    {
+      return Demangle (info.dli_sname);
+    }
+#endif
+  std::ostringstream oss;
+  oss << Demangle (entry.type->name ());
+  if (entry.function != 0)
+    {
+      oss << " at " << entry.function;
+    }
+  return oss.str ();
+}
+
+std::vector<EventProfiler::Record>
+EventProfiler::GetRecords (void) const
+{
+  NS_LOG_FUNCTION (this);
+  // Several addresses can have the same name (e.g., thunks): merge them.
+  std::map<std::string, Record> byName;
+  for (std::unordered_map<const void *, Entry>::const_iterator i = m_entries.begin ();
+       i != m_entries.end (); ++i)
+    {
+      std::string name = GetName (i->second);
+      Record &record = byName[name];
+      record.name = name;
+      record.count += i->second.count;
+      record.nanoseconds += i->second.nanoseconds;
+    }
+  std::vector<Record> records;
+  for (std::map<std::string, Record>::const_iterator i = byName.begin (); i != byName.end (); ++i)
+    {
+      records.push_back (i->second);
+    }
+  std::stable_sort (records.begin (), records.end (),
+                    [] (const Record &a, const Record &b) { return a.nanoseconds > b.nanoseconds; });
+  return records;
+}
+
+void
+EventProfiler::PrintReport (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this << &os);
+  std::vector<Record> records = GetRecords ();
+  uint64_t total = 0;
+  for (std::vector<Record>::const_iterator i = records.begin (); i != records.end (); ++i)
+    {
+      total += i->nanoseconds;
+    }
+  std::ios::fmtflags flags = os.flags ();
+  std::streamsize precision = os.precision ();
+  os << "Event profile: " << m_count << " events, " << total / 1e6 << " ms" << std::endl
+     << std::setw (8) << "time %" << std::setw (12) << "time (ms)" << std::setw (12) << "events"
+     << std::setw (12) << "ns/event" << "  function" << std::endl;
+  os << std::fixed;
+  for (std::vector<Record>::const_iterator i = records.begin (); i != records.end (); ++i)
+    {
+      os << std::setprecision (2) << std::setw (8) << (total > 0 ? 100.0 * i->nanoseconds / total : 0)
+         << std::setprecision (3) << std::setw (12) << i->nanoseconds / 1e6
+         << std::setw (12) << i->count
+         << std::setprecision (0) << std::setw (12) << static_cast<double> (i->nanoseconds) / i->count
+         << "  " << i->name << std::endl;
+    }
+  os.flags (flags);
+  os.precision (precision);
+}
+
+void
+EventProfiler::PrintFolded (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this << &os);
+  std::vector<Record> records = GetRecords ();
+  for (std::vector<Record>::const_iterator i = records.begin (); i != records.end (); ++i)
+    {
+      os << i->name << " " << i->nanoseconds / 1000 << std::endl;
+    }
+}
+
+} // namespace ns3
@@ -51,6 +51,10 @@ EventImpl * MakeEvent (void (*f)(void))
     {
       (*m_function)();
     }
+    virtual const void * GetFunction (void) const
+    {
+      return GetFunctionAddress (m_function);
+    }
 
   private:
     F m_function;
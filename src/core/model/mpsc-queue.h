@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MPSC_QUEUE_H
+#define MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * \file
+ * \ingroup core
+ * ns3::MpscQueue declaration and template implementation.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup core
+ * \brief An unbounded lock-free multi-producer single-consumer FIFO queue.
+ *
+ * Any number of threads may Push concurrently; a single thread (the
+ * consumer) may Pop and call IsEmpty. Values pushed by one thread are
+ * popped in the order they were pushed, and values pushed by different
+ * threads are popped in the order their Push reached the queue.
+ *
+ * The queue is a singly linked list with a dummy node (after D. Vyukov):
+ * a Push is one allocation, one atomic exchange and one release store;
+ * a Pop and IsEmpty are one acquire load by the consumer, with no
+ * read-modify-write. Neither ever blocks.
+ *
+ * A value whose Push has not completed yet is not visible to the consumer,
+ * which sees the queue as empty (or ending just before it) until then.
+ *
+ * \tparam T \explicit The type of the values, which must be default
+ * constructible and copyable.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+  /** Constructor. */
+  MpscQueue ();
+  /** Destructor. Values still in the queue are discarded. */
+  ~MpscQueue ();
+
+  /**
+   * Append a value. Can be called from any thread.
+   *
+   * \param [in] value The value.
+   */
+  void Push (const T &value);
+  /**
+   * Remove the oldest value. Must be called from the consumer thread.
+   *
+   * \param [out] value The value removed, if any.
+   * \returns \c true if a value was removed, \c false if the queue is empty.
+   */
+  bool Pop (T &value);
+  /**
+   * Test if the queue is empty. Must be called from the consumer thread.
+   *
+   * \returns \c true if no value can be popped.
+   */
+  bool IsEmpty (void) const;
+
+private:
+  /** A node of the list. */
+  struct Node
+  {
+    std::atomic<Node *> next;  //!< The next (more recent) node
+    T value;                   //!< The value
+  };
+
+  /**
+   * Copy constructor, unimplemented.
+   * \param [in] o The other queue.
+   */
+  MpscQueue (const MpscQueue &o);
+  /**
+   * Assignment operator, unimplemented.
+   * \param [in] o The other queue.
+   * \returns The queue.
+   */
+  MpscQueue & operator = (const MpscQueue &o);
+
+  /** The most recently pushed node, updated by the producers. */
+  std::atomic<Node *> m_head;
+  /** Keep the producer and consumer ends on separate cache lines. */
+  char m_padding[64 - sizeof (std::atomic<Node *>)];
+  /** The dummy node before the oldest value, owned by the consumer. */
+  Node *m_tail;
+};
+
+} // namespace ns3
+
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3 {
+
+template <typename T>
+MpscQueue<T>::MpscQueue ()
+{
+  Node *stub = new Node;
+  stub->next.store (0, std::memory_order_relaxed);
+  m_head.store (stub, std::memory_order_relaxed);
+  m_tail = stub;
+}
+
+template <typename T>
+MpscQueue<T>::~MpscQueue ()
+{
+  T value;
+  while (Pop (value))
+    {
+    }
+  delete m_tail;
+}
+
+template <typename T>
+void
+MpscQueue<T>::Push (const T &value)
+{
+  Node *node = new Node;
+  node->next.store (0, std::memory_order_relaxed);
+  node->value = value;
+  Node *prev = m_head.exchange (node, std::memory_order_acq_rel);
+  prev->next.store (node, std::memory_order_release);
+}
+
+template <typename T>
+bool
+MpscQueue<T>::Pop (T &value)
+{
+  Node *tail = m_tail;
+  Node *next = tail->next.load (std::memory_order_acquire);
+  if (next == 0)
+    {
+      return false;
+    }
+  value = next->value;
+  m_tail = next;
+  delete tail;
+  return true;
+}
+
+template <typename T>
+bool
+MpscQueue<T>::IsEmpty (void) const
+{
+  return m_tail->next.load (std::memory_order_acquire) == 0;
+}
+
+} // namespace ns3
+
+#endif /* MPSC_QUEUE_H */
@@ -22,10 +22,14 @@
 #include "trace-source-accessor.h"
 #include "attribute-construction-list.h"
 #include "string.h"
+#include "pointer.h"
+#include "config.h"
+#include "system-mutex.h"
 #include "ns3/core-config.h"
 
 #include <cstdlib>  // getenv
-#include <cstring>  // strlen
+#include <memory>
+#include <vector>
 
 /**
  * \file
@@ -76,93 +80,204 @@ ObjectBase::NotifyConstructionCompleted (void)
   NS_LOG_FUNCTION (this);
 }
 
-void
-ObjectBase::ConstructSelf (const AttributeConstructionList &attributes)
+/**
+ * \ingroup object
+ * The information about an attribute which ObjectBase::ConstructSelf
+ * needs, resolved once per TypeId.
+ */
+struct ConstructionItem
+{
+  Ptr<const AttributeAccessor> accessor;   //!< The attribute accessor.
+  Ptr<const AttributeChecker> checker;     //!< The attribute checker.
+  Ptr<const AttributeValue> initialValue;  //!< The initial value.
+  bool construct;                          //!< Whether the attribute is set at construction.
+  bool checked;                            //!< Whether the initial value passes the checker.
+  std::vector<std::string> env;            //!< The values from NS_ATTRIBUTE_DEFAULT, in order.
+  std::string name;                        //!< The attribute name.
+  std::string tidName;                     //!< The name of the TypeId which declares the attribute.
+};
+
+/**
+ * \ingroup object
+ * The attributes of a TypeId and its parents, in the order in which
+ * ObjectBase::ConstructSelf sets them.
+ */
+struct ConstructionPlan
 {
+  uint64_t generation;                 //!< The TypeId::GetAttributeGeneration of the plan.
+  std::string env;                     //!< The NS_ATTRIBUTE_DEFAULT of the plan.
+  std::vector<ConstructionItem> items; //!< The attributes.
+};
+
+/**
+ * \ingroup object
+ * Get the mutex for the cache of the construction plans.
+ *
+ * \returns The mutex.
+ */
+static SystemMutex &
+GetConstructionPlanMutex (void)
+{
+  static SystemMutex mutex;
+  return mutex;
+}
+
+/**
+ * \ingroup object
+ * Build the construction plan of a TypeId.
+ *
+ * \param [in] tid The TypeId.
+ * \param [in] generation The current TypeId::GetAttributeGeneration.
+ * \param [in] env The current value of NS_ATTRIBUTE_DEFAULT.
+ * \returns The plan.
+ */
+static std::shared_ptr<const ConstructionPlan>
+BuildConstructionPlan (TypeId tid, uint64_t generation, const std::string &env)
+{
+  NS_LOG_FUNCTION (tid.GetName () << generation << env);
+  std::shared_ptr<ConstructionPlan> plan = std::make_shared<ConstructionPlan> ();
+  plan->generation = generation;
+  plan->env = env;
   // loop over the inheritance tree back to the Object base class.
-  NS_LOG_FUNCTION (this << &attributes);
-  TypeId tid = GetInstanceTypeId ();
   do
     {
-      // loop over all attributes in object type
-      NS_LOG_DEBUG ("construct tid=" << tid.GetName () << ", params=" << tid.GetAttributeN ());
       for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
         {
           struct TypeId::AttributeInformation info = tid.GetAttribute (i);
-          NS_LOG_DEBUG ("try to construct \"" << tid.GetName () << "::" <<
-                        info.name << "\"");
-          // is this attribute stored in this AttributeConstructionList instance ?
-          Ptr<AttributeValue> value = attributes.Find (info.checker);
-          // See if this attribute should not be set here in the
-          // constructor.
-          if (!(info.flags & TypeId::ATTR_CONSTRUCT))
+          ConstructionItem item;
+          item.accessor = info.accessor;
+          item.checker = info.checker;
+          item.initialValue = info.initialValue;
+          item.construct = (info.flags & TypeId::ATTR_CONSTRUCT) != 0;
+          // A value of another type, such as a StringValue for a pointer,
+          // must be converted by every object.
+          item.checked = info.checker->Check (*info.initialValue);
+          item.name = info.name;
+          item.tidName = tid.GetName ();
+          std::string::size_type cur = 0;
+          std::string::size_type next = 0;
+          while (!env.empty () && next != std::string::npos)
             {
-              // Handle this attribute if it should not be
-              // set here.
-              if (value == 0)
+              next = env.find (";", cur);
+              std::string tmp = std::string (env, cur, next - cur);
+              std::string::size_type equal = tmp.find ("=");
+              if (equal != std::string::npos
+                  && tmp.substr (0, equal) == tid.GetAttributeFullName (i))
                 {
-                  // Skip this attribute if it's not in the
-                  // AttributeConstructionList.
-                  continue;
-                }
-              else
-                {
-                  // This is an error because this attribute is not
-                  // settable in its constructor but is present in
-                  // the AttributeConstructionList.
-                  NS_FATAL_ERROR ("Attribute name=" << info.name << " tid=" << tid.GetName () << ": initial value cannot be set using attributes");
+                  item.env.push_back (tmp.substr (equal + 1, tmp.size () - equal - 1));
                 }
+              cur = next + 1;
+            }
+          plan->items.push_back (item);
+        }
+      tid = tid.GetParent ();
+    }
+  while (tid != ObjectBase::GetTypeId ());
+  return plan;
+}
+
+/**
+ * \ingroup object
+ * Get the construction plan of a TypeId, building it when the
+ * attributes or NS_ATTRIBUTE_DEFAULT changed since the last call.
+ *
+ * \param [in] tid The TypeId.
+ * \returns The plan.
+ */
+static std::shared_ptr<const ConstructionPlan>
+GetConstructionPlan (TypeId tid)
+{
+  static std::vector<std::shared_ptr<const ConstructionPlan> > plans;
+  const char *envVar = getenv ("NS_ATTRIBUTE_DEFAULT");
+  const char *env = envVar != 0 ? envVar : "";
+  uint64_t generation = TypeId::GetAttributeGeneration ();
+  uint16_t uid = tid.GetUid ();
+
+  CriticalSection critical (GetConstructionPlanMutex ());
+  if (uid >= plans.size ())
+    {
+      plans.resize (uid + 1);
+    }
+  std::shared_ptr<const ConstructionPlan> &plan = plans[uid];
+  if (plan == 0 || plan->generation != generation || plan->env != env)
+    {
+      plan = BuildConstructionPlan (tid, generation, env);
+    }
+  return plan;
+}
+
+void
+ObjectBase::ConstructSelf (const AttributeConstructionList &attributes)
+{
+  NS_LOG_FUNCTION (this << &attributes);
+  // The setters may construct other objects, so the plan is kept
+  // alive without holding the lock of the cache.
+  std::shared_ptr<const ConstructionPlan> plan = GetConstructionPlan (GetInstanceTypeId ());
+  bool hasAttributes = attributes.Begin () != attributes.End ();
+  for (std::vector<ConstructionItem>::const_iterator item = plan->items.begin ();
+       item != plan->items.end (); ++item)
+    {
+      NS_LOG_DEBUG ("try to construct \"" << item->tidName << "::" <<
+                    item->name << "\"");
+      // is this attribute stored in this AttributeConstructionList instance ?
+      Ptr<AttributeValue> value = hasAttributes ? attributes.Find (item->checker) : 0;
+      // See if this attribute should not be set here in the
+      // constructor.
+      if (!item->construct)
+        {
+          // Handle this attribute if it should not be
+          // set here.
+          if (value == 0)
+            {
+              // Skip this attribute if it's not in the
+              // AttributeConstructionList.
+              continue;
+            }
+          else
+            {
+              // This is an error because this attribute is not
+              // settable in its constructor but is present in
+              // the AttributeConstructionList.
+              NS_FATAL_ERROR ("Attribute name=" << item->name << " tid=" << item->tidName << ": initial value cannot be set using attributes");
             }
+        }
 
-          if (value != 0)
+      if (value != 0)
+        {
+          // We have a matching attribute value.
+          if (DoSet (item->accessor, item->checker, *value))
             {
-              // We have a matching attribute value.
-              if (DoSet (info.accessor, info.checker, *value))
-                {
-                  NS_LOG_DEBUG ("construct \"" << tid.GetName () << "::" <<
-                                info.name << "\"");
-                  continue;
-                }
+              NS_LOG_DEBUG ("construct \"" << item->tidName << "::" <<
+                            item->name << "\"");
+              continue;
             }
+        }
 
-          // No matching attribute value so we try to look at the env var.
-          const char *envVar = getenv ("NS_ATTRIBUTE_DEFAULT");
-          if (envVar != 0 && std::strlen (envVar) > 0)
+      // No matching attribute value so we try to look at the env var.
+      for (std::vector<std::string>::const_iterator env = item->env.begin ();
+           env != item->env.end (); ++env)
+        {
+          if (DoSet (item->accessor, item->checker, StringValue (*env)))
             {
-              std::string env = envVar;
-              std::string::size_type cur = 0;
-              std::string::size_type next = 0;
-              while (next != std::string::npos)
-                {
-                  next = env.find (";", cur);
-                  std::string tmp = std::string (env, cur, next - cur);
-                  std::string::size_type equal = tmp.find ("=");
-                  if (equal != std::string::npos)
-                    {
-                      std::string name = tmp.substr (0, equal);
-                      std::string envval = tmp.substr (equal + 1, tmp.size () - equal - 1);
-                      if (name == tid.GetAttributeFullName (i))
-                        {
-                          if (DoSet (info.accessor, info.checker, StringValue (envval)))
-                            {
-                              NS_LOG_DEBUG ("construct \"" << tid.GetName () << "::" <<
-                                            info.name << "\" from env var");
-                              break;
-                            }
-                        }
-                    }
-                  cur = next + 1;
-                }
+              NS_LOG_DEBUG ("construct \"" << item->tidName << "::" <<
+                            item->name << "\" from env var");
+              break;
             }
+        }
 
-          // No matching attribute value so we try to set the default value.
-          DoSet (info.accessor, info.checker, *info.initialValue);
-          NS_LOG_DEBUG ("construct \"" << tid.GetName () << "::" <<
-                        info.name << "\" from initial value.");
+      // No matching attribute value so we try to set the default value.
+      if (item->checked)
+        {
+          // No need to copy a value which is already valid.
+          item->accessor->Set (this, *item->initialValue);
         }
-      tid = tid.GetParent ();
+      else
+        {
+          DoSet (item->accessor, item->checker, *item->initialValue);
+        }
+      NS_LOG_DEBUG ("construct \"" << item->tidName << "::" <<
+                    item->name << "\" from initial value.");
     }
-  while (tid != ObjectBase::GetTypeId ());
   NotifyConstructionCompleted ();
 }
 
@@ -200,6 +315,10 @@ ObjectBase::SetAttribute (std::string name, const AttributeValue &value)
     {
       NS_FATAL_ERROR ("Attribute name=" << name << " could not be set for this object: tid=" << tid.GetName ());
     }
+  if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != 0)
+    {
+      Config::InvalidateCompiledPaths ();
+    }
 }
 bool
 ObjectBase::SetAttributeFailSafe (std::string name, const AttributeValue &value)
@@ -216,7 +335,15 @@ ObjectBase::SetAttributeFailSafe (std::string name, const AttributeValue &value)
     {
       return false;
     }
-  return DoSet (info.accessor, info.checker, value);
+  if (!DoSet (info.accessor, info.checker, value))
+    {
+      return false;
+    }
+  if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != 0)
+    {
+      Config::InvalidateCompiledPaths ();
+    }
+  return true;
 }
 
 void
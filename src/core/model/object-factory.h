@@ -24,6 +24,8 @@
 #include "object.h"
 #include "type-id.h"
 
+#include <vector>
+
 /**
  * \file
  * \ingroup object
@@ -111,6 +113,26 @@ public:
    */
   template <typename T>
   Ptr<T> Create (void) const;
+  /**
+   * Create a number of Object instances of the configured TypeId.
+   *
+   * The constructor of the TypeId is looked up once, and the attribute
+   * defaults are resolved once per TypeId, so this is the fastest way
+   * to populate a large scenario with identical objects.
+   *
+   * \param [in] n The number of objects.
+   * \returns The new object instances.
+   */
+  std::vector<Ptr<Object> > Create (uint32_t n) const;
+  /**
+   * Create a number of Object instances of the requested type.
+   *
+   * \tparam T \explicit The requested Object type.
+   * \param [in] n The number of objects.
+   * \returns The new object instances.
+   */
+  template <typename T>
+  std::vector<Ptr<T> > Create (uint32_t n) const;
 
 private:
   /**
@@ -207,6 +229,20 @@ ObjectFactory::Create (void) const
   return object->GetObject<T> ();
 }
 
+template <typename T>
+std::vector<Ptr<T> >
+ObjectFactory::Create (uint32_t n) const
+{
+  std::vector<Ptr<Object> > objects = Create (n);
+  std::vector<Ptr<T> > result;
+  result.reserve (n);
+  for (std::vector<Ptr<Object> >::const_iterator i = objects.begin (); i != objects.end (); ++i)
+    {
+      result.push_back ((*i)->GetObject<T> ());
+    }
+  return result;
+}
+
 template <typename T>
 Ptr<T>
 CreateObjectWithAttributes (std::string n1, const AttributeValue & v1,
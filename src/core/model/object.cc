@@ -21,6 +21,7 @@
 
 #include "object.h"
 #include "object-factory.h"
+#include "config.h"
 #include "assert.h"
 #include "attribute.h"
 #include "log.h"
@@ -191,6 +192,7 @@ Object::Initialize (void)
    * array whenever we call some user code, just in case.
    */
   NS_LOG_FUNCTION (this);
+  Config::InvalidateCompiledPaths ();
 restart:
   uint32_t n = m_aggregates->n;
   for (uint32_t i = 0; i < n; i++)
@@ -222,6 +224,7 @@ Object::Dispose (void)
    * user code.
    */
   NS_LOG_FUNCTION (this);
+  Config::InvalidateCompiledPaths ();
 restart:
   uint32_t n = m_aggregates->n;
   for (uint32_t i = 0; i < n; i++)
@@ -289,6 +292,8 @@ Object::AggregateObject (Ptr<Object> o)
   struct Aggregates *a = m_aggregates;
   struct Aggregates *b = other->m_aggregates;
 
+  Config::InvalidateCompiledPaths ();
+
   // Then, assign the new aggregation buffer to every object
   uint32_t n = aggregates->n;
   for (uint32_t i = 0; i < n; i++)
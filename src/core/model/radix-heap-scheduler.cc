@@ -0,0 +1,288 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "radix-heap-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * Implementation of ns3::RadixHeapScheduler class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("RadixHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (RadixHeapScheduler);
+
+namespace {
+
+/**
+ * \ingroup scheduler
+ * Position of the most significant bit set.
+ *
+ * \param [in] v A non-zero value.
+ * \returns The index, starting at 1, of the highest bit set in \pname{v}.
+ */
+inline uint32_t
+HighestBit (uint64_t v)
+{
+#if defined (__GNUC__)
+  return 64 - __builtin_clzll (v);
+#else
+  uint32_t n = 0;
+  while (v != 0)
+    {
+      v >>= 1;
+      n++;
+    }
+  return n;
+#endif
+}
+
+/**
+ * \ingroup scheduler
+ * Position of the least significant bit set.
+ *
+ * \param [in] v A non-zero value.
+ * \returns The index, starting at 1, of the lowest bit set in \pname{v}.
+ */
+inline uint32_t
+LowestBit (uint64_t v)
+{
+#if defined (__GNUC__)
+  return __builtin_ctzll (v) + 1;
+#else
+  uint32_t n = 1;
+  while ((v & 1) == 0)
+    {
+      v >>= 1;
+      n++;
+    }
+  return n;
+#endif
+}
+
+} // unnamed namespace
+
+TypeId
+RadixHeapScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::RadixHeapScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<RadixHeapScheduler> ()
+  ;
+  return tid;
+}
+
+RadixHeapScheduler::RadixHeapScheduler ()
+  : m_head (0),
+    m_occupied (0),
+    m_last (0),
+    m_size (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+RadixHeapScheduler::~RadixHeapScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+RadixHeapScheduler::GetBucket (uint64_t ts) const
+{
+  return (ts == m_last) ? 0 : HighestBit (ts ^ m_last);
+}
+
+void
+RadixHeapScheduler::Push (const Scheduler::Event &ev)
+{
+  uint32_t i = GetBucket (ev.key.m_ts);
+  Bucket &bucket = m_buckets[i];
+  if (i > 0)
+    {
+      bucket.push_back (ev);
+      m_occupied |= uint64_t (1) << (i - 1);
+    }
+  else if (bucket.size () == m_head || bucket.back () < ev)
+    {
+      // Uids are allocated in scheduling order, so this is the usual case.
+      bucket.push_back (ev);
+    }
+  else
+    {
+      bucket.insert (std::upper_bound (bucket.begin () + m_head, bucket.end (), ev), ev);
+    }
+}
+
+void
+RadixHeapScheduler::Refill (void) const
+{
+  Bucket &first = m_buckets[0];
+  if (m_head < first.size () || m_occupied == 0)
+    {
+      return;
+    }
+  first.clear ();
+  m_head = 0;
+
+  uint32_t i = LowestBit (m_occupied);
+  Bucket &bucket = m_buckets[i];
+  NS_ASSERT (!bucket.empty ());
+  uint64_t min = bucket[0].key.m_ts;
+  for (Bucket::const_iterator it = bucket.begin () + 1; it != bucket.end (); ++it)
+    {
+      min = std::min (min, it->key.m_ts);
+    }
+  NS_LOG_DEBUG ("advance from " << m_last << " to " << min << ", redistributing " << bucket.size () << " events of bucket " << i);
+  m_last = min;
+  // All the events of bucket i share bits i and above with the new
+  // reference, so they move to strictly lower buckets.
+  for (Bucket::const_iterator it = bucket.begin (); it != bucket.end (); ++it)
+    {
+      uint32_t j = GetBucket (it->key.m_ts);
+      NS_ASSERT (j < i);
+      m_buckets[j].push_back (*it);
+      if (j > 0)
+        {
+          m_occupied |= uint64_t (1) << (j - 1);
+        }
+    }
+  bucket.clear ();
+  m_occupied &= ~(uint64_t (1) << (i - 1));
+  if (!std::is_sorted (first.begin (), first.end ()))
+    {
+      std::sort (first.begin (), first.end ());
+    }
+}
+
+void
+RadixHeapScheduler::Rebuild (uint64_t ts)
+{
+  NS_LOG_FUNCTION (this << ts);
+  Bucket events;
+  events.reserve (m_size);
+  events.insert (events.end (), m_buckets[0].begin () + m_head, m_buckets[0].end ());
+  for (uint32_t i = 0; i < N_BUCKETS; i++)
+    {
+      if (i > 0)
+        {
+          events.insert (events.end (), m_buckets[i].begin (), m_buckets[i].end ());
+        }
+      m_buckets[i].clear ();
+    }
+  m_head = 0;
+  m_occupied = 0;
+  m_last = ts;
+  for (Bucket::const_iterator it = events.begin (); it != events.end (); ++it)
+    {
+      Push (*it);
+    }
+  std::sort (m_buckets[0].begin (), m_buckets[0].end ());
+}
+
+void
+RadixHeapScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  if (ev.key.m_ts < m_last)
+    {
+      // Only after PeekNext advanced the reference past a later event.
+      Rebuild (ev.key.m_ts);
+    }
+  Push (ev);
+  m_size++;
+}
+
+bool
+RadixHeapScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_size == 0;
+}
+
+Scheduler::Event
+RadixHeapScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Refill ();
+  return m_buckets[0][m_head];
+}
+
+Scheduler::Event
+RadixHeapScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Refill ();
+  Bucket &first = m_buckets[0];
+  Event next = first[m_head];
+  m_head++;
+  if (m_head == first.size ())
+    {
+      first.clear ();
+      m_head = 0;
+    }
+  m_size--;
+  return next;
+}
+
+void
+RadixHeapScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  NS_ASSERT (ev.key.m_ts >= m_last);
+  uint32_t i = GetBucket (ev.key.m_ts);
+  Bucket &bucket = m_buckets[i];
+  Bucket::iterator begin = (i == 0) ? bucket.begin () + m_head : bucket.begin ();
+  for (Bucket::iterator it = begin; it != bucket.end (); ++it)
+    {
+      if (it->key.m_uid == ev.key.m_uid)
+        {
+          NS_ASSERT (it->impl == ev.impl);
+          if (i == 0)
+            {
+              bucket.erase (it);
+              if (m_head == bucket.size ())
+                {
+                  bucket.clear ();
+                  m_head = 0;
+                }
+            }
+          else
+            {
+              *it = bucket.back ();
+              bucket.pop_back ();
+              if (bucket.empty ())
+                {
+                  m_occupied &= ~(uint64_t (1) << (i - 1));
+                }
+            }
+          m_size--;
+          return;
+        }
+    }
+  NS_ASSERT (false);
+}
+
+} // namespace ns3
@@ -31,9 +31,14 @@
 #include "system-mutex.h"
 #include "boolean.h"
 #include "enum.h"
+#include "string.h"
+#include "uinteger.h"
+#include "trace-source-accessor.h"
 
 
+#include <algorithm>
 #include <cmath>
+#include <fstream>
 
 
 /**
@@ -63,12 +68,44 @@ RealtimeSimulatorImpl::GetTypeId (void)
                    EnumValue (SYNC_BEST_EFFORT),
                    MakeEnumAccessor (&RealtimeSimulatorImpl::SetSynchronizationMode),
                    MakeEnumChecker (SYNC_BEST_EFFORT, "BestEffort",
-                                    SYNC_HARD_LIMIT, "HardLimit"))
+                                    SYNC_HARD_LIMIT, "HardLimit",
+                                    SYNC_ADAPTIVE, "Adaptive"))
     .AddAttribute ("HardLimit",
                    "Maximum acceptable real-time jitter (used in conjunction with SynchronizationMode=HardLimit)",
                    TimeValue (Seconds (0.1)),
                    MakeTimeAccessor (&RealtimeSimulatorImpl::m_hardLimit),
                    MakeTimeChecker ())
+    .AddAttribute ("CatchUpThreshold",
+                   "Lag behind real time above which the simulation starts catching up "
+                   "(used in conjunction with SynchronizationMode=Adaptive)",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&RealtimeSimulatorImpl::m_catchUpThreshold),
+                   MakeTimeChecker ())
+    .AddAttribute ("CatchUpRecovery",
+                   "Lag behind real time below which the simulation has caught up "
+                   "(used in conjunction with SynchronizationMode=Adaptive)",
+                   TimeValue (MilliSeconds (1)),
+                   MakeTimeAccessor (&RealtimeSimulatorImpl::m_catchUpRecovery),
+                   MakeTimeChecker ())
+    .AddAttribute ("LagBinWidth",
+                   "Width of the bins of the lag histogram",
+                   TimeValue (MilliSeconds (1)),
+                   MakeTimeAccessor (&RealtimeSimulatorImpl::m_lagBinWidth),
+                   MakeTimeChecker (NanoSeconds (1)))
+    .AddAttribute ("LagBins",
+                   "Number of bins of the lag histogram; the last one also counts the longer lags",
+                   UintegerValue (1000),
+                   MakeUintegerAccessor (&RealtimeSimulatorImpl::m_lagBins),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("LagHistogramFile",
+                   "File to print the lag histogram to at Simulator::Destroy; none if empty",
+                   StringValue (""),
+                   MakeStringAccessor (&RealtimeSimulatorImpl::m_lagHistogramFile),
+                   MakeStringChecker ())
+    .AddTraceSource ("CatchUp",
+                     "The simulation fell behind real time (true), or caught up (false)",
+                     MakeTraceSourceAccessor (&RealtimeSimulatorImpl::m_catchUpTrace),
+                     "ns3::RealtimeSimulatorImpl::CatchUpCallback")
   ;
   return tid;
 }
@@ -91,6 +128,9 @@ RealtimeSimulatorImpl::RealtimeSimulatorImpl ()
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
   m_eventCount = 0;
+  m_catchingUp = false;
+  m_catchUpCount = 0;
+  m_maxLag = 0;
 
   m_main = SystemThread::Self ();
 
@@ -141,6 +181,19 @@ RealtimeSimulatorImpl::Destroy ()
           ev->Invoke ();
         }
     }
+
+  if (!m_lagHistogramFile.empty ())
+    {
+      std::ofstream file (m_lagHistogramFile.c_str ());
+      if (file.is_open ())
+        {
+          PrintLagHistogram (file);
+        }
+      else
+        {
+          NS_LOG_WARN ("Cannot open " << m_lagHistogramFile);
+        }
+    }
 }
 
 void
@@ -317,6 +370,7 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
   // whatever event is at the head of this list if the list is in time order.
   //
   Scheduler::Event next;
+  bool catchUpChanged = false;
 
   {
     CriticalSection cs (m_mutex);
@@ -381,8 +435,21 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
                             "Hard real-time limit exceeded (jitter = " << tsJitter << ")");
           }
       }
+    else if (m_synchronizationMode == SYNC_ADAPTIVE)
+      {
+        catchUpChanged = UpdateLag (m_synchronizer->GetCurrentRealtime ());
+      }
   }
 
+  //
+  // Tell the models outside the critical section, so that they may schedule
+  // events, before running the event.
+  //
+  if (catchUpChanged)
+    {
+      m_catchUpTrace (m_catchingUp);
+    }
+
   //
   // We have got the event we're about to execute completely disentangled from the
   // event list so we can execute it outside a critical section without fear of someone
@@ -395,6 +462,34 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
   event->Unref ();
 }
 
+bool
+RealtimeSimulatorImpl::UpdateLag (uint64_t tsNow)
+{
+  uint64_t lag = tsNow > m_currentTs ? tsNow - m_currentTs : 0;
+  uint64_t bin = std::min<uint64_t> (lag / m_lagBinWidth.GetTimeStep (), m_lagBins - 1);
+  if (bin >= m_lagHistogram.size ())
+    {
+      m_lagHistogram.resize (bin + 1, 0);
+    }
+  m_lagHistogram[bin]++;
+  m_maxLag = std::max (m_maxLag, lag);
+
+  if (!m_catchingUp && lag > static_cast<uint64_t> (m_catchUpThreshold.GetTimeStep ()))
+    {
+      NS_LOG_LOGIC ("Catching up, lag " << lag);
+      m_catchingUp = true;
+      m_catchUpCount++;
+      return true;
+    }
+  if (m_catchingUp && lag < static_cast<uint64_t> (m_catchUpRecovery.GetTimeStep ()))
+    {
+      NS_LOG_LOGIC ("Caught up, lag " << lag);
+      m_catchingUp = false;
+      return true;
+    }
+  return false;
+}
+
 bool
 RealtimeSimulatorImpl::IsFinished (void) const
 {
@@ -853,4 +948,44 @@ RealtimeSimulatorImpl::GetHardLimit (void) const
   return m_hardLimit;
 }
 
+bool
+RealtimeSimulatorImpl::IsCatchingUp (void) const
+{
+  CriticalSection cs (m_mutex);
+  return m_catchingUp;
+}
+
+std::vector<uint64_t>
+RealtimeSimulatorImpl::GetLagHistogram (void) const
+{
+  NS_LOG_FUNCTION (this);
+  CriticalSection cs (m_mutex);
+  return m_lagHistogram;
+}
+
+Time
+RealtimeSimulatorImpl::GetMaxLag (void) const
+{
+  NS_LOG_FUNCTION (this);
+  CriticalSection cs (m_mutex);
+  return TimeStep (m_maxLag);
+}
+
+void
+RealtimeSimulatorImpl::PrintLagHistogram (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this << &os);
+  CriticalSection cs (m_mutex);
+  os << "# lag (s)\tevents" << std::endl;
+  for (uint32_t i = 0; i < m_lagHistogram.size (); i++)
+    {
+      if (m_lagHistogram[i] != 0)
+        {
+          os << (m_lagBinWidth * i).GetSeconds () << "\t" << m_lagHistogram[i] << std::endl;
+        }
+    }
+  os << "# max lag " << TimeStep (m_maxLag).GetSeconds () << " s, fell behind "
+     << m_catchUpCount << " times" << std::endl;
+}
+
 } // namespace ns3
@@ -30,8 +30,13 @@
 #include "assert.h"
 #include "log.h"
 #include "system-mutex.h"
+#include "traced-callback.h"
+#include "nstime.h"
 
 #include <list>
+#include <ostream>
+#include <string>
+#include <vector>
 
 /**
  * \file
@@ -82,8 +87,27 @@ public:
      * \see SetHardLimit
      */
     SYNC_HARD_LIMIT,
+    /**
+     * Make a best effort to keep synced to real-time, and measure how far
+     * behind the simulation is.
+     *
+     * The CatchUp trace source reports when the lag exceeds the
+     * CatchUpThreshold, so that models can switch to cheaper
+     * abstractions, and when it falls back below CatchUpRecovery.
+     * The lags are recorded in a histogram.
+     * \see GetLagHistogram
+     */
+    SYNC_ADAPTIVE,
   };
 
+  /**
+   * TracedCallback signature for the changes of the catch-up state.
+   *
+   * \param [in] catchingUp \c true when the simulation falls behind
+   *     real time, \c false when it has caught up.
+   */
+  typedef void (* CatchUpCallback)(bool catchingUp);
+
   /** Constructor. */
   RealtimeSimulatorImpl ();
   /** Destructor. */
@@ -156,6 +180,34 @@ public:
    */
   Time GetHardLimit (void) const;
 
+  /**
+   * Is the simulation catching up with real time?
+   *
+   * Only SynchronizationMode SYNC_ADAPTIVE measures the lag.
+   * \returns \c true from the time the lag exceeds CatchUpThreshold
+   *     until it falls back below CatchUpRecovery.
+   */
+  bool IsCatchingUp (void) const;
+  /**
+   * Get the histogram of the lag behind real time at the start of the
+   * events, in SynchronizationMode SYNC_ADAPTIVE.
+   *
+   * \returns The number of events in each bin of LagBinWidth; the last
+   *     bin also counts the longer lags.
+   */
+  std::vector<uint64_t> GetLagHistogram (void) const;
+  /**
+   * Get the longest lag behind real time at the start of an event.
+   * \returns The longest lag.
+   */
+  Time GetMaxLag (void) const;
+  /**
+   * Print the lag histogram, the longest lag and the number of times the
+   * simulation fell behind.
+   * \param [in] os The output stream.
+   */
+  void PrintLagHistogram (std::ostream &os) const;
+
 private:
   /**
    * Is the simulator running?
@@ -174,6 +226,13 @@ private:
   uint64_t NextTs (void) const;
   /** Process the next event. */
   void ProcessOneEvent (void);
+  /**
+   * Record the lag of the current event and update the catch-up state.
+   * Should be called with critical section locked.
+   * \param [in] tsNow The current real time.
+   * \returns \c true if the catch-up state changed.
+   */
+  bool UpdateLag (uint64_t tsNow);
   /** Destructor implementation. */
   virtual void DoDispose (void);
 
@@ -220,6 +279,27 @@ private:
   /** The maximum allowable drift from real-time in SYNC_HARD_LIMIT mode. */
   Time m_hardLimit;
 
+  /** The lag above which SYNC_ADAPTIVE mode starts catching up. */
+  Time m_catchUpThreshold;
+  /** The lag below which SYNC_ADAPTIVE mode has caught up. */
+  Time m_catchUpRecovery;
+  /** The width of the bins of the lag histogram. */
+  Time m_lagBinWidth;
+  /** The number of bins of the lag histogram. */
+  uint32_t m_lagBins;
+  /** The file of the lag histogram, printed at Destroy if not empty. */
+  std::string m_lagHistogramFile;
+  /** Is the simulation catching up? */
+  bool m_catchingUp;
+  /** The number of times the simulation fell behind. */
+  uint64_t m_catchUpCount;
+  /** The longest lag, in timesteps. */
+  uint64_t m_maxLag;
+  /** The lag histogram. */
+  std::vector<uint64_t> m_lagHistogram;
+  /** Trace of the changes of the catch-up state. */
+  TracedCallback<bool> m_catchUpTrace;
+
   /** Main SystemThread. */
   SystemThread::ThreadId m_main;
 };
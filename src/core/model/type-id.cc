@@ -23,6 +23,7 @@
 #include "singleton.h"
 #include "trace-source-accessor.h"
 
+#include <atomic>
 #include <map>
 #include <vector>
 #include <sstream>
@@ -43,6 +44,13 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("TypeId");
 
+/**
+ * \ingroup object
+ * The number of changes to the attributes of all the TypeIds.
+ * \see TypeId::GetAttributeGeneration
+ */
+static std::atomic<uint64_t> g_attributeGeneration (0);
+
 // IidManager needs to be in ns3 namespace for NS_ASSERT and NS_LOG
 // to find g_log
 
@@ -471,6 +479,7 @@ IidManager::SetParent (uint16_t uid, uint16_t parent)
   NS_ASSERT (parent <= m_information.size ());
   struct IidInformation *information = LookupInformation (uid);
   information->parent = parent;
+  g_attributeGeneration++;
 }
 void
 IidManager::SetGroupName (uint16_t uid, std::string groupName)
@@ -681,6 +690,7 @@ IidManager::AddAttribute (uint16_t uid,
   info.supportLevel = supportLevel;
   info.supportMsg = supportMsg;
   information->attributes.push_back (info);
+  g_attributeGeneration++;
   NS_LOG_LOGIC (IIDL << information->attributes.size () - 1);
 }
 void
@@ -692,6 +702,7 @@ IidManager::SetAttributeInitialValue (uint16_t uid,
   struct IidInformation *information = LookupInformation (uid);
   NS_ASSERT (i < information->attributes.size ());
   information->attributes[i].initialValue = initialValue;
+  g_attributeGeneration++;
 }
 
 
@@ -826,6 +837,12 @@ TypeId::TypeId (uint16_t tid)
 {
   NS_LOG_FUNCTION (this << tid);
 }
+
+uint64_t
+TypeId::GetAttributeGeneration (void)
+{
+  return g_attributeGeneration.load (std::memory_order_acquire);
+}
 TypeId
 TypeId::LookupByName (std::string name)
 {
@@ -167,6 +167,16 @@ public:
    * \returns The TypeId instance whose index is \c i.
    */
   static TypeId GetRegistered (uint16_t i);
+  /**
+   * Get the number of changes to the attributes of all the TypeIds.
+   *
+   * The number increases whenever an attribute is added, its initial
+   * value is changed, or a parent is set, so that the users of the
+   * attribute information can cache it.
+   *
+   * \returns The current generation of the attributes.
+   */
+  static uint64_t GetAttributeGeneration (void);
 
   /**
    * Constructor.
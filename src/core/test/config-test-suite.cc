@@ -840,6 +840,121 @@ SearchAttributesOfParentObjectsTestCase::DoRun (void)
 
 }
 
+/**
+ * \ingroup config-tests
+ * Check that a CompiledPath sets and connects the objects matching its
+ * path, and follows the changes of the object graph.
+ */
+class CompiledPathConfigTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  CompiledPathConfigTestCase ();
+  /** Destructor. */
+  virtual ~CompiledPathConfigTestCase ()
+  {}
+
+  /**
+   * Trace callback with context path.
+   * \param path The context path.
+   * \param old The old value.
+   * \param newValue The new value.
+   */
+  void TraceWithPath (std::string path, int16_t old, int16_t newValue)
+  {
+    NS_UNUSED (old);
+    m_newValue = newValue;
+    m_path = path;
+  }
+
+private:
+  virtual void DoRun (void);
+
+  int16_t m_newValue; //!< Flag to detect tracing result.
+  std::string m_path; //!< The context path.
+};
+
+CompiledPathConfigTestCase::CompiledPathConfigTestCase ()
+  : TestCase ("Check that compiled paths are resolved again when the object graph changes")
+{}
+
+void
+CompiledPathConfigTestCase::DoRun (void)
+{
+  IntegerValue iv;
+
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Names::Add ("CompiledPathRoot", root);
+  Ptr<ConfigTestObject> a = CreateObject<ConfigTestObject> ();
+  root->AddNodeA (a);
+
+  Config::CompiledPath nodes ("/Names/CompiledPathRoot/NodesA/*");
+  NS_TEST_ASSERT_MSG_EQ (nodes.GetMatches ().GetN (), 1, "Unexpected number of matches");
+  nodes.Set ("A", IntegerValue (1));
+  a->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 1, "Object Attribute \"A\" not set through the compiled path");
+
+  //
+  // Creating an object does not invalidate the cached matches, and an
+  // object attached through a plain setter is only seen after an explicit
+  // invalidation: the cached matches are used until then.
+  //
+  Ptr<ConfigTestObject> b = CreateObject<ConfigTestObject> ();
+  Ptr<ConfigTestObject> c = CreateObject<ConfigTestObject> ();
+  root->AddNodeA (b);
+  root->AddNodeA (c);
+  NS_TEST_ASSERT_MSG_EQ (nodes.GetMatches ().GetN (), 1, "Unexpected number of matches");
+  nodes.Set ("A", IntegerValue (3));
+  c->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 10, "Object Attribute \"A\" unexpectedly set");
+  Config::InvalidateCompiledPaths ();
+  nodes.Set ("A", IntegerValue (4));
+  NS_TEST_ASSERT_MSG_EQ (nodes.GetMatches ().GetN (), 3, "Unexpected number of matches");
+  b->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 4, "Object Attribute \"A\" not set after invalidation");
+  c->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 4, "Object Attribute \"A\" not set after invalidation");
+  NS_TEST_ASSERT_MSG_EQ (nodes.GetMatches ().GetMatchedPath (2), "/Names/CompiledPathRoot/NodesA/2/",
+                         "Unexpected matched path");
+
+  //
+  // Trace sources are connected with the matched path as context.
+  //
+  nodes.Connect ("Source", MakeCallback (&CompiledPathConfigTestCase::TraceWithPath, this));
+  m_newValue = 0;
+  b->SetAttribute ("Source", IntegerValue (-2));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, -2, "Trace did not fire as expected");
+  NS_TEST_ASSERT_MSG_EQ (m_path, "/Names/CompiledPathRoot/NodesA/1/Source", "Trace did not provide expected context");
+  nodes.Disconnect ("Source", MakeCallback (&CompiledPathConfigTestCase::TraceWithPath, this));
+  m_newValue = 0;
+  b->SetAttribute ("Source", IntegerValue (-3));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, 0, "Trace fired after Disconnect");
+
+  //
+  // Setting a pointer attribute and aggregating an object invalidate the
+  // cached matches.
+  //
+  Config::CompiledPath derived ("/Names/CompiledPathRoot/NodeB/$DerivedConfigObject");
+  NS_TEST_ASSERT_MSG_EQ (derived.GetMatches ().GetN (), 0, "Unexpected number of matches");
+  root->SetAttribute ("NodeB", PointerValue (a));
+  NS_TEST_ASSERT_MSG_EQ (derived.GetMatches ().GetN (), 0, "Unexpected number of matches");
+  Ptr<DerivedConfigObject> x = CreateObject<DerivedConfigObject> ();
+  NS_TEST_ASSERT_MSG_EQ (derived.GetMatches ().GetN (), 0, "Unexpected number of matches");
+  a->AggregateObject (x);
+  derived.Set ("X", IntegerValue (42));
+  x->GetAttribute ("X", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 42, "Object Attribute \"X\" not set on an aggregated object");
+
+  //
+  // The matches are the same as those of Config::LookupMatches.
+  //
+  Config::MatchContainer matches = Config::LookupMatches ("/Names/CompiledPathRoot/NodesA/[1-2]");
+  Config::CompiledPath range ("/Names/CompiledPathRoot/NodesA/[1-2]");
+  NS_TEST_ASSERT_MSG_EQ (range.GetMatches ().GetN (), matches.GetN (), "Unexpected number of matches");
+  NS_TEST_ASSERT_MSG_EQ (range.GetMatches ().Get (0), b, "Unexpected match");
+  NS_TEST_ASSERT_MSG_EQ (range.GetMatches ().Get (1), c, "Unexpected match");
+}
+
 /**
  * \ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -858,6 +973,7 @@ ConfigTestSuite::ConfigTestSuite ()
   AddTestCase (new UnderRootNamespaceConfigTestCase);
   AddTestCase (new ObjectVectorConfigTestCase);
   AddTestCase (new SearchAttributesOfParentObjectsTestCase);
+  AddTestCase (new CompiledPathConfigTestCase);
 }
 
 /**
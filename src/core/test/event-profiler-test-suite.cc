@@ -0,0 +1,273 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/event-profiler.h"
+#include "ns3/make-event.h"
+#include "ns3/simulator.h"
+#include "ns3/config.h"
+#include "ns3/boolean.h"
+#include "ns3/string.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * \ingroup simulator
+ * \ingroup event-profiler-tests
+ * EventProfiler test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup event-profiler-tests EventProfiler test suite
+ */
+
+namespace ns3 {
+
+namespace tests {
+
+
+/**
+ * \ingroup event-profiler-tests
+ * A base class with a virtual event handler.
+ */
+class EventProfilerBase
+{
+public:
+  /** Constructor. */
+  EventProfilerBase () : m_base (0) {}
+  /** Destructor. */
+  virtual ~EventProfilerBase () {}
+  /** A virtual event handler. */
+  virtual void ProfiledVirtual (void)
+  {
+    m_base++;
+  }
+  int m_base; //!< Number of calls to the base handler.
+};
+
+/**
+ * \ingroup event-profiler-tests
+ * A derived class which overrides the virtual event handler.
+ */
+class EventProfilerDerived : public EventProfilerBase
+{
+public:
+  /** Constructor. */
+  EventProfilerDerived () : m_derived (0), m_method (0) {}
+  virtual void ProfiledVirtual (void)
+  {
+    m_derived++;
+  }
+  /**
+   * A non-virtual event handler.
+   * \param [in] n The increment.
+   */
+  void ProfiledMethod (int n)
+  {
+    m_method += n;
+  }
+  int m_derived; //!< Number of calls to the derived handler.
+  int m_method;  //!< Sum of the increments of ProfiledMethod.
+};
+
+/** Number of calls to EventProfilerFunction. */
+int g_eventProfilerCalls = 0;
+
+/** A free event handler. */
+void
+EventProfilerFunction (void)
+{
+  g_eventProfilerCalls++;
+}
+
+/**
+ * \ingroup event-profiler-tests
+ * Check that the profiler attributes the events to their functions.
+ */
+class EventProfilerTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  EventProfilerTestCase ();
+  virtual void DoRun (void);
+};
+
+EventProfilerTestCase::EventProfilerTestCase ()
+  : TestCase ("Attribute events to their functions")
+{}
+
+void
+EventProfilerTestCase::DoRun (void)
+{
+  EventProfiler profiler;
+  EventProfilerDerived derived;
+  EventProfilerBase *base = &derived;
+  g_eventProfilerCalls = 0;
+
+  for (int i = 0; i < 10; i++)
+    {
+      EventImpl *event = MakeEvent (&EventProfilerDerived::ProfiledMethod, &derived, 2);
+      profiler.Invoke (event);
+      event->Unref ();
+    }
+  for (int i = 0; i < 5; i++)
+    {
+      EventImpl *event = MakeEvent (&EventProfilerBase::ProfiledVirtual, base);
+      profiler.Invoke (event);
+      event->Unref ();
+    }
+  for (int i = 0; i < 3; i++)
+    {
+      EventImpl *event = MakeEvent (&EventProfilerFunction);
+      profiler.Invoke (event);
+      event->Unref ();
+    }
+  EventImpl *cancelled = MakeEvent (&EventProfilerFunction);
+  cancelled->Cancel ();
+  profiler.Invoke (cancelled);
+  cancelled->Unref ();
+
+  NS_TEST_ASSERT_MSG_EQ (derived.m_method, 20, "Events not run");
+  NS_TEST_ASSERT_MSG_EQ (derived.m_derived, 5, "Virtual events not dispatched");
+  NS_TEST_ASSERT_MSG_EQ (derived.m_base, 0, "Virtual events not dispatched");
+  NS_TEST_ASSERT_MSG_EQ (g_eventProfilerCalls, 3, "Cancelled event run");
+  NS_TEST_ASSERT_MSG_EQ (profiler.GetEventCount (), 18, "Wrong number of events");
+
+  std::vector<EventProfiler::Record> records = profiler.GetRecords ();
+  NS_TEST_ASSERT_MSG_EQ (records.size (), 3, "Each function must have its record");
+  uint64_t counts[3] = {0, 0, 0};
+  for (std::vector<EventProfiler::Record>::const_iterator i = records.begin (); i != records.end (); ++i)
+    {
+      if (i != records.begin ())
+        {
+          NS_TEST_EXPECT_MSG_EQ ((i->nanoseconds <= (i - 1)->nanoseconds), true, "Records not sorted");
+        }
+      if (i->count == 10)
+        {
+          counts[0]++;
+        }
+      else if (i->count == 5)
+        {
+          counts[1]++;
+        }
+      else if (i->count == 3)
+        {
+          counts[2]++;
+        }
+#if defined (__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+      // The names come from the symbol table.
+      std::string expected = i->count == 10 ? "EventProfilerDerived::ProfiledMethod"
+        : i->count == 5 ? "EventProfilerDerived::ProfiledVirtual" : "EventProfilerFunction";
+      NS_TEST_EXPECT_MSG_NE (i->name.find (expected), std::string::npos,
+                             "Wrong name " << i->name << ", expected " << expected);
+#endif
+    }
+  NS_TEST_EXPECT_MSG_EQ (counts[0], 1, "Wrong count of the method events");
+  NS_TEST_EXPECT_MSG_EQ (counts[1], 1, "Wrong count of the virtual method events");
+  NS_TEST_EXPECT_MSG_EQ (counts[2], 1, "Wrong count of the function events");
+
+  std::ostringstream folded;
+  profiler.PrintFolded (folded);
+  std::istringstream lines (folded.str ());
+  std::string line;
+  int n = 0;
+  while (std::getline (lines, line))
+    {
+      NS_TEST_EXPECT_MSG_NE (line.rfind (' '), std::string::npos, "Wrong folded line " << line);
+      n++;
+    }
+  NS_TEST_EXPECT_MSG_EQ (n, 3, "Wrong number of folded lines");
+}
+
+/**
+ * \ingroup event-profiler-tests
+ * Check that the simulator prints the profile at Simulator::Destroy.
+ */
+class EventProfilerSimulatorTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  EventProfilerSimulatorTestCase ();
+  virtual void DoRun (void);
+};
+
+EventProfilerSimulatorTestCase::EventProfilerSimulatorTestCase ()
+  : TestCase ("Print the event profile at Simulator::Destroy")
+{}
+
+void
+EventProfilerSimulatorTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("event-profile.txt");
+  Simulator::Destroy ();
+  Config::SetDefault ("ns3::DefaultSimulatorImpl::EventProfile", BooleanValue (true));
+  Config::SetDefault ("ns3::DefaultSimulatorImpl::EventProfileFile", StringValue (filename));
+  g_eventProfilerCalls = 0;
+  for (int i = 0; i < 7; i++)
+    {
+      Simulator::Schedule (Seconds (i), &EventProfilerFunction);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  Config::SetDefault ("ns3::DefaultSimulatorImpl::EventProfile", BooleanValue (false));
+  Config::SetDefault ("ns3::DefaultSimulatorImpl::EventProfileFile", StringValue (""));
+  NS_TEST_ASSERT_MSG_EQ (g_eventProfilerCalls, 7, "Events not run");
+
+  std::ifstream in (filename.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (in.is_open (), true, "No event profile in " << filename);
+  std::ostringstream report;
+  report << in.rdbuf ();
+  NS_TEST_EXPECT_MSG_NE (report.str ().find ("7 events"), std::string::npos,
+                         "Wrong event profile " << report.str ());
+  in.close ();
+  remove (filename.c_str ());
+}
+
+
+/**
+ * \ingroup event-profiler-tests
+ * EventProfiler test suite.
+ */
+class EventProfilerTestSuite : public TestSuite
+{
+public:
+  /** Constructor. */
+  EventProfilerTestSuite ();
+};
+
+EventProfilerTestSuite::EventProfilerTestSuite ()
+  : TestSuite ("event-profiler")
+{
+  AddTestCase (new EventProfilerTestCase ());
+  AddTestCase (new EventProfilerSimulatorTestCase ());
+}
+
+
+/**
+ * \ingroup event-profiler-tests
+ * EventProfilerTestSuite instance variable.
+ */
+static EventProfilerTestSuite g_eventProfilerTestSuite;
+
+
+}  // namespace tests
+
+}  // namespace ns3
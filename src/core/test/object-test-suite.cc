@@ -22,6 +22,8 @@
 #include "ns3/object.h"
 #include "ns3/object-factory.h"
 #include "ns3/assert.h"
+#include "ns3/config.h"
+#include "ns3/uinteger.h"
 
 /**
  * \file
@@ -151,10 +153,74 @@ protected:
   }
 };
 
+/**
+ * \ingroup object-tests
+ * Base class C, with an attribute.
+ */
+class BaseC : public ns3::Object
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static ns3::TypeId GetTypeId (void)
+  {
+    static ns3::TypeId tid = ns3::TypeId ("ObjectTest:BaseC")
+      .SetParent<Object> ()
+      .SetGroupName ("Core")
+      .HideFromDocumentation ()
+      .AddConstructor<BaseC> ()
+      .AddAttribute ("Base", "help text",
+                     ns3::UintegerValue (1),
+                     ns3::MakeUintegerAccessor (&BaseC::m_base),
+                     ns3::MakeUintegerChecker<uint32_t> ());
+    return tid;
+  }
+  /** Constructor. */
+  BaseC ()
+    : m_base (0)
+  {}
+  uint32_t m_base; //!< The attribute of the base class.
+};
+
+/**
+ * \ingroup object-tests
+ * Derived class C, with another attribute.
+ */
+class DerivedC : public BaseC
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static ns3::TypeId GetTypeId (void)
+  {
+    static ns3::TypeId tid = ns3::TypeId ("ObjectTest:DerivedC")
+      .SetParent<BaseC> ()
+      .SetGroupName ("Core")
+      .HideFromDocumentation ()
+      .AddConstructor<DerivedC> ()
+      .AddAttribute ("Derived", "help text",
+                     ns3::UintegerValue (2),
+                     ns3::MakeUintegerAccessor (&DerivedC::m_derived),
+                     ns3::MakeUintegerChecker<uint32_t> ());
+    return tid;
+  }
+  /** Constructor. */
+  DerivedC ()
+    : m_derived (0)
+  {}
+  uint32_t m_derived; //!< The attribute of the derived class.
+};
+
 NS_OBJECT_ENSURE_REGISTERED (BaseA);
 NS_OBJECT_ENSURE_REGISTERED (DerivedA);
 NS_OBJECT_ENSURE_REGISTERED (BaseB);
 NS_OBJECT_ENSURE_REGISTERED (DerivedB);
+NS_OBJECT_ENSURE_REGISTERED (BaseC);
+NS_OBJECT_ENSURE_REGISTERED (DerivedC);
 
 }  // unnamed namespace
 
@@ -475,6 +541,62 @@ ObjectFactoryTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_NE (a->GetObject<DerivedA> (), 0, "Unexpectedly able to work around C++ type system");
 }
 
+/**
+ * \ingroup object-tests
+ * Test an Object factory can create many Objects at once, with
+ * the current attribute defaults.
+ */
+class ObjectFactoryBulkTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  ObjectFactoryBulkTestCase ();
+  /** Destructor. */
+  virtual ~ObjectFactoryBulkTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ObjectFactoryBulkTestCase::ObjectFactoryBulkTestCase ()
+  : TestCase ("Check ObjectFactory bulk creation")
+{}
+
+ObjectFactoryBulkTestCase::~ObjectFactoryBulkTestCase ()
+{}
+
+void
+ObjectFactoryBulkTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (DerivedC::GetTypeId ());
+  factory.Set ("Derived", UintegerValue (7));
+
+  std::vector<Ptr<DerivedC> > objects = factory.Create<DerivedC> (5);
+  NS_TEST_ASSERT_MSG_EQ (objects.size (), 5, "Wrong number of objects");
+  for (uint32_t i = 0; i < objects.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_NE (objects[i], 0, "Unable to factory.Create() a DerivedC");
+      NS_TEST_EXPECT_MSG_EQ (objects[i]->m_base, 1, "Wrong initial value of the base attribute");
+      NS_TEST_EXPECT_MSG_EQ (objects[i]->m_derived, 7, "Wrong value of the factory attribute");
+      for (uint32_t j = 0; j < i; j++)
+        {
+          NS_TEST_EXPECT_MSG_NE (objects[i], objects[j], "Objects not distinct");
+        }
+    }
+
+  //
+  // The attribute defaults are resolved once, but must follow a change of
+  // the defaults.
+  //
+  Config::SetDefault ("ObjectTest:BaseC::Base", UintegerValue (3));
+  objects = factory.Create<DerivedC> (2);
+  NS_TEST_EXPECT_MSG_EQ (objects[1]->m_base, 3, "Changed default ignored");
+  Config::SetDefault ("ObjectTest:BaseC::Base", UintegerValue (1));
+  objects = factory.Create<DerivedC> (1);
+  NS_TEST_EXPECT_MSG_EQ (objects[0]->m_base, 1, "Restored default ignored");
+}
+
 /**
  * \ingroup object-tests
  * The Test Suite that glues the Test Cases together.
@@ -492,6 +614,7 @@ ObjectTestSuite::ObjectTestSuite ()
   AddTestCase (new CreateObjectTestCase);
   AddTestCase (new AggregateObjectTestCase);
   AddTestCase (new ObjectFactoryTestCase);
+  AddTestCase (new ObjectFactoryBulkTestCase);
 }
 
 /**
@@ -0,0 +1,186 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/realtime-simulator-impl.h"
+#include "ns3/config.h"
+#include "ns3/enum.h"
+#include "ns3/nstime.h"
+#include "ns3/string.h"
+
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * \ingroup realtime
+ * \ingroup realtime-simulator-tests
+ * RealtimeSimulatorImpl test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup realtime-simulator-tests RealtimeSimulatorImpl test suite
+ */
+
+namespace ns3 {
+
+namespace tests {
+
+
+/**
+ * \ingroup realtime-simulator-tests
+ * Check that the adaptive synchronization mode reports falling behind
+ * real time, and catching up.
+ */
+class RealtimeCatchUpTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  RealtimeCatchUpTestCase ();
+
+private:
+  virtual void DoSetup (void);
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+  /**
+   * Record a change of the catch-up state.
+   * \param [in] catchingUp The new state.
+   */
+  void CatchUp (bool catchingUp);
+  /**
+   * Keep the processor busy.
+   * \param [in] duration The wall-clock time to spend.
+   */
+  void Busy (Time duration);
+  /** An event which does nothing. */
+  void Idle (void);
+
+  std::vector<bool> m_states; //!< The changes of the catch-up state.
+};
+
+RealtimeCatchUpTestCase::RealtimeCatchUpTestCase ()
+  : TestCase ("Fall behind real time and catch up")
+{}
+
+void
+RealtimeCatchUpTestCase::DoSetup (void)
+{
+  Simulator::Destroy ();
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::RealtimeSimulatorImpl"));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::SynchronizationMode", EnumValue (RealtimeSimulatorImpl::SYNC_ADAPTIVE));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::CatchUpThreshold", TimeValue (MilliSeconds (10)));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::CatchUpRecovery", TimeValue (MilliSeconds (5)));
+}
+
+void
+RealtimeCatchUpTestCase::DoTeardown (void)
+{
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::SynchronizationMode", EnumValue (RealtimeSimulatorImpl::SYNC_BEST_EFFORT));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::CatchUpThreshold", TimeValue (MilliSeconds (10)));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::CatchUpRecovery", TimeValue (MilliSeconds (1)));
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::DefaultSimulatorImpl"));
+}
+
+void
+RealtimeCatchUpTestCase::CatchUp (bool catchingUp)
+{
+  m_states.push_back (catchingUp);
+}
+
+void
+RealtimeCatchUpTestCase::Busy (Time duration)
+{
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now ()
+    + std::chrono::nanoseconds (duration.GetNanoSeconds ());
+  while (std::chrono::steady_clock::now () < end)
+    {
+    }
+}
+
+void
+RealtimeCatchUpTestCase::Idle (void)
+{}
+
+void
+RealtimeCatchUpTestCase::DoRun (void)
+{
+  Ptr<RealtimeSimulatorImpl> impl = DynamicCast<RealtimeSimulatorImpl> (Simulator::GetImplementation ());
+  NS_TEST_ASSERT_MSG_NE (impl, 0, "Not a realtime simulator");
+  impl->TraceConnectWithoutContext ("CatchUp", MakeCallback (&RealtimeCatchUpTestCase::CatchUp, this));
+
+  // 40 ms of work at once, then one event per millisecond: the simulation
+  // falls behind, then runs the late events back to back until on time.
+  Simulator::Schedule (MilliSeconds (1), &RealtimeCatchUpTestCase::Busy, this, MilliSeconds (40));
+  for (int i = 2; i < 120; i++)
+    {
+      Simulator::Schedule (MilliSeconds (i), &RealtimeCatchUpTestCase::Idle, this);
+    }
+  // The realtime simulator waits for external events once its queue is empty.
+  Simulator::Stop (MilliSeconds (130));
+  Simulator::Run ();
+
+  // Only the lag caused by the busy event is certain: on a loaded machine
+  // the simulation may fall behind again, or still be catching up at the end.
+  NS_TEST_ASSERT_MSG_GT_OR_EQ (m_states.size (), 1, "Must fall behind");
+  for (uint32_t i = 0; i < m_states.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_states[i], (i % 2 == 0), "Must alternate between falling behind and catching up");
+    }
+  NS_TEST_EXPECT_MSG_EQ (impl->IsCatchingUp (), m_states.back (), "Wrong final state");
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (impl->GetMaxLag (), MilliSeconds (30), "Wrong longest lag");
+
+  std::vector<uint64_t> histogram = impl->GetLagHistogram ();
+  // 119 events, and the one which stops the simulator
+  NS_TEST_EXPECT_MSG_EQ (std::accumulate (histogram.begin (), histogram.end (), uint64_t (0)), 120,
+                         "Each event must be counted once");
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (histogram.size (), 30, "Late events must be in the histogram");
+
+  Simulator::Destroy ();
+}
+
+
+/**
+ * \ingroup realtime-simulator-tests
+ * RealtimeSimulatorImpl test suite.
+ */
+class RealtimeSimulatorTestSuite : public TestSuite
+{
+public:
+  /** Constructor. */
+  RealtimeSimulatorTestSuite ();
+};
+
+RealtimeSimulatorTestSuite::RealtimeSimulatorTestSuite ()
+  : TestSuite ("realtime-simulator")
+{
+  AddTestCase (new RealtimeCatchUpTestCase ());
+}
+
+
+/**
+ * \ingroup realtime-simulator-tests
+ * RealtimeSimulatorTestSuite instance variable.
+ */
+static RealtimeSimulatorTestSuite g_realtimeSimulatorTestSuite;
+
+
+}  // namespace tests
+
+}  // namespace ns3
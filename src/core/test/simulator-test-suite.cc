@@ -24,6 +24,10 @@
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/radix-heap-scheduler.h"
+#include "ns3/event-impl.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/random-variable-stream.h"
 
 using namespace ns3;
 
@@ -465,6 +469,94 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * Check that a scheduler returns the same sequence of events as the
+ * MapScheduler under a random workload which mixes near-future and
+ * far-future events, removals, and events inserted after PeekNext with a
+ * timestamp earlier than the peeked one (as the realtime simulator does).
+ */
+class SchedulerOrderTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param schedulerFactory the factory of the scheduler under test.
+   */
+  SchedulerOrderTestCase (ObjectFactory schedulerFactory);
+  virtual void DoRun (void);
+  ObjectFactory m_schedulerFactory; //!< Factory of the scheduler under test
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check the event order of " + schedulerFactory.GetTypeId ().GetName ()),
+    m_schedulerFactory (schedulerFactory)
+{}
+
+void
+SchedulerOrderTestCase::DoRun (void)
+{
+  Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+  Ptr<Scheduler> reference = CreateObject<MapScheduler> ();
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  rng->SetStream (1);
+  std::vector<Scheduler::Event> pending;
+  uint64_t now = 0;
+  uint32_t uid = 0;
+  for (uint32_t i = 0; i < 20000; i++)
+    {
+      uint32_t action = rng->GetInteger (0, 9);
+      if (action < 5 || reference->IsEmpty ())
+        {
+          Scheduler::Event ev;
+          ev.impl = 0;
+          ev.key.m_uid = uid++;
+          ev.key.m_context = 0;
+          uint64_t delay = (action == 0) ? rng->GetInteger (0, 1000000000) : rng->GetInteger (0, 20);
+          ev.key.m_ts = now + delay;
+          if (action == 1 && !reference->IsEmpty ())
+            {
+              // Peek first, then insert an event earlier than the peeked one
+              Scheduler::Event next = scheduler->PeekNext ();
+              ev.key.m_ts = now + (next.key.m_ts - now) / 2;
+            }
+          scheduler->Insert (ev);
+          reference->Insert (ev);
+          pending.push_back (ev);
+        }
+      else if (action < 9)
+        {
+          Scheduler::Event expected = reference->RemoveNext ();
+          Scheduler::Event actual = scheduler->RemoveNext ();
+          NS_TEST_ASSERT_MSG_EQ (actual.key.m_uid, expected.key.m_uid, "Wrong event order");
+          NS_TEST_ASSERT_MSG_EQ (actual.key.m_ts, expected.key.m_ts, "Wrong event time");
+          now = actual.key.m_ts;
+          for (std::vector<Scheduler::Event>::iterator it = pending.begin (); it != pending.end (); ++it)
+            {
+              if (it->key.m_uid == actual.key.m_uid)
+                {
+                  pending.erase (it);
+                  break;
+                }
+            }
+        }
+      else
+        {
+          uint32_t victim = rng->GetInteger (0, pending.size () - 1);
+          scheduler->Remove (pending[victim]);
+          reference->Remove (pending[victim]);
+          pending.erase (pending.begin () + victim);
+        }
+    }
+  while (!reference->IsEmpty ())
+    {
+      NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), false, "Scheduler lost events");
+      Scheduler::Event expected = reference->RemoveNext ();
+      Scheduler::Event actual = scheduler->RemoveNext ();
+      NS_TEST_ASSERT_MSG_EQ (actual.key.m_uid, expected.key.m_uid, "Wrong event order");
+    }
+  NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), true, "Scheduler has spurious events");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -483,5 +575,8 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (PriorityQueueScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (RadixHeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
@@ -26,12 +26,14 @@
 #include "ns3/config.h"
 #include "ns3/string.h"
 #include "ns3/system-thread.h"
+#include "ns3/mpsc-queue.h"
 
 #include <chrono>  // seconds, milliseconds
 #include <ctime>
 #include <list>
 #include <thread>  // sleep_for
 #include <utility>
+#include <vector>
 
 using namespace ns3;
 
@@ -225,6 +227,85 @@ ThreadedSimulatorEventsTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ (m_a, m_d, "Bad scheduling");
 }
 
+/**
+ * Check that the MpscQueue delivers every value exactly once, in the order
+ * of each producer, while the consumer runs concurrently with the producers.
+ */
+class MpscQueueTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param producers the number of producer threads.
+   */
+  MpscQueueTestCase (unsigned int producers);
+  /**
+   * Push a sequence of values.
+   * \param queue the queue.
+   * \param producer the index of the producer.
+   * \param count the number of values to push.
+   */
+  static void Produce (MpscQueue<std::pair<unsigned int, unsigned int> > *queue,
+                       unsigned int producer, unsigned int count);
+
+private:
+  virtual void DoRun (void);
+  unsigned int m_producers; //!< Number of producer threads
+};
+
+MpscQueueTestCase::MpscQueueTestCase (unsigned int producers)
+  : TestCase ("Check the lock-free queue with " + std::to_string (producers) + " producers"),
+    m_producers (producers)
+{}
+
+void
+MpscQueueTestCase::Produce (MpscQueue<std::pair<unsigned int, unsigned int> > *queue,
+                            unsigned int producer, unsigned int count)
+{
+  for (unsigned int i = 0; i < count; ++i)
+    {
+      queue->Push (std::make_pair (producer, i));
+    }
+}
+
+void
+MpscQueueTestCase::DoRun (void)
+{
+  const unsigned int count = 100000;
+  MpscQueue<std::pair<unsigned int, unsigned int> > queue;
+  NS_TEST_ASSERT_MSG_EQ (queue.IsEmpty (), true, "New queue is not empty");
+
+  std::vector<std::thread> threads;
+  for (unsigned int i = 0; i < m_producers; ++i)
+    {
+      threads.push_back (std::thread (&MpscQueueTestCase::Produce, &queue, i, count));
+    }
+  std::vector<unsigned int> next (m_producers, 0);
+  unsigned int received = 0;
+  std::pair<unsigned int, unsigned int> value;
+  while (received < m_producers * count)
+    {
+      if (!queue.Pop (value))
+        {
+          continue;
+        }
+      // the producers are still running: expect, do not return from DoRun
+      received++;
+      NS_TEST_EXPECT_MSG_LT (value.first, m_producers, "Unknown producer");
+      if (value.first >= m_producers)
+        {
+          continue;
+        }
+      NS_TEST_EXPECT_MSG_EQ (value.second, next[value.first], "Values out of order");
+      next[value.first] = value.second + 1;
+    }
+  for (unsigned int i = 0; i < m_producers; ++i)
+    {
+      threads[i].join ();
+    }
+  NS_TEST_ASSERT_MSG_EQ (queue.IsEmpty (), true, "Spurious values");
+}
+
 class ThreadedSimulatorTestSuite : public TestSuite
 {
 public:
@@ -241,7 +322,8 @@ public:
       "ns3::ListScheduler",
       "ns3::HeapScheduler",
       "ns3::MapScheduler",
-      "ns3::CalendarScheduler"
+      "ns3::CalendarScheduler",
+      "ns3::RadixHeapScheduler"
     };
     unsigned int threadcounts[] = {
       0,
@@ -262,5 +344,7 @@ public:
               }
           }
       }
+    AddTestCase (new MpscQueueTestCase (1), TestCase::QUICK);
+    AddTestCase (new MpscQueueTestCase (4), TestCase::QUICK);
   }
 } g_threadedSimulatorTestSuite;
@@ -67,6 +67,7 @@ BasicTracedCallbackTestCase::DoRun (void)
   // these methods do is to set corresponding member variables m_one and m_two.
   //
   TracedCallback<uint8_t, double> trace;
+  NS_TEST_ASSERT_MSG_EQ (trace.IsEmpty (), true, "New trace unexpectedly has callbacks");
 
   //
   // Connect both callbacks to their respective test methods.  If we hit the
@@ -90,6 +91,7 @@ BasicTracedCallbackTestCase::DoRun (void)
   trace (1, 2);
   NS_TEST_ASSERT_MSG_EQ (m_one, false, "Callback CbOne unexpectedly called");
   NS_TEST_ASSERT_MSG_EQ (m_two, true, "Callback CbTwo not called");
+  NS_TEST_ASSERT_MSG_EQ (trace.IsEmpty (), false, "Trace with one callback reported empty");
 
   //
   // If we now disconnect callback two then neither callback should be called.
@@ -100,6 +102,7 @@ BasicTracedCallbackTestCase::DoRun (void)
   trace (1, 2);
   NS_TEST_ASSERT_MSG_EQ (m_one, false, "Callback CbOne unexpectedly called");
   NS_TEST_ASSERT_MSG_EQ (m_two, false, "Callback CbTwo unexpectedly called");
+  NS_TEST_ASSERT_MSG_EQ (trace.IsEmpty (), true, "Trace with no callbacks reported non-empty");
 
   //
   // If we connect them back up, then both callbacks should be called.
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2015-2020 IMDEA Networks Institute
+ * Author: Hany Assasa <hany.assasa@gmail.com>
+ 2021 ns-3
+ */
+#include "ns3/applications-module.h"
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/dmg-room-partition.h"
+#include <string>
+
+/**
+ * Simulation Objective:
+ * Simulate two neighbouring rooms, each one with its own DMG channel, where the only coupling
+ * between the rooms is the energy leaking through an opening in the separating wall.
+ *
+ * Network Topology:
+ * Each room contains two DMG AdHoc STAs. The rooms share the wall x = 5 m, which has an
+ * opening centered at (5, 2, 1).
+ *
+ *          Room [0]                      |                      Room [1]
+ *   DMG STA [1] (1,2)  DMG STA [2] (4,2)   opening   DMG STA [3] (6,2)  DMG STA [4] (9,2)
+ *
+ * Simulation Description:
+ * In each room, the second STA generates a UDP traffic towards the first one. With MPI each
+ * room runs in its own logical process and the leakage is exchanged between the processes.
+ *
+ * Running Simulation:
+ * ./waf --run "dmg-room-partition-example"
+ *
+ * To run each room in its own logical process (requires ./waf configure --enable-mpi):
+ * mpirun -np 2 ./waf --run "dmg-room-partition-example --distributed=1"
+ *
+ * Simulation Output:
+ * The throughput achieved in each room.
+ */
+
+NS_LOG_COMPONENT_DEFINE ("DmgRoomPartitionExample");
+
+using namespace ns3;
+using namespace std;
+
+/**
+ * Populate the ARP Cache for all the nodes in the network.
+ */
+void
+PopulateArpCache (void)
+{
+  Ptr<ArpCache> arp = CreateObject<ArpCache> ();
+  arp->SetAliveTimeout (Seconds (3600 * 24 * 365));
+
+  for (NodeList::Iterator i = NodeList::Begin (); i != NodeList::End (); ++i)
+    {
+      Ptr<Ipv4L3Protocol> ip = (*i)->GetObject<Ipv4L3Protocol> ();
+      NS_ASSERT (ip != 0);
+      ObjectVectorValue interfaces;
+      ip->GetAttribute ("InterfaceList", interfaces);
+      for (ObjectVectorValue::Iterator j = interfaces.Begin (); j != interfaces.End (); j++)
+        {
+          Ptr<Ipv4Interface> ipIface = (j->second)->GetObject<Ipv4Interface> ();
+          NS_ASSERT (ipIface != 0);
+          Ptr<NetDevice> device = ipIface->GetDevice ();
+          NS_ASSERT (device != 0);
+          Mac48Address addr = Mac48Address::ConvertFrom (device->GetAddress ());
+          for (uint32_t k = 0; k < ipIface->GetNAddresses (); k++)
+            {
+              Ipv4Address ipAddr = ipIface->GetAddress (k).GetLocal ();
+              if (ipAddr == Ipv4Address::GetLoopback ())
+                {
+                  continue;
+                }
+              ArpCache::Entry *entry = arp->Add (ipAddr);
+              entry->MarkWaitReply (0);
+              entry->MarkAlive (addr);
+            }
+        }
+    }
+
+  for (NodeList::Iterator i = NodeList::Begin (); i != NodeList::End (); ++i)
+    {
+      Ptr<Ipv4L3Protocol> ip = (*i)->GetObject<Ipv4L3Protocol> ();
+      NS_ASSERT (ip != 0);
+      ObjectVectorValue interfaces;
+      ip->GetAttribute ("InterfaceList", interfaces);
+      for (ObjectVectorValue::Iterator j = interfaces.Begin (); j != interfaces.End (); j++)
+        {
+          Ptr<Ipv4Interface> ipIface = (j->second)->GetObject<Ipv4Interface> ();
+          ipIface->SetAttribute ("ArpCache", PointerValue (arp));
+        }
+    }
+}
+
+void
+SetAntennaConfigurations (NetDeviceContainer devices)
+{
+  Ptr<WifiNetDevice> rxWifiNetDevice = DynamicCast<WifiNetDevice> (devices.Get (0));
+  Ptr<WifiNetDevice> txWifiNetDevice = DynamicCast<WifiNetDevice> (devices.Get (1));
+  Ptr<DmgAdhocWifiMac> rxWifiMac = DynamicCast<DmgAdhocWifiMac> (rxWifiNetDevice->GetMac ());
+  Ptr<DmgAdhocWifiMac> txWifiMac = DynamicCast<DmgAdhocWifiMac> (txWifiNetDevice->GetMac ());
+  rxWifiMac->AddAntennaConfig (1, 1, txWifiMac->GetAddress ());
+  txWifiMac->AddAntennaConfig (5, 1, rxWifiMac->GetAddress ());
+  rxWifiMac->SteerAntennaToward (txWifiMac->GetAddress ());
+  txWifiMac->SteerAntennaToward (rxWifiMac->GetAddress ());
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t payloadSize = 1472;                  /* Application payload size in bytes. */
+  string dataRate = "1Gbps";                    /* Application data rate in each room. */
+  double openingLoss = 3.0;                     /* Additional loss when crossing the opening in dB. */
+  double simulationTime = 1;                    /* Simulation time in seconds. */
+  bool distributed = false;                     /* Flag to indicate if each room runs in its own logical process. */
+
+  /* Command line argument parser setup. */
+  CommandLine cmd;
+  cmd.AddValue ("payloadSize", "Application payload size in bytes", payloadSize);
+  cmd.AddValue ("dataRate", "Application data rate in each room", dataRate);
+  cmd.AddValue ("openingLoss", "Additional loss when crossing the opening in dB", openingLoss);
+  cmd.AddValue ("simulationTime", "Simulation time in seconds", simulationTime);
+  cmd.AddValue ("distributed", "Run each room in its own MPI logical process", distributed);
+  cmd.Parse (argc, argv);
+
+  uint32_t systemCount = 1;
+  if (distributed)
+    {
+      GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::DistributedSimulatorImpl"));
+      MpiInterface::Enable (&argc, &argv);
+      systemCount = MpiInterface::GetSize ();
+    }
+  uint32_t systemId = MpiInterface::GetSystemId ();
+
+  DmgWifiHelper wifi;
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "DataMode", StringValue ("DMG_MCS12"));
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac");
+
+  Ptr<FriisPropagationLossModel> leakageLoss = CreateObject<FriisPropagationLossModel> ();
+  leakageLoss->SetFrequency (60.48e9);
+
+  NodeContainer roomNodes[2];
+  NetDeviceContainer roomDevices[2];
+  Ptr<DmgRoomPartition> partitions[2];
+  InternetStackHelper stack;
+  Ipv4AddressHelper address;
+  for (uint32_t room = 0; room < 2; room++)
+    {
+      /* Each room has its own channel, the rooms are only coupled through the opening */
+      DmgWifiChannelHelper wifiChannel;
+      wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+      wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+      Ptr<DmgWifiChannel> channel = wifiChannel.Create ();
+
+      DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+      wifiPhy.SetChannel (channel);
+      wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+      wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+      wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+
+      roomNodes[room].Create (2, room % systemCount);
+      roomDevices[room] = wifi.Install (wifiPhy, wifiMac, roomNodes[room]);
+      Simulator::ScheduleNow (&SetAntennaConfigurations, roomDevices[room]);
+
+      MobilityHelper mobility;
+      Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+      positionAlloc->Add (Vector (1.0 + room * 5.0, 2.0, 1.0));
+      positionAlloc->Add (Vector (4.0 + room * 5.0, 2.0, 1.0));
+      mobility.SetPositionAllocator (positionAlloc);
+      mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+      mobility.Install (roomNodes[room]);
+
+      partitions[room] = CreateObject<DmgRoomPartition> ();
+      partitions[room]->SetChannel (channel);
+      partitions[room]->SetPropagationLossModel (leakageLoss);
+      partitions[room]->AddOpening (Vector (5.0, 2.0, 1.0), openingLoss);
+
+      stack.Install (roomNodes[room]);
+      address.SetBase (Ipv4Address (("10.0." + std::to_string (room) + ".0").c_str ()), "255.255.255.0");
+      address.Assign (roomDevices[room]);
+    }
+
+  for (uint32_t room = 0; room < 2; room++)
+    {
+      partitions[room]->AddRemoteDevices (roomDevices[1 - room]);
+      partitions[room]->Install (roomDevices[room]);
+      if (roomNodes[room].Get (0)->GetSystemId () == systemId)
+        {
+          partitions[room]->ApplyLookAhead ();
+        }
+    }
+
+  /* We do not want any ARP packets */
+  PopulateArpCache ();
+
+  Ptr<PacketSink> packetSinks[2];
+  for (uint32_t room = 0; room < 2; room++)
+    {
+      if (roomNodes[room].Get (0)->GetSystemId () != systemId)
+        {
+          continue;
+        }
+      Ipv4Address sinkAddress = roomNodes[room].Get (0)->GetObject<Ipv4> ()->GetAddress (1, 0).GetLocal ();
+      PacketSinkHelper sinkHelper ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), 9999));
+      ApplicationContainer sinkApp = sinkHelper.Install (roomNodes[room].Get (0));
+      packetSinks[room] = StaticCast<PacketSink> (sinkApp.Get (0));
+      sinkApp.Start (Seconds (0.0));
+
+      OnOffHelper src ("ns3::UdpSocketFactory", InetSocketAddress (sinkAddress, 9999));
+      src.SetAttribute ("MaxPackets", UintegerValue (0));
+      src.SetAttribute ("PacketSize", UintegerValue (payloadSize));
+      src.SetAttribute ("OnTime", StringValue ("ns3::ConstantRandomVariable[Constant=1e6]"));
+      src.SetAttribute ("OffTime", StringValue ("ns3::ConstantRandomVariable[Constant=0]"));
+      src.SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+      ApplicationContainer srcApp = src.Install (roomNodes[room].Get (1));
+      srcApp.Start (Seconds (0.0));
+      srcApp.Stop (Seconds (simulationTime));
+    }
+
+  Simulator::Stop (Seconds (simulationTime));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  for (uint32_t room = 0; room < 2; room++)
+    {
+      if (packetSinks[room] != 0)
+        {
+          std::cout << "Room " << room << " throughput = "
+                    << packetSinks[room]->GetTotalRx () * (double) 8 / (simulationTime * 1e6) << " Mbps" << std::endl;
+        }
+    }
+
+  if (distributed)
+    {
+      MpiInterface::Disable ();
+    }
+
+  return 0;
+}
@@ -0,0 +1,284 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/packet.h"
+#include "ns3/node.h"
+#include "ns3/mobility-model.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/mpi-receiver.h"
+#include "ns3/distributed-simulator-impl.h"
+#include "dmg-room-partition.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-ppdu.h"
+#include "ns3/codebook.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgRoomPartition");
+
+NS_OBJECT_ENSURE_REGISTERED (DmgRoomPartition);
+
+/**
+ * Leakage event exchanged between logical processes. All ranks run the same
+ * binary, so the record is sent as-is.
+ */
+struct DmgLeakageRecord
+{
+  double openingX;      //!< X coordinate of the opening
+  double openingY;      //!< Y coordinate of the opening
+  double openingZ;      //!< Z coordinate of the opening
+  double powerDbm;      //!< Power at the opening in dBm
+  int64_t durationNs;   //!< Duration of the leaked signal in nanoseconds
+};
+
+TypeId
+DmgRoomPartition::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgRoomPartition")
+    .SetParent<Object> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<DmgRoomPartition> ()
+    .AddAttribute ("LeakageThreshold",
+                   "Leakage whose power at the opening is below this value (dBm) is not exported.",
+                   DoubleValue (-120.0),
+                   MakeDoubleAccessor (&DmgRoomPartition::m_leakageThreshold),
+                   MakeDoubleChecker<double> ())
+  ;
+  return tid;
+}
+
+DmgRoomPartition::DmgRoomPartition ()
+  : m_delay (CreateObject<ConstantSpeedPropagationDelayModel> ()),
+    m_sourceMobility (CreateObject<ConstantPositionMobilityModel> ()),
+    m_leakageThreshold (-120.0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgRoomPartition::~DmgRoomPartition ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+DmgRoomPartition::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_channel != 0)
+    {
+      m_channel->SetLeakageCallback (DmgWifiChannel::LeakageCallback ());
+    }
+  m_channel = 0;
+  m_scenario = 0;
+  m_loss = 0;
+  m_delay = 0;
+  m_openings.clear ();
+  m_remoteDevices = NetDeviceContainer ();
+  m_sourceMobility = 0;
+  Object::DoDispose ();
+}
+
+void
+DmgRoomPartition::SetChannel (Ptr<DmgWifiChannel> channel)
+{
+  NS_LOG_FUNCTION (this << channel);
+  m_channel = channel;
+  m_channel->SetLeakageCallback (MakeCallback (&DmgRoomPartition::SendLeakage, this));
+}
+
+void
+DmgRoomPartition::SetScenarioModel (Ptr<Obstacle> scenario)
+{
+  NS_LOG_FUNCTION (this << scenario);
+  m_scenario = scenario;
+}
+
+void
+DmgRoomPartition::SetPropagationLossModel (Ptr<PropagationLossModel> loss)
+{
+  NS_LOG_FUNCTION (this << loss);
+  m_loss = loss;
+}
+
+void
+DmgRoomPartition::SetPropagationDelayModel (Ptr<PropagationDelayModel> delay)
+{
+  NS_LOG_FUNCTION (this << delay);
+  m_delay = delay;
+}
+
+void
+DmgRoomPartition::AddOpening (Vector center, double penetrationLossDb)
+{
+  NS_LOG_FUNCTION (this << center << penetrationLossDb);
+  Opening opening;
+  opening.center = center;
+  opening.penetrationLossDb = penetrationLossDb;
+  opening.mobility = CreateObject<ConstantPositionMobilityModel> ();
+  opening.mobility->SetPosition (center);
+  m_openings.push_back (opening);
+}
+
+void
+DmgRoomPartition::AddRemoteDevices (NetDeviceContainer devices)
+{
+  NS_LOG_FUNCTION (this);
+  m_remoteDevices.Add (devices);
+}
+
+void
+DmgRoomPartition::Install (NetDeviceContainer devices)
+{
+  NS_LOG_FUNCTION (this);
+  for (NetDeviceContainer::Iterator i = devices.Begin (); i != devices.End (); ++i)
+    {
+      Ptr<NetDevice> device = *i;
+      if (device->GetNode ()->GetSystemId () != MpiInterface::GetSystemId ())
+        {
+          continue;
+        }
+      Ptr<MpiReceiver> receiver = device->GetObject<MpiReceiver> ();
+      if (receiver == 0)
+        {
+          receiver = CreateObject<MpiReceiver> ();
+          device->AggregateObject (receiver);
+        }
+      receiver->SetReceiveCallback (MakeCallback (&DmgRoomPartition::ReceiveLeakage, this).Bind (device));
+    }
+}
+
+Time
+DmgRoomPartition::GetLookAhead (void) const
+{
+  NS_LOG_FUNCTION (this);
+  Time lookAhead = Time::Max ();
+  for (std::vector<Opening>::const_iterator it = m_openings.begin (); it != m_openings.end (); ++it)
+    {
+      for (NetDeviceContainer::Iterator i = m_remoteDevices.Begin (); i != m_remoteDevices.End (); ++i)
+        {
+          Ptr<MobilityModel> mobility = (*i)->GetNode ()->GetObject<MobilityModel> ();
+          NS_ASSERT (mobility != 0);
+          lookAhead = std::min (lookAhead, m_delay->GetDelay (it->mobility, mobility));
+        }
+    }
+  return lookAhead;
+}
+
+void
+DmgRoomPartition::ApplyLookAhead (void) const
+{
+  NS_LOG_FUNCTION (this);
+  Ptr<DistributedSimulatorImpl> impl = DynamicCast<DistributedSimulatorImpl> (Simulator::GetImplementation ());
+  if (impl == 0)
+    {
+      NS_LOG_DEBUG ("Not running the distributed simulator, no lookahead to set");
+      return;
+    }
+  Time lookAhead = GetLookAhead ();
+  NS_LOG_DEBUG ("Lookahead from openings to remote receivers=" << lookAhead);
+  impl->SetMaximumLookAhead (lookAhead);
+}
+
+void
+DmgRoomPartition::SendLeakage (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm)
+{
+  NS_LOG_FUNCTION (this << sender << ppdu << txPowerDbm);
+  NS_ASSERT_MSG (m_loss != 0, "No propagation loss model set for the room partition");
+  if (m_remoteDevices.GetN () == 0)
+    {
+      return;
+    }
+  Ptr<MobilityModel> senderMobility = sender->GetMobility ();
+  Vector senderPos = senderMobility->GetPosition ();
+  Time duration = ppdu->GetTxDuration ();
+  for (std::vector<Opening>::const_iterator it = m_openings.begin (); it != m_openings.end (); ++it)
+    {
+      double gtx = sender->GetCodebook ()->GetTxGainDbi (CalculateAzimuthAngle (senderPos, it->center));
+      double powerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, it->mobility) + gtx - it->penetrationLossDb;
+      if (m_scenario != 0)
+        {
+          powerDbm += m_scenario->checkLoS (senderPos, it->center).second;
+        }
+      if (powerDbm < m_leakageThreshold)
+        {
+          continue;
+        }
+      Time toOpening = m_delay->GetDelay (senderMobility, it->mobility);
+      DmgLeakageRecord record;
+      record.openingX = it->center.x;
+      record.openingY = it->center.y;
+      record.openingZ = it->center.z;
+      record.powerDbm = powerDbm;
+      record.durationNs = duration.GetNanoSeconds ();
+      for (NetDeviceContainer::Iterator i = m_remoteDevices.Begin (); i != m_remoteDevices.End (); ++i)
+        {
+          Ptr<Node> node = (*i)->GetNode ();
+          Time delay = toOpening + m_delay->GetDelay (it->mobility, node->GetObject<MobilityModel> ());
+          if (node->GetSystemId () != MpiInterface::GetSystemId ())
+            {
+              Ptr<Packet> packet = Create<Packet> (reinterpret_cast<const uint8_t *> (&record), sizeof (record));
+              MpiInterface::SendPacket (packet, Simulator::Now () + delay, node->GetId (), (*i)->GetIfIndex ());
+            }
+          else
+            {
+              Simulator::ScheduleWithContext (node->GetId (), delay, &DmgRoomPartition::DeliverLeakage, this,
+                                              *i, it->center, powerDbm, duration);
+            }
+        }
+    }
+}
+
+void
+DmgRoomPartition::ReceiveLeakage (Ptr<NetDevice> device, Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << device << packet);
+  DmgLeakageRecord record;
+  NS_ASSERT (packet->GetSize () == sizeof (record));
+  packet->CopyData (reinterpret_cast<uint8_t *> (&record), sizeof (record));
+  DeliverLeakage (device, Vector (record.openingX, record.openingY, record.openingZ),
+                  record.powerDbm, NanoSeconds (record.durationNs));
+}
+
+void
+DmgRoomPartition::DeliverLeakage (Ptr<NetDevice> device, Vector opening, double powerDbm, Time duration)
+{
+  NS_LOG_FUNCTION (this << device << opening << powerDbm << duration);
+  NS_ASSERT_MSG (m_loss != 0, "No propagation loss model set for the room partition");
+  Ptr<WifiNetDevice> wifiDevice = DynamicCast<WifiNetDevice> (device);
+  NS_ASSERT (wifiDevice != 0);
+  Ptr<DmgWifiPhy> phy = DynamicCast<DmgWifiPhy> (wifiDevice->GetPhy ());
+  NS_ASSERT (phy != 0);
+  Ptr<MobilityModel> receiverMobility = phy->GetMobility ();
+  Vector receiverPos = receiverMobility->GetPosition ();
+  m_sourceMobility->SetPosition (opening);
+  double grx = phy->GetCodebook ()->GetRxGainDbi (CalculateAzimuthAngle (receiverPos, opening));
+  double rxPowerDbm = m_loss->CalcRxPower (powerDbm, m_sourceMobility, receiverMobility) + grx;
+  if (m_scenario != 0)
+    {
+      rxPowerDbm += m_scenario->checkLoS (opening, receiverPos).second;
+    }
+  NS_LOG_DEBUG ("Leakage through opening " << opening << " received with power=" << rxPowerDbm << "dBm");
+  phy->ReceiveForeignSignal (duration, rxPowerDbm);
+}
+
+} //namespace ns3
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef DMG_ROOM_PARTITION_H
+#define DMG_ROOM_PARTITION_H
+
+#include "ns3/object.h"
+#include "ns3/vector.h"
+#include "ns3/nstime.h"
+#include "ns3/net-device-container.h"
+#include "ns3/dmg-wifi-channel.h"
+#include "ns3/obstacle.h"
+
+namespace ns3 {
+
+class Packet;
+class MobilityModel;
+class PropagationLossModel;
+class PropagationDelayModel;
+
+/**
+ * \brief One room of a multi-room DMG scenario simulated as a logical process.
+ * \ingroup wifi
+ *
+ * Each room owns its DmgWifiChannel and Obstacle scenario and is simulated on
+ * its own MPI rank (the system id of the nodes in the room). The only coupling
+ * between rooms is the energy that leaks through the openings (windows, doors)
+ * of the separating walls: for every PPDU sent on the local channel, the power
+ * reaching each opening is computed and forwarded to the PHYs of the other
+ * rooms, which account for it as non-decodable interference.
+ *
+ * Leakage events are forwarded through MpiInterface::SendPacket when the
+ * receiving device lives on another rank, and scheduled locally otherwise, so
+ * the same scenario also runs unchanged in a single process.
+ *
+ * The earliest a leakage event can reach another room is bounded by the
+ * propagation delay from the openings to the remote receivers, which is used
+ * as the conservative lookahead of the distributed simulator.
+ */
+class DmgRoomPartition : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  DmgRoomPartition ();
+  virtual ~DmgRoomPartition ();
+
+  /**
+   * Set the channel of the local room. Every PPDU sent on it is exported
+   * through the openings of the room.
+   *
+   * \param channel the DMG channel of this room.
+   */
+  void SetChannel (Ptr<DmgWifiChannel> channel);
+  /**
+   * Set the obstacle scenario of this room. Used to account for blockage
+   * between a transmitter and an opening, and between an opening and a receiver.
+   *
+   * \param scenario the obstacle scenario of this room.
+   */
+  void SetScenarioModel (Ptr<Obstacle> scenario);
+  /**
+   * \param loss the propagation loss model used for the sender-to-opening and
+   * opening-to-receiver legs.
+   */
+  void SetPropagationLossModel (Ptr<PropagationLossModel> loss);
+  /**
+   * \param delay the propagation delay model used for both legs.
+   */
+  void SetPropagationDelayModel (Ptr<PropagationDelayModel> delay);
+  /**
+   * Add an opening in the walls of this room.
+   *
+   * \param center the center of the opening.
+   * \param penetrationLossDb the additional loss in dB experienced when crossing the opening.
+   */
+  void AddOpening (Vector center, double penetrationLossDb);
+  /**
+   * Add devices of the other rooms that can be reached through the openings
+   * of this room.
+   *
+   * \param devices the remote DMG devices.
+   */
+  void AddRemoteDevices (NetDeviceContainer devices);
+  /**
+   * Make the local devices able to receive leakage events from other rooms.
+   * Devices whose node does not belong to this rank are ignored.
+   *
+   * \param devices the DMG devices of this room.
+   */
+  void Install (NetDeviceContainer devices);
+  /**
+   * \return the minimum propagation delay between any opening of this room and
+   * any remote device.
+   */
+  Time GetLookAhead (void) const;
+  /**
+   * Configure the lookahead of the distributed simulator, if in use, from
+   * GetLookAhead (). Must be called before Simulator::Run (), on the
+   * partition of the room owned by this rank.
+   */
+  void ApplyLookAhead (void) const;
+
+private:
+  virtual void DoDispose (void);
+
+  /// An opening in the walls of the room
+  struct Opening
+  {
+    Vector center;              //!< Center of the opening
+    double penetrationLossDb;   //!< Additional loss when crossing the opening
+    Ptr<MobilityModel> mobility;  //!< Mobility model placed at the opening
+  };
+
+  /**
+   * Export a PPDU sent on the local channel through the openings.
+   *
+   * \param sender the transmitting PHY.
+   * \param ppdu the transmitted PPDU.
+   * \param txPowerDbm the transmit power in dBm.
+   */
+  void SendLeakage (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm);
+  /**
+   * Handle a leakage event received from another rank.
+   *
+   * \param device the receiving device.
+   * \param packet the serialized leakage event.
+   */
+  void ReceiveLeakage (Ptr<NetDevice> device, Ptr<Packet> packet);
+  /**
+   * Apply a leakage event to a local device.
+   *
+   * \param device the receiving device.
+   * \param opening the position of the opening the energy leaked from.
+   * \param powerDbm the power at the opening in dBm.
+   * \param duration the duration of the leaked signal.
+   */
+  void DeliverLeakage (Ptr<NetDevice> device, Vector opening, double powerDbm, Time duration);
+
+  Ptr<DmgWifiChannel> m_channel;        //!< Channel of the local room
+  Ptr<Obstacle> m_scenario;             //!< Obstacle scenario of the local room
+  Ptr<PropagationLossModel> m_loss;     //!< Propagation loss model
+  Ptr<PropagationDelayModel> m_delay;   //!< Propagation delay model
+  std::vector<Opening> m_openings;      //!< Openings of the local room
+  NetDeviceContainer m_remoteDevices;   //!< Devices of the other rooms
+  Ptr<MobilityModel> m_sourceMobility;  //!< Scratch mobility for received leakage
+  double m_leakageThreshold;            //!< Leakage below this power (dBm) is not exported
+};
+
+} // namespace ns3
+
+#endif /* DMG_ROOM_PARTITION_H */
@@ -26,6 +26,7 @@
 #include <sstream>
 
 #define PERIODIC_CHECK_INTERVAL (Seconds (1))
+#define EXPIRY_SLOT_WIDTH (MilliSeconds (1))
 
 namespace ns3 {
 
@@ -79,8 +80,15 @@ FlowMonitor::GetInstanceTypeId (void) const
   return GetTypeId ();
 }
 
+FlowMonitor::ExpirySlot::ExpirySlot ()
+  : live (0)
+{
+}
+
 FlowMonitor::FlowMonitor ()
-  : m_enabled (false)
+  : m_firstExpirySlot (0),
+    m_expirySlotWidth (EXPIRY_SLOT_WIDTH.GetTimeStep ()),
+    m_enabled (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -91,6 +99,13 @@ FlowMonitor::DoDispose (void)
   NS_LOG_FUNCTION (this);
   Simulator::Cancel (m_startEvent);
   Simulator::Cancel (m_stopEvent);
+  Simulator::Cancel (m_exportEvent);
+  if (m_exportStream.is_open ())
+    {
+      m_exportStream.close ();
+    }
+  m_trackedPackets.Clear ();
+  m_expirySlots.clear ();
   for (std::list<Ptr<FlowClassifier> >::iterator iter = m_classifiers.begin ();
       iter != m_classifiers.end ();
       iter ++)
@@ -135,6 +150,55 @@ FlowMonitor::GetStatsForFlow (FlowId flowId)
     }
 }
 
+inline uint64_t
+FlowMonitor::GetTrackedPacketKey (FlowId flowId, FlowPacketId packetId)
+{
+  return (static_cast<uint64_t> (flowId) << 32) | packetId;
+}
+
+inline int64_t
+FlowMonitor::GetExpirySlot (const Time &time) const
+{
+  return time.GetTimeStep () / m_expirySlotWidth;
+}
+
+void
+FlowMonitor::AddExpiry (uint64_t key, const Time &lastSeenTime)
+{
+  int64_t slot = GetExpirySlot (lastSeenTime);
+  if (m_expirySlots.empty ())
+    {
+      m_firstExpirySlot = slot;
+    }
+  // packets are seen in time order, so that slots are only added at the end
+  NS_ASSERT (slot >= m_firstExpirySlot);
+  while (slot - m_firstExpirySlot >= static_cast<int64_t> (m_expirySlots.size ()))
+    {
+      m_expirySlots.push_back (ExpirySlot ());
+    }
+  ExpirySlot &expiry = m_expirySlots[slot - m_firstExpirySlot];
+  expiry.packets.push_back (key);
+  expiry.live++;
+}
+
+void
+FlowMonitor::RemoveExpiry (const Time &lastSeenTime)
+{
+  int64_t slot = GetExpirySlot (lastSeenTime);
+  NS_ASSERT (slot >= m_firstExpirySlot && slot - m_firstExpirySlot < static_cast<int64_t> (m_expirySlots.size ()));
+  ExpirySlot &expiry = m_expirySlots[slot - m_firstExpirySlot];
+  NS_ASSERT (expiry.live > 0);
+  if (--expiry.live == 0)
+    {
+      // only stale keys are left, release them
+      std::vector<uint64_t> ().swap (expiry.packets);
+      while (!m_expirySlots.empty () && m_expirySlots.front ().live == 0)
+        {
+          m_expirySlots.pop_front ();
+          m_firstExpirySlot++;
+        }
+    }
+}
 
 void
 FlowMonitor::ReportFirstTx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packetId, uint32_t packetSize)
@@ -146,10 +210,17 @@ FlowMonitor::ReportFirstTx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t pack
       return;
     }
   Time now = Simulator::Now ();
-  TrackedPacket &tracked = m_trackedPackets[std::make_pair (flowId, packetId)];
+  uint64_t key = GetTrackedPacketKey (flowId, packetId);
+  bool inserted;
+  TrackedPacket &tracked = m_trackedPackets.Insert (key, &inserted);
+  if (!inserted)
+    {
+      RemoveExpiry (tracked.lastSeenTime);
+    }
   tracked.firstSeenTime = now;
   tracked.lastSeenTime = tracked.firstSeenTime;
   tracked.timesForwarded = 0;
+  AddExpiry (key, now);
   NS_LOG_DEBUG ("ReportFirstTx: adding tracked packet (flowId=" << flowId << ", packetId=" << packetId
                                                                 << ").");
 
@@ -175,19 +246,25 @@ FlowMonitor::ReportForwarding (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t p
       NS_LOG_DEBUG ("FlowMonitor not enabled; returning");
       return;
     }
-  std::pair<FlowId, FlowPacketId> key (flowId, packetId);
-  TrackedPacketMap::iterator tracked = m_trackedPackets.find (key);
-  if (tracked == m_trackedPackets.end ())
+  uint64_t key = GetTrackedPacketKey (flowId, packetId);
+  TrackedPacket *tracked = m_trackedPackets.Find (key);
+  if (tracked == 0)
     {
       NS_LOG_WARN ("Received packet forward report (flowId=" << flowId << ", packetId=" << packetId
                                                              << ") but not known to be transmitted.");
       return;
     }
 
-  tracked->second.timesForwarded++;
-  tracked->second.lastSeenTime = Simulator::Now ();
+  Time now = Simulator::Now ();
+  if (GetExpirySlot (now) != GetExpirySlot (tracked->lastSeenTime))
+    {
+      RemoveExpiry (tracked->lastSeenTime);
+      AddExpiry (key, now);
+    }
+  tracked->timesForwarded++;
+  tracked->lastSeenTime = now;
 
-  Time delay = (Simulator::Now () - tracked->second.firstSeenTime);
+  Time delay = (now - tracked->firstSeenTime);
   probe->AddPacketStats (flowId, packetSize, delay);
 }
 
@@ -201,8 +278,9 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
       NS_LOG_DEBUG ("FlowMonitor not enabled; returning");
       return;
     }
-  TrackedPacketMap::iterator tracked = m_trackedPackets.find (std::make_pair (flowId, packetId));
-  if (tracked == m_trackedPackets.end ())
+  uint64_t key = GetTrackedPacketKey (flowId, packetId);
+  TrackedPacket *tracked = m_trackedPackets.Find (key);
+  if (tracked == 0)
     {
       NS_LOG_WARN ("Received packet last-tx report (flowId=" << flowId << ", packetId=" << packetId
                                                              << ") but not known to be transmitted.");
@@ -210,7 +288,7 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
     }
 
   Time now = Simulator::Now ();
-  Time delay = (now - tracked->second.firstSeenTime);
+  Time delay = (now - tracked->firstSeenTime);
   probe->AddPacketStats (flowId, packetSize, delay);
 
   FlowStats &stats = GetStatsForFlow (flowId);
@@ -249,12 +327,14 @@ FlowMonitor::ReportLastRx (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packe
         }
     }
   stats.timeLastRxPacket = now;
-  stats.timesForwarded += tracked->second.timesForwarded;
+  stats.timesForwarded += tracked->timesForwarded;
 
   NS_LOG_DEBUG ("ReportLastTx: removing tracked packet (flowId="
                 << flowId << ", packetId=" << packetId << ").");
 
-  m_trackedPackets.erase (tracked); // we don't need to track this packet anymore
+  // we don't need to track this packet anymore
+  RemoveExpiry (tracked->lastSeenTime);
+  m_trackedPackets.Erase (key);
 }
 
 void
@@ -281,14 +361,16 @@ FlowMonitor::ReportDrop (Ptr<FlowProbe> probe, uint32_t flowId, uint32_t packetI
   stats.bytesDropped[reasonCode] += packetSize;
   NS_LOG_DEBUG ("++stats.packetsDropped[" << reasonCode<< "]; // becomes: " << stats.packetsDropped[reasonCode]);
 
-  TrackedPacketMap::iterator tracked = m_trackedPackets.find (std::make_pair (flowId, packetId));
-  if (tracked != m_trackedPackets.end ())
+  uint64_t key = GetTrackedPacketKey (flowId, packetId);
+  TrackedPacket *tracked = m_trackedPackets.Find (key);
+  if (tracked != 0)
     {
       // we don't need to track this packet anymore
       // FIXME: this will not necessarily be true with broadcast/multicast
       NS_LOG_DEBUG ("ReportDrop: removing tracked packet (flowId="
                     << flowId << ", packetId=" << packetId << ").");
-      m_trackedPackets.erase (tracked);
+      RemoveExpiry (tracked->lastSeenTime);
+      m_trackedPackets.Erase (key);
     }
 }
 
@@ -303,25 +385,52 @@ void
 FlowMonitor::CheckForLostPackets (Time maxDelay)
 {
   NS_LOG_FUNCTION (this << maxDelay.GetSeconds ());
-  Time now = Simulator::Now ();
+  Time lastSeenLimit = Simulator::Now () - maxDelay;
 
-  for (TrackedPacketMap::iterator iter = m_trackedPackets.begin ();
-       iter != m_trackedPackets.end (); )
+  // Only the slots of packets last seen up to lastSeenLimit are visited:
+  // the older ones entirely, and the last one packet by packet.
+  while (!m_expirySlots.empty ()
+         && m_firstExpirySlot * m_expirySlotWidth <= lastSeenLimit.GetTimeStep ())
     {
-      if (now - iter->second.lastSeenTime >= maxDelay)
+      int64_t slot = m_firstExpirySlot;
+      ExpirySlot &expiry = m_expirySlots.front ();
+      std::vector<uint64_t> remaining;
+      for (std::vector<uint64_t>::const_iterator iter = expiry.packets.begin ();
+           iter != expiry.packets.end (); iter++)
         {
+          TrackedPacket *tracked = m_trackedPackets.Find (*iter);
+          if (tracked == 0 || GetExpirySlot (tracked->lastSeenTime) != slot)
+            {
+              // received, dropped or seen again since then
+              continue;
+            }
+          if (tracked->lastSeenTime > lastSeenLimit)
+            {
+              remaining.push_back (*iter);
+              continue;
+            }
           // packet is considered lost, add it to the loss statistics
-          FlowStatsContainerI flow = m_flowStats.find (iter->first.first);
+          FlowStatsContainerI flow = m_flowStats.find (static_cast<FlowId> (*iter >> 32));
           NS_ASSERT (flow != m_flowStats.end ());
           flow->second.lostPackets++;
 
           // we won't track it anymore
-          m_trackedPackets.erase (iter++);
+          m_trackedPackets.Erase (*iter);
+          expiry.live--;
         }
-      else
+      if (!remaining.empty ())
         {
-          iter++;
+          expiry.packets.swap (remaining);
+          break;
         }
+      NS_ASSERT (expiry.live == 0);
+      m_expirySlots.pop_front ();
+      m_firstExpirySlot++;
+    }
+  while (!m_expirySlots.empty () && m_expirySlots.front ().live == 0)
+    {
+      m_expirySlots.pop_front ();
+      m_firstExpirySlot++;
     }
 }
 
@@ -338,6 +447,72 @@ FlowMonitor::PeriodicCheckForLostPackets ()
   Simulator::Schedule (PERIODIC_CHECK_INTERVAL, &FlowMonitor::PeriodicCheckForLostPackets, this);
 }
 
+void
+FlowMonitor::EnablePeriodicExport (std::string fileName, Time interval)
+{
+  NS_LOG_FUNCTION (this << fileName << interval.GetSeconds ());
+  NS_ASSERT (interval.IsStrictlyPositive ());
+  if (m_exportStream.is_open ())
+    {
+      m_exportStream.close ();
+    }
+  m_exportStream.open (fileName.c_str (), std::ios::out);
+  if (!m_exportStream.is_open ())
+    {
+      NS_FATAL_ERROR ("Could not open the export file " << fileName);
+    }
+  m_exportStream << "time,flowId,txPackets,txBytes,rxPackets,rxBytes,lostPackets,delaySum,jitterSum,timesForwarded"
+                 << std::endl;
+  m_exportInterval = interval;
+  m_exportedStats.clear ();
+  Simulator::Cancel (m_exportEvent);
+  m_exportEvent = Simulator::Schedule (m_exportInterval, &FlowMonitor::PeriodicExport, this);
+}
+
+void
+FlowMonitor::PeriodicExport ()
+{
+  NS_LOG_FUNCTION (this);
+  CheckForLostPackets ();
+  double now = Simulator::Now ().GetSeconds ();
+  for (FlowStatsContainerCI flowI = m_flowStats.begin (); flowI != m_flowStats.end (); flowI++)
+    {
+      const FlowStats &stats = flowI->second;
+      std::map<FlowId, ExportedStats>::iterator last = m_exportedStats.find (flowI->first);
+      if (last == m_exportedStats.end ())
+        {
+          ExportedStats zero = { 0, 0, 0, 0, 0, 0, Seconds (0), Seconds (0) };
+          last = m_exportedStats.insert (std::make_pair (flowI->first, zero)).first;
+        }
+      ExportedStats &exported = last->second;
+      if (stats.txPackets == exported.txPackets && stats.rxPackets == exported.rxPackets
+          && stats.lostPackets == exported.lostPackets)
+        {
+          continue;
+        }
+      m_exportStream << now << "," << flowI->first
+                     << "," << stats.txPackets - exported.txPackets
+                     << "," << stats.txBytes - exported.txBytes
+                     << "," << stats.rxPackets - exported.rxPackets
+                     << "," << stats.rxBytes - exported.rxBytes
+                     << "," << stats.lostPackets - exported.lostPackets
+                     << "," << (stats.delaySum - exported.delaySum).GetSeconds ()
+                     << "," << (stats.jitterSum - exported.jitterSum).GetSeconds ()
+                     << "," << stats.timesForwarded - exported.timesForwarded
+                     << "\n";
+      exported.txBytes = stats.txBytes;
+      exported.rxBytes = stats.rxBytes;
+      exported.txPackets = stats.txPackets;
+      exported.rxPackets = stats.rxPackets;
+      exported.lostPackets = stats.lostPackets;
+      exported.timesForwarded = stats.timesForwarded;
+      exported.delaySum = stats.delaySum;
+      exported.jitterSum = stats.jitterSum;
+    }
+  m_exportStream.flush ();
+  m_exportEvent = Simulator::Schedule (m_exportInterval, &FlowMonitor::PeriodicExport, this);
+}
+
 void
 FlowMonitor::NotifyConstructionCompleted ()
 {
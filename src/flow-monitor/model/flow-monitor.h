@@ -23,11 +23,14 @@
 
 #include <vector>
 #include <map>
+#include <deque>
+#include <fstream>
 
 #include "ns3/ptr.h"
 #include "ns3/object.h"
 #include "ns3/flow-probe.h"
 #include "ns3/flow-classifier.h"
+#include "ns3/flow-hash-table.h"
 #include "ns3/histogram.h"
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
@@ -238,6 +241,17 @@ public:
   /// \returns a list of all the probes
   const FlowProbeContainer& GetAllProbes () const;
 
+  /// Periodically write the statistics of the flows to a CSV file while
+  /// the simulation runs, so that long simulations can be followed live.
+  /// Every interval, one line is written for each flow whose statistics
+  /// changed during the interval, with the end time of the interval, the
+  /// flow identifier, and the packets and bytes transmitted and received,
+  /// the packets lost, the sums of the delays and jitters (in seconds)
+  /// and the number of forwards counted during the interval.
+  /// \param fileName name or path of the output file that will be created
+  /// \param interval the export interval
+  void EnablePeriodicExport (std::string fileName, Time interval);
+
   /// Serializes the results to an std::ostream in XML format
   /// \param os the output stream
   /// \param indent number of spaces to use as base indentation level
@@ -274,12 +288,52 @@ private:
     uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
   };
 
+  /// Hash of a (FlowId,PacketId) key
+  struct TrackedPacketHash
+  {
+    /// \param key the key
+    /// \returns the hash of the key
+    uint64_t operator() (uint64_t key) const
+    {
+      return FlowHashMix (key);
+    }
+  };
+
+  /// The tracked packets last seen during a slot of time, for the expiry
+  /// of lost packets
+  struct ExpirySlot
+  {
+    ExpirySlot ();
+    /// Keys of the packets last seen during the slot, including the keys
+    /// of packets which have been seen again or removed since then
+    std::vector<uint64_t> packets;
+    /// Number of tracked packets last seen during the slot
+    uint32_t live;
+  };
+
+  /// The values of the flow statistics at the last periodic export
+  struct ExportedStats
+  {
+    uint64_t txBytes;        //!< Transmitted bytes
+    uint64_t rxBytes;        //!< Received bytes
+    uint32_t txPackets;      //!< Transmitted packets
+    uint32_t rxPackets;      //!< Received packets
+    uint32_t lostPackets;    //!< Lost packets
+    uint32_t timesForwarded; //!< Forwards
+    Time delaySum;           //!< Sum of the delays
+    Time jitterSum;          //!< Sum of the jitters
+  };
+
   /// FlowId --> FlowStats
   FlowStatsContainer m_flowStats;
 
   /// (FlowId,PacketId) --> TrackedPacket
-  typedef std::map< std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
+  typedef FlowHashTable<uint64_t, TrackedPacket, TrackedPacketHash> TrackedPacketMap;
   TrackedPacketMap m_trackedPackets; //!< Tracked packets
+  /// Tracked packets by time last seen, the slot of m_firstExpirySlot first
+  std::deque<ExpirySlot> m_expirySlots;
+  int64_t m_firstExpirySlot; //!< Number of the first slot of m_expirySlots
+  int64_t m_expirySlotWidth; //!< Duration of an expiry slot, in time steps
   Time m_maxPerHopDelay; //!< Minimum per-hop delay
   FlowProbeContainer m_flowProbes; //!< all the FlowProbes
 
@@ -295,6 +349,11 @@ private:
   double m_flowInterruptionsBinWidth; //!< Flow interruptions bin width (for histograms)
   Time m_flowInterruptionsMinTime; //!< Flow interruptions minimum time
 
+  std::ofstream m_exportStream; //!< Periodic export file
+  Time m_exportInterval;        //!< Periodic export interval
+  EventId m_exportEvent;        //!< Periodic export event
+  std::map<FlowId, ExportedStats> m_exportedStats; //!< Statistics at the last export
+
   /// Get the stats for a given flow
   /// \param flowId the Flow identification
   /// \returns the stats of the flow
@@ -302,6 +361,24 @@ private:
 
   /// Periodic function to check for lost packets and prune statistics
   void PeriodicCheckForLostPackets ();
+
+  /// Periodic function to write the flow statistics to the export file
+  void PeriodicExport ();
+
+  /// \param flowId the Flow identification
+  /// \param packetId the Packet ID
+  /// \returns the key of the packet in m_trackedPackets
+  static uint64_t GetTrackedPacketKey (FlowId flowId, FlowPacketId packetId);
+  /// \param time a time
+  /// \returns the number of the expiry slot of the time
+  int64_t GetExpirySlot (const Time &time) const;
+  /// Add a tracked packet to the expiry slot of the time it was last seen
+  /// \param key the key of the packet
+  /// \param lastSeenTime the time the packet was last seen
+  void AddExpiry (uint64_t key, const Time &lastSeenTime);
+  /// Remove a tracked packet from the expiry slot of the time it was last seen
+  /// \param lastSeenTime the time the packet was last seen
+  void RemoveExpiry (const Time &lastSeenTime);
 };
 
 
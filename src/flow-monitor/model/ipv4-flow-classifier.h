@@ -23,9 +23,11 @@
 
 #include <stdint.h>
 #include <map>
+#include <vector>
 
 #include "ns3/ipv4-header.h"
 #include "ns3/flow-classifier.h"
+#include "ns3/flow-hash-table.h"
 
 namespace ns3 {
 
@@ -92,12 +94,22 @@ public:
 
 private:
 
+  /// Hash function of the FiveTuple
+  struct FiveTupleHash
+  {
+    /// \param tuple the tuple
+    /// \returns the hash of the tuple
+    uint64_t operator() (const FiveTuple &tuple) const;
+  };
+
   /// Map to Flows Identifiers to FlowIds
-  std::map<FiveTuple, FlowId> m_flowMap;
-  /// Map to FlowIds to FlowPacketId
-  std::map<FlowId, FlowPacketId> m_flowPktIdMap;
-  /// Map FlowIds to (DSCP value, packet count) pairs
-  std::map<FlowId, std::map<Ipv4Header::DscpType, uint32_t> > m_flowDscpMap;
+  FlowHashTable<FiveTuple, FlowId, FiveTupleHash> m_flowMap;
+  /// Flows Identifiers, indexed by FlowId - 1
+  std::vector<FiveTuple> m_flowTuples;
+  /// Last FlowPacketId, indexed by FlowId - 1
+  std::vector<FlowPacketId> m_flowPktIdMap;
+  /// (DSCP value, packet count) pairs, indexed by FlowId - 1
+  std::vector<std::map<Ipv4Header::DscpType, uint32_t> > m_flowDscpMap;
 
 };
 
@@ -0,0 +1,335 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation;
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/flow-hash-table.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include <fstream>
+#include <map>
+
+using namespace ns3;
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief A FlowProbe which is fed directly by the test cases
+ */
+class TestFlowProbe : public FlowProbe
+{
+public:
+  /**
+   * Constructor
+   * \param monitor the FlowMonitor this probe is associated with
+   */
+  TestFlowProbe (Ptr<FlowMonitor> monitor)
+    : FlowProbe (monitor)
+  {
+  }
+};
+
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief FlowHashTable Test
+ */
+class FlowHashTableTestCase : public TestCase
+{
+public:
+  FlowHashTableTestCase ();
+  virtual void DoRun (void);
+
+private:
+  /// Hash which sends all the keys to a few entries, to exercise the probing
+  struct BadHash
+  {
+    /// \param key the key \returns the hash of the key
+    uint64_t operator() (uint64_t key) const
+    {
+      return key % 3;
+    }
+  };
+};
+
+FlowHashTableTestCase::FlowHashTableTestCase ()
+  : TestCase ("FlowHashTable")
+{
+}
+
+void
+FlowHashTableTestCase::DoRun (void)
+{
+  FlowHashTable<uint64_t, uint32_t, BadHash> table;
+  std::map<uint64_t, uint32_t> reference;
+  uint64_t x = 1;
+  for (uint32_t i = 0; i < 20000; i++)
+    {
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+      uint64_t key = (x >> 33) % 200;
+      if ((x >> 20) % 3 == 0)
+        {
+          NS_TEST_ASSERT_MSG_EQ (table.Erase (key), (reference.erase (key) == 1), "Erase of key " << key);
+        }
+      else
+        {
+          bool inserted;
+          table.Insert (key, &inserted) = i;
+          NS_TEST_ASSERT_MSG_EQ (inserted, (reference.find (key) == reference.end ()), "Insert of key " << key);
+          reference[key] = i;
+        }
+      NS_TEST_ASSERT_MSG_EQ (table.GetSize (), reference.size (), "Wrong size");
+    }
+  for (uint64_t key = 0; key < 200; key++)
+    {
+      std::map<uint64_t, uint32_t>::const_iterator it = reference.find (key);
+      uint32_t *value = table.Find (key);
+      NS_TEST_ASSERT_MSG_EQ ((value != 0), (it != reference.end ()), "Find of key " << key);
+      if (value != 0)
+        {
+          NS_TEST_EXPECT_MSG_EQ (*value, it->second, "Wrong value for key " << key);
+        }
+    }
+  table.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (table.GetSize (), 0, "Table not empty after Clear");
+  NS_TEST_EXPECT_MSG_EQ ((table.Find (0) == 0), true, "Key found after Clear");
+}
+
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief FlowMonitor lost packets Test
+ *
+ * Packets are last seen at various times, then forwarded, received or
+ * dropped, and the lost packets are checked against several deadlines,
+ * some of which fall in the middle of a slot of the expiry wheel.
+ */
+class FlowMonitorLostPacketsTestCase : public TestCase
+{
+public:
+  FlowMonitorLostPacketsTestCase ();
+  virtual void DoRun (void);
+
+private:
+  /// Transmit the first packets
+  void SendFirst ();
+  /// Transmit the packets of flow 2
+  void SendSecond ();
+  /// Transmit the packets of flow 3
+  void SendThird ();
+  /// Forward, receive and drop some packets
+  void Update ();
+  /// Check the lost packets
+  void Check ();
+
+  Ptr<FlowMonitor> m_monitor; //!< the monitor
+  Ptr<FlowProbe> m_probe;     //!< the probe
+};
+
+FlowMonitorLostPacketsTestCase::FlowMonitorLostPacketsTestCase ()
+  : TestCase ("FlowMonitor lost packets")
+{
+}
+
+void
+FlowMonitorLostPacketsTestCase::SendFirst ()
+{
+  for (FlowPacketId packetId = 0; packetId < 10; packetId++)
+    {
+      m_monitor->ReportFirstTx (m_probe, 1, packetId, 100);
+    }
+}
+
+void
+FlowMonitorLostPacketsTestCase::SendSecond ()
+{
+  m_monitor->ReportFirstTx (m_probe, 2, 0, 100);
+}
+
+void
+FlowMonitorLostPacketsTestCase::SendThird ()
+{
+  m_monitor->ReportFirstTx (m_probe, 3, Simulator::Now () < MicroSeconds (1500) ? 0 : 1, 100);
+}
+
+void
+FlowMonitorLostPacketsTestCase::Update ()
+{
+  m_monitor->ReportForwarding (m_probe, 1, 0, 100);
+  m_monitor->ReportLastRx (m_probe, 1, 1, 100);
+  m_monitor->ReportDrop (m_probe, 1, 2, 100, 0);
+}
+
+void
+FlowMonitorLostPacketsTestCase::Check ()
+{
+  const FlowMonitor::FlowStatsContainer &stats = m_monitor->GetFlowStats ();
+
+  // deadline at 1.5 ms, the dropped packet is already counted as lost
+  m_monitor->CheckForLostPackets (MicroSeconds (8500));
+  NS_TEST_EXPECT_MSG_EQ (stats.find (1)->second.lostPackets, 8, "Wrong number of lost packets for flow 1");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (2)->second.lostPackets, 1, "Wrong number of lost packets for flow 2");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (3)->second.lostPackets, 1, "Wrong number of lost packets for flow 3");
+
+  // nothing new at the same deadline
+  m_monitor->CheckForLostPackets (MicroSeconds (8500));
+  NS_TEST_EXPECT_MSG_EQ (stats.find (1)->second.lostPackets, 8, "Wrong number of lost packets for flow 1");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (3)->second.lostPackets, 1, "Wrong number of lost packets for flow 3");
+
+  // deadline at 3 ms
+  m_monitor->CheckForLostPackets (MilliSeconds (7));
+  NS_TEST_EXPECT_MSG_EQ (stats.find (1)->second.lostPackets, 9, "Wrong number of lost packets for flow 1");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (2)->second.lostPackets, 1, "Wrong number of lost packets for flow 2");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (3)->second.lostPackets, 2, "Wrong number of lost packets for flow 3");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (1)->second.rxPackets, 1, "Wrong number of received packets for flow 1");
+  NS_TEST_EXPECT_MSG_EQ (stats.find (1)->second.timesForwarded, 0, "Lost packets are not forwarded");
+
+  // a lost packet is not tracked anymore
+  m_monitor->ReportLastRx (m_probe, 1, 0, 100);
+  NS_TEST_EXPECT_MSG_EQ (stats.find (1)->second.rxPackets, 1, "Lost packet received");
+}
+
+void
+FlowMonitorLostPacketsTestCase::DoRun (void)
+{
+  m_monitor = CreateObject<FlowMonitor> ();
+  m_probe = Create<TestFlowProbe> (m_monitor);
+  m_monitor->StartRightNow ();
+
+  Simulator::Schedule (MilliSeconds (1), &FlowMonitorLostPacketsTestCase::SendFirst, this);
+  Simulator::Schedule (MicroSeconds (1200), &FlowMonitorLostPacketsTestCase::SendThird, this);
+  Simulator::Schedule (MicroSeconds (1500), &FlowMonitorLostPacketsTestCase::SendSecond, this);
+  Simulator::Schedule (MicroSeconds (1800), &FlowMonitorLostPacketsTestCase::SendThird, this);
+  Simulator::Schedule (MilliSeconds (3), &FlowMonitorLostPacketsTestCase::Update, this);
+  Simulator::Schedule (MilliSeconds (10), &FlowMonitorLostPacketsTestCase::Check, this);
+  Simulator::Stop (MilliSeconds (20));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  m_probe->Dispose ();
+  m_monitor->Dispose ();
+  m_probe = 0;
+  m_monitor = 0;
+}
+
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief FlowMonitor periodic export Test
+ */
+class FlowMonitorExportTestCase : public TestCase
+{
+public:
+  FlowMonitorExportTestCase ();
+  virtual void DoRun (void);
+
+private:
+  /**
+   * Transmit a packet
+   * \param packetId the packet identifier
+   */
+  void Send (FlowPacketId packetId);
+  /**
+   * Receive a packet
+   * \param packetId the packet identifier
+   */
+  void Receive (FlowPacketId packetId);
+
+  Ptr<FlowMonitor> m_monitor; //!< the monitor
+  Ptr<FlowProbe> m_probe;     //!< the probe
+};
+
+FlowMonitorExportTestCase::FlowMonitorExportTestCase ()
+  : TestCase ("FlowMonitor periodic export")
+{
+}
+
+void
+FlowMonitorExportTestCase::Send (FlowPacketId packetId)
+{
+  m_monitor->ReportFirstTx (m_probe, 1, packetId, 100);
+}
+
+void
+FlowMonitorExportTestCase::Receive (FlowPacketId packetId)
+{
+  m_monitor->ReportLastRx (m_probe, 1, packetId, 100);
+}
+
+void
+FlowMonitorExportTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("flow-monitor-export.csv");
+  m_monitor = CreateObject<FlowMonitor> ();
+  m_probe = Create<TestFlowProbe> (m_monitor);
+  m_monitor->StartRightNow ();
+  m_monitor->EnablePeriodicExport (fileName, MilliSeconds (10));
+
+  Simulator::Schedule (MilliSeconds (1), &FlowMonitorExportTestCase::Send, this, 0);
+  Simulator::Schedule (MilliSeconds (3), &FlowMonitorExportTestCase::Receive, this, 0);
+  Simulator::Schedule (MilliSeconds (15), &FlowMonitorExportTestCase::Send, this, 1);
+  Simulator::Stop (MilliSeconds (35));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  m_probe->Dispose ();
+  m_monitor->Dispose ();
+  m_probe = 0;
+  m_monitor = 0;
+
+  std::ifstream file (fileName.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (file.is_open (), true, "Export file not created");
+  std::string line;
+  std::getline (file, line);
+  NS_TEST_EXPECT_MSG_EQ (line, "time,flowId,txPackets,txBytes,rxPackets,rxBytes,lostPackets,delaySum,jitterSum,timesForwarded",
+                         "Wrong header");
+  std::getline (file, line);
+  NS_TEST_EXPECT_MSG_EQ (line, "0.01,1,1,100,1,100,0,0.002,0,0", "Wrong first interval");
+  std::getline (file, line);
+  NS_TEST_EXPECT_MSG_EQ (line, "0.02,1,1,100,0,0,0,0,0,0", "Wrong second interval");
+  // the third interval has no change
+  NS_TEST_EXPECT_MSG_EQ (std::getline (file, line).eof (), true, "Unexpected line " << line);
+}
+
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * \brief FlowMonitor TestSuite
+ */
+class FlowMonitorTestSuite : public TestSuite
+{
+public:
+  FlowMonitorTestSuite ();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite ()
+  : TestSuite ("flow-monitor", UNIT)
+{
+  AddTestCase (new FlowHashTableTestCase, TestCase::QUICK);
+  AddTestCase (new FlowMonitorLostPacketsTestCase, TestCase::QUICK);
+  AddTestCase (new FlowMonitorExportTestCase, TestCase::QUICK);
+}
+
+static FlowMonitorTestSuite g_flowMonitorTestSuite; //!< Static variable for test initialization
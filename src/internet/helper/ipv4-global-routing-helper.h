@@ -84,6 +84,18 @@ public:
    *
    */
   static void RecomputeRoutingTables (void);
+  /**
+   * \brief Bring the routes installed in a prior call to
+   * PopulateRoutingTables(), RecomputeRoutingTables() or
+   * UpdateRoutingTables() up to date with the global topology.
+   *
+   * The routing tables are the same as those RecomputeRoutingTables()
+   * would build, but only the routes of the nodes affected by the links
+   * and interfaces which changed are computed again.  The SPF computations
+   * are run in as many threads as the GlobalRoutingSpfThreads global value
+   * allows.
+   */
+  static void UpdateRoutingTables (void);
 private:
   /**
    * \brief Assignment operator declared private and not implemented to disallow
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "candidate-queue.h"
@@ -57,16 +58,38 @@ operator<< (std::ostream& os, const CandidateQueue& q)
   for (CIter_t iter = list.begin (); iter != list.end (); iter++)
     {
       os << "<" 
-      << (*iter)->GetVertexId () << ", "
-      << (*iter)->GetDistanceFromRoot () << ", "
-      << (*iter)->GetVertexType () << ">" << std::endl;
+      << iter->second->GetVertexId () << ", "
+      << iter->second->GetDistanceFromRoot () << ", "
+      << iter->second->GetVertexType () << ">" << std::endl;
     }
   os << "*** CandidateQueue End ***";
   return os;
 }
 
+/*
+ * In this implementation, SPFVertex follows the ordering where
+ * a vertex is ranked first if its GetDistanceFromRoot () is smaller;
+ * In case of a tie, NetworkLSA is always ranked before RouterLSA.
+ *
+ * This ordering is necessary for implementing ECMP
+ */
+bool
+CandidateQueue::CandidateKey::operator< (const CandidateKey &other) const
+{
+  if (distance != other.distance)
+    {
+      return distance < other.distance;
+    }
+  if (router != other.router)
+    {
+      return !router;
+    }
+  return order < other.order;
+}
+
 CandidateQueue::CandidateQueue()
-  : m_candidates ()
+  : m_candidates (),
+    m_order (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -94,11 +117,12 @@ CandidateQueue::Push (SPFVertex *vNew)
 {
   NS_LOG_FUNCTION (this << vNew);
 
-  CandidateList_t::iterator i = std::upper_bound (
-      m_candidates.begin (), m_candidates.end (), vNew,
-      &CandidateQueue::CompareSPFVertex
-      );
-  m_candidates.insert (i, vNew);
+  CandidateKey key;
+  key.distance = vNew->GetDistanceFromRoot ();
+  key.router = (vNew->GetVertexType () != SPFVertex::VertexNetwork);
+  key.order = m_order++;
+  CandidateList_t::iterator i = m_candidates.insert (std::make_pair (key, vNew)).first;
+  m_index.insert (std::make_pair (vNew->GetVertexId (), i));
 }
 
 SPFVertex *
@@ -110,8 +134,14 @@ CandidateQueue::Pop (void)
       return 0;
     }
 
-  SPFVertex *v = m_candidates.front ();
-  m_candidates.pop_front ();
+  CandidateList_t::iterator i = m_candidates.begin ();
+  SPFVertex *v = i->second;
+  std::map<Ipv4Address, CandidateList_t::iterator>::iterator index = m_index.find (v->GetVertexId ());
+  if (index != m_index.end () && index->second == i)
+    {
+      m_index.erase (index);
+    }
+  m_candidates.erase (i);
   return v;
 }
 
@@ -124,7 +154,7 @@ CandidateQueue::Top (void) const
       return 0;
     }
 
-  return m_candidates.front ();
+  return m_candidates.begin ()->second;
 }
 
 bool
@@ -145,56 +175,47 @@ SPFVertex *
 CandidateQueue::Find (const Ipv4Address addr) const
 {
   NS_LOG_FUNCTION (this);
-  CandidateList_t::const_iterator i = m_candidates.begin ();
-
-  for (; i != m_candidates.end (); i++)
+  std::map<Ipv4Address, CandidateList_t::iterator>::const_iterator i = m_index.find (addr);
+  if (i != m_index.end ())
     {
-      SPFVertex *v = *i;
-      if (v->GetVertexId () == addr)
-        {
-          return v;
-        }
+      return i->second->second;
     }
 
   return 0;
 }
 
+//
+// The distances only ever decrease.  The vertices whose distance changed
+// are pushed again, behind the vertices at the same distance, which is
+// where a stable sort of the queue would put them.
+//
 void
 CandidateQueue::Reorder (void)
 {
   NS_LOG_FUNCTION (this);
 
-  m_candidates.sort (&CandidateQueue::CompareSPFVertex);
-  NS_LOG_LOGIC ("After reordering the CandidateQueue");
-  NS_LOG_LOGIC (*this);
-}
-
-/*
- * In this implementation, SPFVertex follows the ordering where
- * a vertex is ranked first if its GetDistanceFromRoot () is smaller;
- * In case of a tie, NetworkLSA is always ranked before RouterLSA.
- *
- * This ordering is necessary for implementing ECMP
- */
-bool 
-CandidateQueue::CompareSPFVertex (const SPFVertex* v1, const SPFVertex* v2)
-{
-  NS_LOG_FUNCTION (&v1 << &v2);
-
-  bool result = false;
-  if (v1->GetDistanceFromRoot () < v2->GetDistanceFromRoot ())
+  std::vector<SPFVertex*> moved;
+  for (CandidateList_t::iterator i = m_candidates.begin (); i != m_candidates.end (); )
     {
-      result = true;
-    }
-  else if (v1->GetDistanceFromRoot () == v2->GetDistanceFromRoot ())
-    {
-      if (v1->GetVertexType () == SPFVertex::VertexNetwork 
-          && v2->GetVertexType () == SPFVertex::VertexRouter)
+      if (i->first.distance == i->second->GetDistanceFromRoot ())
+        {
+          i++;
+          continue;
+        }
+      std::map<Ipv4Address, CandidateList_t::iterator>::iterator index = m_index.find (i->second->GetVertexId ());
+      if (index != m_index.end () && index->second == i)
         {
-          result = true;
+          m_index.erase (index);
         }
+      moved.push_back (i->second);
+      m_candidates.erase (i++);
+    }
+  for (uint32_t j = 0; j < moved.size (); j++)
+    {
+      Push (moved[j]);
     }
-  return result;
+  NS_LOG_LOGIC ("After reordering the CandidateQueue");
+  NS_LOG_LOGIC (*this);
 }
 
 } // namespace ns3
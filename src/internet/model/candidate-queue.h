@@ -22,7 +22,7 @@
 #define CANDIDATE_QUEUE_H
 
 #include <stdint.h>
-#include <list>
+#include <map>
 #include "ns3/ipv4-address.h"
 
 namespace ns3 {
@@ -46,7 +46,11 @@ class SPFVertex;
  * Although a STL priority_queue almost does what we want, the requirement
  * for a Find () operation, the dynamic nature of the data and the derived
  * requirement for a Reorder () operation led us to implement this simple 
- * enhanced priority queue.
+ * enhanced priority queue.  The vertices are kept in a map ordered by
+ * distance, and indexed by their IP address, so that pushing, popping and
+ * finding a vertex take a logarithmic time in the number of candidates.
+ * Vertices at the same distance and of the same type are popped in the
+ * order they were pushed.
  */
 class CandidateQueue
 {
@@ -171,21 +175,25 @@ private:
  * \return copied object
  */
   CandidateQueue& operator= (CandidateQueue& sr);
-/**
- * \brief return true if v1 < v2
- *
- * SPFVertexes are added into the queue according to the ordering
- * defined by this method. If v1 should be popped before v2, this 
- * method return true; false otherwise
- *
- * \param v1 first operand
- * \param v2 second operand
- * \return True if v1 should be popped before v2; false otherwise
- */
-  static bool CompareSPFVertex (const SPFVertex* v1, const SPFVertex* v2);
 
-  typedef std::list<SPFVertex*> CandidateList_t; //!< container of SPFVertex pointers
+  /// The rank of a vertex in the queue
+  struct CandidateKey
+  {
+    uint32_t distance;  //!< the distance of the vertex from the root
+    bool router;        //!< whether the vertex is not a network, which is ranked first
+    uint64_t order;     //!< the order in which the vertex was pushed
+    /**
+     * \brief Compare the ranks of two vertices.
+     * \param other the other rank
+     * \return true if this vertex should be popped before the other
+     */
+    bool operator< (const CandidateKey &other) const;
+  };
+
+  typedef std::map<CandidateKey, SPFVertex*> CandidateList_t; //!< container of SPFVertex pointers, by rank
   CandidateList_t m_candidates;  //!< SPFVertex candidates
+  std::map<Ipv4Address, CandidateList_t::iterator> m_index;  //!< SPFVertex candidates by IP address
+  uint64_t m_order;  //!< the order of the next vertex pushed
 
   /**
    * \brief Stream insertion operator.
@@ -27,14 +27,21 @@
 #include <queue>
 #include <algorithm>
 #include <iostream>
+#include "ns3/core-config.h"
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
 #include "ns3/log.h"
+#include "ns3/global-value.h"
+#include "ns3/uinteger.h"
 #include "ns3/node-list.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/ipv4-list-routing.h"
 #include "ns3/mpi-interface.h"
+#include "ns3/ipv4-routing-table-entry.h"
+#ifdef HAVE_PTHREAD_H
+#include "ns3/system-thread.h"
+#endif /* HAVE_PTHREAD_H */
 #include "global-router-interface.h"
 #include "global-route-manager-impl.h"
 #include "candidate-queue.h"
@@ -44,6 +51,16 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("GlobalRouteManagerImpl");
 
+/**
+ * \relates GlobalRouteManagerImpl
+ * \anchor GlobalValueGlobalRoutingSpfThreads
+ * \brief The number of threads running the SPF calculations of the routers.
+ */
+static GlobalValue g_spfThreads = GlobalValue ("GlobalRoutingSpfThreads",
+                                               "The number of threads running the SPF calculations of the global routers",
+                                               UintegerValue (1),
+                                               MakeUintegerChecker<uint32_t> (1));
+
 /**
  * \brief Stream insertion operator.
  *
@@ -470,7 +487,33 @@ GlobalRouteManagerLSDB::Insert (Ipv4Address addr, GlobalRoutingLSA* lsa)
     } 
   else
     {
-      m_database.insert (LSDBPair_t (addr, lsa));
+      std::pair<LSDBMap_t::iterator, bool> inserted = m_database.insert (LSDBPair_t (addr, lsa));
+      if (!inserted.second)
+        {
+          return;
+        }
+//
+// Index the LSA by the link data of its transit network records.  When
+// several LSAs have the same link data, the one with the lowest link state
+// ID is found, as when walking the database.
+//
+      for (uint32_t j = 0; j < lsa->GetNLinkRecords (); j++)
+        {
+          GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (j);
+          if (lr->GetLinkType () != GlobalRoutingLinkRecord::TransitNetwork)
+            {
+              continue;
+            }
+          std::map<Ipv4Address, LSDBMap_t::const_iterator>::iterator it = m_linkDataIndex.find (lr->GetLinkData ());
+          if (it == m_linkDataIndex.end ())
+            {
+              m_linkDataIndex.insert (std::make_pair (lr->GetLinkData (), LSDBMap_t::const_iterator (inserted.first)));
+            }
+          else if (addr < it->second->first)
+            {
+              it->second = inserted.first;
+            }
+        }
     }
 }
 
@@ -495,13 +538,10 @@ GlobalRouteManagerLSDB::GetLSA (Ipv4Address addr) const
 //
 // Look up an LSA by its address.
 //
-  LSDBMap_t::const_iterator i;
-  for (i= m_database.begin (); i!= m_database.end (); i++)
+  LSDBMap_t::const_iterator i = m_database.find (addr);
+  if (i != m_database.end ())
     {
-      if (i->first == addr)
-        {
-          return i->second;
-        }
+      return i->second;
     }
   return 0;
 }
@@ -511,26 +551,45 @@ GlobalRouteManagerLSDB::GetLSAByLinkData (Ipv4Address addr) const
 {
   NS_LOG_FUNCTION (this << addr);
 //
-// Look up an LSA by its address.
+// Look up an LSA by the link data of one of its transit network records.
 //
-  LSDBMap_t::const_iterator i;
-  for (i= m_database.begin (); i!= m_database.end (); i++)
+  std::map<Ipv4Address, LSDBMap_t::const_iterator>::const_iterator i = m_linkDataIndex.find (addr);
+  if (i != m_linkDataIndex.end ())
     {
-      GlobalRoutingLSA* temp = i->second;
-// Iterate among temp's Link Records
-      for (uint32_t j = 0; j < temp->GetNLinkRecords (); j++)
-        {
-          GlobalRoutingLinkRecord *lr = temp->GetLinkRecord (j);
-          if ( lr->GetLinkType () == GlobalRoutingLinkRecord::TransitNetwork &&
-               lr->GetLinkData () == addr)
-            {
-              return temp;
-            }
-        }
+      return i->second->second;
     }
   return 0;
 }
 
+GlobalRouteManagerLSDB::Iterator
+GlobalRouteManagerLSDB::Begin (void) const
+{
+  return m_database.begin ();
+}
+
+GlobalRouteManagerLSDB::Iterator
+GlobalRouteManagerLSDB::End (void) const
+{
+  return m_database.end ();
+}
+
+GlobalRouteManagerLSDB*
+GlobalRouteManagerLSDB::Copy (void) const
+{
+  NS_LOG_FUNCTION (this);
+  GlobalRouteManagerLSDB *lsdb = new GlobalRouteManagerLSDB ();
+  for (LSDBMap_t::const_iterator i = m_database.begin (); i != m_database.end (); i++)
+    {
+      lsdb->Insert (i->first, new GlobalRoutingLSA (*i->second));
+    }
+  for (uint32_t j = 0; j < m_extdatabase.size (); j++)
+    {
+      GlobalRoutingLSA *lsa = m_extdatabase.at (j);
+      lsdb->Insert (lsa->GetLinkStateId (), new GlobalRoutingLSA (*lsa));
+    }
+  return lsdb;
+}
+
 // ---------------------------------------------------------------------------
 //
 // GlobalRouteManagerImpl Implementation
@@ -539,7 +598,9 @@ GlobalRouteManagerLSDB::GetLSAByLinkData (Ipv4Address addr) const
 
 GlobalRouteManagerImpl::GlobalRouteManagerImpl () 
   :
-    m_spfroot (0)
+    m_spfroot (0),
+    m_spfRootRouter (0),
+    m_routesComputed (false)
 {
   NS_LOG_FUNCTION (this);
   m_lsdb = new GlobalRouteManagerLSDB ();
@@ -592,6 +653,7 @@ GlobalRouteManagerImpl::DeleteGlobalRoutes ()
         }
       NS_LOG_LOGIC ("Deleted " << j << " global routes from node "<< node->GetId ());
     }
+  m_routesComputed = false;
   if (m_lsdb)
     {
       NS_LOG_LOGIC ("Deleting LSDB, creating new one");
@@ -697,37 +759,744 @@ GlobalRouteManagerImpl::InitializeRoutes ()
 {
   NS_LOG_FUNCTION (this);
 //
-// Walk the list of nodes in the system.
+// Walk the list of nodes in the system.
+//
+  NS_LOG_INFO ("About to start SPF calculation");
+  CollectRouters ();
+  std::vector<Ipv4Address> roots;
+  NodeList::Iterator listEnd = NodeList::End ();
+  for (NodeList::Iterator i = NodeList::Begin (); i != listEnd; i++)
+    {
+      Ptr<Node> node = *i;
+//
+// Look for the GlobalRouter interface that indicates that the node is
+// participating in routing.
+//
+      Ptr<GlobalRouter> rtr = 
+        node->GetObject<GlobalRouter> ();
+
+      uint32_t systemId = MpiInterface::GetSystemId ();
+      // Ignore nodes that are not assigned to our systemId (distributed sim)
+      if (node->GetSystemId () != systemId) 
+        {
+          continue;
+        }
+
+//
+// if the node has a global router interface, then run the global routing
+// algorithms.
+//
+      if (rtr && rtr->GetNumLSAs () )
+        {
+          roots.push_back (rtr->GetRouterId ());
+        }
+    }
+  SPFCalculateRoots (roots);
+  m_routesComputed = true;
+  NS_LOG_INFO ("Finished SPF calculation");
+}
+
+void
+GlobalRouteManagerImpl::CollectRouters (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_routers.clear ();
+  NodeList::Iterator listEnd = NodeList::End ();
+  for (NodeList::Iterator i = NodeList::Begin (); i != listEnd; i++)
+    {
+      Ptr<Node> node = *i;
+      Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter> ();
+      if (rtr == 0)
+        {
+          continue;
+        }
+//
+// When several nodes have the same router ID, the routes are written to the
+// first of them.
+//
+      RouterNode router;
+      router.routing = rtr->GetRoutingProtocol ();
+      router.ipv4 = node->GetObject<Ipv4> ();
+      m_routers.insert (std::make_pair (rtr->GetRouterId (), router));
+    }
+}
+
+//
+// The SPF calculations of different roots only share the LSDB, and the
+// routing table of each root is only written by its own calculation.  Each
+// worker thread therefore gets a copy of the LSDB, whose status flags it
+// is free to change, and the routers of the roots assigned to it.  The
+// reference counts of these routers are only touched by the worker.
+//
+void
+GlobalRouteManagerImpl::SPFCalculateRoots (const std::vector<Ipv4Address> &roots)
+{
+  NS_LOG_FUNCTION (this << roots.size ());
+  UintegerValue threads;
+  g_spfThreads.GetValue (threads);
+  uint32_t nThreads = std::min<uint32_t> (threads.Get (), roots.size ());
+#ifdef HAVE_PTHREAD_H
+  if (nThreads > 1)
+    {
+      NS_LOG_INFO ("Running the SPF calculation of " << roots.size () << " routers in " << nThreads << " threads");
+      std::vector<GlobalRouteManagerImpl *> workers;
+      for (uint32_t i = 0; i < nThreads; i++)
+        {
+          GlobalRouteManagerImpl *worker = new GlobalRouteManagerImpl ();
+          worker->DebugUseLsdb (m_lsdb->Copy ());
+          workers.push_back (worker);
+        }
+      for (uint32_t i = 0; i < roots.size (); i++)
+        {
+          GlobalRouteManagerImpl *worker = workers[i % nThreads];
+          worker->m_spfRoots.push_back (roots[i]);
+          RouterMap_t::const_iterator router = m_routers.find (roots[i]);
+          if (router != m_routers.end ())
+            {
+              worker->m_routers.insert (*router);
+            }
+        }
+      std::vector<Ptr<SystemThread> > systemThreads;
+      for (uint32_t i = 0; i < nThreads; i++)
+        {
+          systemThreads.push_back (Create<SystemThread> (MakeCallback (&GlobalRouteManagerImpl::SPFCalculatePending, workers[i])));
+          systemThreads.back ()->Start ();
+        }
+      for (uint32_t i = 0; i < nThreads; i++)
+        {
+          systemThreads[i]->Join ();
+          delete workers[i];
+        }
+    }
+  else
+#endif /* HAVE_PTHREAD_H */
+    {
+      for (uint32_t i = 0; i < roots.size (); i++)
+        {
+          SPFCalculate (roots[i]);
+        }
+    }
+  m_routers.clear ();
+}
+
+void
+GlobalRouteManagerImpl::SPFCalculatePending (void)
+{
+  NS_LOG_FUNCTION (this << m_spfRoots.size ());
+  for (uint32_t i = 0; i < m_spfRoots.size (); i++)
+    {
+      SPFCalculate (m_spfRoots[i]);
+    }
+  m_spfRoots.clear ();
+  m_routers.clear ();
+}
+
+//
+// Two link records are the same if they describe the same link with the
+// same cost.
+//
+static bool
+SameLinkRecord (const GlobalRoutingLinkRecord *a, const GlobalRoutingLinkRecord *b)
+{
+  return a->GetLinkType () == b->GetLinkType ()
+         && a->GetLinkId () == b->GetLinkId ()
+         && a->GetLinkData () == b->GetLinkData ()
+         && a->GetMetric () == b->GetMetric ();
+}
+
+//
+// Two LSAs are the same if they advertise the same links, networks and
+// attached routers, whatever their SPF status.
+//
+static bool
+SameLSA (const GlobalRoutingLSA *a, const GlobalRoutingLSA *b)
+{
+  if (a->GetLSType () != b->GetLSType ()
+      || a->GetLinkStateId () != b->GetLinkStateId ()
+      || a->GetAdvertisingRouter () != b->GetAdvertisingRouter ()
+      || a->GetNetworkLSANetworkMask () != b->GetNetworkLSANetworkMask ()
+      || a->GetNLinkRecords () != b->GetNLinkRecords ()
+      || a->GetNAttachedRouters () != b->GetNAttachedRouters ())
+    {
+      return false;
+    }
+  for (uint32_t i = 0; i < a->GetNLinkRecords (); i++)
+    {
+      if (!SameLinkRecord (a->GetLinkRecord (i), b->GetLinkRecord (i)))
+        {
+          return false;
+        }
+    }
+  for (uint32_t i = 0; i < a->GetNAttachedRouters (); i++)
+    {
+      if (a->GetAttachedRouter (i) != b->GetAttachedRouter (i))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+//
+// Find the link records of an old LSA which are missing from the new one.
+// Returns false if the new LSA has link records that the old one did not
+// have, or has them in another order.
+//
+static bool
+MissingLinkRecords (const GlobalRoutingLSA *oldLsa, const GlobalRoutingLSA *newLsa,
+                    std::vector<GlobalRoutingLinkRecord *> &missing)
+{
+  uint32_t j = 0;
+  for (uint32_t i = 0; i < oldLsa->GetNLinkRecords (); i++)
+    {
+      GlobalRoutingLinkRecord *lr = oldLsa->GetLinkRecord (i);
+      if (j < newLsa->GetNLinkRecords () && SameLinkRecord (lr, newLsa->GetLinkRecord (j)))
+        {
+          j++;
+        }
+      else
+        {
+          missing.push_back (lr);
+        }
+    }
+  return j == newLsa->GetNLinkRecords ();
+}
+
+//
+// Count the point-to-point and transit network link records of a router LSA,
+// and return the last of them.
+//
+static uint32_t
+CountTransitLinks (const GlobalRoutingLSA *lsa, GlobalRoutingLinkRecord **transitLink)
+{
+  uint32_t transits = 0;
+  for (uint32_t i = 0; i < lsa->GetNLinkRecords (); i++)
+    {
+      GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (i);
+      if (lr->GetLinkType () == GlobalRoutingLinkRecord::TransitNetwork
+          || lr->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint)
+        {
+          transits++;
+          *transitLink = lr;
+        }
+    }
+  return transits;
+}
+
+//
+// Whether GlobalRouteManagerImpl::CheckForStubNode () finds a router to be
+// a stub in a LSDB, i.e., whether its routes only depend on its own LSA and
+// on the LSA of the neighbor returned.
+//
+static bool
+IsStubNode (const GlobalRouteManagerLSDB *lsdb, Ipv4Address root, Ipv4Address &neighbor)
+{
+  neighbor = Ipv4Address::GetZero ();
+  GlobalRoutingLSA *rlsa = lsdb->GetLSA (root);
+  if (rlsa == 0)
+    {
+      return false;
+    }
+  GlobalRoutingLinkRecord *transitLink = 0;
+  uint32_t transits = CountTransitLinks (rlsa, &transitLink);
+  if (transits == 0)
+    {
+      return true;
+    }
+  if (transits > 1 || transitLink->GetLinkType () != GlobalRoutingLinkRecord::PointToPoint)
+    {
+      return false;
+    }
+  GlobalRoutingLSA *w_lsa = lsdb->GetLSA (transitLink->GetLinkId ());
+  if (w_lsa == 0)
+    {
+      return false;
+    }
+  for (uint32_t j = 0; j < w_lsa->GetNLinkRecords (); j++)
+    {
+      GlobalRoutingLinkRecord *lr = w_lsa->GetLinkRecord (j);
+      if (lr->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint && lr->GetLinkId () == root)
+        {
+          neighbor = transitLink->GetLinkId ();
+          return true;
+        }
+    }
+  return false;
+}
+
+/// Union-find forest of link state IDs
+typedef std::map<Ipv4Address, Ipv4Address> ComponentMap_t;
+
+//
+// Find the representative of the set of a link state ID, compressing the
+// path to it.
+//
+static Ipv4Address
+FindComponent (ComponentMap_t &parent, Ipv4Address id)
+{
+  ComponentMap_t::iterator i = parent.insert (std::make_pair (id, id)).first;
+  while (i->second != i->first)
+    {
+      ComponentMap_t::iterator up = parent.find (i->second);
+      i->second = up->second;
+      i = up;
+    }
+  return i->first;
+}
+
+//
+// Label each LSA of a LSDB with the connected component of the link state
+// graph it belongs to.  Links are followed in both directions, so that the
+// SPF tree of a router never leaves its component.
+//
+static void
+LabelComponents (const GlobalRouteManagerLSDB *lsdb, ComponentMap_t &components)
+{
+  ComponentMap_t parent;
+  for (GlobalRouteManagerLSDB::Iterator i = lsdb->Begin (); i != lsdb->End (); i++)
+    {
+      GlobalRoutingLSA *lsa = i->second;
+      Ipv4Address id = FindComponent (parent, i->first);
+      for (uint32_t j = 0; j < lsa->GetNLinkRecords (); j++)
+        {
+          GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (j);
+          if (lr->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint
+              || lr->GetLinkType () == GlobalRoutingLinkRecord::TransitNetwork)
+            {
+              Ipv4Address other = FindComponent (parent, lr->GetLinkId ());
+              parent[other] = id;
+            }
+        }
+      for (uint32_t j = 0; j < lsa->GetNAttachedRouters (); j++)
+        {
+          Ipv4Address other = FindComponent (parent, lsa->GetAttachedRouter (j));
+          parent[other] = id;
+        }
+    }
+  for (GlobalRouteManagerLSDB::Iterator i = lsdb->Begin (); i != lsdb->End (); i++)
+    {
+      components[i->first] = FindComponent (parent, i->first);
+    }
+}
+
+//
+// Count the stub link records and network LSAs of a LSDB for a network,
+// except those of some routers.
+//
+static uint32_t
+CountNetworkAdvertisements (const GlobalRouteManagerLSDB *lsdb, Ipv4Address network, Ipv4Mask mask,
+                            const std::set<Ipv4Address> &except)
+{
+  uint32_t count = 0;
+  for (GlobalRouteManagerLSDB::Iterator i = lsdb->Begin (); i != lsdb->End (); i++)
+    {
+      GlobalRoutingLSA *lsa = i->second;
+      if (lsa->GetLSType () == GlobalRoutingLSA::NetworkLSA)
+        {
+          if (lsa->GetNetworkLSANetworkMask () == mask
+              && lsa->GetLinkStateId ().CombineMask (mask) == network)
+            {
+              count++;
+            }
+          continue;
+        }
+      if (except.find (i->first) != except.end ())
+        {
+          continue;
+        }
+      for (uint32_t j = 0; j < lsa->GetNLinkRecords (); j++)
+        {
+          GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (j);
+          if (lr->GetLinkType () == GlobalRoutingLinkRecord::StubNetwork
+              && Ipv4Mask (lr->GetLinkData ().Get ()) == mask
+              && lr->GetLinkId ().CombineMask (mask) == network)
+            {
+              count++;
+            }
+        }
+    }
+  return count;
+}
+
+//
+// Count the point-to-point link records of a LSDB whose link data is an
+// address, except those of some routers.  The SPF calculation installs a
+// host route to the address for each of them.
+//
+static uint32_t
+CountHostAdvertisements (const GlobalRouteManagerLSDB *lsdb, Ipv4Address address,
+                         const std::set<Ipv4Address> &except)
+{
+  uint32_t count = 0;
+  for (GlobalRouteManagerLSDB::Iterator i = lsdb->Begin (); i != lsdb->End (); i++)
+    {
+      if (except.find (i->first) != except.end ())
+        {
+          continue;
+        }
+      GlobalRoutingLSA *lsa = i->second;
+      for (uint32_t j = 0; j < lsa->GetNLinkRecords (); j++)
+        {
+          GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (j);
+          if (lr->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint
+              && lr->GetLinkData () == address)
+            {
+              count++;
+            }
+        }
+    }
+  return count;
+}
+
+//
+// Remove all the routes of a routing table.
+//
+static void
+ClearRoutes (Ptr<Ipv4GlobalRouting> gr)
+{
+  uint32_t nRoutes = gr->GetNRoutes ();
+  for (uint32_t j = 0; j < nRoutes; j++)
+    {
+      gr->RemoveRoute (0);
+    }
+}
+
+//
+// When a router loses its single link, e.g., when an access point fails
+// over, its routes and those of its neighbor change, but the SPF trees of
+// the other routers only lose a leaf.  Rather than running the SPF
+// calculation again for every router, the routes which are gone are removed.
+// The result is the same routing tables, with the routes in the same order,
+// as a full recomputation.
+//
+void
+GlobalRouteManagerImpl::UpdateRoutes ()
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_routesComputed)
+    {
+      DeleteGlobalRoutes ();
+      BuildGlobalRoutingDatabase ();
+      InitializeRoutes ();
+      return;
+    }
+  GlobalRouteManagerLSDB *previous = m_lsdb;
+  m_lsdb = new GlobalRouteManagerLSDB ();
+  BuildGlobalRoutingDatabase ();
+//
+// Find the LSAs which were added, removed or changed.
+//
+  std::set<Ipv4Address> changed;
+  GlobalRouteManagerLSDB::Iterator i = previous->Begin ();
+  GlobalRouteManagerLSDB::Iterator j = m_lsdb->Begin ();
+  while (i != previous->End () || j != m_lsdb->End ())
+    {
+      if (j == m_lsdb->End () || (i != previous->End () && i->first < j->first))
+        {
+          changed.insert (i->first);
+          i++;
+        }
+      else if (i == previous->End () || j->first < i->first)
+        {
+          changed.insert (j->first);
+          j++;
+        }
+      else
+        {
+          if (!SameLSA (i->second, j->second))
+            {
+              changed.insert (i->first);
+            }
+          i++;
+          j++;
+        }
+    }
+  bool externalChanged = (previous->GetNumExtLSAs () != m_lsdb->GetNumExtLSAs ());
+  for (uint32_t k = 0; !externalChanged && k < m_lsdb->GetNumExtLSAs (); k++)
+    {
+      externalChanged = !SameLSA (previous->GetExtLSA (k), m_lsdb->GetExtLSA (k));
+    }
+  NS_LOG_LOGIC (changed.size () << " LSAs changed, external LSAs " << (externalChanged ? "changed" : "unchanged"));
+//
+// Find the parts of the network, before and after the change, which have
+// an LSA that changed.
+//
+  ComponentMap_t oldComponents;
+  ComponentMap_t newComponents;
+  LabelComponents (previous, oldComponents);
+  LabelComponents (m_lsdb, newComponents);
+  std::set<Ipv4Address> oldTouched;
+  std::set<Ipv4Address> newTouched;
+  for (std::set<Ipv4Address>::const_iterator c = changed.begin (); c != changed.end (); c++)
+    {
+      ComponentMap_t::const_iterator component = oldComponents.find (*c);
+      if (component != oldComponents.end ())
+        {
+          oldTouched.insert (component->second);
+        }
+      component = newComponents.find (*c);
+      if (component != newComponents.end ())
+        {
+          newTouched.insert (component->second);
+        }
+    }
+
+  Pruning pruning;
+  bool prune = !externalChanged && PlanPruning (previous, changed, pruning);
+
+  CollectRouters ();
+  std::vector<Ipv4Address> roots;
+  uint32_t unchanged = 0;
+  uint32_t pruned = 0;
+  uint32_t systemId = MpiInterface::GetSystemId ();
+  NodeList::Iterator listEnd = NodeList::End ();
+  for (NodeList::Iterator n = NodeList::Begin (); n != listEnd; n++)
+    {
+      Ptr<Node> node = *n;
+      Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter> ();
+      if (rtr == 0)
+        {
+          continue;
+        }
+      Ptr<Ipv4GlobalRouting> gr = rtr->GetRoutingProtocol ();
+      Ipv4Address root = rtr->GetRouterId ();
+//
+// The routers which do not run the SPF calculation have no global routes.
+//
+      if (node->GetSystemId () != systemId || rtr->GetNumLSAs () == 0)
+        {
+          ClearRoutes (gr);
+          continue;
+        }
+      Ipv4Address oldNeighbor;
+      Ipv4Address newNeighbor;
+      bool oldStub = IsStubNode (previous, root, oldNeighbor);
+      bool newStub = IsStubNode (m_lsdb, root, newNeighbor);
+      bool recompute = true;
+      if (previous->GetLSA (root) == 0)
+        {
+          recompute = true;
+        }
+      else if (oldStub && newStub)
+        {
+          recompute = (changed.find (root) != changed.end ()
+                       || changed.find (newNeighbor) != changed.end ());
+          unchanged += recompute ? 0 : 1;
+        }
+      else if (oldStub || newStub || pruning.leaves.find (root) != pruning.leaves.end ())
+        {
+          recompute = true;
+        }
+      else if (!externalChanged
+               && oldTouched.find (oldComponents[root]) == oldTouched.end ()
+               && newTouched.find (newComponents[root]) == newTouched.end ())
+        {
+          recompute = false;
+          unchanged++;
+        }
+      else if (prune)
+        {
+          recompute = !PruneRoutes (gr, pruning);
+          pruned += recompute ? 0 : 1;
+        }
+      if (recompute)
+        {
+          ClearRoutes (gr);
+          roots.push_back (root);
+        }
+    }
+  delete previous;
+  NS_LOG_INFO ("Routes of " << unchanged << " routers unchanged, " << pruned <<
+               " pruned, " << roots.size () << " to recompute");
+  SPFCalculateRoots (roots);
+  m_routesComputed = true;
+}
+
+bool
+GlobalRouteManagerImpl::PlanPruning (const GlobalRouteManagerLSDB* previous,
+                                     const std::set<Ipv4Address> &changed, Pruning &pruning) const
+{
+  NS_LOG_FUNCTION (this << previous << changed.size ());
+//
+// Only router LSAs which lost link records may have changed.  The routers
+// which lost their single point-to-point link become leaves, detached
+// from the network.
+//
+  std::map<Ipv4Address, std::vector<GlobalRoutingLinkRecord *> > missing;
+  std::map<Ipv4Address, GlobalRoutingLinkRecord *> leafLinks;
+  for (std::set<Ipv4Address>::const_iterator c = changed.begin (); c != changed.end (); c++)
+    {
+      GlobalRoutingLSA *oldLsa = previous->GetLSA (*c);
+      GlobalRoutingLSA *newLsa = m_lsdb->GetLSA (*c);
+      if (oldLsa == 0 || newLsa == 0
+          || oldLsa->GetLSType () != GlobalRoutingLSA::RouterLSA
+          || newLsa->GetLSType () != GlobalRoutingLSA::RouterLSA
+          || !MissingLinkRecords (oldLsa, newLsa, missing[*c]))
+        {
+          return false;
+        }
+      GlobalRoutingLinkRecord *oldLink = 0;
+      GlobalRoutingLinkRecord *newLink = 0;
+      if (CountTransitLinks (oldLsa, &oldLink) == 1
+          && oldLink->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint
+          && CountTransitLinks (newLsa, &newLink) == 0)
+        {
+          pruning.leaves.insert (*c);
+          leafLinks[*c] = oldLink;
+//
+// All the routes to a leaf are gone, even those to the networks it still has.
+//
+          missing[*c].clear ();
+          for (uint32_t k = 0; k < oldLsa->GetNLinkRecords (); k++)
+            {
+              missing[*c].push_back (oldLsa->GetLinkRecord (k));
+            }
+        }
+    }
+  std::set<Ipv4Address> none;
+  std::set<std::pair<uint32_t, uint32_t> > networks;
+  for (std::map<Ipv4Address, std::vector<GlobalRoutingLinkRecord *> >::const_iterator c = missing.begin ();
+       c != missing.end (); c++)
+    {
+      bool leaf = (pruning.leaves.find (c->first) != pruning.leaves.end ());
+      for (uint32_t k = 0; k < c->second.size (); k++)
+        {
+          GlobalRoutingLinkRecord *lr = c->second[k];
+          if (lr->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint)
+            {
+//
+// The host route to the address of a lost link is removed if the link was
+// the only one with this address.
+//
+              if (!leaf && pruning.leaves.find (lr->GetLinkId ()) == pruning.leaves.end ())
+                {
+                  NS_LOG_LOGIC ("Link between routers " << c->first << " and " << lr->GetLinkId () << " lost");
+                  return false;
+                }
+              if (CountHostAdvertisements (previous, lr->GetLinkData (), none) != 1
+                  || CountHostAdvertisements (m_lsdb, lr->GetLinkData (), pruning.leaves) != 0)
+                {
+                  return false;
+                }
+              pruning.hosts.push_back (lr->GetLinkData ());
+            }
+          else if (lr->GetLinkType () == GlobalRoutingLinkRecord::StubNetwork)
+            {
+              Ipv4Mask mask (lr->GetLinkData ().Get ());
+              Ipv4Address network = lr->GetLinkId ().CombineMask (mask);
+              if (!networks.insert (std::make_pair (network.Get (), mask.Get ())).second)
+                {
+                  continue;
+                }
+//
+// The routes to a network are all removed if no router advertises it any
+// more.  If it was also advertised by one other router, only the routes
+// through the leaf, which are the last installed, are removed.
+//
+              PrunedNetwork prunedNetwork;
+              prunedNetwork.network = network;
+              prunedNetwork.mask = mask;
+              prunedNetwork.leaf = Ipv4Address::GetZero ();
+              uint32_t newCount = CountNetworkAdvertisements (m_lsdb, network, mask, pruning.leaves);
+              if (newCount > 0)
+                {
+                  uint32_t oldCount = CountNetworkAdvertisements (previous, network, mask, pruning.leaves);
+                  uint32_t leafCount = 0;
+                  for (std::set<Ipv4Address>::const_iterator l = pruning.leaves.begin (); l != pruning.leaves.end (); l++)
+                    {
+                      std::set<Ipv4Address> others (pruning.leaves);
+                      others.erase (*l);
+                      uint32_t count = CountNetworkAdvertisements (previous, network, mask, others) - oldCount;
+                      if (count > 0)
+                        {
+                          prunedNetwork.leaf = leafLinks[*l]->GetLinkData ();
+                        }
+                      leafCount += count;
+                    }
+                  if (newCount != 1 || oldCount != 1 || leafCount != 1)
+                    {
+                      NS_LOG_LOGIC ("Network " << network << " still advertised");
+                      return false;
+                    }
+                }
+              pruning.networks.push_back (prunedNetwork);
+            }
+          else
+            {
+              return false;
+            }
+        }
+    }
+//
+// A leaf must be unreachable, and must not advertise external routes.
 //
-  NS_LOG_INFO ("About to start SPF calculation");
-  NodeList::Iterator listEnd = NodeList::End ();
-  for (NodeList::Iterator i = NodeList::Begin (); i != listEnd; i++)
+  for (GlobalRouteManagerLSDB::Iterator l = m_lsdb->Begin (); l != m_lsdb->End (); l++)
     {
-      Ptr<Node> node = *i;
-//
-// Look for the GlobalRouter interface that indicates that the node is
-// participating in routing.
-//
-      Ptr<GlobalRouter> rtr = 
-        node->GetObject<GlobalRouter> ();
+      GlobalRoutingLSA *lsa = l->second;
+      for (uint32_t k = 0; k < lsa->GetNLinkRecords (); k++)
+        {
+          GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (k);
+          if (lr->GetLinkType () == GlobalRoutingLinkRecord::PointToPoint
+              && pruning.leaves.find (lr->GetLinkId ()) != pruning.leaves.end ())
+            {
+              return false;
+            }
+        }
+    }
+  for (uint32_t k = 0; k < m_lsdb->GetNumExtLSAs (); k++)
+    {
+      if (pruning.leaves.find (m_lsdb->GetExtLSA (k)->GetAdvertisingRouter ()) != pruning.leaves.end ())
+        {
+          return false;
+        }
+    }
+  NS_LOG_LOGIC ("Pruning " << pruning.leaves.size () << " leaves, " << pruning.hosts.size () <<
+                " host routes and " << pruning.networks.size () << " networks");
+  return true;
+}
 
-      uint32_t systemId = MpiInterface::GetSystemId ();
-      // Ignore nodes that are not assigned to our systemId (distributed sim)
-      if (node->GetSystemId () != systemId) 
+bool
+GlobalRouteManagerImpl::PruneRoutes (Ptr<Ipv4GlobalRouting> routing, const Pruning &pruning) const
+{
+  NS_LOG_FUNCTION (this << routing);
+  std::map<Ipv4Address, std::vector<Ipv4RoutingTableEntry> > hostRoutes;
+  for (uint32_t i = 0; i < pruning.hosts.size (); i++)
+    {
+      hostRoutes[pruning.hosts[i]] = routing->RemoveHostRoutesTo (pruning.hosts[i]);
+    }
+  for (uint32_t i = 0; i < pruning.networks.size (); i++)
+    {
+      const PrunedNetwork &network = pruning.networks[i];
+      if (network.leaf == Ipv4Address::GetZero ())
         {
+          routing->RemoveNetworkRoutesTo (network.network, network.mask);
           continue;
         }
-
 //
-// if the node has a global router interface, then run the global routing
-// algorithms.
+// The routes through the leaf use the same next hops as the host routes
+// to the leaf.
 //
-      if (rtr && rtr->GetNumLSAs () )
+      const std::vector<Ipv4RoutingTableEntry> &exits = hostRoutes[network.leaf];
+      if (exits.empty ())
+        {
+          continue;
+        }
+      std::vector<Ipv4RoutingTableEntry> removed = routing->RemoveNetworkRoutesTo (network.network, network.mask, exits.size ());
+      if (removed.size () != exits.size ())
+        {
+          return false;
+        }
+      for (uint32_t j = 0; j < removed.size (); j++)
         {
-          SPFCalculate (rtr->GetRouterId ());
+          if (removed[j].GetGateway () != exits[j].GetGateway ()
+              || removed[j].GetInterface () != exits[j].GetInterface ())
+            {
+              NS_LOG_LOGIC ("Route to " << network.network << " not through leaf " << network.leaf);
+              return false;
+            }
         }
     }
-  NS_LOG_INFO ("Finished SPF calculation");
+  return true;
 }
 
 //
@@ -1247,7 +2016,9 @@ void
 GlobalRouteManagerImpl::DebugSPFCalculate (Ipv4Address root)
 {
   NS_LOG_FUNCTION (this << root);
+  CollectRouters ();
   SPFCalculate (root);
+  m_routers.clear ();
 }
 
 //
@@ -1320,9 +2091,8 @@ GlobalRouteManagerImpl::CheckForStubNode (Ipv4Address root)
               if (lr->GetLinkId () == myRouterId)
                 {
                   // Next hop is stored in the LinkID field of lr
-                  Ptr<GlobalRouter> router = rlsa->GetNode ()->GetObject<GlobalRouter> ();
-                  NS_ASSERT (router);
-                  Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol ();
+                  NS_ASSERT (m_spfRootRouter);
+                  Ptr<Ipv4GlobalRouting> gr = m_spfRootRouter->routing;
                   NS_ASSERT (gr);
                   gr->AddNetworkRouteTo (Ipv4Address ("0.0.0.0"), Ipv4Mask ("0.0.0.0"), lr->GetLinkData (), 
                                          FindOutgoingInterfaceId (transitLink->GetLinkData ()));
@@ -1345,6 +2115,11 @@ GlobalRouteManagerImpl::SPFCalculate (Ipv4Address root)
 
   SPFVertex *v;
 //
+// Look up the router at the root, to which the routes are written.
+//
+  RouterMap_t::iterator router = m_routers.find (root);
+  m_spfRootRouter = (router != m_routers.end ()) ? &router->second : 0;
+//
 // Initialize the Link State Database.
 //
   m_lsdb->Initialize ();
@@ -1377,10 +2152,12 @@ GlobalRouteManagerImpl::SPFCalculate (Ipv4Address root)
 // reached.  Instead, short-circuit this computation and just install
 // a default route in the CheckForStubNode() method.
 //
-  if (NodeList::GetNNodes () > 0 && CheckForStubNode (root))
+  if (m_spfRootRouter != 0 && CheckForStubNode (root))
     {
       NS_LOG_LOGIC ("SPFCalculate truncated for stub node " << root);
       delete m_spfroot;
+      m_spfroot = 0;
+      m_spfRootRouter = 0;
       return;
     }
 
@@ -1502,6 +2279,7 @@ GlobalRouteManagerImpl::SPFCalculate (Ipv4Address root)
 //
   delete m_spfroot;
   m_spfroot = 0;
+  m_spfRootRouter = 0;
 }
 
 void
@@ -1560,105 +2338,59 @@ GlobalRouteManagerImpl::SPFAddASExternal (GlobalRoutingLSA *extlsa, SPFVertex *v
 
   NS_LOG_LOGIC ("Vertex ID = " << routerId);
 //
-// We need to walk the list of nodes looking for the one that has the router
-// ID corresponding to the root vertex.  This is the one we're going to write
-// the routing information to.
+// The router corresponding to the root of the SPF tree was looked up when the
+// calculation started.  This is the one we're going to write the routing
+// information to.  If there is no such router, there is nothing to do.
 //
-  NodeList::Iterator i = NodeList::Begin (); 
-  NodeList::Iterator listEnd = NodeList::End ();
-  for (; i != listEnd; i++)
+  if (m_spfRootRouter == 0)
     {
-      Ptr<Node> node = *i;
-//
-// The router ID is accessible through the GlobalRouter interface, so we need
-// to QI for that interface.  If there's no GlobalRouter interface, the node
-// in question cannot be the router we want, so we continue.
-// 
-      Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter> ();
-
-      if (rtr == 0)
-        {
-          NS_LOG_LOGIC ("No GlobalRouter interface on node " << node->GetId ());
-          continue;
-        }
-//
-// If the router ID of the current node is equal to the router ID of the 
-// root of the SPF tree, then this node is the one for which we need to 
-// write the routing tables.
-//
-      NS_LOG_LOGIC ("Considering router " << rtr->GetRouterId ());
-
-      if (rtr->GetRouterId () == routerId)
-        {
-          NS_LOG_LOGIC ("Setting routes for node " << node->GetId ());
-//
-// Routing information is updated using the Ipv4 interface.  We need to QI
-// for that interface.  If the node is acting as an IP version 4 router, it
-// should absolutely have an Ipv4 interface.
-//
-          Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
-          NS_ASSERT_MSG (ipv4, 
-                         "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                         "QI for <Ipv4> interface failed");
+      NS_LOG_LOGIC ("No GlobalRouter interface for router " << routerId);
+      return;
+    }
 //
 // Get the Global Router Link State Advertisement from the vertex we're
 // adding the routes to.  The LSA will have a number of attached Global Router
 // Link Records corresponding to links off of that vertex / node.  We're going
 // to be interested in the records corresponding to point-to-point links.
 //
-          NS_ASSERT_MSG (v->GetLSA (), 
-                         "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                         "Expected valid LSA in SPFVertex* v");
-          Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask ();
-          Ipv4Address tempip = extlsa->GetLinkStateId ();
-          tempip = tempip.CombineMask (tempmask);
+  NS_ASSERT_MSG (v->GetLSA (), 
+                 "GlobalRouteManagerImpl::SPFAddASExternal (): "
+                 "Expected valid LSA in SPFVertex* v");
+  Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask ();
+  Ipv4Address tempip = extlsa->GetLinkStateId ();
+  tempip = tempip.CombineMask (tempmask);
 
 //
-// Here's why we did all of that work.  We're going to add a host route to the
-// host address found in the m_linkData field of the point-to-point link
-// record.  In the case of a point-to-point link, this is the local IP address
-// of the node connected to the link.  Each of these point-to-point links
-// will correspond to a local interface that has an IP address to which
-// the node at the root of the SPF tree can send packets.  The vertex <v> 
-// (corresponding to the node that has these links and interfaces) has 
-// an m_nextHop address precalculated for us that is the address to which the
-// root node should send packets to be forwarded to these IP addresses.
-// Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-// which the packets should be send for forwarding.
+// The vertex <v> (corresponding to the router advertising the external
+// network) has the next hop addresses and outbound interfaces precalculated
+// for us: these are the ones the root node uses to forward packets toward
+// the external network.
 //
-          Ptr<GlobalRouter> router = node->GetObject<GlobalRouter> ();
-          if (router == 0)
-            {
-              continue;
-            }
-          Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol ();
-          NS_ASSERT (gr);
-          // walk through all next-hop-IPs and out-going-interfaces for reaching
-          // the stub network gateway 'v' from the root node
-          for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
-            {
-              SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
-              Ipv4Address nextHop = exit.first;
-              int32_t outIf = exit.second;
-              if (outIf >= 0)
-                {
-                  gr->AddASExternalRouteTo (tempip, tempmask, nextHop, outIf);
-                  NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                " add external network route to " << tempip <<
-                                " using next hop " << nextHop <<
-                                " via interface " << outIf);
-                }
-              else
-                {
-                  NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                " NOT able to add network route to " << tempip <<
-                                " using next hop " << nextHop <<
-                                " since outgoing interface id is negative");
-                }
-            }
-          return;
-        } // if
-    } // for
+  Ptr<Ipv4GlobalRouting> gr = m_spfRootRouter->routing;
+  NS_ASSERT (gr);
+  // walk through all next-hop-IPs and out-going-interfaces for reaching
+  // the stub network gateway 'v' from the root node
+  for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
+    {
+      SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
+      Ipv4Address nextHop = exit.first;
+      int32_t outIf = exit.second;
+      if (outIf >= 0)
+        {
+          gr->AddASExternalRouteTo (tempip, tempmask, nextHop, outIf);
+          NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                        " add external network route to " << tempip <<
+                        " using next hop " << nextHop <<
+                        " via interface " << outIf);
+        }
+      else
+        {
+          NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                        " NOT able to add network route to " << tempip <<
+                        " using next hop " << nextHop <<
+                        " since outgoing interface id is negative");
+        }
+    }
 }
 
 
@@ -1721,121 +2453,65 @@ GlobalRouteManagerImpl::SPFIntraAddStub (GlobalRoutingLinkRecord *l, SPFVertex*
 //
 // The root of the Shortest Path First tree is the router to which we are 
 // going to write the actual routing table entries.  The vertex corresponding
-// to this router has a vertex ID which is the router ID of that node.  We're
-// going to use this ID to discover which node it is that we're actually going
-// to update.
+// to this router has a vertex ID which is the router ID of that node.
 //
   Ipv4Address routerId = m_spfroot->GetVertexId ();
 
   NS_LOG_LOGIC ("Vertex ID = " << routerId);
 //
-// We need to walk the list of nodes looking for the one that has the router
-// ID corresponding to the root vertex.  This is the one we're going to write
-// the routing information to.
+// The router with the ID of the root vertex was looked up when the SPF
+// calculation started.  This is the one we're going to write the routing
+// information to.  If there is no such router, there is nothing to do.
 //
-  NodeList::Iterator i = NodeList::Begin (); 
-  NodeList::Iterator listEnd = NodeList::End ();
-  for (; i != listEnd; i++)
+  if (m_spfRootRouter == 0)
     {
-      Ptr<Node> node = *i;
-//
-// The router ID is accessible through the GlobalRouter interface, so we need
-// to QI for that interface.  If there's no GlobalRouter interface, the node
-// in question cannot be the router we want, so we continue.
-// 
-      Ptr<GlobalRouter> rtr = 
-        node->GetObject<GlobalRouter> ();
-
-      if (rtr == 0)
+      NS_LOG_LOGIC ("No GlobalRouter interface for router " << routerId);
+      return;
+    }
+  NS_ASSERT_MSG (v->GetLSA (), 
+                 "GlobalRouteManagerImpl::SPFIntraAddStub (): "
+                 "Expected valid LSA in SPFVertex* v");
+  Ipv4Mask tempmask (l->GetLinkData ().Get ());
+  Ipv4Address tempip = l->GetLinkId ();
+  tempip = tempip.CombineMask (tempmask);
+//
+// We're going to add a network route to the stub network described by the
+// link record.  The vertex <v> (corresponding to the node that has this stub
+// network) has the next hop addresses and outbound interfaces precalculated
+// for us: these are the ones the root node uses to forward packets toward
+// <v> and the networks behind it.
+//
+  Ptr<Ipv4GlobalRouting> gr = m_spfRootRouter->routing;
+  NS_ASSERT (gr);
+  // walk through all next-hop-IPs and out-going-interfaces for reaching
+  // the stub network gateway 'v' from the root node
+  for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
+    {
+      SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
+      Ipv4Address nextHop = exit.first;
+      int32_t outIf = exit.second;
+      if (outIf >= 0)
         {
-          NS_LOG_LOGIC ("No GlobalRouter interface on node " << 
-                        node->GetId ());
-          continue;
+          gr->AddNetworkRouteTo (tempip, tempmask, nextHop, outIf);
+          NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                        " add network route to " << tempip <<
+                        " using next hop " << nextHop <<
+                        " via interface " << outIf);
         }
-//
-// If the router ID of the current node is equal to the router ID of the 
-// root of the SPF tree, then this node is the one for which we need to 
-// write the routing tables.
-//
-      NS_LOG_LOGIC ("Considering router " << rtr->GetRouterId ());
-
-      if (rtr->GetRouterId () == routerId)
+      else
         {
-          NS_LOG_LOGIC ("Setting routes for node " << node->GetId ());
-//
-// Routing information is updated using the Ipv4 interface.  We need to QI
-// for that interface.  If the node is acting as an IP version 4 router, it
-// should absolutely have an Ipv4 interface.
-//
-          Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
-          NS_ASSERT_MSG (ipv4, 
-                         "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                         "QI for <Ipv4> interface failed");
-//
-// Get the Global Router Link State Advertisement from the vertex we're
-// adding the routes to.  The LSA will have a number of attached Global Router
-// Link Records corresponding to links off of that vertex / node.  We're going
-// to be interested in the records corresponding to point-to-point links.
-//
-          NS_ASSERT_MSG (v->GetLSA (), 
-                         "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                         "Expected valid LSA in SPFVertex* v");
-          Ipv4Mask tempmask (l->GetLinkData ().Get ());
-          Ipv4Address tempip = l->GetLinkId ();
-          tempip = tempip.CombineMask (tempmask);
-//
-// Here's why we did all of that work.  We're going to add a host route to the
-// host address found in the m_linkData field of the point-to-point link
-// record.  In the case of a point-to-point link, this is the local IP address
-// of the node connected to the link.  Each of these point-to-point links
-// will correspond to a local interface that has an IP address to which
-// the node at the root of the SPF tree can send packets.  The vertex <v> 
-// (corresponding to the node that has these links and interfaces) has 
-// an m_nextHop address precalculated for us that is the address to which the
-// root node should send packets to be forwarded to these IP addresses.
-// Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-// which the packets should be send for forwarding.
-//
-
-          Ptr<GlobalRouter> router = node->GetObject<GlobalRouter> ();
-          if (router == 0)
-            {
-              continue;
-            }
-          Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol ();
-          NS_ASSERT (gr);
-          // walk through all next-hop-IPs and out-going-interfaces for reaching
-          // the stub network gateway 'v' from the root node
-          for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
-            {
-              SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
-              Ipv4Address nextHop = exit.first;
-              int32_t outIf = exit.second;
-              if (outIf >= 0)
-                {
-                  gr->AddNetworkRouteTo (tempip, tempmask, nextHop, outIf);
-                  NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                " add network route to " << tempip <<
-                                " using next hop " << nextHop <<
-                                " via interface " << outIf);
-                }
-              else
-                {
-                  NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                " NOT able to add network route to " << tempip <<
-                                " using next hop " << nextHop <<
-                                " since outgoing interface id is negative");
-                }
-            }
-          return;
-        } // if
-    } // for
+          NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                        " NOT able to add network route to " << tempip <<
+                        " using next hop " << nextHop <<
+                        " since outgoing interface id is negative");
+        }
+    }
 }
 
 //
 // Return the interface number corresponding to a given IP address and mask
-// This is a wrapper around GetInterfaceForPrefix(), but we first
-// have to find the right node pointer to pass to that function.
+// This is a wrapper around GetInterfaceForPrefix(), on the IPv4 stack of the
+// node at the root of the SPF tree.
 // If no such interface is found, return -1 (note:  unit test framework
 // for routing assumes -1 to be a legal return value)
 //
@@ -1846,68 +2522,39 @@ GlobalRouteManagerImpl::FindOutgoingInterfaceId (Ipv4Address a, Ipv4Mask amask)
 //
 // We have an IP address <a> and a vertex ID of the root of the SPF tree.
 // The question is what interface index does this address correspond to.
-// The answer is a little complicated since we have to find a pointer to
-// the node corresponding to the vertex ID, find the Ipv4 interface on that
-// node in order to iterate the interfaces and find the one corresponding to
-// the address in question.
-//
-  Ipv4Address routerId = m_spfroot->GetVertexId ();
-//
-// Walk the list of nodes in the system looking for the one corresponding to
-// the node at the root of the SPF tree.  This is the node for which we are
-// building the routing table.
+// The node of the root was looked up when the SPF calculation started; we
+// need its Ipv4 interface to find the interface corresponding to the address
+// in question.
 //
-  NodeList::Iterator i = NodeList::Begin (); 
-  NodeList::Iterator listEnd = NodeList::End ();
-  for (; i != listEnd; i++)
+  if (m_spfRootRouter == 0)
     {
-      Ptr<Node> node = *i;
-
-      Ptr<GlobalRouter> rtr = 
-        node->GetObject<GlobalRouter> ();
-//
-// If the node doesn't have a GlobalRouter interface it can't be the one
-// we're interested in.
-//
-      if (rtr == 0)
-        {
-          continue;
-        }
-
-      if (rtr->GetRouterId () == routerId)
-        {
+      NS_LOG_LOGIC ("FindOutgoingInterfaceId():Can't find root node " << m_spfroot->GetVertexId ());
+      return -1;
+    }
 //
-// This is the node we're building the routing table for.  We're going to need
-// the Ipv4 interface to look for the ipv4 interface index.  Since this node
-// is participating in routing IP version 4 packets, it certainly must have 
+// This is the node we're building the routing table for.  Since this node
+// is participating in routing IP version 4 packets, it certainly must have
 // an Ipv4 interface.
 //
-          Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
-          NS_ASSERT_MSG (ipv4, 
-                         "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
-                         "GetObject for <Ipv4> interface failed");
+  Ptr<Ipv4> ipv4 = m_spfRootRouter->ipv4;
+  NS_ASSERT_MSG (ipv4, 
+                 "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
+                 "GetObject for <Ipv4> interface failed");
 //
 // Look through the interfaces on this node for one that has the IP address
 // we're looking for.  If we find one, return the corresponding interface
 // index, or -1 if not found.
 //
-          int32_t interface = ipv4->GetInterfaceForPrefix (a, amask);
+  int32_t interface = ipv4->GetInterfaceForPrefix (a, amask);
 
 #if 0
-          if (interface < 0)
-            {
-              NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
-                              "Expected an interface associated with address a:" << a);
-            }
-#endif 
-          return interface;
-        }
+  if (interface < 0)
+    {
+      NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
+                      "Expected an interface associated with address a:" << a);
     }
-//
-// Couldn't find it.
-//
-  NS_LOG_LOGIC ("FindOutgoingInterfaceId():Can't find root node " << routerId);
-  return -1;
+#endif 
+  return interface;
 }
 
 //
@@ -1936,68 +2583,36 @@ GlobalRouteManagerImpl::SPFIntraAddRouter (SPFVertex* v)
 //
 // The root of the Shortest Path First tree is the router to which we are 
 // going to write the actual routing table entries.  The vertex corresponding
-// to this router has a vertex ID which is the router ID of that node.  We're
-// going to use this ID to discover which node it is that we're actually going
-// to update.
+// to this router has a vertex ID which is the router ID of that node.
 //
   Ipv4Address routerId = m_spfroot->GetVertexId ();
 
   NS_LOG_LOGIC ("Vertex ID = " << routerId);
 //
-// We need to walk the list of nodes looking for the one that has the router
-// ID corresponding to the root vertex.  This is the one we're going to write
-// the routing information to.
+// The router with the ID of the root vertex was looked up when the SPF
+// calculation started.  This is the one we're going to write the routing
+// information to.  If there is no such router, there is nothing to do.
 //
-  NodeList::Iterator i = NodeList::Begin (); 
-  NodeList::Iterator listEnd = NodeList::End ();
-  for (; i != listEnd; i++)
+  if (m_spfRootRouter == 0)
     {
-      Ptr<Node> node = *i;
-//
-// The router ID is accessible through the GlobalRouter interface, so we need
-// to GetObject for that interface.  If there's no GlobalRouter interface, 
-// the node in question cannot be the router we want, so we continue.
-// 
-      Ptr<GlobalRouter> rtr = 
-        node->GetObject<GlobalRouter> ();
-
-      if (rtr == 0)
-        {
-          NS_LOG_LOGIC ("No GlobalRouter interface on node " << 
-                        node->GetId ());
-          continue;
-        }
-//
-// If the router ID of the current node is equal to the router ID of the 
-// root of the SPF tree, then this node is the one for which we need to 
-// write the routing tables.
-//
-      NS_LOG_LOGIC ("Considering router " << rtr->GetRouterId ());
-
-      if (rtr->GetRouterId () == routerId)
-        {
-          NS_LOG_LOGIC ("Setting routes for node " << node->GetId ());
-//
-// Routing information is updated using the Ipv4 interface.  We need to 
-// GetObject for that interface.  If the node is acting as an IP version 4 
-// router, it should absolutely have an Ipv4 interface.
-//
-          Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
-          NS_ASSERT_MSG (ipv4, 
-                         "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                         "GetObject for <Ipv4> interface failed");
+      NS_LOG_LOGIC ("No GlobalRouter interface for router " << routerId);
+      return;
+    }
+  NS_LOG_LOGIC ("Setting routes for router " << routerId);
 //
 // Get the Global Router Link State Advertisement from the vertex we're
 // adding the routes to.  The LSA will have a number of attached Global Router
 // Link Records corresponding to links off of that vertex / node.  We're going
 // to be interested in the records corresponding to point-to-point links.
 //
-          GlobalRoutingLSA *lsa = v->GetLSA ();
-          NS_ASSERT_MSG (lsa, 
-                         "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                         "Expected valid LSA in SPFVertex* v");
+  GlobalRoutingLSA *lsa = v->GetLSA ();
+  NS_ASSERT_MSG (lsa, 
+                 "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                 "Expected valid LSA in SPFVertex* v");
 
-          uint32_t nLinkRecords = lsa->GetNLinkRecords ();
+  uint32_t nLinkRecords = lsa->GetNLinkRecords ();
+  Ptr<Ipv4GlobalRouting> gr = m_spfRootRouter->routing;
+  NS_ASSERT (gr);
 //
 // Iterate through the link records on the vertex to which we're going to add
 // routes.  To make sure we're being clear, we're going to add routing table
@@ -2006,18 +2621,18 @@ GlobalRouteManagerImpl::SPFIntraAddRouter (SPFVertex* v)
 // the local side of the point-to-point links found on the node described by
 // the vertex <v>.
 //
-          NS_LOG_LOGIC (" Node " << node->GetId () <<
-                        " found " << nLinkRecords << " link records in LSA " << lsa << "with LinkStateId "<< lsa->GetLinkStateId ());
-          for (uint32_t j = 0; j < nLinkRecords; ++j)
-            {
+  NS_LOG_LOGIC (" Router " << routerId <<
+                " found " << nLinkRecords << " link records in LSA " << lsa << "with LinkStateId "<< lsa->GetLinkStateId ());
+  for (uint32_t j = 0; j < nLinkRecords; ++j)
+    {
 //
 // We are only concerned about point-to-point links
 //
-              GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (j);
-              if (lr->GetLinkType () != GlobalRoutingLinkRecord::PointToPoint)
-                {
-                  continue;
-                }
+      GlobalRoutingLinkRecord *lr = lsa->GetLinkRecord (j);
+      if (lr->GetLinkType () != GlobalRoutingLinkRecord::PointToPoint)
+        {
+          continue;
+        }
 //
 // Here's why we did all of that work.  We're going to add a host route to the
 // host address found in the m_linkData field of the point-to-point link
@@ -2031,46 +2646,34 @@ GlobalRouteManagerImpl::SPFIntraAddRouter (SPFVertex* v)
 // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
 // which the packets should be send for forwarding.
 //
-              Ptr<GlobalRouter> router = node->GetObject<GlobalRouter> ();
-              if (router == 0)
-                {
-                  continue;
-                }
-              Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol ();
-              NS_ASSERT (gr);
-              // walk through all available exit directions due to ECMP,
-              // and add host route for each of the exit direction toward
-              // the vertex 'v'
-              for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
-                {
-                  SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
-                  Ipv4Address nextHop = exit.first;
-                  int32_t outIf = exit.second;
-                  if (outIf >= 0)
-                    {
-                      gr->AddHostRouteTo (lr->GetLinkData (), nextHop,
-                                          outIf);
-                      NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                    " adding host route to " << lr->GetLinkData () <<
-                                    " using next hop " << nextHop <<
-                                    " and outgoing interface " << outIf);
-                    }
-                  else
-                    {
-                      NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                    " NOT able to add host route to " << lr->GetLinkData () <<
-                                    " using next hop " << nextHop <<
-                                    " since outgoing interface id is negative " << outIf);
-                    }
-                } // for all routes from the root the vertex 'v'
+      // walk through all available exit directions due to ECMP,
+      // and add host route for each of the exit direction toward
+      // the vertex 'v'
+      for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
+        {
+          SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
+          Ipv4Address nextHop = exit.first;
+          int32_t outIf = exit.second;
+          if (outIf >= 0)
+            {
+              gr->AddHostRouteTo (lr->GetLinkData (), nextHop,
+                                  outIf);
+              NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                            " adding host route to " << lr->GetLinkData () <<
+                            " using next hop " << nextHop <<
+                            " and outgoing interface " << outIf);
             }
-//
-// Done adding the routes for the selected node.
-//
-          return;
-        }
+          else
+            {
+              NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                            " NOT able to add host route to " << lr->GetLinkData () <<
+                            " using next hop " << nextHop <<
+                            " since outgoing interface id is negative " << outIf);
+            }
+        } // for all routes from the root the vertex 'v'
     }
 }
+
 void
 GlobalRouteManagerImpl::SPFIntraAddTransit (SPFVertex* v)
 {
@@ -2081,103 +2684,61 @@ GlobalRouteManagerImpl::SPFIntraAddTransit (SPFVertex* v)
 //
 // The root of the Shortest Path First tree is the router to which we are 
 // going to write the actual routing table entries.  The vertex corresponding
-// to this router has a vertex ID which is the router ID of that node.  We're
-// going to use this ID to discover which node it is that we're actually going
-// to update.
+// to this router has a vertex ID which is the router ID of that node.
 //
   Ipv4Address routerId = m_spfroot->GetVertexId ();
 
   NS_LOG_LOGIC ("Vertex ID = " << routerId);
 //
-// We need to walk the list of nodes looking for the one that has the router
-// ID corresponding to the root vertex.  This is the one we're going to write
-// the routing information to.
+// The router with the ID of the root vertex was looked up when the SPF
+// calculation started.  This is the one we're going to write the routing
+// information to.  If there is no such router, there is nothing to do.
 //
-  NodeList::Iterator i = NodeList::Begin (); 
-  NodeList::Iterator listEnd = NodeList::End ();
-  for (; i != listEnd; i++)
+  if (m_spfRootRouter == 0)
     {
-      Ptr<Node> node = *i;
+      NS_LOG_LOGIC ("No GlobalRouter interface for router " << routerId);
+      return;
+    }
+  NS_LOG_LOGIC ("setting routes for router " << routerId);
 //
-// The router ID is accessible through the GlobalRouter interface, so we need
-// to GetObject for that interface.  If there's no GlobalRouter interface, 
-// the node in question cannot be the router we want, so we continue.
-// 
-      Ptr<GlobalRouter> rtr = 
-        node->GetObject<GlobalRouter> ();
+// Get the Global Router Link State Advertisement from the vertex we're
+// adding the routes to.  The LSA of a network vertex gives the address and
+// the mask of the transit network.
+//
+  GlobalRoutingLSA *lsa = v->GetLSA ();
+  NS_ASSERT_MSG (lsa, 
+                 "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                 "Expected valid LSA in SPFVertex* v");
+  Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask ();
+  Ipv4Address tempip = lsa->GetLinkStateId ();
+  tempip = tempip.CombineMask (tempmask);
+  Ptr<Ipv4GlobalRouting> gr = m_spfRootRouter->routing;
+  NS_ASSERT (gr);
+  // walk through all available exit directions due to ECMP,
+  // and add host route for each of the exit direction toward
+  // the vertex 'v'
+  for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
+    {
+      SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
+      Ipv4Address nextHop = exit.first;
+      int32_t outIf = exit.second;
 
-      if (rtr == 0)
+      if (outIf >= 0)
         {
-          NS_LOG_LOGIC ("No GlobalRouter interface on node " << 
-                        node->GetId ());
-          continue;
+          gr->AddNetworkRouteTo (tempip, tempmask, nextHop, outIf);
+          NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                        " add network route to " << tempip <<
+                        " using next hop " << nextHop <<
+                        " via interface " << outIf);
         }
-//
-// If the router ID of the current node is equal to the router ID of the 
-// root of the SPF tree, then this node is the one for which we need to 
-// write the routing tables.
-//
-      NS_LOG_LOGIC ("Considering router " << rtr->GetRouterId ());
-
-      if (rtr->GetRouterId () == routerId)
+      else
         {
-          NS_LOG_LOGIC ("setting routes for node " << node->GetId ());
-//
-// Routing information is updated using the Ipv4 interface.  We need to 
-// GetObject for that interface.  If the node is acting as an IP version 4 
-// router, it should absolutely have an Ipv4 interface.
-//
-          Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
-          NS_ASSERT_MSG (ipv4, 
-                         "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                         "GetObject for <Ipv4> interface failed");
-//
-// Get the Global Router Link State Advertisement from the vertex we're
-// adding the routes to.  The LSA will have a number of attached Global Router
-// Link Records corresponding to links off of that vertex / node.  We're going
-// to be interested in the records corresponding to point-to-point links.
-//
-          GlobalRoutingLSA *lsa = v->GetLSA ();
-          NS_ASSERT_MSG (lsa, 
-                         "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                         "Expected valid LSA in SPFVertex* v");
-          Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask ();
-          Ipv4Address tempip = lsa->GetLinkStateId ();
-          tempip = tempip.CombineMask (tempmask);
-          Ptr<GlobalRouter> router = node->GetObject<GlobalRouter> ();
-          if (router == 0)
-            {
-              continue;
-            }
-          Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol ();
-          NS_ASSERT (gr);
-          // walk through all available exit directions due to ECMP,
-          // and add host route for each of the exit direction toward
-          // the vertex 'v'
-          for (uint32_t i = 0; i < v->GetNRootExitDirections (); i++)
-            {
-              SPFVertex::NodeExit_t exit = v->GetRootExitDirection (i);
-              Ipv4Address nextHop = exit.first;
-              int32_t outIf = exit.second;
-
-              if (outIf >= 0)
-                {
-                  gr->AddNetworkRouteTo (tempip, tempmask, nextHop, outIf);
-                  NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                " add network route to " << tempip <<
-                                " using next hop " << nextHop <<
-                                " via interface " << outIf);
-                }
-              else
-                {
-                  NS_LOG_LOGIC ("(Route " << i << ") Node " << node->GetId () <<
-                                " NOT able to add network route to " << tempip <<
-                                " using next hop " << nextHop <<
-                                " since outgoing interface id is negative " << outIf);
-                }
-            }
+          NS_LOG_LOGIC ("(Route " << i << ") Router " << routerId <<
+                        " NOT able to add network route to " << tempip <<
+                        " using next hop " << nextHop <<
+                        " since outgoing interface id is negative " << outIf);
         }
-    } 
+    }
 }
 
 // Derived from quagga ospf_vertex_add_parents ()
@@ -26,6 +26,7 @@
 #include <list>
 #include <queue>
 #include <map>
+#include <set>
 #include <vector>
 #include "ns3/object.h"
 #include "ns3/ptr.h"
@@ -37,6 +38,7 @@ namespace ns3 {
 const uint32_t SPF_INFINITY = 0xffffffff; //!< "infinite" distance between nodes
 
 class CandidateQueue;
+class Ipv4;
 class Ipv4GlobalRouting;
 
 /**
@@ -674,12 +676,36 @@ public:
    */
   uint32_t GetNumExtLSAs () const;
 
+  /// Const iterator over the router and network LSAs, in the order of their link state IDs
+  typedef std::map<Ipv4Address, GlobalRoutingLSA*>::const_iterator Iterator;
+
+  /**
+   * @brief Get an iterator to the first router or network LSA.
+   *
+   * @returns an iterator to the first LSA
+   */
+  Iterator Begin (void) const;
+  /**
+   * @brief Get an iterator past the last router or network LSA.
+   *
+   * @returns an iterator past the last LSA
+   */
+  Iterator End (void) const;
+
+  /**
+   * @brief Copy the Link State Database, for an SPF computation which
+   * must not share the status flags of its LSAs.
+   *
+   * @returns a new database holding copies of all the LSAs
+   */
+  GlobalRouteManagerLSDB* Copy (void) const;
 
 private:
   typedef std::map<Ipv4Address, GlobalRoutingLSA*> LSDBMap_t; //!< container of IPv4 addresses / Link State Advertisements
   typedef std::pair<Ipv4Address, GlobalRoutingLSA*> LSDBPair_t; //!< pair of IPv4 addresses / Link State Advertisements
 
   LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
+  std::map<Ipv4Address, LSDBMap_t::const_iterator> m_linkDataIndex; //!< LSAs by the link data of their transit network link records
   std::vector<GlobalRoutingLSA*> m_extdatabase; //!< database of External Link State Advertisements
 
 /**
@@ -735,6 +761,21 @@ public:
  */
   virtual void InitializeRoutes ();
 
+/**
+ * @brief Rebuild the routing database and recompute only the routes which
+ * changed since the last computation
+ *
+ * The new Link State Advertisements are compared with those of the last
+ * computation.  The routes of a router are left alone if no LSA changed in
+ * the part of the network it is connected to, or, for a stub router, if
+ * neither its LSA nor that of its neighbor changed.  When the only changes
+ * are routers which lost their single link, the routes to these routers
+ * and to their networks are removed from the other routing tables without
+ * any SPF calculation.  The SPF calculation is run again for the other
+ * routers.  Without a previous computation, all the routes are computed.
+ */
+  virtual void UpdateRoutes ();
+
 /**
  * @brief Debugging routine; allow client code to supply a pre-built LSDB
  */
@@ -766,8 +807,81 @@ private:
  */
   GlobalRouteManagerImpl& operator= (GlobalRouteManagerImpl& srmi);
 
+  /// The routing protocol and the IPv4 stack of a router
+  struct RouterNode
+  {
+    Ptr<Ipv4GlobalRouting> routing; //!< the global routing protocol of the router
+    Ptr<Ipv4> ipv4;                 //!< the IPv4 stack of the router
+  };
+  typedef std::map<Ipv4Address, RouterNode> RouterMap_t; //!< container of routers by router ID
+
+  /// A network whose routes are removed from the routing tables without SPF calculation
+  struct PrunedNetwork
+  {
+    Ipv4Address network; //!< the network address
+    Ipv4Mask mask;       //!< the network mask
+    Ipv4Address leaf;    //!< the address of the router whose routes to the network are removed, or 0.0.0.0 for all of them
+  };
+
+  /// The routes to remove from the routing tables when routers lose their single link
+  struct Pruning
+  {
+    std::set<Ipv4Address> leaves;          //!< the routers which lost their single link
+    std::vector<Ipv4Address> hosts;        //!< the destinations of the host routes to remove
+    std::vector<PrunedNetwork> networks;   //!< the networks whose routes to remove
+  };
+
   SPFVertex* m_spfroot; //!< the root node
   GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
+  RouterMap_t m_routers; //!< the routers whose routes are computed, by router ID
+  RouterNode* m_spfRootRouter; //!< the router at the root of the current SPF calculation, if any
+  std::vector<Ipv4Address> m_spfRoots; //!< the roots of the SPF calculations of a worker thread
+  bool m_routesComputed; //!< whether the routes were computed from the current LSDB
+
+  /**
+   * \brief Find the routers of the simulation, to install the routes
+   * computed for them.
+   */
+  void CollectRouters (void);
+
+  /**
+   * \brief Run the SPF calculation for some roots, in as many threads as
+   * the GlobalRoutingSpfThreads global value allows.
+   *
+   * \param roots the router IDs of the roots
+   */
+  void SPFCalculateRoots (const std::vector<Ipv4Address> &roots);
+
+  /**
+   * \brief Run the SPF calculation for each of the roots assigned to this
+   * worker.  This is the body of a worker thread.
+   */
+  void SPFCalculatePending (void);
+
+  /**
+   * \brief Find the routes which a change of the LSDB only removes.
+   *
+   * This is the case when, besides the loss of stub networks, the only
+   * links lost are the single links of some routers.
+   *
+   * \param previous the LSDB of the last computation
+   * \param changed the link state IDs of the LSAs which changed since then
+   * \param pruning the routes to remove
+   * \returns true if removing the routes brings the routing tables of all the
+   * other routers up to date
+   */
+  bool PlanPruning (const GlobalRouteManagerLSDB* previous,
+                    const std::set<Ipv4Address> &changed, Pruning &pruning) const;
+
+  /**
+   * \brief Remove routes from a routing table.
+   *
+   * \param routing the routing protocol whose table to update
+   * \param pruning the routes to remove
+   * \returns false if the routes found are not those expected, in which
+   * case the SPF calculation must be run again for this router
+   */
+  bool PruneRoutes (Ptr<Ipv4GlobalRouting> routing, const Pruning &pruning) const;
 
   /**
    * \brief Test if a node is a stub, from an OSPF sense.
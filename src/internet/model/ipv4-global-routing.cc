@@ -362,6 +362,48 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
   NS_ASSERT (false);
 }
 
+std::vector<Ipv4RoutingTableEntry>
+Ipv4GlobalRouting::RemoveHostRoutesTo (Ipv4Address dest)
+{
+  NS_LOG_FUNCTION (this << dest);
+  std::vector<Ipv4RoutingTableEntry> removed;
+  for (HostRoutesI i = m_hostRoutes.begin (); i != m_hostRoutes.end (); )
+    {
+      if ((*i)->GetDest () == dest)
+        {
+          removed.push_back (**i);
+          delete *i;
+          i = m_hostRoutes.erase (i);
+        }
+      else
+        {
+          i++;
+        }
+    }
+  NS_LOG_LOGIC ("Removed " << removed.size () << " host routes to " << dest);
+  return removed;
+}
+
+std::vector<Ipv4RoutingTableEntry>
+Ipv4GlobalRouting::RemoveNetworkRoutesTo (Ipv4Address network, Ipv4Mask networkMask, uint32_t count)
+{
+  NS_LOG_FUNCTION (this << network << networkMask << count);
+  std::vector<Ipv4RoutingTableEntry> removed;
+  NetworkRoutesI j = m_networkRoutes.end ();
+  while (j != m_networkRoutes.begin () && removed.size () < count)
+    {
+      j--;
+      if ((*j)->GetDestNetwork () == network && (*j)->GetDestNetworkMask () == networkMask)
+        {
+          removed.insert (removed.begin (), **j);
+          delete *j;
+          j = m_networkRoutes.erase (j);
+        }
+    }
+  NS_LOG_LOGIC ("Removed " << removed.size () << " network routes to " << network);
+  return removed;
+}
+
 int64_t
 Ipv4GlobalRouting::AssignStreams (int64_t stream)
 {
@@ -537,9 +579,7 @@ Ipv4GlobalRouting::NotifyInterfaceUp (uint32_t i)
   NS_LOG_FUNCTION (this << i);
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
-      GlobalRouteManager::DeleteGlobalRoutes ();
-      GlobalRouteManager::BuildGlobalRoutingDatabase ();
-      GlobalRouteManager::InitializeRoutes ();
+      GlobalRouteManager::UpdateRoutes ();
     }
 }
 
@@ -549,9 +589,7 @@ Ipv4GlobalRouting::NotifyInterfaceDown (uint32_t i)
   NS_LOG_FUNCTION (this << i);
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
-      GlobalRouteManager::DeleteGlobalRoutes ();
-      GlobalRouteManager::BuildGlobalRoutingDatabase ();
-      GlobalRouteManager::InitializeRoutes ();
+      GlobalRouteManager::UpdateRoutes ();
     }
 }
 
@@ -561,9 +599,7 @@ Ipv4GlobalRouting::NotifyAddAddress (uint32_t interface, Ipv4InterfaceAddress ad
   NS_LOG_FUNCTION (this << interface << address);
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
-      GlobalRouteManager::DeleteGlobalRoutes ();
-      GlobalRouteManager::BuildGlobalRoutingDatabase ();
-      GlobalRouteManager::InitializeRoutes ();
+      GlobalRouteManager::UpdateRoutes ();
     }
 }
 
@@ -573,9 +609,7 @@ Ipv4GlobalRouting::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress
   NS_LOG_FUNCTION (this << interface << address);
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
-      GlobalRouteManager::DeleteGlobalRoutes ();
-      GlobalRouteManager::BuildGlobalRoutingDatabase ();
-      GlobalRouteManager::InitializeRoutes ();
+      GlobalRouteManager::UpdateRoutes ();
     }
 }
 
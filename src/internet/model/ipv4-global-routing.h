@@ -21,6 +21,7 @@
 #define IPV4_GLOBAL_ROUTING_H
 
 #include <list>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -218,6 +219,27 @@ public:
    */
   void RemoveRoute (uint32_t i);
 
+  /**
+   * \brief Remove the host routes to a destination.
+   *
+   * \param dest The Ipv4Address of the destination.
+   * \return the routes removed, in the order of the routing table
+   */
+  std::vector<Ipv4RoutingTableEntry> RemoveHostRoutesTo (Ipv4Address dest);
+
+  /**
+   * \brief Remove the last network routes to a network.
+   *
+   * \param network The Ipv4Address network of the routes.
+   * \param networkMask The Ipv4Mask of the network.
+   * \param count The largest number of routes to remove, counted from the
+   * end of the routing table; by default all the routes to the network.
+   * \return the routes removed, in the order of the routing table
+   */
+  std::vector<Ipv4RoutingTableEntry> RemoveNetworkRoutesTo (Ipv4Address network,
+                                                            Ipv4Mask networkMask,
+                                                            uint32_t count = 0xffffffff);
+
   /**
    * Assign a fixed random variable stream number to the random variables
    * used by this model.  Return the number of streams (possibly zero) that
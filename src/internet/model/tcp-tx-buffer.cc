@@ -25,6 +25,7 @@
 #include "ns3/packet.h"
 #include "ns3/log.h"
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/tcp-option-ts.h"
 
 #include "tcp-tx-buffer.h"
@@ -46,6 +47,13 @@ TcpTxBuffer::GetTypeId (void)
                      "First unacknowledged sequence number (SND.UNA)",
                      MakeTraceSourceAccessor (&TcpTxBuffer::m_firstByteSeq),
                      "ns3::SequenceNumber32TracedValueCallback")
+    .AddAttribute ("SequenceIndex",
+                   "Look up the sent segments through an index by sequence "
+                   "number, instead of walking the list of sent segments",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&TcpTxBuffer::SetSequenceIndex,
+                                        &TcpTxBuffer::GetSequenceIndex),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -58,7 +66,8 @@ TcpTxBuffer::GetTypeId (void)
  * initialized below is insignificant.
  */
 TcpTxBuffer::TcpTxBuffer (uint32_t n)
-  : m_maxBuffer (32768), m_size (0), m_sentSize (0), m_firstByteSeq (n)
+  : m_maxBuffer (32768), m_size (0), m_sentSize (0), m_firstByteSeq (n),
+    m_lostFrontier (n), m_retransHint (n), m_lostHint (n)
 {
 }
 
@@ -117,6 +126,21 @@ TcpTxBuffer::Available (void) const
   return m_maxBuffer - m_size;
 }
 
+void
+TcpTxBuffer::SetSequenceIndex (bool enable)
+{
+  NS_LOG_FUNCTION (this << enable);
+  m_sequenceIndex = enable;
+  RebuildIndex ();
+  ResetHints ();
+}
+
+bool
+TcpTxBuffer::GetSequenceIndex (void) const
+{
+  return m_sequenceIndex;
+}
+
 void
 TcpTxBuffer::SetDupAckThresh (uint32_t dupAckThresh)
 {
@@ -161,6 +185,7 @@ TcpTxBuffer::SetHeadSequence (const SequenceNumber32& seq)
   // if you change the head with data already sent, something bad will happen
   NS_ASSERT (m_sentList.size () == 0);
   m_highestSack = std::make_pair (m_sentList.end (), SequenceNumber32 (0));
+  ResetHints ();
 }
 
 bool
@@ -274,7 +299,7 @@ TcpTxBuffer::GetNewSegment (uint32_t numBytes)
   NS_LOG_INFO ("AppList start at " << startOfAppList << ", sentSize = " <<
                m_sentSize << " firstByte: " << m_firstByteSeq);
 
-  TcpTxItem *item = GetPacketFromList (m_appList, startOfAppList,
+  TcpTxItem *item = GetPacketFromList (m_appList, m_appList.begin (), startOfAppList,
                                        numBytes, startOfAppList);
   item->m_startSeq = startOfAppList;
 
@@ -283,7 +308,11 @@ TcpTxBuffer::GetNewSegment (uint32_t numBytes)
   NS_ASSERT (it != m_appList.end ());
 
   m_appList.erase (it);
-  m_sentList.insert (m_sentList.end (), item);
+  PacketList::iterator pos = m_sentList.insert (m_sentList.end (), item);
+  if (m_sequenceIndex)
+    {
+      m_sentIndex.push_back (pos);
+    }
   m_sentSize += item->m_packet->GetSize ();
 
   return item;
@@ -297,40 +326,42 @@ TcpTxBuffer::GetTransmittedSegment (uint32_t numBytes, const SequenceNumber32 &s
   NS_ASSERT (numBytes <= m_sentSize);
   NS_ASSERT (m_sentList.size () >= 1);
 
-  auto it = m_sentList.begin ();
+  auto it = FindSentItem (seq);
+  NS_ASSERT (it != m_sentList.end ());
   bool listEdited = false;
   uint32_t s = numBytes;
 
   // Avoid to merge different packet for this retransmission if flags are
   // different.
-  for (; it != m_sentList.end(); ++it)
+  if ((*it)->m_startSeq == seq)
     {
-      if ((*it)->m_startSeq == seq)
+      auto next = it;
+      next++;
+      if (next != m_sentList.end ())
         {
-          auto next = it;
-          next++;
-          if (next != m_sentList.end ())
+          // Next is not sacked... there is the possibility to merge
+          if (! (*next)->m_sacked)
             {
-              // Next is not sacked... there is the possibility to merge
-              if (! (*next)->m_sacked)
-                {
-                  s = std::min(s, (*it)->m_packet->GetSize () + (*next)->m_packet->GetSize ());
-                }
-              else
-                {
-                  // Next is sacked... better to retransmit only the first segment
-                  s = std::min(s, (*it)->m_packet->GetSize ());
-                }
+              s = std::min(s, (*it)->m_packet->GetSize () + (*next)->m_packet->GetSize ());
             }
           else
             {
+              // Next is sacked... better to retransmit only the first segment
               s = std::min(s, (*it)->m_packet->GetSize ());
             }
-          break;
+        }
+      else
+        {
+          s = std::min(s, (*it)->m_packet->GetSize ());
         }
     }
 
-  TcpTxItem *item = GetPacketFromList (m_sentList, m_firstByteSeq, s, seq, &listEdited);
+  TcpTxItem *item = GetPacketFromList (m_sentList, it, (*it)->m_startSeq, s, seq, &listEdited);
+
+  if (listEdited)
+    {
+      RebuildIndex ();
+    }
 
   if (! item->m_retrans)
     {
@@ -385,7 +416,8 @@ TcpTxBuffer::SplitItems (TcpTxItem *t1, TcpTxItem *t2, uint32_t size) const
 }
 
 TcpTxItem*
-TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listStartFrom,
+TcpTxBuffer::GetPacketFromList (PacketList &list, PacketList::iterator it,
+                                const SequenceNumber32 &startingSeq,
                                 uint32_t numBytes, const SequenceNumber32 &seq,
                                 bool *listEdited) const
 {
@@ -416,19 +448,21 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
    * In (1), things are pretty easy, it's just a matter of walking the list and
    * defragment packets, if needed (e.g. seq is the beginning of the first packet
    * while maxBytes is the end of some packet next in the list).
+   *
+   * After an edit, the walk starts again from the item that begins at seq,
+   * or from the item that contains it.
    */
 
   Ptr<Packet> currentPacket = nullptr;
   TcpTxItem *currentItem = nullptr;
   TcpTxItem *outItem = nullptr;
-  PacketList::iterator it = list.begin ();
-  SequenceNumber32 beginOfCurrentPacket = listStartFrom;
+  SequenceNumber32 beginOfCurrentPacket = startingSeq;
 
   while (it != list.end ())
     {
       currentItem = *it;
       currentPacket = currentItem->m_packet;
-      NS_ASSERT_MSG (list != m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
+      NS_ASSERT_MSG (&list != &m_sentList || currentItem->m_startSeq >= m_firstByteSeq,
                      "start: " << m_firstByteSeq << " currentItem start: " <<
                      currentItem->m_startSeq);
 
@@ -464,7 +498,8 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
                   *listEdited = true;
                 }
 
-              return GetPacketFromList (list, listStartFrom, numBytes, seq, listEdited);
+              // currentItem now begins at seq
+              return GetPacketFromList (list, it, seq, numBytes, seq, listEdited);
             }
           else
             {
@@ -502,18 +537,18 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
                   // current > outPacket in the list. Merge current with the
                   // previous, and recurse.
                   NS_ASSERT (it != list.begin ());
-                  TcpTxItem *previous = *(--it);
+                  PacketList::iterator previous = std::prev (it);
 
                   list.erase (it);
 
-                  MergeItems (previous, currentItem);
+                  MergeItems (*previous, currentItem);
                   delete currentItem;
                   if (listEdited)
                     {
                       *listEdited = true;
                     }
 
-                  return GetPacketFromList (list, listStartFrom, numBytes, seq, listEdited);
+                  return GetPacketFromList (list, previous, seq, numBytes, seq, listEdited);
                 }
             }
           else if (numBytes < currentPacket->GetSize ())
@@ -537,6 +572,7 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
         {
           // The end isn't inside current packet, but there is an exception for
           // the merge and recurse strategy...
+          PacketList::iterator current = it;
           if (++it == list.end ())
             {
               // ...current is the last packet we sent. We have not more data;
@@ -562,7 +598,7 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
               *listEdited = true;
             }
 
-          return GetPacketFromList (list, listStartFrom, numBytes, seq, listEdited);
+          return GetPacketFromList (list, current, seq, numBytes, seq, listEdited);
         }
     }
 
@@ -604,6 +640,7 @@ TcpTxBuffer::MergeItems (TcpTxItem *t1, TcpTxItem *t2) const
           self->m_retrans -= t2->m_packet->GetSize ();
           t2->m_retrans = false;
         }
+      LowerHints (t1->m_startSeq);
     }
 
   if (t1->m_lastSent < t2->m_lastSent)
@@ -684,6 +721,10 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
           RemoveFromCounts (item, pktSize);
 
           i = m_sentList.erase (i);
+          if (m_sequenceIndex)
+            {
+              m_sentIndex.pop_front ();
+            }
           NS_LOG_INFO ("Removed " << *item << " lost: " << m_lostOut <<
                        " retrans: " << m_retrans << " sacked: " << m_sackedOut <<
                        ". Remaining data " << m_size);
@@ -721,6 +762,21 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
       m_firstByteSeq = seq;
     }
 
+  // Keep the hints within the buffer, so that they compare correctly with
+  // the sequences in it after a wrap around
+  if (m_lostFrontier < m_firstByteSeq)
+    {
+      m_lostFrontier = m_firstByteSeq;
+    }
+  if (m_retransHint < m_firstByteSeq)
+    {
+      m_retransHint = m_firstByteSeq;
+    }
+  if (m_lostHint < m_firstByteSeq)
+    {
+      m_lostHint = m_firstByteSeq;
+    }
+
   if (!m_sentList.empty ())
     {
       TcpTxItem *head = m_sentList.front ();
@@ -766,15 +822,21 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
 
   for (auto option_it = list.begin (); option_it != list.end (); ++option_it)
     {
-      PacketList::iterator item_it = m_sentList.begin ();
-      SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
       if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
           NS_LOG_INFO ("Not updating scoreboard, the option block is outside the sent list");
           return bytesSacked;
         }
 
+      // The items before the block cannot be sacked by it, and if one of them
+      // ended after the block, so would the first item we look at
+      PacketList::const_iterator item_it = FindSentFrom ((*option_it).first);
+      SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq + m_sentSize;
+      if (item_it != m_sentList.end ())
+        {
+          beginOfCurrentPacket = (*item_it)->m_startSeq;
+        }
+
       while (item_it != m_sentList.end ())
         {
           uint32_t pktSize = (*item_it)->m_packet->GetSize ();
@@ -868,6 +930,9 @@ TcpTxBuffer::UpdateLostCount ()
                    ", will start from item " << *(*m_highestSack.first));
     }
 
+  // The items below the frontier of the previous update are lost or sacked
+  SequenceNumber32 lostFrontier = m_lostFrontier;
+  bool frontierMoved = false;
   for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
     {
       TcpTxItem *item = *it;
@@ -878,10 +943,22 @@ TcpTxBuffer::UpdateLostCount ()
 
       if (sacked >= m_dupAckThresh)
         {
+          if (m_sequenceIndex && item->m_startSeq < lostFrontier)
+            {
+              // the items from here down to the head are lost or sacked already
+              break;
+            }
+          if (m_sequenceIndex && !frontierMoved)
+            {
+              // all the items below this one will be lost or sacked
+              m_lostFrontier = item->m_startSeq;
+              frontierMoved = true;
+            }
           if (!item->m_sacked && !item->m_lost)
             {
               item->m_lost = true;
               m_lostOut += item->m_packet->GetSize ();
+              LowerHints (item->m_startSeq);
             }
         }
       beginOfCurrentPacket -= item->m_packet->GetSize ();
@@ -894,6 +971,7 @@ TcpTxBuffer::UpdateLostCount ()
         {
           item->m_lost = true;
           m_lostOut += item->m_packet->GetSize ();
+          LowerHints (item->m_startSeq);
         }
     }
   NS_LOG_INFO ("Status after the update: " << *this);
@@ -905,35 +983,24 @@ TcpTxBuffer::IsLost (const SequenceNumber32 &seq) const
 {
   NS_LOG_FUNCTION (this << seq);
 
-  SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-  PacketList::const_iterator it;
-
   if (seq >= m_highestSack.second)
     {
       return false;
     }
 
-  // In theory, using a map and hints when inserting elements can improve
-  // performance
-  for (it = m_sentList.begin (); it != m_sentList.end (); ++it)
+  for (auto it = FindSentFrom (seq); it != m_sentList.end (); ++it)
     {
-      // Search for the right iterator before calling IsLost()
-      if (beginOfCurrentPacket >= seq)
+      if ((*it)->m_lost == true)
         {
-          if ((*it)->m_lost == true)
-            {
-              NS_LOG_INFO ("seq=" << seq << " is lost because of lost flag");
-              return true;
-            }
-
-          if ((*it)->m_sacked == true)
-            {
-              NS_LOG_INFO ("seq=" << seq << " is not lost because of sacked flag");
-              return false;
-            }
+          NS_LOG_INFO ("seq=" << seq << " is lost because of lost flag");
+          return true;
         }
 
-      beginOfCurrentPacket += (*it)->m_packet->GetSize ();
+      if ((*it)->m_sacked == true)
+        {
+          NS_LOG_INFO ("seq=" << seq << " is not lost because of sacked flag");
+          return false;
+        }
     }
 
   return false;
@@ -961,31 +1028,51 @@ TcpTxBuffer::NextSeg (SequenceNumber32 *seq, bool isRecovery) const
   TcpTxItem *item;
   SequenceNumber32 seqPerRule3;
   bool isSeqPerRule3Valid = false;
-  SequenceNumber32 beginOfCurrentPkt = m_firstByteSeq;
+  SequenceNumber32 endOfSentList = m_firstByteSeq + m_sentSize;
 
-  for (it = m_sentList.begin (); it != m_sentList.end (); ++it)
+  // With the index, the walk starts from where the previous one found the
+  // first item to retransmit
+  it = m_sequenceIndex ? FindSentFrom (m_lostHint) : m_sentList.begin ();
+  for (; it != m_sentList.end (); ++it)
     {
       item = *it;
 
       // Condition 1.a , 1.b , and 1.c
+      if (item->m_retrans == false && item->m_sacked == false && item->m_lost)
+        {
+          NS_LOG_INFO("IsLost, returning" << item->m_startSeq);
+          m_lostHint = item->m_startSeq;
+          *seq = item->m_startSeq;
+          return true;
+        }
+    }
+  m_lostHint = endOfSentList;
+
+  // Rule 3 looks for the first unSACKed item not retransmitted yet (none is
+  // lost, otherwise rule 1 would have returned it)
+  it = m_sequenceIndex ? FindSentFrom (m_retransHint) : m_sentList.begin ();
+  for (; isRecovery && it != m_sentList.end (); ++it)
+    {
+      item = *it;
+
       if (item->m_retrans == false && item->m_sacked == false)
         {
-          if (item->m_lost)
+          if (!isSeqPerRule3Valid)
             {
-              NS_LOG_INFO("IsLost, returning" << beginOfCurrentPkt);
-              *seq = beginOfCurrentPkt;
-              return true;
+              m_retransHint = item->m_startSeq;
             }
-          else if (seqPerRule3.GetValue () == 0 && isRecovery)
+          if (seqPerRule3.GetValue () != 0)
             {
-              NS_LOG_INFO ("Saving for rule 3 the seq " << beginOfCurrentPkt);
-              isSeqPerRule3Valid = true;
-              seqPerRule3 = beginOfCurrentPkt;
+              break;
             }
+          NS_LOG_INFO ("Saving for rule 3 the seq " << item->m_startSeq);
+          isSeqPerRule3Valid = true;
+          seqPerRule3 = item->m_startSeq;
         }
-
-      // Nothing found, iterate
-      beginOfCurrentPkt += item->m_packet->GetSize ();
+    }
+  if (isRecovery && !isSeqPerRule3Valid)
+    {
+      m_retransHint = endOfSentList;
     }
 
   /* (2) If no sequence number 'S2' per rule (1) exists but there
@@ -1189,6 +1276,7 @@ TcpTxBuffer::ResetRenoSack ()
     }
 
   m_highestSack = std::make_pair (m_sentList.end (), SequenceNumber32 (0));
+  ResetHints ();
 }
 
 void
@@ -1205,12 +1293,14 @@ TcpTxBuffer::ResetSentList ()
       m_appList.push_front (item);
       m_sentList.pop_back ();
     }
+  m_sentIndex.clear ();
 
   m_sentSize = 0;
   m_lostOut = 0;
   m_retrans = 0;
   m_sackedOut = 0;
   m_highestSack = std::make_pair (m_sentList.end (), SequenceNumber32 (0));
+  ResetHints ();
 }
 
 void
@@ -1222,12 +1312,18 @@ TcpTxBuffer::ResetLastSegmentSent ()
       TcpTxItem *item = m_sentList.back ();
 
       m_sentList.pop_back ();
+      if (m_sequenceIndex)
+        {
+          m_sentIndex.pop_back ();
+        }
       m_sentSize -= item->m_packet->GetSize ();
       if (item->m_retrans)
         {
           m_retrans -= item->m_packet->GetSize ();
         }
       m_appList.insert (m_appList.begin (), item);
+      // the item will be sent again as it is
+      LowerHints (item->m_startSeq);
     }
   ConsistencyCheck ();
 }
@@ -1273,6 +1369,7 @@ TcpTxBuffer::SetSentListLost (bool resetSack)
 
       (*it)->m_retrans = false;
     }
+  LowerHints (m_firstByteSeq);
 
   NS_LOG_INFO ("Set sent list lost, status: " << *this);
   NS_ASSERT_MSG (m_sentSize >= m_sackedOut + m_lostOut, *this);
@@ -1306,6 +1403,7 @@ TcpTxBuffer::DeleteRetransmittedFlagFromHead ()
     {
       m_sentList.front ()->m_retrans = false;
       m_retrans -= m_sentList.front ()->m_packet->GetSize ();
+      LowerHints (m_firstByteSeq);
     }
   ConsistencyCheck ();
 }
@@ -1335,6 +1433,7 @@ TcpTxBuffer::MarkHeadAsLost ()
           m_sentList.front()->m_lost = true;
           m_lostOut += m_sentList.front ()->m_packet->GetSize ();
         }
+      LowerHints (m_firstByteSeq);
     }
   ConsistencyCheck ();
 }
@@ -1411,6 +1510,86 @@ TcpTxBuffer::ConsistencyCheck () const
                  " stored retrans: " << m_retrans);
 }
 
+TcpTxBuffer::PacketList::const_iterator
+TcpTxBuffer::FindSentFrom (const SequenceNumber32 &seq) const
+{
+  if (!m_sequenceIndex)
+    {
+      auto it = m_sentList.begin ();
+      while (it != m_sentList.end () && (*it)->m_startSeq < seq)
+        {
+          ++it;
+        }
+      return it;
+    }
+
+  auto pos = std::lower_bound (m_sentIndex.begin (), m_sentIndex.end (), seq,
+                               [] (const PacketList::iterator &item, const SequenceNumber32 &s)
+                               { return (*item)->m_startSeq < s; });
+  if (pos == m_sentIndex.end ())
+    {
+      return m_sentList.end ();
+    }
+  return *pos;
+}
+
+TcpTxBuffer::PacketList::iterator
+TcpTxBuffer::FindSentItem (const SequenceNumber32 &seq)
+{
+  if (!m_sequenceIndex)
+    {
+      auto found = m_sentList.end ();
+      for (auto it = m_sentList.begin (); it != m_sentList.end () && (*it)->m_startSeq <= seq; ++it)
+        {
+          found = it;
+        }
+      return found;
+    }
+
+  auto pos = std::upper_bound (m_sentIndex.begin (), m_sentIndex.end (), seq,
+                               [] (const SequenceNumber32 &s, const PacketList::iterator &item)
+                               { return s < (*item)->m_startSeq; });
+  if (pos == m_sentIndex.begin ())
+    {
+      return m_sentList.end ();
+    }
+  return *(--pos);
+}
+
+void
+TcpTxBuffer::RebuildIndex ()
+{
+  m_sentIndex.clear ();
+  if (m_sequenceIndex)
+    {
+      for (auto it = m_sentList.begin (); it != m_sentList.end (); ++it)
+        {
+          m_sentIndex.push_back (it);
+        }
+    }
+}
+
+void
+TcpTxBuffer::ResetHints ()
+{
+  m_lostFrontier = m_firstByteSeq;
+  m_retransHint = m_firstByteSeq;
+  m_lostHint = m_firstByteSeq;
+}
+
+void
+TcpTxBuffer::LowerHints (const SequenceNumber32 &seq) const
+{
+  if (seq < m_retransHint)
+    {
+      m_retransHint = seq;
+    }
+  if (seq < m_lostHint)
+    {
+      m_lostHint = seq;
+    }
+}
+
 std::ostream &
 operator<< (std::ostream & os, TcpTxItem const & item)
 {
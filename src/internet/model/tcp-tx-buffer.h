@@ -22,6 +22,8 @@
 #ifndef TCP_TX_BUFFER_H
 #define TCP_TX_BUFFER_H
 
+#include <deque>
+
 #include "ns3/object.h"
 #include "ns3/traced-value.h"
 #include "ns3/sequence-number.h"
@@ -114,6 +116,21 @@ class Packet;
  * connection, the TcpSocketImplementation should provide hints through
  * the MarkHeadAsLost and AddRenoSack methods.
  *
+ * Sequence index
+ * --------------
+ *
+ * With large windows, walking the sent list for each SACK block, for each
+ * check of a lost sequence and for each NextSeg dominates the processing of
+ * the ACKs. When the attribute SequenceIndex is true (the default) the
+ * class keeps a double-ended queue of iterators to the items of the sent
+ * list, ordered by sequence number: the items are appended and removed at
+ * its ends as they are sent and acknowledged, and a binary search finds the
+ * item of a sequence number. The class also remembers how far the sent
+ * list is known to hold no segment to mark as lost (UpdateLostCount) and
+ * no segment to retransmit (NextSeg), so that those walks resume where the
+ * previous one stopped. The results are the same with and without the
+ * index.
+ *
  * \see BytesInFlight
  * \see Size
  * \see SizeFromSequence
@@ -172,6 +189,18 @@ public:
    */
   uint32_t Available (void) const;
 
+  /**
+   * \brief Enable or disable the index of the sent list by sequence number
+   * \param enable true to look up the sent segments through the index
+   */
+  void SetSequenceIndex (bool enable);
+
+  /**
+   * \brief Check whether the sent list is indexed by sequence number
+   * \return true if the sent segments are looked up through the index
+   */
+  bool GetSequenceIndex (void) const;
+
   /**
    * \brief Set the DupAckThresh
    * \param dupAckThresh the threshold
@@ -526,14 +555,19 @@ private:
    * MSS can change, but it is stable, and retransmissions do not happen for
    * each segment).
    *
+   * The walk starts from the given item of the list, which must not be
+   * after the item containing the requested sequence.
+   *
    * \param list List to extract block from
-   * \param startingSeq Starting sequence of the list
+   * \param it Item of the list to start from
+   * \param startingSeq Starting sequence of that item
    * \param numBytes Bytes to extract, starting from requestedSeq
    * \param requestedSeq Requested sequence
    * \param listEdited output parameter which indicates if the list has been edited
    * \return the item that contains the right packet
    */
-  TcpTxItem* GetPacketFromList (PacketList &list, const SequenceNumber32 &startingSeq,
+  TcpTxItem* GetPacketFromList (PacketList &list, PacketList::iterator it,
+                                const SequenceNumber32 &startingSeq,
                                 uint32_t numBytes, const SequenceNumber32 &requestedSeq,
                                 bool *listEdited = nullptr) const;
 
@@ -567,6 +601,39 @@ private:
    */
   void ConsistencyCheck () const;
 
+  /**
+   * \brief Find the first item of the sent list starting at or after a sequence
+   * \param seq the sequence
+   * \return an iterator to the item, or the end of the sent list
+   */
+  PacketList::const_iterator FindSentFrom (const SequenceNumber32 &seq) const;
+
+  /**
+   * \brief Find the item of the sent list containing a sequence
+   * \param seq the sequence
+   * \return an iterator to the last item starting at or before seq, or the
+   * end of the sent list if there is none
+   */
+  PacketList::iterator FindSentItem (const SequenceNumber32 &seq);
+
+  /**
+   * \brief Index again all the items of the sent list, after it has been edited
+   */
+  void RebuildIndex ();
+
+  /**
+   * \brief Forget the hints of UpdateLostCount and NextSeg, after the flags
+   * of the items have been reset
+   */
+  void ResetHints ();
+
+  /**
+   * \brief Move the hints of NextSeg back, after the flags of an item have
+   * changed such that it may have to be retransmitted
+   * \param seq the starting sequence of the item
+   */
+  void LowerHints (const SequenceNumber32 &seq) const;
+
   /**
    * \brief Find the highest SACK byte
    * \return a pair with the highest byte and an iterator inside m_sentList
@@ -591,6 +658,12 @@ private:
   uint32_t m_segmentSize {0}; //!< Segment size from TcpSocketBase
   bool     m_renoSack {false}; //!< Indicates if AddRenoSack was called
 
+  bool m_sequenceIndex {true}; //!< Whether the sent list is indexed by sequence number
+  std::deque<PacketList::iterator> m_sentIndex; //!< The items of the sent list, in order (if indexed)
+  SequenceNumber32 m_lostFrontier;            //!< Every sent item below it is either lost or sacked
+  mutable SequenceNumber32 m_retransHint;     //!< Every sent item below it is either retransmitted or sacked
+  mutable SequenceNumber32 m_lostHint;        //!< No sent item below it is lost and still to retransmit
+
   static Callback<void, TcpTxItem *> m_nullCb; //!< Null callback for an item
 };
 
@@ -28,6 +28,7 @@
 #include "ns3/ipv4-route.h"
 #include "ns3/ipv6-route.h"
 #include "ns3/ipv6-header.h"
+#include "ns3/traffic-control-layer.h"
 
 #include "udp-l4-protocol.h"
 #include "udp-header.h"
@@ -458,6 +459,41 @@ UdpL4Protocol::Send (Ptr<Packet> packet,
   m_downTarget (packet, saddr, daddr, PROT_NUMBER, route);
 }
 
+void
+UdpL4Protocol::SendBurst (const std::vector<Ptr<Packet> > &packets,
+                          Ipv4Address saddr, Ipv4Address daddr,
+                          uint16_t sport, uint16_t dport, Ptr<Ipv4Route> route)
+{
+  NS_LOG_FUNCTION (this << packets.size () << saddr << daddr << sport << dport << route);
+
+  // the pseudo-header is the same for all the packets
+  UdpHeader udpHeader;
+  if(Node::ChecksumEnabled ())
+    {
+      udpHeader.EnableChecksums ();
+      udpHeader.InitializeChecksum (saddr,
+                                    daddr,
+                                    PROT_NUMBER);
+    }
+  udpHeader.SetDestinationPort (dport);
+  udpHeader.SetSourcePort (sport);
+
+  Ptr<TrafficControlLayer> tc = m_node->GetObject<TrafficControlLayer> ();
+  if (tc)
+    {
+      tc->StartBurst ();
+    }
+  for (const auto &packet : packets)
+    {
+      packet->AddHeader (udpHeader);
+      m_downTarget (packet, saddr, daddr, PROT_NUMBER, route);
+    }
+  if (tc)
+    {
+      tc->EndBurst ();
+    }
+}
+
 void
 UdpL4Protocol::Send (Ptr<Packet> packet,
                      Ipv6Address saddr, Ipv6Address daddr,
@@ -22,6 +22,7 @@
 #define UDP_L4_PROTOCOL_H
 
 #include <stdint.h>
+#include <vector>
 
 #include "ns3/packet.h"
 #include "ns3/ptr.h"
@@ -197,6 +198,22 @@ public:
   void Send (Ptr<Packet> packet,
              Ipv4Address saddr, Ipv4Address daddr, 
              uint16_t sport, uint16_t dport, Ptr<Ipv4Route> route);
+  /**
+   * \brief Send a burst of packets via UDP (IPv4)
+   *
+   * The packets are sent down to IP one after the other, within a burst of
+   * the traffic control layer, so that they reach the device in one call.
+   *
+   * \param packets The packets to send, in order
+   * \param saddr The source Ipv4Address
+   * \param daddr The destination Ipv4Address
+   * \param sport The source port number
+   * \param dport The destination port number
+   * \param route The route
+   */
+  void SendBurst (const std::vector<Ptr<Packet> > &packets,
+                  Ipv4Address saddr, Ipv4Address daddr,
+                  uint16_t sport, uint16_t dport, Ptr<Ipv4Route> route);
   /**
    * \brief Send a packet via UDP (IPv6)
    * \param packet The packet to send
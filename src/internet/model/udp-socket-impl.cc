@@ -443,6 +443,109 @@ UdpSocketImpl::Send (Ptr<Packet> p, uint32_t flags)
   return DoSend (p);
 }
 
+int
+UdpSocketImpl::SendBurst (const std::vector<Ptr<Packet> > &packets, std::size_t first, std::size_t last,
+                          uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << packets.size () << first << last << flags);
+  NS_ASSERT (first <= last && last <= packets.size ());
+
+  if (!m_connected)
+    {
+      m_errno = ERROR_NOTCONN;
+      return -1;
+    }
+
+  // Only the unicast packets to an IPv4 peer reached through the routing
+  // protocol are sent as a burst; the other cases are rare enough to be
+  // sent one at a time
+  Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4> ();
+  if (first == last || !Ipv4Address::IsMatchingType (m_defaultAddress)
+      || ipv4->GetRoutingProtocol () == 0)
+    {
+      return Socket::SendBurst (packets, first, last, flags);
+    }
+  Ipv4Address dest = Ipv4Address::ConvertFrom (m_defaultAddress);
+  if (dest.IsBroadcast () || dest.IsMulticast ())
+    {
+      return Socket::SendBurst (packets, first, last, flags);
+    }
+  if (m_endPoint == 0)
+    {
+      if (Bind () == -1)
+        {
+          NS_ASSERT (m_endPoint == 0);
+          return -1;
+        }
+      NS_ASSERT (m_endPoint != 0);
+    }
+  if (m_endPoint->GetLocalAddress () != Ipv4Address::GetAny ())
+    {
+      return Socket::SendBurst (packets, first, last, flags);
+    }
+  if (m_shutdownSend)
+    {
+      m_errno = ERROR_SHUTDOWN;
+      return -1;
+    }
+
+  std::vector<Ptr<Packet> > copies;
+  copies.reserve (last - first);
+  for (std::size_t i = first; i < last; i++)
+    {
+      const Ptr<Packet> &p = packets[i];
+      if (p->GetSize () > GetTxAvailable ())
+        {
+          m_errno = ERROR_MSGSIZE;
+          break;
+        }
+      AddSendTags (p, dest, GetIpTos ());
+      copies.push_back (p->Copy ());
+    }
+  if (copies.empty ())
+    {
+      return -1;
+    }
+
+  // the route of the first packet is used for the whole burst
+  Ipv4Header header;
+  header.SetDestination (dest);
+  header.SetProtocol (UdpL4Protocol::PROT_NUMBER);
+  Socket::SocketErrno errno_;
+  Ptr<NetDevice> oif = m_boundnetdevice; //specify non-zero if bound to a specific device
+  Ptr<Ipv4Route> route = ipv4->GetRoutingProtocol ()->RouteOutput (copies.front (), header, oif, errno_);
+  if (route == 0)
+    {
+      NS_LOG_LOGIC ("No route to destination");
+      NS_LOG_ERROR (errno_);
+      m_errno = errno_;
+      return -1;
+    }
+  if (!m_allowBroadcast)
+    {
+      // Here we try to route subnet-directed broadcasts
+      uint32_t outputIfIndex = ipv4->GetInterfaceForDevice (route->GetOutputDevice ());
+      uint32_t ifNAddr = ipv4->GetNAddresses (outputIfIndex);
+      for (uint32_t addrI = 0; addrI < ifNAddr; ++addrI)
+        {
+          Ipv4InterfaceAddress ifAddr = ipv4->GetAddress (outputIfIndex, addrI);
+          if (dest == ifAddr.GetBroadcast ())
+            {
+              m_errno = ERROR_OPNOTSUPP;
+              return -1;
+            }
+        }
+    }
+
+  m_udp->SendBurst (copies, route->GetSource (), dest,
+                    m_endPoint->GetLocalPort (), m_defaultPort, route);
+  for (std::size_t i = 0; i < copies.size (); i++)
+    {
+      NotifyDataSent (packets[first + i]->GetSize ());
+    }
+  return copies.size ();
+}
+
 int 
 UdpSocketImpl::DoSend (Ptr<Packet> p)
 {
@@ -513,62 +616,10 @@ UdpSocketImpl::DoSendTo (Ptr<Packet> p, Ipv4Address dest, uint16_t port, uint8_t
       return -1;
     }
 
-  uint8_t priority = GetPriority ();
-  if (tos)
-    {
-      SocketIpTosTag ipTosTag;
-      ipTosTag.SetTos (tos);
-      // This packet may already have a SocketIpTosTag (see BUG 2440)
-      p->ReplacePacketTag (ipTosTag);
-      priority = IpTos2Priority (tos);
-    }
-
-  if (priority)
-    {
-      SocketPriorityTag priorityTag;
-      priorityTag.SetPriority (priority);
-      p->ReplacePacketTag (priorityTag);
-    }
+  AddSendTags (p, dest, tos);
 
   Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4> ();
 
-  // Locally override the IP TTL for this socket
-  // We cannot directly modify the TTL at this stage, so we set a Packet tag
-  // The destination can be either multicast, unicast/anycast, or
-  // either all-hosts broadcast or limited (subnet-directed) broadcast.
-  // For the latter two broadcast types, the TTL will later be set to one
-  // irrespective of what is set in these socket options.  So, this tagging
-  // may end up setting the TTL of a limited broadcast packet to be
-  // the same as a unicast, but it will be fixed further down the stack
-  if (m_ipMulticastTtl != 0 && dest.IsMulticast ())
-    {
-      SocketIpTtlTag tag;
-      tag.SetTtl (m_ipMulticastTtl);
-      p->AddPacketTag (tag);
-    }
-  else if (IsManualIpTtl () && GetIpTtl () != 0 && !dest.IsMulticast () && !dest.IsBroadcast ())
-    {
-      SocketIpTtlTag tag;
-      tag.SetTtl (GetIpTtl ());
-      p->AddPacketTag (tag);
-    }
-  {
-    SocketSetDontFragmentTag tag;
-    bool found = p->RemovePacketTag (tag);
-    if (!found)
-      {
-        if (m_mtuDiscover)
-          {
-            tag.Enable ();
-          }
-        else
-          {
-            tag.Disable ();
-          }
-        p->AddPacketTag (tag);
-      }
-  }
-
   // Note that some systems will only send limited broadcast packets
   // out of the "default" interface; here we send it out all interfaces
   if (dest.IsBroadcast ())
@@ -662,6 +713,65 @@ UdpSocketImpl::DoSendTo (Ptr<Packet> p, Ipv4Address dest, uint16_t port, uint8_t
   return 0;
 }
 
+void
+UdpSocketImpl::AddSendTags (Ptr<Packet> p, Ipv4Address dest, uint8_t tos)
+{
+  NS_LOG_FUNCTION (this << p << dest << (uint16_t) tos);
+  uint8_t priority = GetPriority ();
+  if (tos)
+    {
+      SocketIpTosTag ipTosTag;
+      ipTosTag.SetTos (tos);
+      // This packet may already have a SocketIpTosTag (see BUG 2440)
+      p->ReplacePacketTag (ipTosTag);
+      priority = IpTos2Priority (tos);
+    }
+
+  if (priority)
+    {
+      SocketPriorityTag priorityTag;
+      priorityTag.SetPriority (priority);
+      p->ReplacePacketTag (priorityTag);
+    }
+
+  // Locally override the IP TTL for this socket
+  // We cannot directly modify the TTL at this stage, so we set a Packet tag
+  // The destination can be either multicast, unicast/anycast, or
+  // either all-hosts broadcast or limited (subnet-directed) broadcast.
+  // For the latter two broadcast types, the TTL will later be set to one
+  // irrespective of what is set in these socket options.  So, this tagging
+  // may end up setting the TTL of a limited broadcast packet to be
+  // the same as a unicast, but it will be fixed further down the stack
+  if (m_ipMulticastTtl != 0 && dest.IsMulticast ())
+    {
+      SocketIpTtlTag tag;
+      tag.SetTtl (m_ipMulticastTtl);
+      p->AddPacketTag (tag);
+    }
+  else if (IsManualIpTtl () && GetIpTtl () != 0 && !dest.IsMulticast () && !dest.IsBroadcast ())
+    {
+      SocketIpTtlTag tag;
+      tag.SetTtl (GetIpTtl ());
+      p->AddPacketTag (tag);
+    }
+  {
+    SocketSetDontFragmentTag tag;
+    bool found = p->RemovePacketTag (tag);
+    if (!found)
+      {
+        if (m_mtuDiscover)
+          {
+            tag.Enable ();
+          }
+        else
+          {
+            tag.Disable ();
+          }
+        p->AddPacketTag (tag);
+      }
+  }
+}
+
 int
 UdpSocketImpl::DoSendTo (Ptr<Packet> p, Ipv6Address dest, uint16_t port)
 {
@@ -104,6 +104,9 @@ public:
   virtual int Listen (void);
   virtual uint32_t GetTxAvailable (void) const;
   virtual int Send (Ptr<Packet> p, uint32_t flags);
+  using Socket::SendBurst;
+  virtual int SendBurst (const std::vector<Ptr<Packet> > &packets, std::size_t first, std::size_t last,
+                         uint32_t flags);
   virtual int SendTo (Ptr<Packet> p, uint32_t flags, const Address &address);
   virtual uint32_t GetRxAvailable (void) const;
   virtual Ptr<Packet> Recv (uint32_t maxSize, uint32_t flags);
@@ -209,6 +212,13 @@ private:
    * \returns 0 on success, -1 on failure
    */
   int DoSendTo (Ptr<Packet> p, Ipv6Address daddr, uint16_t dport);
+  /**
+   * \brief Add to a packet the tags carrying the socket options (IPv4)
+   * \param p packet
+   * \param daddr destination address
+   * \param tos ToS
+   */
+  void AddSendTags (Ptr<Packet> p, Ipv4Address daddr, uint8_t tos);
 
   /**
    * \brief Called by the L3 protocol when it received an ICMP packet to pass on to TCP.
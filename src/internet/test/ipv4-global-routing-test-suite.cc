@@ -15,6 +15,7 @@
  */
 
 #include <vector>
+#include <sstream>
 #include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/inet-socket-address.h"
@@ -1244,6 +1245,171 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 GlobalRouting incremental and parallel update test
+ *
+ * Check that updating the routing tables after interfaces go down and up
+ * again, or computing them in several threads, yields the same routing
+ * tables as recomputing them from scratch.
+ */
+class Ipv4GlobalRoutingUpdateTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingUpdateTestCase ();
+
+private:
+  virtual void DoSetup (void);
+  virtual void DoRun (void);
+  /**
+   * \brief Get the global routes of all the nodes.
+   * \returns the routes, a node per line
+   */
+  std::string GetRoutes (void) const;
+  /**
+   * \brief Change the state of an interface, then check that updating the
+   * routing tables yields the same routes as recomputing them.
+   * \param node the node of the interface
+   * \param device the device of the interface
+   * \param up whether to set the interface up or down
+   * \returns the routes after the change
+   */
+  std::string CheckUpdate (uint32_t node, Ptr<NetDevice> device, bool up);
+
+  NodeContainer m_core;              //!< The core routers, on a ring
+  NodeContainer m_leaves;            //!< The routers with a single link to the core
+  NodeContainer m_nodes;             //!< All the nodes
+  NetDeviceContainer m_ring;         //!< The devices of the ring, two per link
+  NetDeviceContainer m_uplinks;      //!< The devices of the leaves to the core, two per link
+};
+
+Ipv4GlobalRoutingUpdateTestCase::Ipv4GlobalRoutingUpdateTestCase ()
+  : TestCase ("Incremental and parallel update of the global routes")
+{
+}
+
+void
+Ipv4GlobalRoutingUpdateTestCase::DoSetup (void)
+{
+  m_core.Create (4);
+  m_leaves.Create (3);
+  NodeContainer lan;
+  lan.Create (1);
+  m_nodes.Add (m_core);
+  m_nodes.Add (m_leaves);
+  m_nodes.Add (lan);
+
+  InternetStackHelper internet;
+  Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+  internet.SetRoutingHelper (ipv4RoutingHelper);
+  internet.Install (m_nodes);
+
+  SimpleNetDeviceHelper p2pHelper;
+  p2pHelper.SetNetDevicePointToPointMode (true);
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.0.0", "255.255.255.252");
+  // the core ring, whose opposite routers have two paths between them
+  for (uint32_t i = 0; i < m_core.GetN (); i++)
+    {
+      NetDeviceContainer link = p2pHelper.Install (NodeContainer (m_core.Get (i), m_core.Get ((i + 1) % m_core.GetN ())));
+      ipv4.Assign (link);
+      ipv4.NewNetwork ();
+      m_ring.Add (link);
+    }
+  // the leaves, each with a stub network
+  ipv4.SetBase ("10.2.0.0", "255.255.255.252");
+  Ipv4AddressHelper stubs;
+  stubs.SetBase ("192.168.0.0", "255.255.255.0");
+  SimpleNetDeviceHelper lanHelper;
+  for (uint32_t i = 0; i < m_leaves.GetN (); i++)
+    {
+      NetDeviceContainer link = p2pHelper.Install (NodeContainer (m_leaves.Get (i), m_core.Get (i)));
+      ipv4.Assign (link);
+      ipv4.NewNetwork ();
+      m_uplinks.Add (link);
+      stubs.Assign (lanHelper.Install (m_leaves.Get (i)));
+      stubs.NewNetwork ();
+    }
+  // a transit network between two core routers and another router
+  stubs.Assign (lanHelper.Install (NodeContainer (m_core.Get (0), m_core.Get (2), lan.Get (0))));
+}
+
+std::string
+Ipv4GlobalRoutingUpdateTestCase::GetRoutes (void) const
+{
+  std::ostringstream routes;
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      Ptr<Ipv4GlobalRouting> routing = m_nodes.Get (i)->GetObject<Ipv4> ()->GetRoutingProtocol ()->GetObject<Ipv4GlobalRouting> ();
+      for (uint32_t j = 0; j < routing->GetNRoutes (); j++)
+        {
+          routes << *routing->GetRoute (j) << "; ";
+        }
+      routes << std::endl;
+    }
+  return routes.str ();
+}
+
+std::string
+Ipv4GlobalRoutingUpdateTestCase::CheckUpdate (uint32_t node, Ptr<NetDevice> device, bool up)
+{
+  Ptr<Ipv4> ipv4 = m_nodes.Get (node)->GetObject<Ipv4> ();
+  int32_t interface = ipv4->GetInterfaceForDevice (device);
+  if (up)
+    {
+      ipv4->SetUp (interface);
+    }
+  else
+    {
+      ipv4->SetDown (interface);
+    }
+  Ipv4GlobalRoutingHelper::UpdateRoutingTables ();
+  std::string updated = GetRoutes ();
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  std::string recomputed = GetRoutes ();
+  NS_TEST_EXPECT_MSG_EQ (updated, recomputed, "Routes of node " << node << " interface " << interface <<
+                         (up ? " up" : " down") << " not updated");
+  return recomputed;
+}
+
+void
+Ipv4GlobalRoutingUpdateTestCase::DoRun (void)
+{
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+  std::string initial = GetRoutes ();
+
+  // a leaf loses its link, from its side and from the side of the core
+  std::string down = CheckUpdate (4, m_uplinks.Get (0), false);
+  NS_TEST_EXPECT_MSG_NE (down, initial, "The routes to the leaf were not removed");
+  NS_TEST_EXPECT_MSG_EQ (CheckUpdate (4, m_uplinks.Get (0), true), initial, "The routes to the leaf were not restored");
+  CheckUpdate (1, m_uplinks.Get (3), false);
+  NS_TEST_EXPECT_MSG_EQ (CheckUpdate (1, m_uplinks.Get (3), true), initial, "The routes to the leaf were not restored");
+  // two leaves at once
+  Ptr<Ipv4> ipv4 = m_nodes.Get (5)->GetObject<Ipv4> ();
+  ipv4->SetDown (ipv4->GetInterfaceForDevice (m_uplinks.Get (2)));
+  CheckUpdate (6, m_uplinks.Get (4), false);
+  ipv4->SetUp (ipv4->GetInterfaceForDevice (m_uplinks.Get (2)));
+  NS_TEST_EXPECT_MSG_EQ (CheckUpdate (6, m_uplinks.Get (4), true), initial, "The routes to the leaves were not restored");
+  // a link of the core
+  CheckUpdate (0, m_ring.Get (0), false);
+  NS_TEST_EXPECT_MSG_EQ (CheckUpdate (0, m_ring.Get (0), true), initial, "The routes of the core were not restored");
+  // nothing changed
+  Ipv4GlobalRoutingHelper::UpdateRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (GetRoutes (), initial, "The routes changed");
+
+  // the same routes in several threads
+  Config::SetGlobal ("GlobalRoutingSpfThreads", UintegerValue (4));
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (GetRoutes (), initial, "The routes computed in several threads differ");
+  NS_TEST_EXPECT_MSG_EQ (CheckUpdate (4, m_uplinks.Get (0), false), down, "The routes computed in several threads differ");
+  NS_TEST_EXPECT_MSG_EQ (CheckUpdate (4, m_uplinks.Get (0), true), initial, "The routes computed in several threads differ");
+  Config::SetGlobal ("GlobalRoutingSpfThreads", UintegerValue (1));
+
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -1267,6 +1433,7 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite ()
     AddTestCase (new TwoBridgeTest, TestCase::QUICK);
     AddTestCase (new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase (new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase (new Ipv4GlobalRoutingUpdateTestCase, TestCase::QUICK);
   }
 
 static Ipv4GlobalRoutingTestSuite g_globalRoutingTestSuite; //!< Static variable for test initialization
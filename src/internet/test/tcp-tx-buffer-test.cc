@@ -20,6 +20,8 @@
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
+#include <set>
 
 using namespace ns3;
 
@@ -34,8 +36,11 @@ NS_LOG_COMPONENT_DEFINE ("TcpTxBufferTestSuite");
 class TcpTxBufferTestCase : public TestCase
 {
 public:
-  /** \brief Constructor */
-  TcpTxBufferTestCase ();
+  /**
+   * \brief Constructor
+   * \param sequenceIndex whether the buffers index the sent list by sequence number
+   */
+  TcpTxBufferTestCase (bool sequenceIndex);
 
 private:
   virtual void DoRun (void);
@@ -49,10 +54,13 @@ private:
   void TestTransmittedBlock ();
   /** \brief Test the generation of the "next" block */
   void TestNextSeg ();
+
+  bool m_sequenceIndex; //!< Whether the buffers index the sent list by sequence number
 };
 
-TcpTxBufferTestCase::TcpTxBufferTestCase ()
-  : TestCase ("TcpTxBuffer Test")
+TcpTxBufferTestCase::TcpTxBufferTestCase (bool sequenceIndex)
+  : TestCase (sequenceIndex ? "TcpTxBuffer Test with sequence index" : "TcpTxBuffer Test"),
+    m_sequenceIndex (sequenceIndex)
 {
 }
 
@@ -90,6 +98,7 @@ void
 TcpTxBufferTestCase::TestIsLost ()
 {
   TcpTxBuffer txBuf;
+  txBuf.SetSequenceIndex (m_sequenceIndex);
   SequenceNumber32 head (1);
   txBuf.SetHeadSequence (head);
   SequenceNumber32 ret;
@@ -137,6 +146,7 @@ void
 TcpTxBufferTestCase::TestNextSeg ()
 {
   TcpTxBuffer txBuf;
+  txBuf.SetSequenceIndex (m_sequenceIndex);
   SequenceNumber32 head (1);
   SequenceNumber32 ret;
   txBuf.SetSegmentSize (150);
@@ -272,6 +282,7 @@ TcpTxBufferTestCase::TestNewBlock ()
 {
   // Manually recreating all the conditions
   TcpTxBuffer txBuf;
+  txBuf.SetSequenceIndex (m_sequenceIndex);
   txBuf.SetHeadSequence (SequenceNumber32 (1));
   txBuf.SetSegmentSize (100);
 
@@ -347,6 +358,136 @@ TcpTxBufferTestCase::DoTeardown ()
 {
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that the sequence index does not change the scoreboard
+ *
+ * Two buffers, one with the sequence index and one without, go through the
+ * same random sequence of transmissions, SACK blocks, cumulative ACKs and
+ * timeouts, starting close to the wrap around of the sequence numbers; they
+ * must agree on every query.
+ */
+class TcpTxBufferSequenceIndexTestCase : public TestCase
+{
+public:
+  /** \brief Constructor */
+  TcpTxBufferSequenceIndexTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * \brief Compare the state of the two buffers
+   * \param step the number of the step
+   */
+  void Check (uint32_t step);
+
+  TcpTxBuffer m_indexed;                //!< Buffer with the sequence index
+  TcpTxBuffer m_walked;                 //!< Buffer without the sequence index
+  SequenceNumber32 m_highTx;            //!< Highest sequence sent, plus one
+};
+
+TcpTxBufferSequenceIndexTestCase::TcpTxBufferSequenceIndexTestCase ()
+  : TestCase ("TcpTxBuffer scoreboard with and without sequence index")
+{
+}
+
+void
+TcpTxBufferSequenceIndexTestCase::Check (uint32_t step)
+{
+  NS_TEST_ASSERT_MSG_EQ (m_indexed.HeadSequence (), m_walked.HeadSequence (), "Different head at step " << step);
+  NS_TEST_ASSERT_MSG_EQ (m_indexed.BytesInFlight (), m_walked.BytesInFlight (), "Different bytes in flight at step " << step);
+  NS_TEST_ASSERT_MSG_EQ (m_indexed.GetLost (), m_walked.GetLost (), "Different lost bytes at step " << step);
+  NS_TEST_ASSERT_MSG_EQ (m_indexed.GetSacked (), m_walked.GetSacked (), "Different sacked bytes at step " << step);
+  NS_TEST_ASSERT_MSG_EQ (m_indexed.GetRetransmitsCount (), m_walked.GetRetransmitsCount (),
+                         "Different retransmitted bytes at step " << step);
+  for (SequenceNumber32 seq = m_indexed.HeadSequence (); seq < m_highTx; seq += 700)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_indexed.IsLost (seq), m_walked.IsLost (seq),
+                             "Different loss of " << seq << " at step " << step);
+    }
+}
+
+void
+TcpTxBufferSequenceIndexTestCase::DoRun ()
+{
+  const uint32_t segmentSize = 100;
+  const uint32_t window = 200 * segmentSize;
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  rng->SetStream (1);
+
+  m_highTx = SequenceNumber32 (0xffffe000);
+  m_indexed.SetSequenceIndex (true);
+  m_walked.SetSequenceIndex (false);
+  for (TcpTxBuffer *txBuf : {&m_indexed, &m_walked})
+    {
+      txBuf->SetHeadSequence (m_highTx);
+      txBuf->SetSegmentSize (segmentSize);
+      txBuf->SetDupAckThresh (3);
+      txBuf->SetMaxBufferSize (100000000);
+      txBuf->Add (Create<Packet> (50000000));
+    }
+
+  std::set<SequenceNumber32> sacked;
+  for (uint32_t step = 0; step < 20000; step++)
+    {
+      SequenceNumber32 head = m_indexed.HeadSequence ();
+      uint32_t sentSegments = (m_highTx - head) / segmentSize;
+      uint32_t op = rng->GetInteger (0, 19);
+      if (op < 10)
+        {
+          // transmit the next segment, new or retransmitted
+          bool recovery = (m_indexed.GetSacked () > 0);
+          SequenceNumber32 seq1;
+          SequenceNumber32 seq2;
+          bool ret1 = m_indexed.NextSeg (&seq1, recovery);
+          bool ret2 = m_walked.NextSeg (&seq2, recovery);
+          NS_TEST_ASSERT_MSG_EQ (ret1, ret2, "Different NextSeg at step " << step);
+          NS_TEST_ASSERT_MSG_EQ (seq1, seq2, "Different NextSeg sequence at step " << step);
+          if (ret1 && (seq1 < m_highTx || m_highTx - head < window))
+            {
+              m_indexed.CopyFromSequence (segmentSize, seq1);
+              m_walked.CopyFromSequence (segmentSize, seq1);
+              m_highTx = std::max (m_highTx, seq1 + segmentSize);
+            }
+        }
+      else if (op < 17 && sentSegments > 1)
+        {
+          // SACK a segment, never the head
+          SequenceNumber32 begin = head + segmentSize * rng->GetInteger (1, sentSegments - 1);
+          TcpOptionSack::SackList list;
+          list.push_back (TcpOptionSack::SackBlock (begin, begin + segmentSize));
+          NS_TEST_ASSERT_MSG_EQ (m_indexed.Update (list), m_walked.Update (list),
+                                 "Different bytes sacked at step " << step);
+          sacked.insert (begin);
+        }
+      else if (op < 19 && sentSegments > 0)
+        {
+          // cumulative ACK, which does not leave a sacked segment at the head
+          SequenceNumber32 ack = head + segmentSize * rng->GetInteger (1, std::min (sentSegments, 20u));
+          if (sacked.count (ack) == 0)
+            {
+              m_indexed.DiscardUpTo (ack);
+              m_walked.DiscardUpTo (ack);
+              sacked.erase (sacked.begin (), sacked.lower_bound (ack));
+            }
+        }
+      else if (op == 19 && rng->GetValue () < 0.1)
+        {
+          // retransmission timeout
+          m_indexed.SetSentListLost ();
+          m_walked.SetSentListLost ();
+        }
+      Check (step);
+      if (IsStatusFailure ())
+        {
+          return;
+        }
+    }
+  NS_TEST_ASSERT_MSG_GT (m_indexed.HeadSequence (), SequenceNumber32 (0), "The sequence numbers did not wrap around");
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -359,7 +500,9 @@ public:
   TcpTxBufferTestSuite ()
     : TestSuite ("tcp-tx-buffer", UNIT)
   {
-    AddTestCase (new TcpTxBufferTestCase, TestCase::QUICK);
+    AddTestCase (new TcpTxBufferTestCase (false), TestCase::QUICK);
+    AddTestCase (new TcpTxBufferTestCase (true), TestCase::QUICK);
+    AddTestCase (new TcpTxBufferSequenceIndexTestCase, TestCase::QUICK);
   }
 };
 
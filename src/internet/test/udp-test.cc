@@ -478,6 +478,169 @@ UdpSocketImplTest::DoRun (void)
 
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief UDP Socket burst over IPv4 Test
+ */
+class UdpSocketBurstTest : public TestCase
+{
+  std::vector<uint32_t> m_received; //!< Sizes of the packets received.
+  uint32_t m_dataSent;              //!< Number of packets notified as sent.
+  int m_sent;                       //!< Value returned by SendBurst.
+
+  /**
+   * \brief Send a burst of packets.
+   * \param socket The sending socket.
+   * \param packets The packets.
+   */
+  void DoSendBurst (Ptr<Socket> socket, std::vector<Ptr<Packet> > packets);
+  /**
+   * \brief Send a burst of packets and run the simulation.
+   * \param socket The sending socket.
+   * \param packets The packets.
+   */
+  void SendBurst (Ptr<Socket> socket, std::vector<Ptr<Packet> > packets);
+
+public:
+  virtual void DoRun (void);
+  UdpSocketBurstTest ();
+
+  /**
+   * \brief Receive packets.
+   * \param socket The receiving socket.
+   */
+  void ReceivePkt (Ptr<Socket> socket);
+  /**
+   * \brief Count the packets notified as sent.
+   * \param socket The sending socket.
+   * \param size The size of the packet.
+   */
+  void DataSent (Ptr<Socket> socket, uint32_t size);
+};
+
+UdpSocketBurstTest::UdpSocketBurstTest ()
+  : TestCase ("UDP socket burst"),
+    m_dataSent (0),
+    m_sent (0)
+{
+}
+
+void UdpSocketBurstTest::ReceivePkt (Ptr<Socket> socket)
+{
+  Ptr<Packet> packet;
+  while ((packet = socket->Recv ()))
+    {
+      m_received.push_back (packet->GetSize ());
+    }
+}
+
+void UdpSocketBurstTest::DataSent (Ptr<Socket> socket, uint32_t size)
+{
+  m_dataSent++;
+}
+
+void
+UdpSocketBurstTest::DoSendBurst (Ptr<Socket> socket, std::vector<Ptr<Packet> > packets)
+{
+  m_sent = socket->SendBurst (packets, 0);
+}
+
+void
+UdpSocketBurstTest::SendBurst (Ptr<Socket> socket, std::vector<Ptr<Packet> > packets)
+{
+  m_received.clear ();
+  m_dataSent = 0;
+  Simulator::ScheduleWithContext (socket->GetNode ()->GetId (), Seconds (0),
+                                  &UdpSocketBurstTest::DoSendBurst, this, socket, packets);
+  Simulator::Run ();
+}
+
+void
+UdpSocketBurstTest::DoRun (void)
+{
+  // Create topology
+
+  // Receiver Node
+  Ptr<Node> rxNode = CreateObject<Node> ();
+  // Sender Node
+  Ptr<Node> txNode = CreateObject<Node> ();
+
+  NodeContainer nodes (rxNode, txNode);
+
+  SimpleNetDeviceHelper helperChannel;
+  helperChannel.SetNetDevicePointToPointMode (true);
+  NetDeviceContainer net = helperChannel.Install (nodes);
+
+  InternetStackHelper internet;
+  internet.Install (nodes);
+
+  TrafficControlHelper tch = TrafficControlHelper::Default ();
+  QueueDiscContainer qdiscs = tch.Install (net.Get (1));
+
+  Ptr<Ipv4> ipv4;
+  uint32_t netdev_idx;
+
+  // Receiver Node
+  ipv4 = rxNode->GetObject<Ipv4> ();
+  netdev_idx = ipv4->AddInterface (net.Get (0));
+  ipv4->AddAddress (netdev_idx, Ipv4InterfaceAddress (Ipv4Address ("10.0.0.1"), Ipv4Mask ("/24")));
+  ipv4->SetUp (netdev_idx);
+
+  // Sender Node
+  ipv4 = txNode->GetObject<Ipv4> ();
+  netdev_idx = ipv4->AddInterface (net.Get (1));
+  ipv4->AddAddress (netdev_idx, Ipv4InterfaceAddress (Ipv4Address ("10.0.0.2"), Ipv4Mask ("/24")));
+  ipv4->SetUp (netdev_idx);
+
+  // Create the UDP sockets
+  Ptr<Socket> rxSocket = rxNode->GetObject<UdpSocketFactory> ()->CreateSocket ();
+  NS_TEST_EXPECT_MSG_EQ (rxSocket->Bind (InetSocketAddress (Ipv4Address ("10.0.0.1"), 1234)), 0, "trivial");
+  rxSocket->SetRecvCallback (MakeCallback (&UdpSocketBurstTest::ReceivePkt, this));
+
+  Ptr<Socket> txSocket = txNode->GetObject<UdpSocketFactory> ()->CreateSocket ();
+  txSocket->SetDataSentCallback (MakeCallback (&UdpSocketBurstTest::DataSent, this));
+
+  std::vector<Ptr<Packet> > packets;
+  for (uint32_t i = 0; i < 20; i++)
+    {
+      packets.push_back (Create<Packet> (100 + i));
+    }
+
+  // ------ Now the tests ------------
+
+  // A socket which is not connected refuses the burst
+  SendBurst (txSocket, packets);
+  NS_TEST_EXPECT_MSG_EQ (m_sent, -1, "the burst should be refused");
+  NS_TEST_EXPECT_MSG_EQ (txSocket->GetErrno (), Socket::ERROR_NOTCONN, "socket error code should be ERROR_NOTCONN");
+  NS_TEST_EXPECT_MSG_EQ (m_received.size (), 0, "no packet should be received");
+
+  NS_TEST_EXPECT_MSG_EQ (txSocket->Connect (InetSocketAddress ("10.0.0.1", 1234)), 0, "socket Connect() should succeed");
+
+  // All the packets of the burst are received, in order
+  SendBurst (txSocket, packets);
+  NS_TEST_EXPECT_MSG_EQ (m_sent, 20, "all the packets should be sent");
+  NS_TEST_EXPECT_MSG_EQ (m_dataSent, 20, "all the packets should be notified as sent");
+  NS_TEST_ASSERT_MSG_EQ (m_received.size (), 20, "all the packets should be received");
+  for (uint32_t i = 0; i < m_received.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_received[i], 100 + i, "the packets should be received in order");
+    }
+  NS_TEST_EXPECT_MSG_EQ (qdiscs.Get (0)->GetStats ().nTotalDequeuedPackets, 20, "the packets should go through the queue disc");
+
+  // The burst stops at the first packet too large to be sent
+  packets.resize (5);
+  packets.push_back (Create<Packet> (70000));
+  packets.push_back (Create<Packet> (100));
+  SendBurst (txSocket, packets);
+  NS_TEST_EXPECT_MSG_EQ (m_sent, 5, "the packets before the large one should be sent");
+  NS_TEST_EXPECT_MSG_EQ (txSocket->GetErrno (), Socket::ERROR_MSGSIZE, "socket error code should be ERROR_MSGSIZE");
+  NS_TEST_EXPECT_MSG_EQ (m_received.size (), 5, "the packets before the large one should be received");
+
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -720,6 +883,7 @@ public:
   UdpTestSuite () : TestSuite ("udp", UNIT)
   {
     AddTestCase (new UdpSocketImplTest, TestCase::QUICK);
+    AddTestCase (new UdpSocketBurstTest, TestCase::QUICK);
     AddTestCase (new UdpSocketLoopbackTest, TestCase::QUICK);
     AddTestCase (new Udp6SocketImplTest, TestCase::QUICK);
     AddTestCase (new Udp6SocketLoopbackTest, TestCase::QUICK);
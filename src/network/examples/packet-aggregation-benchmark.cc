@@ -0,0 +1,348 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the memory allocations and the time spent building
+// and taking apart packets the way an aggregating DMG MAC does: MSDUs are
+// tagged and aggregated into A-MSDUs, which get a MAC header and an FCS,
+// are copied for retransmission, and are aggregated with their delimiters
+// into an A-MPDU; at the receiver, the A-MPDU is split into MPDUs, which are
+// tagged and split into MSDUs.
+//
+// Sample usage:  ./waf --run 'packet-aggregation-benchmark --ppdus=1000 --mpdus=32'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/packet.h"
+#include "ns3/packet-metadata.h"
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+namespace {
+
+uint64_t g_allocations = 0; //!< Number of calls to operator new
+
+} // unnamed namespace
+
+/**
+ * Count the allocations of the whole program.
+ * \param size the size of the allocation
+ * \returns the allocated memory
+ */
+void *
+operator new (std::size_t size)
+{
+  g_allocations++;
+  void *p = std::malloc (size == 0 ? 1 : size);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+/**
+ * Count the allocations of the whole program.
+ * \param size the size of the allocation
+ * \returns the allocated memory
+ */
+void *
+operator new[] (std::size_t size)
+{
+  return operator new (size);
+}
+
+/**
+ * Release memory allocated by the operator new above.
+ * \param p the memory
+ */
+void
+operator delete (void *p) noexcept
+{
+  std::free (p);
+}
+
+/**
+ * Release memory allocated by the operator new[] above.
+ * \param p the memory
+ */
+void
+operator delete[] (void *p) noexcept
+{
+  std::free (p);
+}
+
+/// Header of N bytes, standing for a MAC header, a delimiter or a subframe header
+template <int N>
+class AggregationHeader : public Header
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void)
+  {
+    std::ostringstream oss;
+    oss << "ns3::AggregationHeader<" << N << ">";
+    static TypeId tid = TypeId (oss.str ().c_str ())
+      .SetParent<Header> ()
+      .SetGroupName ("Network")
+      .HideFromDocumentation ()
+      .AddConstructor<AggregationHeader<N> > ()
+    ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << "N=" << N;
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return N;
+  }
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    start.WriteU8 (N, N);
+  }
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    start.Next (N);
+    return N;
+  }
+};
+
+/// Trailer of 4 bytes, standing for the FCS
+class FcsTrailer : public Trailer
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::AggregationBenchmarkFcsTrailer")
+      .SetParent<Trailer> ()
+      .SetGroupName ("Network")
+      .HideFromDocumentation ()
+      .AddConstructor<FcsTrailer> ()
+    ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual void Print (std::ostream &os) const
+  {
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return 4;
+  }
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    start.Prev (4);
+    start.WriteU32 (0);
+  }
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    start.Prev (4);
+    start.ReadU32 ();
+    return 4;
+  }
+};
+
+/// Packet tag of N bytes, standing for the priority, A-MPDU or SNR tags
+template <int N>
+class AggregationTag : public Tag
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void)
+  {
+    std::ostringstream oss;
+    oss << "ns3::AggregationTag<" << N << ">";
+    static TypeId tid = TypeId (oss.str ().c_str ())
+      .SetParent<Tag> ()
+      .SetGroupName ("Network")
+      .HideFromDocumentation ()
+      .AddConstructor<AggregationTag<N> > ()
+    ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return N;
+  }
+  virtual void Serialize (TagBuffer buf) const
+  {
+    for (uint32_t i = 0; i < N; ++i)
+      {
+        buf.WriteU8 (N);
+      }
+  }
+  virtual void Deserialize (TagBuffer buf)
+  {
+    for (uint32_t i = 0; i < N; ++i)
+      {
+        buf.ReadU8 ();
+      }
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << "N=" << N;
+  }
+};
+
+/**
+ * Build an A-MPDU and take it apart.
+ * \param nMpdus the number of MPDUs in the A-MPDU
+ * \param nMsdus the number of MSDUs in each A-MSDU
+ * \param msduSize the size of the MSDUs
+ * \returns the number of bytes received, to keep the work alive
+ */
+static uint64_t
+RunPpdu (uint32_t nMpdus, uint32_t nMsdus, uint32_t msduSize)
+{
+  // transmitter
+  Ptr<Packet> psdu = Create<Packet> ();
+  std::vector<Ptr<Packet> > retransmissions;
+  std::vector<uint32_t> mpduSizes;
+  for (uint32_t m = 0; m < nMpdus; m++)
+    {
+      Ptr<Packet> amsdu = Create<Packet> ();
+      for (uint32_t k = 0; k < nMsdus; k++)
+        {
+          Ptr<Packet> msdu = Create<Packet> (msduSize);
+          msdu->AddPacketTag (AggregationTag<1> ()); // priority
+          msdu->AddPacketTag (AggregationTag<8> ()); // flow
+          msdu->AddHeader (AggregationHeader<8> ()); // LLC/SNAP
+          msdu->AddHeader (AggregationHeader<14> ()); // A-MSDU subframe header
+          uint32_t padding = (4 - (msdu->GetSize () % 4)) % 4;
+          if (k + 1 < nMsdus && padding > 0)
+            {
+              msdu->AddPaddingAtEnd (padding);
+            }
+          amsdu->AddAtEnd (msdu);
+        }
+      Ptr<Packet> mpdu = amsdu;
+      mpdu->AddHeader (AggregationHeader<26> ()); // QoS data MAC header
+      mpdu->AddTrailer (FcsTrailer ());
+      mpdu->AddPacketTag (AggregationTag<4> ()); // A-MPDU subframe
+      retransmissions.push_back (mpdu->Copy ());
+      mpduSizes.push_back (mpdu->GetSize ());
+      mpdu->AddHeader (AggregationHeader<4> ()); // delimiter
+      uint32_t padding = (4 - (mpdu->GetSize () % 4)) % 4;
+      if (m + 1 < nMpdus && padding > 0)
+        {
+          mpdu->AddPaddingAtEnd (padding);
+        }
+      psdu->AddAtEnd (mpdu);
+    }
+
+  // receiver
+  uint64_t received = 0;
+  uint32_t offset = 0;
+  for (uint32_t m = 0; m < nMpdus; m++)
+    {
+      uint32_t length = 4 + mpduSizes[m];
+      Ptr<Packet> mpdu = psdu->CreateFragment (offset, length);
+      offset += length + (4 - (length % 4)) % 4;
+      AggregationHeader<4> delimiter;
+      mpdu->RemoveHeader (delimiter);
+      mpdu->AddPacketTag (AggregationTag<8> ()); // SNR
+      AggregationHeader<26> macHeader;
+      mpdu->RemoveHeader (macHeader);
+      FcsTrailer fcs;
+      mpdu->RemoveTrailer (fcs);
+      uint32_t msduOffset = 0;
+      while (msduOffset < mpdu->GetSize ())
+        {
+          uint32_t msduLength = 14 + 8 + msduSize;
+          Ptr<Packet> msdu = mpdu->CreateFragment (msduOffset, msduLength);
+          msduOffset += msduLength + (4 - (msduLength % 4)) % 4;
+          AggregationHeader<14> subframeHeader;
+          msdu->RemoveHeader (subframeHeader);
+          AggregationHeader<8> llc;
+          msdu->RemoveHeader (llc);
+          msdu->AddPacketTag (AggregationTag<8> ()); // SNR
+          received += msdu->GetSize ();
+        }
+    }
+  return received;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t nPpdus = 1000;
+  uint32_t nMpdus = 16;
+  uint32_t nMsdus = 4;
+  uint32_t msduSize = 1500;
+  bool metadata = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("ppdus", "number of A-MPDUs to build", nPpdus);
+  cmd.AddValue ("mpdus", "number of MPDUs per A-MPDU", nMpdus);
+  cmd.AddValue ("msdus", "number of MSDUs per A-MSDU", nMsdus);
+  cmd.AddValue ("msduSize", "size of the MSDUs", msduSize);
+  cmd.AddValue ("metadata", "enable the packet metadata", metadata);
+  cmd.Parse (argc, argv);
+
+  if (metadata)
+    {
+      PacketMetadata::Enable ();
+    }
+
+  // warm up the free lists
+  uint64_t received = RunPpdu (nMpdus, nMsdus, msduSize);
+
+  SystemWallClockMs clock;
+  uint64_t allocations = g_allocations;
+  clock.Start ();
+  for (uint32_t i = 0; i < nPpdus; i++)
+    {
+      received += RunPpdu (nMpdus, nMsdus, msduSize);
+    }
+  int64_t elapsed = clock.End ();
+  allocations = g_allocations - allocations;
+
+  double nMsdusTotal = static_cast<double> (nPpdus) * nMpdus * nMsdus;
+  std::cout << "A-MPDUs: " << nPpdus << " x " << nMpdus << " MPDUs x " << nMsdus
+            << " MSDUs of " << msduSize << " bytes, metadata "
+            << (metadata ? "enabled" : "disabled") << std::endl
+            << "received: " << received << " bytes" << std::endl
+            << "allocations per MSDU: " << allocations / nMsdusTotal << std::endl
+            << "time per MSDU: " << elapsed * 1e6 / nMsdusTotal << " ns" << std::endl;
+  return 0;
+}
@@ -20,6 +20,8 @@
 #include "node-container.h"
 #include "ns3/node-list.h"
 #include "ns3/names.h"
+#include "ns3/object-factory.h"
+#include "ns3/uinteger.h"
 
 namespace ns3 {
 
@@ -97,18 +99,19 @@ NodeContainer::Get (uint32_t i) const
 void 
 NodeContainer::Create (uint32_t n)
 {
-  for (uint32_t i = 0; i < n; i++)
-    {
-      m_nodes.push_back (CreateObject<Node> ());
-    }
+  ObjectFactory factory;
+  factory.SetTypeId (Node::GetTypeId ());
+  std::vector<Ptr<Node> > nodes = factory.Create<Node> (n);
+  m_nodes.insert (m_nodes.end (), nodes.begin (), nodes.end ());
 }
 void 
 NodeContainer::Create (uint32_t n, uint32_t systemId)
 {
-  for (uint32_t i = 0; i < n; i++)
-    {
-      m_nodes.push_back (CreateObject<Node> (systemId));
-    }
+  ObjectFactory factory;
+  factory.SetTypeId (Node::GetTypeId ());
+  factory.Set ("SystemId", UintegerValue (systemId));
+  std::vector<Ptr<Node> > nodes = factory.Create<Node> (n);
+  m_nodes.insert (m_nodes.end (), nodes.begin (), nodes.end ());
 }
 void 
 NodeContainer::Add (NodeContainer other)
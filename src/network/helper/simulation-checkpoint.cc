@@ -0,0 +1,256 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "simulation-checkpoint.h"
+#include "ns3/log.h"
+#include "ns3/fatal-error.h"
+#include "ns3/simulator.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/pointer.h"
+#include "ns3/object-ptr-container.h"
+#include "ns3/node-list.h"
+#include "ns3/channel-list.h"
+#include "ns3/node.h"
+#include "ns3/channel.h"
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SimulationCheckpoint");
+
+SimulationCheckpoint::SimulationCheckpoint ()
+  : m_maxParallel (1)
+{
+  NS_LOG_FUNCTION (this);
+  const char *groups[] = {
+    "Core", "Network", "Internet", "Applications", "Mobility", "Propagation",
+    "Antenna", "Wifi", "PointToPoint", "TrafficControl", "Stats"
+  };
+  for (uint32_t i = 0; i < sizeof (groups) / sizeof (groups[0]); i++)
+    {
+      m_groups.insert (groups[i]);
+    }
+}
+
+void
+SimulationCheckpoint::AddSupportedGroup (std::string group)
+{
+  NS_LOG_FUNCTION (this << group);
+  m_groups.insert (group);
+}
+
+void
+SimulationCheckpoint::AddBranch (std::string name, SetupCallback setup, FinishCallback finish)
+{
+  NS_LOG_FUNCTION (this << name);
+  Branch branch;
+  branch.name = name;
+  branch.setup = setup;
+  branch.finish = finish;
+  m_branches.push_back (branch);
+}
+
+void
+SimulationCheckpoint::SetMaxParallel (uint32_t parallel)
+{
+  NS_LOG_FUNCTION (this << parallel);
+  NS_ASSERT (parallel > 0);
+  m_maxParallel = parallel;
+}
+
+void
+SimulationCheckpoint::CheckObject (Ptr<const Object> object, std::string path,
+                                   std::set<const Object *> &visited,
+                                   std::vector<std::string> &unsupported) const
+{
+  if (object == 0 || !visited.insert (PeekPointer (object)).second)
+    {
+      return;
+    }
+  TypeId tid = object->GetInstanceTypeId ();
+  // A type without a group belongs to the group of its closest ancestor
+  TypeId groupTid = tid;
+  while (groupTid.GetGroupName ().empty () && groupTid.HasParent () && groupTid.GetParent () != groupTid)
+    {
+      groupTid = groupTid.GetParent ();
+    }
+  std::string group = groupTid.GetGroupName ();
+  if (m_groups.find (group) == m_groups.end ())
+    {
+      unsupported.push_back (path + " (" + tid.GetName () + ", group \"" + group + "\")");
+      return;
+    }
+
+  Object::AggregateIterator aggregates = object->GetAggregateIterator ();
+  while (aggregates.HasNext ())
+    {
+      Ptr<const Object> aggregate = aggregates.Next ();
+      if (aggregate != object)
+        {
+          CheckObject (aggregate, path + "/$" + aggregate->GetInstanceTypeId ().GetName (),
+                       visited, unsupported);
+        }
+    }
+
+  TypeId nextTid = tid;
+  do
+    {
+      tid = nextTid;
+      for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation info = tid.GetAttribute (i);
+          if (!(info.flags & TypeId::ATTR_GET) || !info.accessor->HasGetter ())
+            {
+              continue;
+            }
+          if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              PointerValue value;
+              object->GetAttribute (info.name, value);
+              CheckObject (value.Get<Object> (), path + "/" + info.name, visited, unsupported);
+            }
+          else if (dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              ObjectPtrContainerValue container;
+              object->GetAttribute (info.name, container);
+              for (ObjectPtrContainerValue::Iterator it = container.Begin (); it != container.End (); ++it)
+                {
+                  std::ostringstream oss;
+                  oss << path << "/" << info.name << "/" << it->first;
+                  CheckObject (it->second, oss.str (), visited, unsupported);
+                }
+            }
+        }
+      nextTid = tid.GetParent ();
+    }
+  while (nextTid != tid);
+}
+
+void
+SimulationCheckpoint::Check (void) const
+{
+  NS_LOG_FUNCTION (this);
+  std::vector<std::string> unsupported;
+  TypeId simulatorTid = Simulator::GetImplementation ()->GetInstanceTypeId ();
+  if (simulatorTid.GetName () != "ns3::DefaultSimulatorImpl")
+    {
+      unsupported.push_back ("SimulatorImplementationType (" + simulatorTid.GetName () + ")");
+    }
+
+  std::set<const Object *> visited;
+  for (uint32_t i = 0; i < NodeList::GetNNodes (); i++)
+    {
+      std::ostringstream oss;
+      oss << "/NodeList/" << i;
+      CheckObject (NodeList::GetNode (i), oss.str (), visited, unsupported);
+    }
+  for (uint32_t i = 0; i < ChannelList::GetNChannels (); i++)
+    {
+      std::ostringstream oss;
+      oss << "/ChannelList/" << i;
+      CheckObject (ChannelList::GetChannel (i), oss.str (), visited, unsupported);
+    }
+
+  if (!unsupported.empty ())
+    {
+      std::ostringstream oss;
+      for (std::vector<std::string>::const_iterator it = unsupported.begin (); it != unsupported.end (); ++it)
+        {
+          oss << std::endl << "  " << *it;
+        }
+      NS_FATAL_ERROR ("The simulation cannot be checkpointed, unsupported objects:" << oss.str ());
+    }
+}
+
+void
+SimulationCheckpoint::RunBranch (const Branch &branch)
+{
+  NS_LOG_INFO ("Branch " << branch.name << " starts at " << Simulator::Now ().As (Time::S));
+  if (!branch.setup.IsNull ())
+    {
+      branch.setup ();
+    }
+  Simulator::Run ();
+  int status = branch.finish.IsNull () ? 0 : branch.finish ();
+  Simulator::Destroy ();
+  NS_LOG_INFO ("Branch " << branch.name << " exits with status " << status);
+  std::cout.flush ();
+  std::cerr.flush ();
+  std::clog.flush ();
+  std::fflush (0);
+  // Skip the destructors of the static objects, which belong to the checkpoint.
+  _exit (status);
+}
+
+std::vector<int>
+SimulationCheckpoint::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  Check ();
+
+  std::vector<int> status (m_branches.size (), -1);
+  std::map<pid_t, std::size_t> running;
+  for (std::size_t i = 0; i <= m_branches.size (); i++)
+    {
+      while (!running.empty () && (running.size () >= m_maxParallel || i == m_branches.size ()))
+        {
+          int result;
+          pid_t pid = waitpid (-1, &result, 0);
+          if (pid < 0)
+            {
+              NS_FATAL_ERROR ("waitpid failed: " << std::strerror (errno));
+            }
+          std::map<pid_t, std::size_t>::iterator it = running.find (pid);
+          if (it == running.end ())
+            {
+              continue;
+            }
+          status[it->second] = WIFEXITED (result) ? WEXITSTATUS (result) : -1;
+          NS_LOG_INFO ("Branch " << m_branches[it->second].name << " finished with status " << status[it->second]);
+          running.erase (it);
+        }
+      if (i == m_branches.size ())
+        {
+          break;
+        }
+      // Do not let the children inherit buffered output.
+      std::cout.flush ();
+      std::cerr.flush ();
+      std::clog.flush ();
+      std::fflush (0);
+      pid_t pid = fork ();
+      if (pid < 0)
+        {
+          NS_FATAL_ERROR ("Unable to fork branch " << m_branches[i].name << ": " << std::strerror (errno));
+        }
+      if (pid == 0)
+        {
+          RunBranch (m_branches[i]);
+        }
+      running[pid] = i;
+    }
+  return status;
+}
+
+} // namespace ns3
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SIMULATION_CHECKPOINT_H
+#define SIMULATION_CHECKPOINT_H
+
+#include "ns3/callback.h"
+#include "ns3/object.h"
+#include <set>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup network
+ *
+ * \brief Run several what-if branches from the same warmed-up simulation state.
+ *
+ * A typical scenario spends a long warm-up (codebook loading, association,
+ * beamforming training, TCP slow start) before the traffic of interest
+ * starts. A checkpoint captures the whole state of the simulation after the
+ * warm-up, so that several variants (a moved obstacle, a new station, a
+ * different service period schedule) can each be run from it:
+ *
+ * \code
+ *   Simulator::Stop (Seconds (1.0));
+ *   Simulator::Run ();                 // warm-up
+ *   SimulationCheckpoint checkpoint;
+ *   checkpoint.AddBranch ("baseline", MakeCallback (&Baseline), MakeCallback (&Report));
+ *   checkpoint.AddBranch ("moved-sta", MakeCallback (&MoveSta), MakeCallback (&Report));
+ *   checkpoint.Run ();
+ * \endcode
+ *
+ * The snapshot is the address space of the process: each branch runs in a
+ * child process forked from the checkpoint, which shares the warmed-up state
+ * copy-on-write. This captures the event queue, nodes, devices, sockets,
+ * applications and random variable states exactly, including scheduled
+ * callbacks, which cannot be serialised to a file. Each branch first calls
+ * its setup callback, which applies the variant and schedules the end of
+ * the branch (Simulator::Stop), then runs the simulation, then calls its
+ * finish callback, which reports results and returns the exit status of
+ * the branch. The state of the calling process is left untouched, so
+ * several sets of branches can be run from the same checkpoint.
+ *
+ * Before forking, every object reachable from the NodeList and the
+ * ChannelList (through aggregation and pointer attributes) is checked
+ * against the set of supported groups. Objects which hold threads,
+ * sockets of the host or MPI state would be shared between branches and
+ * are refused with a fatal error that names them, as are the realtime and
+ * distributed simulator implementations. The default groups are the
+ * modules used by the TGad evaluation scenarios.
+ *
+ * Files opened before the checkpoint (pcap and ascii traces, output
+ * streams) are shared by all the branches; open the per-branch outputs in
+ * the setup callback instead.
+ */
+class SimulationCheckpoint
+{
+public:
+  /**
+   * Setup callback of a branch: applies the variant and schedules the end
+   * of the branch.
+   */
+  typedef Callback<void> SetupCallback;
+  /**
+   * Finish callback of a branch: reports the results of the branch.
+   * Returns the exit status of the branch.
+   */
+  typedef Callback<int> FinishCallback;
+
+  SimulationCheckpoint ();
+
+  /**
+   * Add a group of objects (see TypeId::SetGroupName) which can be part of
+   * a checkpoint.
+   *
+   * \param group the group name.
+   */
+  void AddSupportedGroup (std::string group);
+  /**
+   * Add a branch.
+   *
+   * \param name the name of the branch, used in log messages.
+   * \param setup the setup callback of the branch.
+   * \param finish the finish callback of the branch, or a null callback.
+   */
+  void AddBranch (std::string name, SetupCallback setup, FinishCallback finish);
+  /**
+   * Set the maximum number of branches running at the same time.
+   *
+   * \param parallel the number of concurrent branches, 1 by default.
+   */
+  void SetMaxParallel (uint32_t parallel);
+  /**
+   * Check that the current state of the simulation can be checkpointed.
+   * Aborts the simulation with a list of the unsupported objects otherwise.
+   */
+  void Check (void) const;
+  /**
+   * Check the state of the simulation, then run every branch from it.
+   *
+   * \return the exit status of each branch, in the order of AddBranch.
+   * A branch which did not exit normally is reported as -1.
+   */
+  std::vector<int> Run (void);
+
+private:
+  /// A what-if branch
+  struct Branch
+  {
+    std::string name;       //!< Name of the branch
+    SetupCallback setup;    //!< Setup callback
+    FinishCallback finish;  //!< Finish callback
+  };
+
+  /**
+   * Check an object and the objects reachable from it.
+   *
+   * \param object the object.
+   * \param path the config path of the object.
+   * \param visited the objects already checked.
+   * \param unsupported the list of unsupported objects found so far.
+   */
+  void CheckObject (Ptr<const Object> object, std::string path, std::set<const Object *> &visited,
+                    std::vector<std::string> &unsupported) const;
+  /**
+   * Run a branch in the current (child) process and exit.
+   *
+   * \param branch the branch.
+   */
+  static void RunBranch (const Branch &branch);
+
+  std::set<std::string> m_groups;     //!< Supported groups
+  std::vector<Branch> m_branches;     //!< Branches
+  uint32_t m_maxParallel;             //!< Maximum number of concurrent branches
+};
+
+} // namespace ns3
+
+#endif /* SIMULATION_CHECKPOINT_H */
@@ -75,21 +75,53 @@ uint32_t Buffer::g_recommendedStart = 0;
 #define IS_INITIALIZED(x) (!IS_UNINITIALIZED (x) && !IS_DESTROYED (x))
 #define DESTROYED ((Buffer::FreeList*)MAGIC_DESTROYED)
 #define UNINITIALIZED ((Buffer::FreeList*)0)
-uint32_t Buffer::g_maxSize = 0;
+/* The buffer data are recycled by size class: the size of a recycled
+ * data storage is a power of two between 2^MIN_SIZE_CLASS and
+ * 2^MAX_SIZE_CLASS, which covers the headers of a small packet as well
+ * as an aggregated DMG PSDU (up to 262143 bytes) and larger EDMG PSDUs,
+ * so that a buffer which grows by aggregation finds room at its end most
+ * of the time. Each free list keeps at most MAX_FREE_BUFFERS buffers and
+ * MAX_FREE_BYTES bytes. Larger storage is not recycled.
+ */
+#define MIN_SIZE_CLASS 7
+#define MAX_SIZE_CLASS 22
+#define MAX_FREE_BUFFERS 1024U
+#define MAX_FREE_BYTES (1U << 22)
 Buffer::FreeList *Buffer::g_freeList = 0;
 struct Buffer::LocalStaticDestructor Buffer::g_localStaticDestructor;
 
+/**
+ * \ingroup packet
+ * \brief Get the size class of a data storage
+ * \param size the size of the data storage
+ * \returns the smallest size class which can hold size bytes
+ */
+static uint32_t
+GetSizeClass (uint32_t size)
+{
+  uint32_t sizeClass = MIN_SIZE_CLASS;
+  while (sizeClass < 32 && (1U << sizeClass) < size)
+    {
+      sizeClass++;
+    }
+  return sizeClass;
+}
+
 Buffer::LocalStaticDestructor::~LocalStaticDestructor(void)
 {
   NS_LOG_FUNCTION (this);
   if (IS_INITIALIZED (g_freeList))
     {
-      for (Buffer::FreeList::iterator i = g_freeList->begin ();
-           i != g_freeList->end (); i++)
+      for (uint32_t c = MIN_SIZE_CLASS; c <= MAX_SIZE_CLASS; c++)
         {
-          Buffer::Deallocate (*i);
+          Buffer::FreeList &freeList = g_freeList[c - MIN_SIZE_CLASS];
+          for (Buffer::FreeList::iterator i = freeList.begin ();
+               i != freeList.end (); i++)
+            {
+              Buffer::Deallocate (*i);
+            }
         }
-      delete g_freeList;
+      delete [] g_freeList;
       g_freeList = DESTROYED;
     }
 }
@@ -100,18 +132,19 @@ Buffer::Recycle (struct Buffer::Data *data)
   NS_LOG_FUNCTION (data);
   NS_ASSERT (data->m_count == 0);
   NS_ASSERT (!IS_UNINITIALIZED (g_freeList));
-  g_maxSize = std::max (g_maxSize, data->m_size);
-  /* feed into free list */
-  if (data->m_size < g_maxSize ||
-      IS_DESTROYED (g_freeList) ||
-      g_freeList->size () > 1000)
+  uint32_t sizeClass = GetSizeClass (data->m_size);
+  /* feed into the free list of its size class */
+  if (IS_DESTROYED (g_freeList)
+      || sizeClass > MAX_SIZE_CLASS
+      || data->m_size != (1U << sizeClass)
+      || g_freeList[sizeClass - MIN_SIZE_CLASS].size () >= std::min (MAX_FREE_BUFFERS, MAX_FREE_BYTES >> sizeClass))
     {
       Buffer::Deallocate (data);
     }
   else
     {
       NS_ASSERT (IS_INITIALIZED (g_freeList));
-      g_freeList->push_back (data);
+      g_freeList[sizeClass - MIN_SIZE_CLASS].push_back (data);
     }
 }
 
@@ -119,26 +152,29 @@ Buffer::Data *
 Buffer::Create (uint32_t dataSize)
 {
   NS_LOG_FUNCTION (dataSize);
-  /* try to find a buffer correctly sized. */
   if (IS_UNINITIALIZED (g_freeList))
     {
-      g_freeList = new Buffer::FreeList ();
+      g_freeList = new Buffer::FreeList [MAX_SIZE_CLASS - MIN_SIZE_CLASS + 1];
+    }
+  uint32_t sizeClass = GetSizeClass (dataSize);
+  if (sizeClass > MAX_SIZE_CLASS)
+    {
+      return Buffer::Allocate (dataSize);
     }
-  else if (IS_INITIALIZED (g_freeList))
+  /* reuse a buffer of the size class, if any. */
+  if (IS_INITIALIZED (g_freeList))
     {
-      while (!g_freeList->empty ()) 
+      Buffer::FreeList &freeList = g_freeList[sizeClass - MIN_SIZE_CLASS];
+      if (!freeList.empty ())
         {
-          struct Buffer::Data *data = g_freeList->back ();
-          g_freeList->pop_back ();
-          if (data->m_size >= dataSize) 
-            {
-              data->m_count = 1;
-              return data;
-            }
-          Buffer::Deallocate (data);
+          struct Buffer::Data *data = freeList.back ();
+          freeList.pop_back ();
+          NS_ASSERT (data->m_size >= dataSize);
+          data->m_count = 1;
+          return data;
         }
     }
-  struct Buffer::Data *data = Buffer::Allocate (dataSize);
+  struct Buffer::Data *data = Buffer::Allocate (1U << sizeClass);
   NS_ASSERT (data->m_count == 1);
   return data;
 }
@@ -798,8 +798,7 @@ private:
   {
     ~LocalStaticDestructor ();
   };
-  static uint32_t g_maxSize; //!< Max observed data size
-  static FreeList *g_freeList; //!< Buffer data container
+  static FreeList *g_freeList; //!< Buffer data containers, one per size class of the recycled data
   static struct LocalStaticDestructor g_localStaticDestructor; //!< Local static destructor
 #endif
 };
@@ -22,6 +22,7 @@
 #define NET_DEVICE_H
 
 #include <stdint.h>
+#include <vector>
 #include "ns3/callback.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
@@ -246,6 +247,20 @@ public:
    * \return whether the Send operation succeeded 
    */
   virtual bool Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber) = 0;
+  /**
+   * \param packets packets sent from above down to Network Device, in order
+   * \param dest mac address of the destination (already resolved)
+   * \param protocolNumber identifies the type of payload contained in
+   *        these packets. Used to call the right L3Protocol when the packets
+   *        are received.
+   *
+   *  Called from higher layer to send a burst of packets into Network Device
+   *  to the specified destination Address. The default implementation calls
+   *  Send for each packet; devices able to enqueue a burst at once override it.
+   *
+   * \return the number of packets for which the Send operation succeeded
+   */
+  virtual uint32_t SendBurst (const std::vector<Ptr<Packet> > &packets, const Address& dest, uint16_t protocolNumber);
   /**
    * \param packet packet sent from above down to Network Device
    * \param source source mac address (so called "MAC spoofing")
@@ -43,8 +43,8 @@ PacketTagList::CreateTagData (size_t dataSize)
                  << " exceeds maximum "
                  << std::numeric_limits<decltype(TagData::size)>::max () );
 
-  void * p = std::malloc (sizeof (TagData) + dataSize - 1);
-  // The matching frees are in RemoveAll and RemoveWriter
+  void * p = ::operator new (sizeof (TagData) + dataSize - 1);
+  // The matching deletes are in ReleaseList and RemoveWriter
 
   TagData * tag = new (p) TagData;
   tag->size = dataSize;
@@ -175,7 +175,23 @@ PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
 bool
 PacketTagList::Remove (Tag & tag)
 {
-  return COWTraverse (tag, &PacketTagList::RemoveWriter);
+  TypeId tid = tag.GetInstanceTypeId ();
+  for (uint32_t i = 0; i < m_inlineCount; i++)
+    {
+      TagData *cur = GetInline (i);
+      if (cur->tid == tid)
+        {
+          tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
+          // keep the inline tags contiguous
+          std::memmove (&m_inline[i], &m_inline[i + 1], (m_inlineCount - i - 1) * sizeof (InlineTag));
+          m_inlineCount--;
+          LinkInline ();
+          return true;
+        }
+    }
+  bool found = COWTraverse (tag, &PacketTagList::RemoveWriter);
+  LinkInline ();
+  return found;
 }
 
 // COWWriter implementing Remove
@@ -195,7 +211,7 @@ PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
     {
       // found tid before first merge, so delete cur
       cur->~TagData ();
-      std::free (cur);
+      ::operator delete (cur);
     }
   else
     {
@@ -214,7 +230,18 @@ PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
 bool
 PacketTagList::Replace (Tag & tag)
 {
+  TypeId tid = tag.GetInstanceTypeId ();
+  for (uint32_t i = 0; i < m_inlineCount; i++)
+    {
+      TagData *cur = GetInline (i);
+      if (cur->tid == tid)
+        {
+          tag.Serialize (TagBuffer (cur->data, cur->data + cur->size));
+          return true;
+        }
+    }
   bool found = COWTraverse (tag, &PacketTagList::ReplaceWriter);
+  LinkInline ();
   if (!found)
     {
       Add (tag);
@@ -261,19 +288,33 @@ PacketTagList::Add (const Tag &tag) const
 {
   NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ());
   // ensure this id was not yet added
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next) 
+  for (const struct TagData *cur = Head (); cur != 0; cur = cur->next) 
     {
       NS_ASSERT_MSG (cur->tid != tag.GetInstanceTypeId (),
                      "Error: cannot add the same kind of tag twice.");
     }
-  struct TagData * head = CreateTagData (tag.GetSerializedSize ());
+  PacketTagList *self = const_cast<PacketTagList *> (this);
+  uint32_t size = tag.GetSerializedSize ();
+  if (m_inlineCount < INLINE_TAGS && size <= INLINE_TAG_SIZE)
+    {
+      struct TagData * inlineTag = new (&self->m_inline[m_inlineCount]) TagData;
+      inlineTag->count = 1;
+      inlineTag->tid = tag.GetInstanceTypeId ();
+      inlineTag->size = size;
+      tag.Serialize (TagBuffer (inlineTag->data, inlineTag->data + inlineTag->size));
+      self->m_inlineCount++;
+      LinkInline ();
+      return;
+    }
+  struct TagData * head = CreateTagData (size);
   head->count = 1;
   head->next = 0;
   head->tid = tag.GetInstanceTypeId ();
   head->next = m_next;
   tag.Serialize (TagBuffer (head->data, head->data + head->size));
 
-  const_cast<PacketTagList *> (this)->m_next = head;
+  self->m_next = head;
+  LinkInline ();
 }
 
 bool
@@ -281,12 +322,13 @@ PacketTagList::Peek (Tag &tag) const
 {
   NS_LOG_FUNCTION (this << tag.GetInstanceTypeId ());
   TypeId tid = tag.GetInstanceTypeId ();
-  for (struct TagData *cur = m_next; cur != 0; cur = cur->next) 
+  for (const struct TagData *cur = Head (); cur != 0; cur = cur->next) 
     {
       if (cur->tid == tid) 
         {
           /* found tag */
-          tag.Deserialize (TagBuffer (cur->data, cur->data + cur->size));
+          uint8_t *data = const_cast<uint8_t *> (cur->data);
+          tag.Deserialize (TagBuffer (data, data + cur->size));
           return true;
         }
     }
@@ -297,7 +339,7 @@ PacketTagList::Peek (Tag &tag) const
 const struct PacketTagList::TagData *
 PacketTagList::Head (void) const
 {
-  return m_next;
+  return m_inlineCount > 0 ? GetInline (0) : m_next;
 }
 
 } /* namespace ns3 */
@@ -27,6 +27,8 @@
 
 #include <stdint.h>
 #include <ostream>
+#include <new>
+#include <cstring>
 #include "ns3/type-id.h"
 
 namespace ns3 {
@@ -119,6 +121,19 @@ class Tag;
  *       The portion of the list between the first branch and the target is
  *       shared. This portion is copied before the #Remove or #Replace is
  *       performed.
+ *
+ * \par <b> Inline tags </b>
+ *
+ *   - The first INLINE_TAGS tags whose serialized size is at most
+ *     INLINE_TAG_SIZE bytes are not put in the tree, but stored in the
+ *     PacketTagList itself, so that tagging a packet, copying it, and
+ *     removing its tags does not allocate memory in the usual case of a
+ *     few small tags. Copies copy the inline tags; only the tags beyond
+ *     them are shared copy-on-write as described above.
+ *
+ *   - The inline tags are TagData structures too, chained by their
+ *     \c next pointers in front of #m_next, so that #Head and
+ *     PacketTagIterator see a single list.
  */
 class PacketTagList 
 {
@@ -147,6 +162,11 @@ public:
     uint8_t data[1];            /**< Serialization buffer */
   };  /* struct TagData */
 
+  /// Number of tags stored in the PacketTagList itself
+  static const uint32_t INLINE_TAGS = 4;
+  /// Largest serialized size of a tag stored in the PacketTagList itself
+  static const uint32_t INLINE_TAG_SIZE = 20;
+
   /**
    * Create a new PacketTagList.
    */
@@ -156,8 +176,8 @@ public:
    *
    * \param [in] o The PacketTagList to copy.
    *
-   * This makes a light-weight copy by #RemoveAll, then
-   * pointing to the same \ref TagData as \pname{o}.
+   * This copies the inline tags of \pname{o}, then points
+   * to the same \ref TagData as \pname{o}.
    */
   inline PacketTagList (PacketTagList const &o);
   /**
@@ -166,8 +186,9 @@ public:
    * \param [in] o The PacketTagList to copy.
    * \returns the copied object
    *
-   * This makes a light-weight copy by #RemoveAll, then
-   * pointing to the same \ref TagData as \pname{o}.
+   * This makes a light-weight copy by #RemoveAll, then copying the
+   * inline tags of \pname{o} and pointing to the same \ref TagData
+   * as \pname{o}.
    */
   inline PacketTagList &operator = (PacketTagList const &o);
   /**
@@ -219,6 +240,29 @@ public:
   const struct PacketTagList::TagData *Head (void) const;
 
 private:
+  /**
+   * Storage of an inline tag: a TagData with INLINE_TAG_SIZE bytes of data.
+   */
+  struct InlineTag
+  {
+    /// The storage, aligned for a TagData
+    uint64_t storage[(sizeof (TagData) + INLINE_TAG_SIZE + 7) / 8];
+  };
+
+  /**
+   * \param [in] i The index of an inline tag.
+   * \returns The TagData of the inline tag.
+   */
+  inline TagData * GetInline (uint32_t i) const;
+  /**
+   * Chain the inline tags to each other, and the last one to #m_next.
+   */
+  inline void LinkInline (void) const;
+  /**
+   * Release the TagData of the list, up to the first merge.
+   */
+  inline void ReleaseList (void);
+
   /**
    * Allocate and construct a TagData struct, sizing the data area
    * large enough to serialize dataSize bytes from a Tag.
@@ -279,7 +323,15 @@ private:
                       struct TagData * cur, struct TagData ** prevNext);
 
   /**
-   * Pointer to first \ref TagData on the list
+   * The inline tags
+   */
+  InlineTag m_inline[INLINE_TAGS];
+  /**
+   * Number of inline tags
+   */
+  uint32_t m_inlineCount;
+  /**
+   * Pointer to first \ref TagData on the list after the inline tags
    */
   struct TagData *m_next;
 };
@@ -293,43 +345,75 @@ private:
 namespace ns3 {
 
 PacketTagList::PacketTagList ()
-  : m_next ()
+  : m_inlineCount (0),
+    m_next ()
 {
 }
 
 PacketTagList::PacketTagList (PacketTagList const &o)
-  : m_next (o.m_next)
+  : m_inlineCount (o.m_inlineCount),
+    m_next (o.m_next)
 {
+  std::memcpy (m_inline, o.m_inline, m_inlineCount * sizeof (InlineTag));
   if (m_next != 0)
     {
       m_next->count++;
     }
+  LinkInline ();
 }
 
 PacketTagList &
 PacketTagList::operator = (PacketTagList const &o)
 {
   // self assignment
-  if (m_next == o.m_next) 
+  if (this == &o) 
     {
       return *this;
     }
-  RemoveAll ();
-  m_next = o.m_next;
-  if (m_next != 0) 
+  m_inlineCount = o.m_inlineCount;
+  std::memcpy (m_inline, o.m_inline, m_inlineCount * sizeof (InlineTag));
+  if (m_next != o.m_next)
     {
-      m_next->count++;
+      ReleaseList ();
+      m_next = o.m_next;
+      if (m_next != 0) 
+        {
+          m_next->count++;
+        }
     }
+  LinkInline ();
   return *this;
 }
 
 PacketTagList::~PacketTagList ()
 {
-  RemoveAll ();
+  ReleaseList ();
+}
+
+PacketTagList::TagData *
+PacketTagList::GetInline (uint32_t i) const
+{
+  return reinterpret_cast<TagData *> (const_cast<InlineTag *> (&m_inline[i]));
+}
+
+void
+PacketTagList::LinkInline (void) const
+{
+  for (uint32_t i = 0; i < m_inlineCount; i++)
+    {
+      GetInline (i)->next = (i + 1 < m_inlineCount) ? GetInline (i + 1) : m_next;
+    }
 }
 
 void
 PacketTagList::RemoveAll (void)
+{
+  m_inlineCount = 0;
+  ReleaseList ();
+}
+
+void
+PacketTagList::ReleaseList (void)
 {
   struct TagData *prev = 0;
   for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
@@ -342,14 +426,14 @@ PacketTagList::RemoveAll (void)
       if (prev != 0) 
         {
           prev->~TagData ();
-          std::free (prev);
+          ::operator delete (prev);
         }
       prev = cur;
     }
   if (prev != 0) 
     {
       prev->~TagData ();
-      std::free (prev);
+      ::operator delete (prev);
     }
   m_next = 0;
 }
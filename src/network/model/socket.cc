@@ -138,6 +138,31 @@ Socket::Send (Ptr<Packet> p)
   return Send (p, 0);
 }
 
+int
+Socket::SendBurst (const std::vector<Ptr<Packet> > &packets, uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << packets.size () << flags);
+  return SendBurst (packets, 0, packets.size (), flags);
+}
+
+int
+Socket::SendBurst (const std::vector<Ptr<Packet> > &packets, std::size_t first, std::size_t last,
+                   uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << packets.size () << first << last << flags);
+  NS_ASSERT (first <= last && last <= packets.size ());
+  int sent = 0;
+  for (std::size_t i = first; i < last; i++)
+    {
+      if (Send (packets[i], flags) < 0)
+        {
+          return (sent > 0 ? sent : -1);
+        }
+      sent++;
+    }
+  return sent;
+}
+
 int 
 Socket::Send (const uint8_t* buf, uint32_t size, uint32_t flags)
 {
@@ -30,6 +30,7 @@
 #include "ns3/net-device.h"
 #include "address.h"
 #include <stdint.h>
+#include <vector>
 #include "ns3/inet-socket-address.h"
 #include "ns3/inet6-socket-address.h"
 
@@ -388,6 +389,39 @@ public:
   virtual int SendTo (Ptr<Packet> p, uint32_t flags, 
                       const Address &toAddress) = 0;
 
+  /**
+   * \brief Send a burst of packets to the remote host
+   *
+   * This method has the semantics of calling Send () on each packet in
+   * turn, until one of them cannot be sent. Subclasses may override it to
+   * check the socket state and look up the route once for the whole burst,
+   * and to hand the packets over to the lower layers in one call.
+   *
+   * \param packets the packets to send, in order
+   * \param flags Socket control flags
+   * \returns the number of packets accepted for transmission, which are the
+   *          first ones of the burst, or -1 if the first packet could not be
+   *          sent. In both cases, SocketErrno is set if a packet was refused.
+   */
+  int SendBurst (const std::vector<Ptr<Packet> > &packets, uint32_t flags);
+  /**
+   * \brief Send the packets [first, last) of a vector to the remote host
+   *
+   * Same as SendBurst (packets, flags) for a part of the vector, so that a
+   * caller retrying after a refused packet does not need to copy the
+   * remaining packets into a new vector.
+   *
+   * \param packets the packets
+   * \param first the index of the first packet to send
+   * \param last the index following the last packet to send
+   * \param flags Socket control flags
+   * \returns the number of packets accepted for transmission, which are the
+   *          first ones of the range, or -1 if the first packet could not be
+   *          sent. In both cases, SocketErrno is set if a packet was refused.
+   */
+  virtual int SendBurst (const std::vector<Ptr<Packet> > &packets, std::size_t first, std::size_t last,
+                         uint32_t flags);
+
   /**
    * Return number of bytes which can be returned from one or 
    * multiple calls to Recv.
@@ -0,0 +1,276 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "ns3/test.h"
+#include "ns3/boolean.h"
+#include "ns3/global-value.h"
+#include "ns3/packet.h"
+#include "ns3/pcap-file.h"
+#include "ns3/output-stream-wrapper.h"
+#include "ns3/async-trace-writer.h"
+
+using namespace ns3;
+
+/**
+ * Read a whole file.
+ * \param filename the name of the file
+ * \returns the contents of the file
+ */
+static std::string
+ReadFile (std::string const &filename)
+{
+  std::ifstream in (filename.c_str (), std::ios::binary);
+  std::ostringstream oss;
+  oss << in.rdbuf ();
+  return oss.str ();
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Write the same packets to a pcap file synchronously and from the
+ * background writer, and check that both files are identical; check the
+ * per-packet snapshot length.
+ */
+class AsyncPcapTestCase : public TestCase
+{
+public:
+  AsyncPcapTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Write the test packets to a pcap file.
+   * \param filename the name of the file
+   * \param async write from the background writer
+   */
+  void WritePackets (std::string const &filename, bool async);
+};
+
+AsyncPcapTestCase::AsyncPcapTestCase ()
+  : TestCase ("Check that a pcap file written from the background writer is identical")
+{
+}
+
+void
+AsyncPcapTestCase::WritePackets (std::string const &filename, bool async)
+{
+  GlobalValue::Bind ("TraceAsyncWrite", BooleanValue (async));
+  PcapFile f;
+  f.Open (filename, std::ios::out);
+  GlobalValue::Bind ("TraceAsyncWrite", BooleanValue (false));
+  NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Open (" << filename << ") returns error");
+  f.Init (1, 1000);
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      uint8_t data[1500];
+      for (uint32_t j = 0; j < sizeof (data); j++)
+        {
+          data[j] = static_cast<uint8_t> (i + j);
+        }
+      Ptr<const Packet> p = Create<Packet> (data, 100 + i);
+      f.Write (i, 2 * i, p, (i % 2) ? 64 : 2000);
+      NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Write must not fail");
+    }
+  NS_TEST_EXPECT_MSG_EQ (f.GetDroppedPackets (), 0, "No packet can be dropped when blocking");
+  f.Close ();
+}
+
+void
+AsyncPcapTestCase::DoRun (void)
+{
+  std::string syncFilename = CreateTempDirFilename ("async-trace-writer-sync.pcap");
+  std::string asyncFilename = CreateTempDirFilename ("async-trace-writer-async.pcap");
+  WritePackets (syncFilename, false);
+  WritePackets (asyncFilename, true);
+
+  std::string sync = ReadFile (syncFilename);
+  std::string async = ReadFile (asyncFilename);
+  NS_TEST_ASSERT_MSG_EQ (async.size (), sync.size (), "Files have different sizes");
+  NS_TEST_EXPECT_MSG_EQ ((async == sync), true, "Files are different");
+
+  PcapFile f;
+  f.Open (asyncFilename, std::ios::in);
+  NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Open (" << asyncFilename << ") returns error");
+  NS_TEST_EXPECT_MSG_EQ (f.GetSnapLen (), 1000, "Wrong snapshot length");
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      uint8_t data[1500];
+      uint32_t tsSec, tsUsec, inclLen, origLen, readLen;
+      f.Read (data, sizeof (data), tsSec, tsUsec, inclLen, origLen, readLen);
+      NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Read must not fail");
+      NS_TEST_EXPECT_MSG_EQ (tsSec, i, "Wrong timestamp");
+      NS_TEST_EXPECT_MSG_EQ (tsUsec, 2 * i, "Wrong timestamp");
+      NS_TEST_EXPECT_MSG_EQ (origLen, 100 + i, "Wrong original length");
+      uint32_t expected = (i % 2) ? 64 : std::min<uint32_t> (100 + i, 1000);
+      NS_TEST_EXPECT_MSG_EQ (inclLen, expected, "Wrong included length");
+      NS_TEST_EXPECT_MSG_EQ (data[inclLen - 1], static_cast<uint8_t> (i + inclLen - 1), "Wrong data");
+    }
+  f.Close ();
+
+  remove (syncFilename.c_str ());
+  remove (asyncFilename.c_str ());
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Check the overflow policies with records longer than the ring: the
+ * blocking writer hands them over in pieces, the dropping writer drops
+ * them whole.
+ */
+class AsyncOverflowTestCase : public TestCase
+{
+public:
+  AsyncOverflowTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+AsyncOverflowTestCase::AsyncOverflowTestCase ()
+  : TestCase ("Check the overflow policies of the background writer")
+{
+}
+
+void
+AsyncOverflowTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("async-trace-writer-overflow.bin");
+  std::string small (100, 'a');
+  std::string large (1000, 'b');
+
+  {
+    AsyncTraceWriter writer (filename, std::ios::out, 512, AsyncTraceWriter::BLOCK);
+    NS_TEST_ASSERT_MSG_EQ (writer.IsOpen (), true, "Cannot open " << filename);
+    std::ostream os (&writer);
+    os << small << std::flush << large << std::flush << small << std::flush;
+    writer.Flush ();
+    NS_TEST_EXPECT_MSG_EQ (ReadFile (filename), small + large + small, "Records lost while blocking");
+    writer.Close ();
+    NS_TEST_EXPECT_MSG_EQ (writer.GetDroppedRecords (), 0, "No record can be dropped when blocking");
+  }
+
+  {
+    AsyncTraceWriter writer (filename, std::ios::out, 512, AsyncTraceWriter::DROP);
+    NS_TEST_ASSERT_MSG_EQ (writer.IsOpen (), true, "Cannot open " << filename);
+    std::ostream os (&writer);
+    os << small << std::flush << large << std::flush << small << std::flush;
+    writer.Close ();
+    NS_TEST_EXPECT_MSG_EQ (writer.GetDroppedRecords (), 1, "The large record must be dropped");
+    NS_TEST_EXPECT_MSG_EQ (writer.GetDroppedBytes (), large.size (), "Wrong number of dropped bytes");
+    NS_TEST_EXPECT_MSG_EQ (ReadFile (filename), small + small, "Small records must be written");
+  }
+
+  // Records longer than the stream buffer are handed over in pieces: they
+  // are still dropped, or written, whole.
+  std::string huge (20000, 'c');
+
+  {
+    AsyncTraceWriter writer (filename, std::ios::out, 512, AsyncTraceWriter::DROP);
+    NS_TEST_ASSERT_MSG_EQ (writer.IsOpen (), true, "Cannot open " << filename);
+    std::ostream os (&writer);
+    os << small << std::flush << huge << std::flush << small << std::flush;
+    writer.Close ();
+    NS_TEST_EXPECT_MSG_EQ (writer.GetDroppedRecords (), 1, "The huge record must be dropped once");
+    NS_TEST_EXPECT_MSG_EQ (writer.GetDroppedBytes (), huge.size (), "Wrong number of dropped bytes");
+    NS_TEST_EXPECT_MSG_EQ (ReadFile (filename), small + small, "No piece of the huge record can be written");
+  }
+
+  {
+    AsyncTraceWriter writer (filename, std::ios::out, 8192, AsyncTraceWriter::DROP);
+    NS_TEST_ASSERT_MSG_EQ (writer.IsOpen (), true, "Cannot open " << filename);
+    std::ostream os (&writer);
+    os << small << std::flush << huge << std::flush << small << std::flush;
+    writer.Close ();
+    NS_TEST_EXPECT_MSG_EQ (writer.GetDroppedRecords (), 0, "A record partly in the ring cannot be dropped");
+    NS_TEST_EXPECT_MSG_EQ (ReadFile (filename), small + huge + small, "The huge record must be written whole");
+  }
+
+  remove (filename.c_str ());
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Write an ascii trace through an OutputStreamWrapper with the background
+ * writer enabled.
+ */
+class AsyncAsciiTestCase : public TestCase
+{
+public:
+  AsyncAsciiTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+AsyncAsciiTestCase::AsyncAsciiTestCase ()
+  : TestCase ("Check an ascii stream written from the background writer")
+{
+}
+
+void
+AsyncAsciiTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("async-trace-writer.tr");
+  std::ostringstream expected;
+  GlobalValue::Bind ("TraceAsyncWrite", BooleanValue (true));
+  {
+    Ptr<OutputStreamWrapper> stream = Create<OutputStreamWrapper> (filename, std::ios::out);
+    for (uint32_t i = 0; i < 10000; i++)
+      {
+        *stream->GetStream () << "+ " << i << " /NodeList/0/DeviceList/0" << std::endl;
+        expected << "+ " << i << " /NodeList/0/DeviceList/0" << std::endl;
+      }
+    // a last line without a flush
+    *stream->GetStream () << "end";
+    expected << "end";
+  }
+  GlobalValue::Bind ("TraceAsyncWrite", BooleanValue (false));
+  NS_TEST_EXPECT_MSG_EQ ((ReadFile (filename) == expected.str ()), true, "Wrong ascii trace");
+  remove (filename.c_str ());
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief AsyncTraceWriter TestSuite
+ */
+class AsyncTraceWriterTestSuite : public TestSuite
+{
+public:
+  AsyncTraceWriterTestSuite ();
+};
+
+AsyncTraceWriterTestSuite::AsyncTraceWriterTestSuite ()
+  : TestSuite ("async-trace-writer", UNIT)
+{
+  AddTestCase (new AsyncPcapTestCase, TestCase::QUICK);
+  AddTestCase (new AsyncOverflowTestCase, TestCase::QUICK);
+  AddTestCase (new AsyncAsciiTestCase, TestCase::QUICK);
+}
+
+static AsyncTraceWriterTestSuite g_asyncTraceWriterTestSuite; //!< Static variable for test initialization
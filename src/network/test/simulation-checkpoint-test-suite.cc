@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simulation-checkpoint.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Run two branches from a warmed-up simulation and check that each one
+ * continues from the checkpoint, and that the checkpoint is left untouched.
+ */
+class SimulationCheckpointTestCase : public TestCase
+{
+public:
+  SimulationCheckpointTestCase ();
+  virtual void DoRun (void);
+
+private:
+  /// Periodic event, advancing the counter
+  void Tick (void);
+  /// Setup of the baseline branch
+  void Baseline (void);
+  /// Setup of the branch which doubles the increment
+  void Double (void);
+  /**
+   * Finish callback of the branches
+   * \returns 0 if the counter has the expected value, 1 otherwise
+   */
+  int Finish (void);
+
+  uint32_t m_counter;   //!< Counter advanced by Tick
+  uint32_t m_increment; //!< Increment of the counter
+  uint32_t m_expected;  //!< Expected counter at the end of a branch
+};
+
+SimulationCheckpointTestCase::SimulationCheckpointTestCase ()
+  : TestCase ("Check that branches run from the checkpoint state")
+{
+}
+
+void
+SimulationCheckpointTestCase::Tick (void)
+{
+  m_counter += m_increment;
+  Simulator::Schedule (MilliSeconds (1), &SimulationCheckpointTestCase::Tick, this);
+}
+
+void
+SimulationCheckpointTestCase::Baseline (void)
+{
+  m_expected = m_counter + 5;
+  Simulator::Stop (MilliSeconds (5));
+}
+
+void
+SimulationCheckpointTestCase::Double (void)
+{
+  m_increment = 2;
+  m_expected = m_counter + 10;
+  Simulator::Stop (MilliSeconds (5));
+}
+
+int
+SimulationCheckpointTestCase::Finish (void)
+{
+  return (m_counter == m_expected && Simulator::Now () == MilliSeconds (15) + NanoSeconds (1)) ? 0 : 1;
+}
+
+void
+SimulationCheckpointTestCase::DoRun (void)
+{
+  NodeContainer nodes;
+  nodes.Create (2);
+  SimpleNetDeviceHelper helper;
+  helper.Install (nodes);
+
+  m_counter = 0;
+  m_increment = 1;
+  Simulator::Schedule (MilliSeconds (1), &SimulationCheckpointTestCase::Tick, this);
+  Simulator::Stop (MilliSeconds (10) + NanoSeconds (1));
+  Simulator::Run ();
+  NS_TEST_ASSERT_MSG_EQ (m_counter, 10, "Unexpected warm-up");
+
+  SimulationCheckpoint checkpoint;
+  checkpoint.AddBranch ("baseline", MakeCallback (&SimulationCheckpointTestCase::Baseline, this),
+                        MakeCallback (&SimulationCheckpointTestCase::Finish, this));
+  checkpoint.AddBranch ("double", MakeCallback (&SimulationCheckpointTestCase::Double, this),
+                        MakeCallback (&SimulationCheckpointTestCase::Finish, this));
+  checkpoint.SetMaxParallel (2);
+  std::vector<int> status = checkpoint.Run ();
+  NS_TEST_ASSERT_MSG_EQ (status.size (), 2, "Missing branch status");
+  NS_TEST_EXPECT_MSG_EQ (status[0], 0, "The baseline branch did not continue from the checkpoint");
+  NS_TEST_EXPECT_MSG_EQ (status[1], 0, "The modified branch did not continue from the checkpoint");
+  NS_TEST_EXPECT_MSG_EQ (m_counter, 10, "A branch modified the checkpoint");
+  NS_TEST_EXPECT_MSG_EQ (m_increment, 1, "A branch modified the checkpoint");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Simulation checkpoint test suite.
+ */
+class SimulationCheckpointTestSuite : public TestSuite
+{
+public:
+  SimulationCheckpointTestSuite ()
+    : TestSuite ("simulation-checkpoint", UNIT)
+  {
+    AddTestCase (new SimulationCheckpointTestCase, TestCase::QUICK);
+  }
+};
+
+static SimulationCheckpointTestSuite g_simulationCheckpointTestSuite; //!< Static variable for test initialization
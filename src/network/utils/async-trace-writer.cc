@@ -0,0 +1,369 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "async-trace-writer.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/global-value.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/enum.h"
+#ifdef HAVE_PTHREAD_H
+#include "ns3/system-thread.h"
+#include "ns3/system-condition.h"
+#include <sched.h>
+#endif /* HAVE_PTHREAD_H */
+#include <algorithm>
+#include <cstring>
+
+/// Initial size of the pending record
+#define RECORD_SIZE 2048
+/// Longest sleep of an idle writer thread, in nanoseconds
+#define WRITER_POLL_NS 1000000
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("AsyncTraceWriter");
+
+/**
+ * \relates AsyncTraceWriter
+ * \anchor GlobalValueTraceAsyncWrite
+ * \brief A global switch to write the pcap and ascii traces from a background thread.
+ */
+static GlobalValue g_traceAsyncWrite = GlobalValue ("TraceAsyncWrite",
+                                                    "Write the pcap and ascii traces from a background thread",
+                                                    BooleanValue (false),
+                                                    MakeBooleanChecker ());
+
+/**
+ * \relates AsyncTraceWriter
+ * \anchor GlobalValueTraceAsyncBufferSize
+ * \brief The size of the ring of each asynchronous trace file.
+ */
+static GlobalValue g_traceAsyncBufferSize = GlobalValue ("TraceAsyncBufferSize",
+                                                         "The size in bytes of the ring buffer of each asynchronous trace file",
+                                                         UintegerValue (4 << 20),
+                                                         MakeUintegerChecker<uint32_t> (4096));
+
+/**
+ * \relates AsyncTraceWriter
+ * \anchor GlobalValueTraceAsyncOverflowPolicy
+ * \brief What to do with a trace record which does not fit in the ring.
+ */
+static GlobalValue g_traceAsyncOverflowPolicy = GlobalValue ("TraceAsyncOverflowPolicy",
+                                                             "What to do with a trace record which does not fit in the ring buffer",
+                                                             EnumValue (AsyncTraceWriter::BLOCK),
+                                                             MakeEnumChecker (AsyncTraceWriter::BLOCK, "Block",
+                                                                              AsyncTraceWriter::DROP, "Drop"));
+
+AsyncTraceWriter::AsyncTraceWriter (std::string const &filename, std::ios::openmode mode,
+                                    uint32_t bufferSize, OverflowPolicy policy)
+  : m_record (RECORD_SIZE),
+    m_mask (0),
+    m_head (0),
+    m_tail (0),
+    m_stop (false),
+    m_error (false),
+    m_policy (policy),
+    m_droppedRecords (0),
+    m_droppedBytes (0),
+    m_maxRecord (RECORD_SIZE),
+    m_partial (false),
+    m_dropping (false),
+    m_closed (false)
+{
+  NS_LOG_FUNCTION (this << filename << mode << bufferSize << policy);
+  // The writer thread hands whole chunks of the ring to the file: the
+  // stream needs no buffer of its own.
+  m_file.rdbuf ()->pubsetbuf (0, 0);
+  m_file.open (filename.c_str (), mode | std::ios::out);
+  setp (&m_record[0], &m_record[0] + m_record.size ());
+#ifdef HAVE_PTHREAD_H
+  uint64_t size = 1;
+  while (size < bufferSize)
+    {
+      size <<= 1;
+    }
+  m_ring.resize (size);
+  m_mask = size - 1;
+  m_maxRecord = std::max<uint64_t> (RECORD_SIZE, size / 4);
+  m_wakeup = new SystemCondition ();
+  if (m_file.is_open ())
+    {
+      m_thread = Create<SystemThread> (MakeCallback (&AsyncTraceWriter::Run, this));
+      m_thread->Start ();
+    }
+#endif /* HAVE_PTHREAD_H */
+}
+
+AsyncTraceWriter::~AsyncTraceWriter ()
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+#ifdef HAVE_PTHREAD_H
+  delete m_wakeup;
+#endif /* HAVE_PTHREAD_H */
+}
+
+bool
+AsyncTraceWriter::IsEnabled (void)
+{
+  BooleanValue val;
+  g_traceAsyncWrite.GetValue (val);
+  return val.Get ();
+}
+
+AsyncTraceWriter *
+AsyncTraceWriter::Open (std::string const &filename, std::ios::openmode mode)
+{
+  NS_LOG_FUNCTION (filename << mode);
+  UintegerValue size;
+  g_traceAsyncBufferSize.GetValue (size);
+  EnumValue policy;
+  g_traceAsyncOverflowPolicy.GetValue (policy);
+  return new AsyncTraceWriter (filename, mode, size.Get (),
+                               static_cast<OverflowPolicy> (policy.Get ()));
+}
+
+bool
+AsyncTraceWriter::IsOpen (void) const
+{
+  return m_file.is_open ();
+}
+
+uint64_t
+AsyncTraceWriter::GetDroppedRecords (void) const
+{
+  return m_droppedRecords;
+}
+
+uint64_t
+AsyncTraceWriter::GetDroppedBytes (void) const
+{
+  return m_droppedBytes;
+}
+
+AsyncTraceWriter::int_type
+AsyncTraceWriter::overflow (int_type c)
+{
+  if (m_closed)
+    {
+      return traits_type::eof ();
+    }
+  std::size_t used = pptr () - pbase ();
+  if (used >= m_maxRecord)
+    {
+      // A stream which is never flushed would grow the record forever:
+      // hand a long record over in pieces.
+      Commit (pbase (), used, false);
+      used = 0;
+    }
+  else
+    {
+      m_record.resize (2 * m_record.size ());
+    }
+  setp (&m_record[0], &m_record[0] + m_record.size ());
+  pbump (static_cast<int> (used));
+  if (!traits_type::eq_int_type (c, traits_type::eof ()))
+    {
+      *pptr () = traits_type::to_char_type (c);
+      pbump (1);
+    }
+  return traits_type::not_eof (c);
+}
+
+int
+AsyncTraceWriter::sync (void)
+{
+  std::size_t used = pptr () - pbase ();
+  if (used > 0)
+    {
+      Commit (pbase (), used, true);
+      setp (&m_record[0], &m_record[0] + m_record.size ());
+    }
+  return m_error.load (std::memory_order_relaxed) ? -1 : 0;
+}
+
+void
+AsyncTraceWriter::Commit (const char *data, uint64_t size, bool end)
+{
+#ifdef HAVE_PTHREAD_H
+  if (m_thread != 0)
+    {
+      if (m_dropping)
+        {
+          // The first piece of this record was dropped: drop the others.
+          m_droppedBytes += size;
+          if (end)
+            {
+              m_droppedRecords++;
+              m_dropping = false;
+            }
+          return;
+        }
+      uint64_t capacity = m_mask + 1;
+      uint64_t head = m_head.load (std::memory_order_relaxed);
+      uint64_t used = head - m_tail.load (std::memory_order_acquire);
+      if (size <= capacity - used)
+        {
+          CopyIn (data, size);
+          m_partial = !end;
+          if (used < capacity / 4 && used + size >= capacity / 4)
+            {
+              Wake ();
+            }
+          return;
+        }
+      if (m_policy == DROP && !m_partial)
+        {
+          m_droppedBytes += size;
+          if (end)
+            {
+              m_droppedRecords++;
+            }
+          else
+            {
+              m_dropping = true;
+            }
+          Wake ();
+          return;
+        }
+      // Block, or finish a record already partly in the ring: hand the
+      // record over as the writer thread makes room.
+      while (size > 0)
+        {
+          used = m_head.load (std::memory_order_relaxed) - m_tail.load (std::memory_order_acquire);
+          uint64_t room = std::min (size, capacity - used);
+          if (room == 0)
+            {
+              Wake ();
+              sched_yield ();
+              continue;
+            }
+          CopyIn (data, room);
+          data += room;
+          size -= room;
+        }
+      m_partial = !end;
+      Wake ();
+      return;
+    }
+#endif /* HAVE_PTHREAD_H */
+  if (!m_file.write (data, size))
+    {
+      m_error.store (true, std::memory_order_relaxed);
+    }
+}
+
+void
+AsyncTraceWriter::CopyIn (const char *data, uint64_t size)
+{
+  uint64_t head = m_head.load (std::memory_order_relaxed);
+  uint64_t start = head & m_mask;
+  uint64_t first = std::min (size, m_mask + 1 - start);
+  std::memcpy (&m_ring[start], data, first);
+  std::memcpy (&m_ring[0], data + first, size - first);
+  m_head.store (head + size, std::memory_order_release);
+}
+
+void
+AsyncTraceWriter::Wake (void)
+{
+#ifdef HAVE_PTHREAD_H
+  m_wakeup->SetCondition (true);
+  m_wakeup->Signal ();
+#endif /* HAVE_PTHREAD_H */
+}
+
+void
+AsyncTraceWriter::Run (void)
+{
+#ifdef HAVE_PTHREAD_H
+  while (true)
+    {
+      bool stop = m_stop.load (std::memory_order_acquire);
+      uint64_t head = m_head.load (std::memory_order_acquire);
+      uint64_t tail = m_tail.load (std::memory_order_relaxed);
+      if (head != tail)
+        {
+          // Write everything up to the producer position, in at most two
+          // pieces when the data wraps around the end of the ring.
+          uint64_t start = tail & m_mask;
+          uint64_t size = std::min (head - tail, m_mask + 1 - start);
+          if (!m_error.load (std::memory_order_relaxed)
+              && !m_file.write (&m_ring[start], size))
+            {
+              m_error.store (true, std::memory_order_relaxed);
+            }
+          m_tail.store (tail + size, std::memory_order_release);
+          continue;
+        }
+      if (stop)
+        {
+          break;
+        }
+      m_wakeup->TimedWait (WRITER_POLL_NS);
+      m_wakeup->SetCondition (false);
+    }
+#endif /* HAVE_PTHREAD_H */
+}
+
+void
+AsyncTraceWriter::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  pubsync ();
+#ifdef HAVE_PTHREAD_H
+  if (m_thread != 0)
+    {
+      Wake ();
+      while (m_tail.load (std::memory_order_acquire) != m_head.load (std::memory_order_relaxed))
+        {
+          sched_yield ();
+        }
+    }
+#endif /* HAVE_PTHREAD_H */
+  m_file.flush ();
+}
+
+void
+AsyncTraceWriter::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_closed)
+    {
+      return;
+    }
+  pubsync ();
+  m_closed = true;
+#ifdef HAVE_PTHREAD_H
+  if (m_thread != 0)
+    {
+      m_stop.store (true, std::memory_order_release);
+      Wake ();
+      m_thread->Join ();
+      m_thread = 0;
+    }
+#endif /* HAVE_PTHREAD_H */
+  if (m_droppedRecords > 0)
+    {
+      NS_LOG_WARN ("Dropped " << m_droppedRecords << " trace records (" <<
+                   m_droppedBytes << " bytes) because the ring buffer was full");
+    }
+  m_file.close ();
+}
+
+} // namespace ns3
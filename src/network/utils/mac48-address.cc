@@ -246,6 +246,20 @@ Mac48Address Mac48Address::GetMulticast (Ipv6Address addr)
   return etherAddr;
 }
 
+size_t Mac48AddressHash::operator() (Mac48Address const &x) const
+{
+  uint8_t buffer[6];
+  x.CopyTo (buffer);
+  uint64_t hash = 0;
+  for (uint8_t i = 0; i < 6; i++)
+    {
+      hash = (hash << 8) | buffer[i];
+    }
+  // fold the upper bytes for a 32 bit size_t: the addresses allocated by
+  // the simulator only differ in their last bytes
+  return static_cast<size_t> (hash ^ (hash >> 32));
+}
+
 std::ostream& operator<< (std::ostream& os, const Mac48Address & address)
 {
   uint8_t ad[6];
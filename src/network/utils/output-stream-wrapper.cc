@@ -17,6 +17,7 @@
  */
 
 #include "output-stream-wrapper.h"
+#include "async-trace-writer.h"
 #include "ns3/log.h"
 #include "ns3/fatal-impl.h"
 #include "ns3/abort.h"
@@ -27,9 +28,19 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("OutputStreamWrapper");
 
 OutputStreamWrapper::OutputStreamWrapper (std::string filename, std::ios::openmode filemode)
-  : m_destroyable (true)
+  : m_writer (0),
+    m_destroyable (true)
 {
   NS_LOG_FUNCTION (this << filename << filemode);
+  if ((filemode & std::ios::in) == 0 && AsyncTraceWriter::IsEnabled ())
+    {
+      m_writer = AsyncTraceWriter::Open (filename, filemode);
+      m_ostream = new std::ostream (m_writer);
+      FatalImpl::RegisterStream (m_ostream);
+      NS_ABORT_MSG_UNLESS (m_writer->IsOpen (), "AsciiTraceHelper::CreateFileStream():  " <<
+                           "Unable to Open " << filename << " for mode " << filemode);
+      return;
+    }
   std::ofstream* os = new std::ofstream ();
   os->open (filename.c_str (), filemode);
   m_ostream = os;
@@ -39,7 +50,7 @@ OutputStreamWrapper::OutputStreamWrapper (std::string filename, std::ios::openmo
 }
 
 OutputStreamWrapper::OutputStreamWrapper (std::ostream* os)
-  : m_ostream (os), m_destroyable (false)
+  : m_ostream (os), m_writer (0), m_destroyable (false)
 {
   NS_LOG_FUNCTION (this << os);
   FatalImpl::RegisterStream (m_ostream);
@@ -52,6 +63,9 @@ OutputStreamWrapper::~OutputStreamWrapper ()
   FatalImpl::UnregisterStream (m_ostream);
   if (m_destroyable) delete m_ostream;
   m_ostream = 0;
+  // The writer outlives its stream, and writes the pending records when deleted.
+  delete m_writer;
+  m_writer = 0;
 }
 
 std::ostream *
@@ -26,6 +26,8 @@
 
 namespace ns3 {
 
+class AsyncTraceWriter;
+
 /**
  * @brief A class encapsulating an output stream.
  *
@@ -66,6 +68,10 @@ namespace ns3 {
  *
  * This class uses a basic ns-3 reference counting base class but is not 
  * an ns3::Object with attributes, TypeId, or aggregation.
+ *
+ * A file opened by name for writing is written from a background thread
+ * when the global value TraceAsyncWrite is true (see AsyncTraceWriter);
+ * each flush of the stream, such as std::endl, then ends a record.
  */
 class OutputStreamWrapper : public SimpleRefCount<OutputStreamWrapper>
 {
@@ -94,6 +100,7 @@ public:
 
 private:
   std::ostream *m_ostream; //!< The output stream
+  AsyncTraceWriter *m_writer; //!< The background writer of the stream, or 0
   bool m_destroyable; //!< Can be destroyed
 };
 
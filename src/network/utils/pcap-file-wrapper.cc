@@ -116,42 +116,42 @@ PcapFileWrapper::Init (uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrec
 }
 
 void
-PcapFileWrapper::Write (Time t, Ptr<const Packet> p)
+PcapFileWrapper::Write (Time t, Ptr<const Packet> p, uint32_t snapLen)
 {
-  NS_LOG_FUNCTION (this << t << p);
+  NS_LOG_FUNCTION (this << t << p << snapLen);
   if (m_file.IsNanoSecMode())
     {
       uint64_t current = t.GetNanoSeconds ();
       uint64_t s       = current / 1000000000;
       uint64_t ns      = current % 1000000000;
-      m_file.Write (s, ns, p);
+      m_file.Write (s, ns, p, snapLen);
     }
   else
     {
       uint64_t current = t.GetMicroSeconds ();
       uint64_t s       = current / 1000000;
       uint64_t us      = current % 1000000;
-      m_file.Write (s, us, p);
+      m_file.Write (s, us, p, snapLen);
     }
 }
 
 void
-PcapFileWrapper::Write (Time t, const Header &header, Ptr<const Packet> p)
+PcapFileWrapper::Write (Time t, const Header &header, Ptr<const Packet> p, uint32_t snapLen)
 {
-  NS_LOG_FUNCTION (this << t << &header << p);
+  NS_LOG_FUNCTION (this << t << &header << p << snapLen);
   if (m_file.IsNanoSecMode())
     {
       uint64_t current = t.GetNanoSeconds ();
       uint64_t s       = current / 1000000000;
       uint64_t ns      = current % 1000000000;
-      m_file.Write (s, ns, header, p);
+      m_file.Write (s, ns, header, p, snapLen);
     }
   else
     {
       uint64_t current = t.GetMicroSeconds ();
       uint64_t s       = current / 1000000;
       uint64_t us      = current % 1000000;
-      m_file.Write (s, us, header, p);
+      m_file.Write (s, us, header, p, snapLen);
     }
 }
 
@@ -256,4 +256,11 @@ PcapFileWrapper::GetDataLinkType (void)
   return m_file.GetDataLinkType ();
 }
 
+uint64_t
+PcapFileWrapper::GetDroppedPackets (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_file.GetDroppedPackets ();
+}
+
 } // namespace ns3
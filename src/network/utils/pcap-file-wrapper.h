@@ -114,9 +114,12 @@ public:
    * 
    * \param t Packet timestamp as ns3::Time.
    * \param p Packet to write to the pcap file.
+   * \param snapLen Maximum number of bytes of this packet to save, in
+   * addition to the snapshot length of the file.
    * 
    */
-  void Write (Time t, Ptr<const Packet> p);
+  void Write (Time t, Ptr<const Packet> p,
+              uint32_t snapLen = std::numeric_limits<uint32_t>::max ());
 
   /**
    * \brief Write the provided header along with the packet to the pcap file.
@@ -128,9 +131,12 @@ public:
    * \param t Packet timestamp as ns3::Time.
    * \param header The Header to prepend to the packet.
    * \param p Packet to write to the pcap file.
+   * \param snapLen Maximum number of bytes of the header and packet to
+   * save, in addition to the snapshot length of the file.
    * 
    */
-  void Write (Time t, const Header &header, Ptr<const Packet> p);
+  void Write (Time t, const Header &header, Ptr<const Packet> p,
+              uint32_t snapLen = std::numeric_limits<uint32_t>::max ());
 
   /**
    * \brief Write the provided data buffer to the pcap file.
@@ -220,6 +226,16 @@ public:
    */ 
   uint32_t GetDataLinkType (void);
 
+  /**
+   * \brief Returns the number of packets dropped because the buffer of the
+   * background writer was full.
+   *
+   * \see AsyncTraceWriter
+   *
+   * \returns number of dropped packets
+   */
+  uint64_t GetDroppedPackets (void) const;
+
 private:
   PcapFile m_file; //!< Pcap file
   uint32_t m_snapLen; //!< max length of saved packets
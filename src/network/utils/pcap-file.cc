@@ -27,6 +27,7 @@
 #include "ns3/header.h"
 #include "ns3/buffer.h"
 #include "pcap-file.h"
+#include "async-trace-writer.h"
 #include "ns3/log.h"
 #include "ns3/build-profile.h"
 //
@@ -49,6 +50,9 @@ const uint16_t VERSION_MINOR = 4;             /**< Minor version of supported pc
 
 PcapFile::PcapFile ()
   : m_file (),
+    m_writer (0),
+    m_asyncStream (0),
+    m_out (&m_file),
     m_swapMode (false),
     m_nanosecMode (false)
 {
@@ -68,7 +72,7 @@ bool
 PcapFile::Fail (void) const
 {
   NS_LOG_FUNCTION (this);
-  return m_file.fail ();
+  return m_out->fail ();
 }
 bool 
 PcapFile::Eof (void) const
@@ -80,7 +84,7 @@ void
 PcapFile::Clear (void)
 {
   NS_LOG_FUNCTION (this);
-  m_file.clear ();
+  m_out->clear ();
 }
 
 
@@ -88,6 +92,15 @@ void
 PcapFile::Close (void)
 {
   NS_LOG_FUNCTION (this);
+  if (m_writer != 0)
+    {
+      m_writer->Close ();
+      delete m_writer;
+      m_writer = 0;
+      m_asyncStream.rdbuf (0);
+      m_out = &m_file;
+      return;
+    }
   m_file.close ();
 }
 
@@ -147,6 +160,13 @@ PcapFile::GetSwapMode (void)
   return m_swapMode;
 }
 
+uint64_t
+PcapFile::GetDroppedPackets (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_writer != 0 ? m_writer->GetDroppedRecords () : 0;
+}
+
 bool
 PcapFile::IsNanoSecMode (void)
 {
@@ -204,9 +224,13 @@ PcapFile::WriteFileHeader (void)
   NS_LOG_FUNCTION (this);
   //
   // If we're initializing the file, we need to write the pcap file header
-  // at the start of the file.
+  // at the start of the file. A background writer starts from an empty
+  // file, whose first record is the header.
   //
-  m_file.seekp (0, std::ios::beg);
+  if (m_writer == 0)
+    {
+      m_file.seekp (0, std::ios::beg);
+    }
  
   //
   // We have the ability to write out the pcap file header in a foreign endian
@@ -234,13 +258,14 @@ PcapFile::WriteFileHeader (void)
   // Watch out for memory alignment differences between machines, so write
   // them all individually.
   //
-  m_file.write ((const char *)&headerOut->m_magicNumber, sizeof(headerOut->m_magicNumber));
-  m_file.write ((const char *)&headerOut->m_versionMajor, sizeof(headerOut->m_versionMajor));
-  m_file.write ((const char *)&headerOut->m_versionMinor, sizeof(headerOut->m_versionMinor));
-  m_file.write ((const char *)&headerOut->m_zone, sizeof(headerOut->m_zone));
-  m_file.write ((const char *)&headerOut->m_sigFigs, sizeof(headerOut->m_sigFigs));
-  m_file.write ((const char *)&headerOut->m_snapLen, sizeof(headerOut->m_snapLen));
-  m_file.write ((const char *)&headerOut->m_type, sizeof(headerOut->m_type));
+  m_out->write ((const char *)&headerOut->m_magicNumber, sizeof(headerOut->m_magicNumber));
+  m_out->write ((const char *)&headerOut->m_versionMajor, sizeof(headerOut->m_versionMajor));
+  m_out->write ((const char *)&headerOut->m_versionMinor, sizeof(headerOut->m_versionMinor));
+  m_out->write ((const char *)&headerOut->m_zone, sizeof(headerOut->m_zone));
+  m_out->write ((const char *)&headerOut->m_sigFigs, sizeof(headerOut->m_sigFigs));
+  m_out->write ((const char *)&headerOut->m_snapLen, sizeof(headerOut->m_snapLen));
+  m_out->write ((const char *)&headerOut->m_type, sizeof(headerOut->m_type));
+  EndRecord ();
 }
 
 void
@@ -333,6 +358,17 @@ PcapFile::Open (std::string const &filename, std::ios::openmode mode)
   mode |= std::ios::binary;
 
   m_filename=filename;
+  if ((mode & std::ios::in) == 0 && AsyncTraceWriter::IsEnabled ())
+    {
+      m_writer = AsyncTraceWriter::Open (filename, mode);
+      m_asyncStream.rdbuf (m_writer);
+      m_out = &m_asyncStream;
+      if (!m_writer->IsOpen ())
+        {
+          m_asyncStream.setstate (std::ios::failbit);
+        }
+      return;
+    }
   m_file.open (filename.c_str (), mode);
   if (mode & std::ios::in)
     {
@@ -400,12 +436,12 @@ PcapFile::Init (uint32_t dataLinkType, uint32_t snapLen, int32_t timeZoneCorrect
 }
 
 uint32_t
-PcapFile::WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
+PcapFile::WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen, uint32_t snapLen)
 {
-  NS_LOG_FUNCTION (this << tsSec << tsUsec << totalLen);
-  NS_ASSERT (m_file.good ());
+  NS_LOG_FUNCTION (this << tsSec << tsUsec << totalLen << snapLen);
+  NS_ASSERT (m_out->good ());
 
-  uint32_t inclLen = totalLen > m_fileHeader.m_snapLen ? m_fileHeader.m_snapLen : totalLen;
+  uint32_t inclLen = std::min (totalLen, std::min (m_fileHeader.m_snapLen, snapLen));
 
   PcapRecordHeader header;
   header.m_tsSec = tsSec;
@@ -422,47 +458,65 @@ PcapFile::WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
   // Watch out for memory alignment differences between machines, so write
   // them all individually.
   //
-  m_file.write ((const char *)&header.m_tsSec, sizeof(header.m_tsSec));
-  m_file.write ((const char *)&header.m_tsUsec, sizeof(header.m_tsUsec));
-  m_file.write ((const char *)&header.m_inclLen, sizeof(header.m_inclLen));
-  m_file.write ((const char *)&header.m_origLen, sizeof(header.m_origLen));
-  NS_BUILD_DEBUG(m_file.flush());
+  m_out->write ((const char *)&header.m_tsSec, sizeof(header.m_tsSec));
+  m_out->write ((const char *)&header.m_tsUsec, sizeof(header.m_tsUsec));
+  m_out->write ((const char *)&header.m_inclLen, sizeof(header.m_inclLen));
+  m_out->write ((const char *)&header.m_origLen, sizeof(header.m_origLen));
   return inclLen;
 }
 
+void
+PcapFile::EndRecord (void)
+{
+  //
+  // Flushing the stream of a background writer hands it the record; a
+  // file written synchronously is only flushed in debug builds.
+  //
+  if (m_writer != 0)
+    {
+      m_asyncStream.flush ();
+    }
+  else
+    {
+      NS_BUILD_DEBUG(m_file.flush());
+    }
+}
+
 void
 PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, uint8_t const * const data, uint32_t totalLen)
 {
   NS_LOG_FUNCTION (this << tsSec << tsUsec << &data << totalLen);
   uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalLen);
-  m_file.write ((const char *)data, inclLen);
-  NS_BUILD_DEBUG(m_file.flush());
+  m_out->write ((const char *)data, inclLen);
+  EndRecord ();
 }
 
 void 
-PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p)
+PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p, uint32_t snapLen)
 {
-  NS_LOG_FUNCTION (this << tsSec << tsUsec << p);
-  uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, p->GetSize ());
-  p->CopyData (&m_file, inclLen);
-  NS_BUILD_DEBUG(m_file.flush());
+  NS_LOG_FUNCTION (this << tsSec << tsUsec << p << snapLen);
+  uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, p->GetSize (), snapLen);
+  p->CopyData (m_out, inclLen);
+  EndRecord ();
 }
 
 void 
-PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<const Packet> p)
+PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<const Packet> p,
+                 uint32_t snapLen)
 {
-  NS_LOG_FUNCTION (this << tsSec << tsUsec << &header << p);
+  NS_LOG_FUNCTION (this << tsSec << tsUsec << &header << p << snapLen);
   uint32_t headerSize = header.GetSerializedSize ();
   uint32_t totalSize = headerSize + p->GetSize ();
-  uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalSize);
+  uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalSize, snapLen);
 
   Buffer headerBuffer;
   headerBuffer.AddAtStart (headerSize);
   header.Serialize (headerBuffer.Begin ());
   uint32_t toCopy = std::min (headerSize, inclLen);
-  headerBuffer.CopyData (&m_file, toCopy);
+  headerBuffer.CopyData (m_out, toCopy);
   inclLen -= toCopy;
-  p->CopyData (&m_file, inclLen);
+  p->CopyData (m_out, inclLen);
+  EndRecord ();
 }
 
 void
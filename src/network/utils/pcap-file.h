@@ -23,6 +23,7 @@
 
 #include <string>
 #include <fstream>
+#include <limits>
 #include <stdint.h>
 #include "ns3/ptr.h"
 
@@ -30,6 +31,7 @@ namespace ns3 {
 
 class Packet;
 class Header;
+class AsyncTraceWriter;
 
 
 /**
@@ -77,6 +79,9 @@ public:
    * \param filename String containing the name of the file.
    *
    * \param mode the access mode for the file.
+   *
+   * A file opened for writing only is written from a background thread
+   * when the global value TraceAsyncWrite is true (see AsyncTraceWriter).
    */
   void Open (std::string const &filename, std::ios::openmode mode);
 
@@ -139,9 +144,12 @@ public:
    * \param tsSec       Packet timestamp, seconds 
    * \param tsUsec      Packet timestamp, microseconds
    * \param p           Packet to write
+   * \param snapLen     Maximum number of bytes of this packet to save, in
+   *                    addition to the snapshot length of the file
    * 
    */
-  void Write (uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p);
+  void Write (uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p,
+              uint32_t snapLen = std::numeric_limits<uint32_t>::max ());
   /**
    * \brief Write next packet to file
    * 
@@ -149,9 +157,12 @@ public:
    * \param tsUsec      Packet timestamp, microseconds
    * \param header      Header to write, in front of packet
    * \param p           Packet to write
+   * \param snapLen     Maximum number of bytes of the header and packet to
+   *                    save, in addition to the snapshot length of the file
    * 
    */
-  void Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<const Packet> p);
+  void Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<const Packet> p,
+              uint32_t snapLen = std::numeric_limits<uint32_t>::max ());
 
 
   /**
@@ -195,6 +206,14 @@ public:
    */
   bool GetSwapMode (void);
 
+  /**
+   * \brief Get the number of packets dropped by the background writer
+   * because its buffer was full (see AsyncTraceWriter).
+   *
+   * \returns the number of dropped packets, 0 for a synchronous file
+   */
+  uint64_t GetDroppedPackets (void) const;
+
   /**
    * \brief Get the nanosecond mode of the file.
    *
@@ -357,9 +376,16 @@ private:
    * \param tsSec Time stamp (seconds part)
    * \param tsUsec Time stamp (microseconds part)
    * \param totalLen total packet length
+   * \param snapLen maximum length of the packet to write, in addition to
+   * the snapshot length of the file
    * \returns the length of the packet to write in the Pcap file
    */
-  uint32_t WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen);
+  uint32_t WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen,
+                              uint32_t snapLen = std::numeric_limits<uint32_t>::max ());
+  /**
+   * \brief End a record: hand it to the background writer, if any
+   */
+  void EndRecord (void);
 
   /**
    * \brief Read and verify a Pcap file header
@@ -368,6 +394,9 @@ private:
 
   std::string    m_filename;    //!< file name
   std::fstream   m_file;        //!< file stream
+  AsyncTraceWriter *m_writer;   //!< background writer of a file opened for writing, or 0
+  std::ostream   m_asyncStream; //!< stream over m_writer
+  std::ostream  *m_out;         //!< stream the records are written to
   PcapFileHeader m_fileHeader;  //!< file header
   bool m_swapMode;              //!< swap mode
   bool m_nanosecMode;           //!< nanosecond timestamp mode
@@ -388,6 +388,7 @@ QueueDisc::DoDispose (void)
   m_classes.clear ();
   m_devQueueIface = 0;
   m_send = nullptr;
+  m_sendBurst = nullptr;
   m_requeued = 0;
   m_internalQueueDbeFunctor = nullptr;
   m_internalQueueDadFunctor = nullptr;
@@ -563,6 +564,20 @@ QueueDisc::GetSendCallback (void) const
   return m_send;
 }
 
+void
+QueueDisc::SetSendBurstCallback (SendBurstCallback func)
+{
+  NS_LOG_FUNCTION (this);
+  m_sendBurst = func;
+}
+
+QueueDisc::SendBurstCallback
+QueueDisc::GetSendBurstCallback (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_sendBurst;
+}
+
 void
 QueueDisc::SetQuota (const uint32_t quota)
 {
@@ -972,6 +987,47 @@ QueueDisc::Run (void)
     }
 }
 
+void
+QueueDisc::RunBurst (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  if (m_devQueueIface || !m_sendBurst)
+    {
+      // the device may stop its queues while the packets are sent one at a time
+      uint32_t nPackets;
+      do
+        {
+          nPackets = GetNPackets ();
+          Run ();
+        }
+      while (GetNPackets () > 0 && GetNPackets () < nPackets);
+      return;
+    }
+
+  if (RunBegin ())
+    {
+      // the queues of the device are never stopped, hence a packet sent to the
+      // device is never requeued and Run would dequeue all of them anyway
+      std::vector<Ptr<QueueDiscItem> > items;
+      Ptr<QueueDiscItem> item;
+      while ((item = DequeuePacket ()) != 0)
+        {
+          // a device that does not install a device queue interface likely
+          // makes no use of the priority tag
+          SocketPriorityTag priorityTag;
+          item->GetPacket ()->RemovePacketTag (priorityTag);
+          items.push_back (item);
+        }
+      NS_LOG_LOGIC ("Send a burst of " << items.size () << " packets");
+      if (!items.empty ())
+        {
+          m_sendBurst (items);
+        }
+      RunEnd ();
+    }
+}
+
 bool
 QueueDisc::RunBegin (void)
 {
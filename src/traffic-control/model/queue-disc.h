@@ -372,6 +372,22 @@ public:
    */
   SendCallback GetSendCallback (void) const;
 
+  /// Callback invoked to send a burst of packets to the receiving object when RunBurst is called
+  typedef std::function<void (const std::vector<Ptr<QueueDiscItem> > &)> SendBurstCallback;
+
+  /**
+   * \param func the callback to send a burst of packets to the receiving object.
+   *
+   * Set the callback used by the RunBurst method to send the packets dequeued
+   * at once to the receiving object.
+   */
+  void SetSendBurstCallback (SendBurstCallback func);
+
+  /**
+   * \return the callback to send a burst of packets to the receiving object.
+   */
+  SendBurstCallback GetSendBurstCallback (void) const;
+
   /**
    * \brief Set the maximum number of dequeue operations following a packet enqueue
    * \param quota the maximum number of dequeue operations following a packet enqueue.
@@ -418,6 +434,15 @@ public:
    */
   void Run (void);
 
+  /**
+   * Dequeue the packets after a burst of packets has been enqueued. If the
+   * receiving object never stops its queues (it has no NetDeviceQueueInterface)
+   * and a send burst callback is set, all the packets that can be dequeued are
+   * sent at once, as Linux does with bulk dequeues. Otherwise, Run is called
+   * until the queue disc is empty or no more packets can be sent.
+   */
+  void RunBurst (void);
+
   /// Internal queues store QueueDiscItem objects
   typedef Queue<QueueDiscItem> InternalQueue;
 
@@ -706,6 +731,7 @@ private:
   uint32_t m_quota;                 //!< Maximum number of packets dequeued in a qdisc run
   Ptr<NetDeviceQueueInterface> m_devQueueIface;   //!< NetDevice queue interface
   SendCallback m_send;              //!< Callback used to send a packet to the receiving object
+  SendBurstCallback m_sendBurst;    //!< Callback used to send a burst of packets to the receiving object
   bool m_running;                   //!< The queue disc is performing multiple dequeue operations
   Ptr<QueueDiscItem> m_requeued;    //!< The last packet that failed to be transmitted
   bool m_peeked;                    //!< A packet was dequeued because Peek was called
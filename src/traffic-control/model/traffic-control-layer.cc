@@ -24,6 +24,7 @@
 #include "ns3/packet.h"
 #include "ns3/socket.h"
 #include "ns3/queue-disc.h"
+#include <algorithm>
 #include <tuple>
 
 namespace ns3 {
@@ -55,7 +56,8 @@ TrafficControlLayer::GetInstanceTypeId (void) const
 }
 
 TrafficControlLayer::TrafficControlLayer ()
-  : Object ()
+  : Object (),
+    m_burstDepth (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -72,6 +74,7 @@ TrafficControlLayer::DoDispose (void)
   m_node = 0;
   m_handlers.clear ();
   m_netDevices.clear ();
+  m_burst.clear ();
   Object::DoDispose ();
 }
 
@@ -193,6 +196,8 @@ TrafficControlLayer::ScanDevices (void)
               q->SetNetDeviceQueueInterface (ndqi);
               q->SetSendCallback ([dev] (Ptr<QueueDiscItem> item)
                                   { dev->Send (item->GetPacket (), item->GetAddress (), item->GetProtocol ()); });
+              q->SetSendBurstCallback ([dev] (const std::vector<Ptr<QueueDiscItem> > &items)
+                                       { SendBurstToDevice (dev, items); });
             }
         }
     }
@@ -257,6 +262,7 @@ TrafficControlLayer::DeleteRootQueueDiscOnDevice (Ptr<NetDevice> device)
     {
       q->SetNetDeviceQueueInterface (nullptr);
       q->SetSendCallback (nullptr);
+      q->SetSendBurstCallback (nullptr);
     }
   ndi->second.m_queueDiscsToWake.clear ();
 
@@ -346,6 +352,12 @@ TrafficControlLayer::Send (Ptr<NetDevice> device, Ptr<QueueDiscItem> item)
   NS_LOG_DEBUG ("Send packet to device " << device << " protocol number " <<
                 item->GetProtocol ());
 
+  if (m_burstDepth > 0)
+    {
+      m_burst.push_back (std::make_pair (device, item));
+      return;
+    }
+
   Ptr<NetDeviceQueueInterface> devQueueIface;
   std::map<Ptr<NetDevice>, NetDeviceInfo>::iterator ndi = m_netDevices.find (device);
 
@@ -398,4 +410,122 @@ TrafficControlLayer::Send (Ptr<NetDevice> device, Ptr<QueueDiscItem> item)
     }
 }
 
+void
+TrafficControlLayer::SendBurst (Ptr<NetDevice> device, const std::vector<Ptr<QueueDiscItem> > &items)
+{
+  NS_LOG_FUNCTION (this << device << items.size ());
+
+  Ptr<NetDeviceQueueInterface> devQueueIface;
+  std::map<Ptr<NetDevice>, NetDeviceInfo>::iterator ndi = m_netDevices.find (device);
+
+  if (ndi != m_netDevices.end ())
+    {
+      devQueueIface = ndi->second.m_ndqi;
+    }
+
+  if (ndi == m_netDevices.end () || ndi->second.m_rootQueueDisc == 0)
+    {
+      if (devQueueIface)
+        {
+          // the device may stop its queues in the middle of the burst
+          for (const auto &item : items)
+            {
+              Send (device, item);
+            }
+          return;
+        }
+      // the device has no attached queue disc and never stops its queues,
+      // thus add the header to the packets and send them directly to the device
+      for (const auto &item : items)
+        {
+          item->AddHeader ();
+          // a device that does not install a device queue interface likely
+          // makes no use of the priority tag
+          SocketPriorityTag priorityTag;
+          item->GetPacket ()->RemovePacketTag (priorityTag);
+        }
+      SendBurstToDevice (device, items);
+      return;
+    }
+
+  // Enqueue all the packets in the queue discs associated with the netdevice
+  // queues selected for them, then dequeue packets from such queue discs
+  std::vector<Ptr<QueueDisc> > qDiscs;
+  for (const auto &item : items)
+    {
+      std::size_t txq = 0;
+      if (devQueueIface && devQueueIface->GetNTxQueues () > 1)
+        {
+          txq = devQueueIface->GetSelectQueueCallback () (item);
+        }
+      NS_ASSERT (!devQueueIface || txq < devQueueIface->GetNTxQueues ());
+      item->SetTxQueueIndex (txq);
+
+      Ptr<QueueDisc> qDisc = ndi->second.m_queueDiscsToWake[txq];
+      NS_ASSERT (qDisc);
+      qDisc->Enqueue (item);
+      if (std::find (qDiscs.begin (), qDiscs.end (), qDisc) == qDiscs.end ())
+        {
+          qDiscs.push_back (qDisc);
+        }
+    }
+  for (auto& qDisc : qDiscs)
+    {
+      qDisc->RunBurst ();
+    }
+}
+
+void
+TrafficControlLayer::StartBurst (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_burstDepth++;
+}
+
+void
+TrafficControlLayer::EndBurst (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_burstDepth > 0, "No burst started");
+
+  if (--m_burstDepth > 0)
+    {
+      return;
+    }
+
+  std::vector<std::pair<Ptr<NetDevice>, Ptr<QueueDiscItem> > > burst;
+  burst.swap (m_burst);
+  std::vector<Ptr<QueueDiscItem> > items;
+  for (auto it = burst.begin (); it != burst.end (); )
+    {
+      Ptr<NetDevice> device = it->first;
+      items.clear ();
+      for (; it != burst.end () && it->first == device; it++)
+        {
+          items.push_back (it->second);
+        }
+      SendBurst (device, items);
+    }
+}
+
+void
+TrafficControlLayer::SendBurstToDevice (Ptr<NetDevice> device, const std::vector<Ptr<QueueDiscItem> > &items)
+{
+  NS_LOG_FUNCTION (device << items.size ());
+
+  std::vector<Ptr<Packet> > packets;
+  for (auto it = items.begin (); it != items.end (); )
+    {
+      const Address &dest = (*it)->GetAddress ();
+      uint16_t protocol = (*it)->GetProtocol ();
+      packets.clear ();
+      for (; it != items.end () && (*it)->GetAddress () == dest
+             && (*it)->GetProtocol () == protocol; it++)
+        {
+          packets.push_back ((*it)->GetPacket ());
+        }
+      device->SendBurst (packets, dest, protocol);
+    }
+}
+
 } // namespace ns3
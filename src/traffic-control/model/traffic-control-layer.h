@@ -195,6 +195,35 @@ public:
    */
   virtual void Send (Ptr<NetDevice> device, Ptr<QueueDiscItem> item);
 
+  /**
+   * \brief Called from upper layer to queue a burst of packets for the transmission.
+   *
+   * The packets are enqueued in the queue disc installed on the device, which
+   * is then run once for the whole burst. Packets dequeued for a device that
+   * never stops its queues, or sent to a device without a queue disc, are
+   * handed over to the device at once by calling NetDevice::SendBurst.
+   *
+   * \param device the device the packets must be sent to
+   * \param items the queue items including the packets, in order
+   */
+  virtual void SendBurst (Ptr<NetDevice> device, const std::vector<Ptr<QueueDiscItem> > &items);
+
+  /**
+   * \brief Start holding back the packets sent
+   *
+   * Until the matching call to EndBurst, the packets that the upper layers
+   * send one at a time are only stored. Calls can be nested.
+   */
+  void StartBurst (void);
+
+  /**
+   * \brief Send the packets held back since the matching call to StartBurst
+   *
+   * The packets are passed to SendBurst, a burst for each device, in the
+   * order they were sent.
+   */
+  void EndBurst (void);
+
 protected:
 
   virtual void DoDispose (void);
@@ -249,11 +278,22 @@ private:
    */
   Ptr<QueueDisc> GetRootQueueDiscOnDeviceByIndex (uint32_t index) const;
 
+  /**
+   * \brief Send a burst of packets to a device, grouping the packets by
+   *        destination address and protocol
+   * \param device the device the packets must be sent to
+   * \param items the queue items including the packets, in order
+   */
+  static void SendBurstToDevice (Ptr<NetDevice> device, const std::vector<Ptr<QueueDiscItem> > &items);
+
   /// The node this TrafficControlLayer object is aggregated to
   Ptr<Node> m_node;
   /// Map storing the required information for each device with a queue disc installed
   std::map<Ptr<NetDevice>, NetDeviceInfo> m_netDevices;
   ProtocolHandlerList m_handlers;  //!< List of upper-layer handlers
+  uint32_t m_burstDepth;           //!< Number of nested bursts started
+  /// Packets held back until the end of the burst, with their device
+  std::vector<std::pair<Ptr<NetDevice>, Ptr<QueueDiscItem> > > m_burst;
 };
 
 } // namespace ns3
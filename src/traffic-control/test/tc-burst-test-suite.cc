@@ -0,0 +1,374 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "ns3/simulator.h"
+#include "ns3/node-container.h"
+#include "ns3/traffic-control-layer.h"
+#include "ns3/traffic-control-helper.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/error-model.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/data-rate.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/drop-tail-queue.h"
+#include "ns3/queue.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief Queue Disc Burst Test Item
+ */
+class QueueDiscBurstTestItem : public QueueDiscItem {
+public:
+  /**
+   * Constructor
+   *
+   * \param p the packet stored in this item
+   * \param addr the destination address of the packet
+   */
+  QueueDiscBurstTestItem (Ptr<Packet> p, const Address &addr);
+  virtual ~QueueDiscBurstTestItem ();
+  virtual void AddHeader (void);
+  virtual bool Mark (void);
+};
+
+QueueDiscBurstTestItem::QueueDiscBurstTestItem (Ptr<Packet> p, const Address &addr)
+  : QueueDiscItem (p, addr, 0)
+{
+}
+
+QueueDiscBurstTestItem::~QueueDiscBurstTestItem ()
+{
+}
+
+void
+QueueDiscBurstTestItem::AddHeader (void)
+{
+}
+
+bool
+QueueDiscBurstTestItem::Mark (void)
+{
+  return false;
+}
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief A SimpleNetDevice recording the bursts it is given
+ */
+class BurstTestNetDevice : public SimpleNetDevice
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  virtual uint32_t SendBurst (const std::vector<Ptr<Packet> > &packets, const Address& dest, uint16_t protocolNumber);
+
+  std::vector<uint32_t> m_bursts;   //!< Number of packets of each burst
+};
+
+TypeId
+BurstTestNetDevice::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::BurstTestNetDevice")
+    .SetParent<SimpleNetDevice> ()
+    .SetGroupName ("TrafficControl")
+    .AddConstructor<BurstTestNetDevice> ()
+  ;
+  return tid;
+}
+
+uint32_t
+BurstTestNetDevice::SendBurst (const std::vector<Ptr<Packet> > &packets, const Address& dest, uint16_t protocolNumber)
+{
+  m_bursts.push_back (packets.size ());
+  return SimpleNetDevice::SendBurst (packets, dest, protocolNumber);
+}
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief Traffic Control Burst Test Case
+ *
+ * A burst of packets sent to a device which does not stop its queues is
+ * handed over to the device in one call per destination, with or without
+ * a queue disc.
+ */
+class TcBurstTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param queueDisc whether to install a queue disc on the device
+   */
+  TcBurstTestCase (bool queueDisc);
+  virtual ~TcBurstTestCase ();
+private:
+  virtual void DoRun (void);
+  /**
+   * Send a burst of packets, alternating between two destinations halfway
+   * \param n the node
+   * \param nPackets the number of packets to send
+   */
+  void SendBurst (Ptr<Node> n, uint16_t nPackets);
+  /**
+   * Receive a packet
+   * \param device the receiving device
+   * \param p the packet
+   * \param protocol the protocol number
+   * \param from the sender address
+   * \return true
+   */
+  bool Receive (Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol, const Address &from);
+
+  bool m_queueDisc;           //!< whether a queue disc is installed
+  Address m_dest1;            //!< first destination
+  Address m_dest2;            //!< second destination
+  std::vector<uint32_t> m_received;  //!< sizes of the packets received
+};
+
+TcBurstTestCase::TcBurstTestCase (bool queueDisc)
+  : TestCase (std::string ("Send a burst to a device that does not stop its queues, ")
+              + (queueDisc ? "with" : "without") + " a queue disc"),
+    m_queueDisc (queueDisc)
+{
+}
+
+TcBurstTestCase::~TcBurstTestCase ()
+{
+}
+
+void
+TcBurstTestCase::SendBurst (Ptr<Node> n, uint16_t nPackets)
+{
+  Ptr<TrafficControlLayer> tc = n->GetObject<TrafficControlLayer> ();
+  tc->StartBurst ();
+  for (uint16_t i = 0; i < nPackets; i++)
+    {
+      Address dest = (i < nPackets / 2 ? m_dest1 : m_dest2);
+      tc->Send (n->GetDevice (0), Create<QueueDiscBurstTestItem> (Create<Packet> (100 + i), dest));
+    }
+  NS_TEST_EXPECT_MSG_EQ (m_received.size (), 0, "No packet must be sent before the end of the burst");
+  tc->EndBurst ();
+}
+
+bool
+TcBurstTestCase::Receive (Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t protocol, const Address &from)
+{
+  m_received.push_back (p->GetSize ());
+  return true;
+}
+
+void
+TcBurstTestCase::DoRun (void)
+{
+  NodeContainer n;
+  n.Create (2);
+
+  n.Get (0)->AggregateObject (CreateObject<TrafficControlLayer> ());
+  n.Get (1)->AggregateObject (CreateObject<TrafficControlLayer> ());
+
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+
+  // no NetDeviceQueueInterface is aggregated to the devices
+  Ptr<BurstTestNetDevice> txDev = CreateObject<BurstTestNetDevice> ();
+  txDev->SetAddress (Mac48Address::Allocate ());
+  txDev->SetChannel (channel);
+  txDev->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+  n.Get (0)->AddDevice (txDev);
+
+  Ptr<SimpleNetDevice> rxDev = CreateObject<SimpleNetDevice> ();
+  rxDev->SetAddress (Mac48Address::Allocate ());
+  rxDev->SetChannel (channel);
+  rxDev->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+  n.Get (1)->AddDevice (rxDev);
+  rxDev->SetReceiveCallback (MakeCallback (&TcBurstTestCase::Receive, this));
+  rxDev->SetPromiscReceiveCallback (MakeNullCallback<bool, Ptr<NetDevice>, Ptr<const Packet>, uint16_t,
+                                                     const Address &, const Address &, NetDevice::PacketType> ());
+
+  m_dest1 = rxDev->GetAddress ();
+  m_dest2 = rxDev->GetBroadcast ();
+
+  Ptr<QueueDisc> qdisc;
+  if (m_queueDisc)
+    {
+      TrafficControlHelper tch;
+      tch.SetRootQueueDisc ("ns3::FifoQueueDisc");
+      qdisc = tch.Install (txDev).Get (0);
+    }
+
+  Simulator::Schedule (Seconds (0), &TcBurstTestCase::SendBurst, this, n.Get (0), 10);
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (txDev->m_bursts.size (), 2, "The burst must be handed over once for each destination");
+  NS_TEST_EXPECT_MSG_EQ (txDev->m_bursts[0], 5, "Unexpected size of the burst to the first destination");
+  NS_TEST_EXPECT_MSG_EQ (txDev->m_bursts[1], 5, "Unexpected size of the burst to the second destination");
+
+  NS_TEST_ASSERT_MSG_EQ (m_received.size (), 10, "All the packets of the burst must be received");
+  for (uint32_t i = 0; i < m_received.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_received[i], 100 + i, "The packets must be received in order");
+    }
+  if (qdisc)
+    {
+      QueueDisc::Stats stats = qdisc->GetStats ();
+      NS_TEST_EXPECT_MSG_EQ (stats.nTotalDequeuedPackets, 10, "All the packets must go through the queue disc");
+      NS_TEST_EXPECT_MSG_EQ (qdisc->GetNPackets (), 0, "The queue disc must be empty");
+    }
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief Traffic Control Burst Flow Control Test Case
+ *
+ * A burst of packets sent to a device which stops its queues is subject to
+ * the same flow control as the packets sent one at a time.
+ */
+class TcBurstFlowControlTestCase : public TestCase
+{
+public:
+  TcBurstFlowControlTestCase ();
+  virtual ~TcBurstFlowControlTestCase ();
+private:
+  virtual void DoRun (void);
+  /**
+   * Send a burst of packets
+   * \param n the node
+   * \param nPackets the number of packets to send
+   */
+  void SendBurst (Ptr<Node> n, uint16_t nPackets);
+  /**
+   * Check the packets stored in the device queue and in the queue disc
+   * \param dev the device
+   * \param nDevPackets the expected number of packets in the device queue
+   * \param nQdiscPackets the expected number of packets in the queue disc
+   */
+  void CheckPackets (Ptr<NetDevice> dev, uint16_t nDevPackets, uint16_t nQdiscPackets);
+};
+
+TcBurstFlowControlTestCase::TcBurstFlowControlTestCase ()
+  : TestCase ("Send a burst to a device that stops its queues")
+{
+}
+
+TcBurstFlowControlTestCase::~TcBurstFlowControlTestCase ()
+{
+}
+
+void
+TcBurstFlowControlTestCase::SendBurst (Ptr<Node> n, uint16_t nPackets)
+{
+  Ptr<TrafficControlLayer> tc = n->GetObject<TrafficControlLayer> ();
+  std::vector<Ptr<QueueDiscItem> > items;
+  for (uint16_t i = 0; i < nPackets; i++)
+    {
+      items.push_back (Create<QueueDiscBurstTestItem> (Create<Packet> (1000), Mac48Address ()));
+    }
+  tc->SendBurst (n->GetDevice (0), items);
+}
+
+void
+TcBurstFlowControlTestCase::CheckPackets (Ptr<NetDevice> dev, uint16_t nDevPackets, uint16_t nQdiscPackets)
+{
+  PointerValue ptr;
+  dev->GetAttributeFailSafe ("TxQueue", ptr);
+  Ptr<Queue<Packet> > queue = ptr.Get<Queue<Packet> > ();
+  NS_TEST_EXPECT_MSG_EQ (queue->GetNPackets (), nDevPackets, "Unexpected number of packets in the device queue");
+
+  Ptr<NetDeviceQueueInterface> ndqi = dev->GetObject<NetDeviceQueueInterface> ();
+  NS_TEST_EXPECT_MSG_EQ (ndqi->GetTxQueue (0)->IsStopped (), (nDevPackets == 5), "Unexpected state of the device queue");
+
+  Ptr<TrafficControlLayer> tc = dev->GetNode ()->GetObject<TrafficControlLayer> ();
+  Ptr<QueueDisc> qdisc = tc->GetRootQueueDiscOnDevice (dev);
+  NS_TEST_EXPECT_MSG_EQ (qdisc->GetNPackets (), nQdiscPackets, "Unexpected number of packets in the queue disc");
+}
+
+void
+TcBurstFlowControlTestCase::DoRun (void)
+{
+  NodeContainer n;
+  n.Create (2);
+
+  n.Get (0)->AggregateObject (CreateObject<TrafficControlLayer> ());
+  n.Get (1)->AggregateObject (CreateObject<TrafficControlLayer> ());
+
+  SimpleNetDeviceHelper simple;
+
+  NetDeviceContainer rxDevC = simple.Install (n.Get (1));
+
+  simple.SetDeviceAttribute ("DataRate", DataRateValue (DataRate ("1Mb/s")));
+  simple.SetQueue ("ns3::DropTailQueue", "MaxSize", StringValue ("5p"));
+
+  Ptr<NetDevice> txDev;
+  txDev = simple.Install (n.Get (0), DynamicCast<SimpleChannel> (rxDevC.Get (0)->GetChannel ())).Get (0);
+  txDev->SetMtu (2500);
+
+  TrafficControlHelper tch = TrafficControlHelper::Default ();
+  tch.Install (txDev);
+
+  // transmit a burst of 10 packets at time 0
+  Simulator::Schedule (Time (Seconds (0)), &TcBurstFlowControlTestCase::SendBurst,
+                       this, n.Get (0), 10);
+
+  // as when the packets are sent one at a time, the transmission of each
+  // packet takes 1000B/1Mbps = 8ms and, after 1ms, we have 5 packets in the
+  // device queue (stopped) and 4 in the queue disc
+  Simulator::Schedule (Time (MilliSeconds (1)), &TcBurstFlowControlTestCase::CheckPackets,
+                       this, txDev, 5, 4);
+  Simulator::Schedule (Time (MilliSeconds (33)), &TcBurstFlowControlTestCase::CheckPackets,
+                       this, txDev, 5, 0);
+  Simulator::Schedule (Time (MilliSeconds (41)), &TcBurstFlowControlTestCase::CheckPackets,
+                       this, txDev, 4, 0);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief Traffic Control Burst Test Suite
+ */
+static class TcBurstTestSuite : public TestSuite
+{
+public:
+  TcBurstTestSuite ()
+    : TestSuite ("tc-burst", UNIT)
+  {
+    AddTestCase (new TcBurstTestCase (false), TestCase::QUICK);
+    AddTestCase (new TcBurstTestCase (true), TestCase::QUICK);
+    AddTestCase (new TcBurstFlowControlTestCase (), TestCase::QUICK);
+  }
+} g_tcBurstTestSuite; ///< the test suite
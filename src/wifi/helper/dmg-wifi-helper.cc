@@ -22,6 +22,9 @@
 #include "ns3/names.h"
 #include "ns3/pointer.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/simulator.h"
+#include "ns3/realtime-simulator-impl.h"
 #include "dmg-wifi-helper.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/propagation-delay-model.h"
@@ -129,10 +132,20 @@ DmgWifiChannelHelper::AssignStreams (Ptr<DmgWifiChannel> c, int64_t stream)
   return c->AssignStreams (stream);
 }
 
+void
+DmgWifiChannelHelper::EnableRealtimeCatchUp (Ptr<DmgWifiChannel> channel)
+{
+  Ptr<RealtimeSimulatorImpl> impl = DynamicCast<RealtimeSimulatorImpl> (Simulator::GetImplementation ());
+  NS_ABORT_MSG_IF (impl == 0, "The realtime catch-up needs SimulatorImplementationType=ns3::RealtimeSimulatorImpl");
+  impl->TraceConnectWithoutContext ("CatchUp", MakeCallback (&DmgWifiChannel::SetCatchUp, channel));
+}
+
 DmgWifiPhyHelper::DmgWifiPhyHelper ()
   : m_channel (0)
 {
   m_phy.SetTypeId ("ns3::DmgWifiPhy");
+  /* Keep the headers of the data frames, not their multi-Gbps payload */
+  SetDataSnapshotLength (256);
 }
 
 void
@@ -166,6 +179,12 @@ DmgWifiPhyHelper::SetChannel (Ptr<DmgWifiChannel> channel)
   m_channel = channel;
 }
 
+void
+DmgWifiPhyHelper::SetTelemetry (Ptr<DmgTelemetry> telemetry)
+{
+  m_telemetry = telemetry;
+}
+
 void
 DmgWifiPhyHelper::SetChannel (std::string channelName)
 {
@@ -181,11 +200,17 @@ DmgWifiPhyHelper::Create (Ptr<Node> node, Ptr<NetDevice> device) const
   phy->SetErrorRateModel (error);
   phy->SetChannel (m_channel);
   phy->SetDevice (device);
+  if (m_telemetry != 0)
+    {
+      phy->SetTelemetry (m_telemetry);
+      m_channel->SetTelemetry (m_telemetry);
+    }
   return phy;
 }
 
 
 DmgWifiHelper::DmgWifiHelper ()
+  : m_servicePeriodQueues (0)
 {
   SetStandard (WIFI_PHY_STANDARD_80211ad);
   SetRemoteStationManager ("ns3::ConstantRateWifiManager",
@@ -204,14 +229,21 @@ DmgWifiHelper::Install (const DmgWifiPhyHelper &phyHelper,
                         NodeContainer::Iterator last) const
 {
   NetDeviceContainer devices;
-  for (NodeContainer::Iterator i = first; i != last; ++i)
+  uint32_t n = std::distance (first, last);
+  ObjectFactory deviceFactory;
+  deviceFactory.SetTypeId (WifiNetDevice::GetTypeId ());
+  std::vector<Ptr<WifiNetDevice> > newDevices = deviceFactory.Create<WifiNetDevice> (n);
+  std::vector<Ptr<WifiRemoteStationManager> > managers = m_stationManager.Create<WifiRemoteStationManager> (n);
+  std::vector<Ptr<Codebook> > codebooks = m_codeBook.Create<Codebook> (n);
+  uint32_t index = 0;
+  for (NodeContainer::Iterator i = first; i != last; ++i, ++index)
     {
       Ptr<Node> node = *i;
-      Ptr<WifiNetDevice> device = CreateObject<WifiNetDevice> ();
-      Ptr<WifiRemoteStationManager> manager = m_stationManager.Create<WifiRemoteStationManager> ();
+      Ptr<WifiNetDevice> device = newDevices[index];
+      Ptr<WifiRemoteStationManager> manager = managers[index];
       Ptr<DmgWifiMac> mac = StaticCast<DmgWifiMac> (macHelper.Create (device));
       Ptr<DmgWifiPhy> phy = StaticCast<DmgWifiPhy> (phyHelper.Create (node, device));
-      Ptr<Codebook> codebook = m_codeBook.Create<Codebook> ();
+      Ptr<Codebook> codebook = codebooks[index];
       codebook->SetDevice (device);
       mac->SetAddress (Mac48Address::Allocate ());
       mac->ConfigureStandard (m_standard);
@@ -238,7 +270,7 @@ DmgWifiHelper::Install (const DmgWifiPhyHelper &phyHelper,
           if (qosSupported.Get ())
             {
               ndqi = CreateObjectWithAttributes<NetDeviceQueueInterface> ("NTxQueues",
-                                                                          UintegerValue (4));
+                                                                          UintegerValue (4 + m_servicePeriodQueues));
 
               rmac->GetAttributeFailSafe ("BE_Txop", ptr);
               ackSelector = m_ackPolicySelector[AC_BE].Create<WifiAckPolicySelector> ();
@@ -268,6 +300,15 @@ DmgWifiHelper::Install (const DmgWifiPhyHelper &phyHelper,
               wmq = ptr.Get<QosTxop> ()->GetWifiMacQueue ();
               ndqi->GetTxQueue (3)->ConnectQueueTraces (wmq);
               ndqi->SetSelectQueueCallback (m_selectQueueCallback);
+              if (m_servicePeriodQueues > 0)
+                {
+                  // the queues following the access category ones hold the traffic of the SP peers
+                  mac->ConfigureServicePeriodQueues (ndqi, 4);
+                  DmgWifiMac *dmgMac = PeekPointer (mac);
+                  SelectQueueCallback selectQueue = m_selectQueueCallback;
+                  ndqi->SetSelectQueueCallback ([dmgMac, selectQueue] (Ptr<QueueItem> item)
+                                                { return dmgMac->SelectServicePeriodQueue (item, selectQueue (item)); });
+                }
             }
           else
             {
@@ -327,6 +368,12 @@ void DmgWifiHelper::SetCodebook (std::string name,
   m_codeBook.Set (n7, v7);
 }
 
+void
+DmgWifiHelper::SetServicePeriodQueues (uint8_t queues)
+{
+  m_servicePeriodQueues = queues;
+}
+
 NetDeviceContainer
 DmgWifiHelper::Install (const SpectrumDmgWifiPhyHelper &phyHelper,
                         const DmgWifiMacHelper &macHelper,
@@ -334,11 +381,17 @@ DmgWifiHelper::Install (const SpectrumDmgWifiPhyHelper &phyHelper,
                         NodeContainer::Iterator last, bool installCodebook) const
 {
   NetDeviceContainer devices;
-  for (NodeContainer::Iterator i = first; i != last; ++i)
+  uint32_t n = std::distance (first, last);
+  ObjectFactory deviceFactory;
+  deviceFactory.SetTypeId (WifiNetDevice::GetTypeId ());
+  std::vector<Ptr<WifiNetDevice> > newDevices = deviceFactory.Create<WifiNetDevice> (n);
+  std::vector<Ptr<WifiRemoteStationManager> > managers = m_stationManager.Create<WifiRemoteStationManager> (n);
+  uint32_t index = 0;
+  for (NodeContainer::Iterator i = first; i != last; ++i, ++index)
     {
       Ptr<Node> node = *i;
-      Ptr<WifiNetDevice> device = CreateObject<WifiNetDevice> ();
-      Ptr<WifiRemoteStationManager> manager = m_stationManager.Create<WifiRemoteStationManager> ();
+      Ptr<WifiNetDevice> device = newDevices[index];
+      Ptr<WifiRemoteStationManager> manager = managers[index];
       Ptr<DmgWifiMac> mac = StaticCast<DmgWifiMac> (macHelper.Create (device));
       Ptr<SpectrumDmgWifiPhy> phy = StaticCast<SpectrumDmgWifiPhy> (phyHelper.Create (node, device));
       mac->SetAddress (Mac48Address::Allocate ());
@@ -370,7 +423,7 @@ DmgWifiHelper::Install (const SpectrumDmgWifiPhyHelper &phyHelper,
           if (qosSupported.Get ())
             {
               ndqi = CreateObjectWithAttributes<NetDeviceQueueInterface> ("NTxQueues",
-                                                                          UintegerValue (4));
+                                                                          UintegerValue (4 + m_servicePeriodQueues));
 
               rmac->GetAttributeFailSafe ("BE_Txop", ptr);
               ackSelector = m_ackPolicySelector[AC_BE].Create<WifiAckPolicySelector> ();
@@ -400,6 +453,15 @@ DmgWifiHelper::Install (const SpectrumDmgWifiPhyHelper &phyHelper,
               wmq = ptr.Get<QosTxop> ()->GetWifiMacQueue ();
               ndqi->GetTxQueue (3)->ConnectQueueTraces (wmq);
               ndqi->SetSelectQueueCallback (m_selectQueueCallback);
+              if (m_servicePeriodQueues > 0)
+                {
+                  // the queues following the access category ones hold the traffic of the SP peers
+                  mac->ConfigureServicePeriodQueues (ndqi, 4);
+                  DmgWifiMac *dmgMac = PeekPointer (mac);
+                  SelectQueueCallback selectQueue = m_selectQueueCallback;
+                  ndqi->SetSelectQueueCallback ([dmgMac, selectQueue] (Ptr<QueueItem> item)
+                                                { return dmgMac->SelectServicePeriodQueue (item, selectQueue (item)); });
+                }
             }
           else
             {
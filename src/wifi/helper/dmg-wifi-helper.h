@@ -22,6 +22,7 @@
 #define DMG_WIFI_HELPER_H
 
 #include "ns3/dmg-wifi-channel.h"
+#include "ns3/dmg-telemetry.h"
 #include "dmg-wifi-mac-helper.h"
 #include "spectrum-wifi-helper.h"
 #include "wifi-helper.h"
@@ -142,6 +143,18 @@ public:
   */
   int64_t AssignStreams (Ptr<DmgWifiChannel> c, int64_t stream);
 
+  /**
+   * Switch the channel to its catch-up abstractions whenever the realtime
+   * simulator falls behind real time (SynchronizationMode=Adaptive), and
+   * back when it has caught up.
+   *
+   * The simulator implementation must be ns3::RealtimeSimulatorImpl.
+   *
+   * \param channel the channel to switch.
+   * \see DmgWifiChannel::SetCatchUp
+   */
+  static void EnableRealtimeCatchUp (Ptr<DmgWifiChannel> channel);
+
 
 private:
   std::vector<ObjectFactory> m_propagationLoss; ///< vector of propagation loss models
@@ -158,6 +171,8 @@ private:
  * The Pcap and ascii traces generated by the EnableAscii and EnablePcap methods defined
  * in this class correspond to PHY-level traces and come to us via WifiPhyHelper
  *
+ * Only the first 256 bytes of the data frames are stored in the Pcap traces by
+ * default; use SetDataSnapshotLength to change this.
  */
 class DmgWifiPhyHelper : public WifiPhyHelper
 {
@@ -186,6 +201,13 @@ public:
    * Every PHY created by a call to Install is associated to this channel.
    */
   void SetChannel (std::string channelName);
+  /**
+   * \param telemetry the telemetry sink to associate to this helper
+   *
+   * Every PHY created by a call to Install, and the channel they are
+   * attached to, record their per-frame telemetry to this sink.
+   */
+  void SetTelemetry (Ptr<DmgTelemetry> telemetry);
 
 protected:
   friend class DmgWifiHelper;
@@ -204,6 +226,7 @@ protected:
   virtual Ptr<WifiPhy> Create (Ptr<Node> node, Ptr<NetDevice> device) const;
 
   Ptr<DmgWifiChannel> m_channel; ///< Dmg wifi channel
+  Ptr<DmgTelemetry> m_telemetry; ///< Per-frame telemetry sink
 
 };
 
@@ -343,6 +366,18 @@ public:
                     std::string n5 = "", const AttributeValue &v5 = EmptyAttributeValue (),
                     std::string n6 = "", const AttributeValue &v6 = EmptyAttributeValue (),
                     std::string n7 = "", const AttributeValue &v7 = EmptyAttributeValue ());
+  /**
+   * \param queues the number of device transmission queues dedicated to the peers
+   *        of the service periods, in addition to the access category queues.
+   *
+   * With QoS, each installed device gets this number of extra transmission
+   * queues, which the DMG MAC maps to the peers of its service periods and
+   * starts and stops with them. Install a multi-queue aware queue disc, such as
+   * MqQueueDisc, on the devices so that the traffic of a peer is held back in
+   * the traffic control layer outside its service periods. Zero, the default,
+   * dedicates no queue.
+   */
+  void SetServicePeriodQueues (uint8_t queues);
   /**
    * \param phy the PHY helper to create PHY objects
    * \param mac the MAC helper to create MAC objects
@@ -382,6 +417,7 @@ public:
 
 private:
   ObjectFactory m_codeBook;                  ///< Codebook factory for all the devices
+  uint8_t m_servicePeriodQueues;             ///< Number of transmission queues for the SP peers
 
 };
 
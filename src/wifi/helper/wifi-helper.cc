@@ -163,7 +163,8 @@ AsciiPhyActivityTraceWithoutContext (
 WifiPhyHelper::WifiPhyHelper ()
   : m_pcapDlt (PcapHelper::DLT_IEEE802_11),
     m_asciiTraceType (ASCII_TRACE_LEGACY),
-    m_snaplen (std::numeric_limits<uint32_t>::max ())
+    m_snaplen (std::numeric_limits<uint32_t>::max ()),
+    m_dataSnaplen (std::numeric_limits<uint32_t>::max ())
 {
   SetPreambleDetectionModel ("ns3::ThresholdPreambleDetectionModel");
 }
@@ -278,9 +279,53 @@ WifiPhyHelper::EnableMultiBandPcap (std::string prefix, Ptr<NetDevice> nd, Ptr<W
 //  phy->TraceConnectWithoutContext ("MonitorSnifferRx", MakeBoundCallback (&WifiPhyHelper::PcapSniffRxEvent, file));
 }
 
+/**
+ * \param mpdu the MPDU, starting with its MAC header or, if it is part of an
+ * A-MPDU, with its MPDU delimiter
+ * \param aggregated whether the MPDU starts with its MPDU delimiter
+ * \param dataSnapLen the maximum length of the data frames to store
+ * \returns the maximum length of the MPDU to store
+ */
+static uint32_t
+GetPcapSnapLength (Ptr<const Packet> mpdu, bool aggregated, uint32_t dataSnapLen)
+{
+  uint8_t start[5];
+  uint32_t offset = aggregated ? 4 : 0;
+  if (dataSnapLen == std::numeric_limits<uint32_t>::max ()
+      || mpdu->CopyData (start, offset + 1) != offset + 1)
+    {
+      return std::numeric_limits<uint32_t>::max ();
+    }
+  // Bits 2 and 3 of the frame control field hold the type of the frame,
+  // which is 2 for data frames.
+  bool isData = ((start[offset] >> 2) & 0x3) == 2;
+  return isData ? offset + dataSnapLen : std::numeric_limits<uint32_t>::max ();
+}
+
+/**
+ * Write an MPDU behind its radiotap header, without copying the MPDU.
+ *
+ * \param file the pcap file wrapper
+ * \param header the radiotap header
+ * \param mpdu the MPDU
+ * \param dataSnapLen the maximum length of the data frames to store
+ */
+static void
+WriteRadiotapRecord (Ptr<PcapFileWrapper> file, const RadiotapHeader &header,
+                     Ptr<const Packet> mpdu, uint32_t dataSnapLen)
+{
+  uint32_t snapLen = GetPcapSnapLength (mpdu, false, dataSnapLen);
+  if (snapLen != std::numeric_limits<uint32_t>::max ())
+    {
+      snapLen += header.GetSerializedSize ();
+    }
+  file->Write (Simulator::Now (), header, mpdu, snapLen);
+}
+
 void
 WifiPhyHelper::PcapSniffTxEvent (
   Ptr<PcapFileWrapper> file,
+  uint32_t             dataSnapLen,
   Ptr<const Packet>    packet,
   uint16_t             channelFreqMhz,
   WifiTxVector         txVector,
@@ -290,7 +335,8 @@ WifiPhyHelper::PcapSniffTxEvent (
   switch (dlt)
     {
     case PcapHelper::DLT_IEEE802_11:
-      file->Write (Simulator::Now (), packet);
+      file->Write (Simulator::Now (), packet,
+                   GetPcapSnapLength (packet, txVector.IsAggregation (), dataSnapLen));
       return;
     case PcapHelper::DLT_PRISM_HEADER:
       {
@@ -301,8 +347,7 @@ WifiPhyHelper::PcapSniffTxEvent (
       {
         Ptr<Packet> p = packet->Copy ();
         RadiotapHeader header = GetRadiotapHeader (p, channelFreqMhz, txVector, aMpdu);
-        p->AddHeader (header);
-        file->Write (Simulator::Now (), p);
+        WriteRadiotapRecord (file, header, p, dataSnapLen);
         return;
       }
     default:
@@ -313,6 +358,7 @@ WifiPhyHelper::PcapSniffTxEvent (
 void
 WifiPhyHelper::PcapSniffRxEvent (
   Ptr<PcapFileWrapper>  file,
+  uint32_t              dataSnapLen,
   Ptr<const Packet>     packet,
   uint16_t              channelFreqMhz,
   WifiTxVector          txVector,
@@ -323,7 +369,8 @@ WifiPhyHelper::PcapSniffRxEvent (
   switch (dlt)
     {
     case PcapHelper::DLT_IEEE802_11:
-      file->Write (Simulator::Now (), packet);
+      file->Write (Simulator::Now (), packet,
+                   GetPcapSnapLength (packet, txVector.IsAggregation (), dataSnapLen));
       return;
     case PcapHelper::DLT_PRISM_HEADER:
       {
@@ -336,8 +383,7 @@ WifiPhyHelper::PcapSniffRxEvent (
         RadiotapHeader header = GetRadiotapHeader (p, channelFreqMhz, txVector, aMpdu);
         header.SetAntennaSignalPower (signalNoise.signal);
         header.SetAntennaNoisePower (signalNoise.noise);
-        p->AddHeader (header);
-        file->Write (Simulator::Now (), p);
+        WriteRadiotapRecord (file, header, p, dataSnapLen);
         return;
       }
     default:
@@ -628,6 +674,12 @@ WifiPhyHelper::SetSnapshotLength (uint32_t length)
   m_snaplen = length;
 }
 
+void
+WifiPhyHelper::SetDataSnapshotLength (uint32_t length)
+{
+  m_dataSnaplen = length;
+}
+
 PcapHelper::DataLinkType
 WifiPhyHelper::GetPcapDataLinkType (void) const
 {
@@ -640,6 +692,12 @@ WifiPhyHelper::GetSnapshotLength (void) const
   return m_snaplen;
 }
 
+uint32_t
+WifiPhyHelper::GetDataSnapshotLength (void) const
+{
+  return m_dataSnaplen;
+}
+
 void
 WifiPhyHelper::EnablePcapInternal (std::string prefix, Ptr<NetDevice> nd, bool promiscuous, bool explicitFilename)
 {
@@ -672,8 +730,8 @@ WifiPhyHelper::EnablePcapInternal (std::string prefix, Ptr<NetDevice> nd, bool p
 
   Ptr<PcapFileWrapper> file = pcapHelper.CreateFile (filename, std::ios::out, m_pcapDlt, m_snaplen);
 
-  phy->TraceConnectWithoutContext ("MonitorSnifferTx", MakeBoundCallback (&WifiPhyHelper::PcapSniffTxEvent, file));
-  phy->TraceConnectWithoutContext ("MonitorSnifferRx", MakeBoundCallback (&WifiPhyHelper::PcapSniffRxEvent, file));
+  phy->TraceConnectWithoutContext ("MonitorSnifferTx", MakeBoundCallback (&WifiPhyHelper::PcapSniffTxEvent, file, m_dataSnaplen));
+  phy->TraceConnectWithoutContext ("MonitorSnifferRx", MakeBoundCallback (&WifiPhyHelper::PcapSniffRxEvent, file, m_dataSnaplen));
 }
 
 void
@@ -214,6 +214,19 @@ public:
    */
   void SetSnapshotLength (uint32_t length);
 
+  /**
+   * Set the maximum length of the data frames stored in the PCAP file.
+   * Only the first bytes of the data frames, enough for the MAC, LLC, IP
+   * and transport headers, are usually needed to analyze a trace, while
+   * their payload makes up most of the file at multi-Gbps rates. Control
+   * and management frames are always stored whole (up to the snapshot
+   * length of the file), and the original length of the truncated frames
+   * is kept in the PCAP records.
+   *
+   * \param length The length in bytes of the MPDU of the data frames to store.
+   */
+  void SetDataSnapshotLength (uint32_t length);
+
   /**
    * Get the data link type of PCAP traces to be used.
    *
@@ -228,6 +241,12 @@ public:
    * \return length The length of the snapshot in bytes.
    */
   uint32_t GetSnapshotLength (void) const;
+  /**
+   * Get the maximum length of the data frames stored in the PCAP file.
+   *
+   * \return The length in bytes of the MPDU of the data frames to store.
+   */
+  uint32_t GetDataSnapshotLength (void) const;
   /**
    * Enable pcap output for the indicated net device.
    *
@@ -246,6 +265,7 @@ public:
 protected:
   /**
    * \param file the pcap file wrapper
+   * \param dataSnapLen the maximum length of the data frames to store
    * \param packet the packet
    * \param channelFreqMhz the channel frequency
    * \param txVector the TXVECTOR
@@ -254,12 +274,14 @@ protected:
    * Handle TX pcap.
    */
   static void PcapSniffTxEvent (Ptr<PcapFileWrapper> file,
+                                uint32_t dataSnapLen,
                                 Ptr<const Packet> packet,
                                 uint16_t channelFreqMhz,
                                 WifiTxVector txVector,
                                 MpduInfo aMpdu);
   /**
    * \param file the pcap file wrapper
+   * \param dataSnapLen the maximum length of the data frames to store
    * \param packet the packet
    * \param channelFreqMhz the channel frequency
    * \param txVector the TXVECTOR
@@ -269,6 +291,7 @@ protected:
    * Handle RX pcap.
    */
   static void PcapSniffRxEvent (Ptr<PcapFileWrapper> file,
+                                uint32_t dataSnapLen,
                                 Ptr<const Packet> packet,
                                 uint16_t channelFreqMhz,
                                 WifiTxVector txVector,
@@ -280,6 +303,7 @@ protected:
   PcapHelper::DataLinkType m_pcapDlt; ///< PCAP data link type
   SupportedAsciiTraceTypes m_asciiTraceType;  ///< ASCII Trace type.
   uint32_t m_snaplen; ///< Snapshot length in bytes.
+  uint32_t m_dataSnaplen; ///< Snapshot length of the data frames in bytes.
   ObjectFactory m_frameCaptureModel; ///< frame capture model
   ObjectFactory m_preambleDetectionModel; ///< preamble detection model
 
@@ -175,8 +175,8 @@ BlockAckManager::CreateAgreement (const MgtAddBaRequestHeader *reqHdr, Mac48Addr
   uint8_t tid = reqHdr->GetTid ();
   m_agreementState (Simulator::Now (), recipient, tid, OriginatorBlockAckAgreement::PENDING);
   agreement.SetState (OriginatorBlockAckAgreement::PENDING);
-  PacketQueue queue;
-  std::pair<OriginatorBlockAckAgreement, PacketQueue> value (agreement, queue);
+  BlockAckScoreboard scoreboard;
+  std::pair<OriginatorBlockAckAgreement, BlockAckScoreboard> value (agreement, scoreboard);
   if (ExistsAgreement (recipient, tid))
     {
       // Delete agreement if it exists and in RESET state
@@ -250,6 +250,7 @@ BlockAckManager::UpdateAgreement (const MgtAddBaResponseHeader *respHdr, Mac48Ad
         }
       agreement.SetStartingSequence (startSeq);
       agreement.InitTxWindow ();
+      it->second.second.Init (agreement.GetBufferSize ());
       if (respHdr->IsImmediateBlockAck ())
         {
           agreement.SetImmediateBlockAck ();
@@ -301,28 +302,12 @@ BlockAckManager::StorePacket (Ptr<WifiMacQueueItem> mpdu)
       return;
     }
 
-  // store the packet and keep the list sorted in increasing order of sequence number
-  // with respect to the starting sequence number
-  PacketQueueI it = agreementIt->second.second.begin ();
-  while (it != agreementIt->second.second.end ())
+  // store the packet in the slot of its sequence number
+  if (!agreementIt->second.second.Insert (mpdu, agreementIt->second.first.GetStartingSequence ()))
     {
-      if (mpdu->GetHeader ().GetSequenceControl () == (*it)->GetHeader ().GetSequenceControl ())
-        {
-          NS_LOG_DEBUG ("Packet already in the queue of the BA agreement");
-          return;
-        }
-
-      uint16_t dist = agreementIt->second.first.GetDistance ((*it)->GetHeader ().GetSequenceNumber ());
-
-      if (mpduDist < dist ||
-          (mpduDist == dist && mpdu->GetHeader ().GetFragmentNumber () < (*it)->GetHeader ().GetFragmentNumber ()))
-        {
-          break;
-        }
-
-      it++;
+      NS_LOG_DEBUG ("Packet already in the queue of the BA agreement");
+      return;
     }
-  agreementIt->second.second.insert (it, mpdu);
   agreementIt->second.first.NotifyTransmittedMpdu (mpdu);
 }
 
@@ -357,17 +342,18 @@ BlockAckManager::GetBar (bool remove)
               continue;
             }
           // remove expired outstanding MPDUs and update the starting sequence number
-          for (auto mpduIt = it->second.second.begin (); mpduIt != it->second.second.end (); )
+          if (!it->second.second.IsEmpty ())
             {
-              if ((*mpduIt)->GetTimeStamp () + m_queue->GetMaxDelay () <= Simulator::Now ())
-                {
-                  // MPDU expired
-                  it->second.first.NotifyDiscardedMpdu (*mpduIt);
-                  mpduIt = it->second.second.erase (mpduIt);
-                }
-              else
+              std::vector<Ptr<WifiMacQueueItem>> mpdus;
+              it->second.second.GetMpdus (it->second.first.GetStartingSequence (), mpdus);
+              for (auto& mpdu : mpdus)
                 {
-                  mpduIt++;
+                  if (mpdu->GetTimeStamp () + m_queue->GetMaxDelay () <= Simulator::Now ())
+                    {
+                      // MPDU expired
+                      it->second.first.NotifyDiscardedMpdu (mpdu);
+                      it->second.second.Remove (mpdu);
+                    }
                 }
             }
           // update BAR if the starting sequence number changed
@@ -408,19 +394,8 @@ BlockAckManager::GetNBufferedPackets (Mac48Address recipient, uint8_t tid) const
     {
       return 0;
     }
-  uint32_t nPackets = 0;
-  PacketQueueCI queueIt = (*it).second.second.begin ();
-  while (queueIt != (*it).second.second.end ())
-    {
-      uint16_t currentSeq = (*queueIt)->GetHeader ().GetSequenceNumber ();
-      nPackets++;
-      /* a fragmented packet must be counted as one packet */
-      while (queueIt != (*it).second.second.end () && (*queueIt)->GetHeader ().GetSequenceNumber () == currentSeq)
-        {
-          queueIt++;
-        }
-    }
-  return nPackets;
+  /* a fragmented packet must be counted as one packet */
+  return it->second.second.GetNSequenceNumbers ();
 }
 
 void
@@ -451,18 +426,7 @@ BlockAckManager::NotifyGotAck (Ptr<const WifiMacQueueItem> mpdu)
   NS_ASSERT (it != m_agreements.end ());
 
   // remove the acknowledged frame from the queue of outstanding packets
-  PacketQueueI queueIt = it->second.second.begin ();
-  while (queueIt != it->second.second.end ())
-    {
-      if ((*queueIt)->GetHeader ().GetSequenceNumber () == mpdu->GetHeader ().GetSequenceNumber ())
-        {
-          queueIt = it->second.second.erase (queueIt);
-        }
-      else
-      {
-        queueIt++;
-      }
-    }
+  it->second.second.Remove (mpdu->GetHeader ().GetSequenceNumber ());
 
   it->second.first.NotifyAckedMpdu (mpdu);
 }
@@ -482,18 +446,7 @@ BlockAckManager::NotifyMissedAck (Ptr<WifiMacQueueItem> mpdu)
 
   // remove the frame from the queue of outstanding packets (it will be re-inserted
   // if retransmitted)
-  PacketQueueI queueIt = it->second.second.begin ();
-  while (queueIt != it->second.second.end ())
-    {
-      if ((*queueIt)->GetHeader ().GetSequenceNumber () == mpdu->GetHeader ().GetSequenceNumber ())
-        {
-          queueIt = it->second.second.erase (queueIt);
-        }
-      else
-      {
-        queueIt++;
-      }
-    }
+  it->second.second.Remove (mpdu->GetHeader ().GetSequenceNumber ());
 
   // insert in the retransmission queue
   InsertInRetryQueue (mpdu);
@@ -512,7 +465,6 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
           uint8_t nSuccessfulMpdus = 0;
           uint8_t nFailedMpdus = 0;
           AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-          PacketQueueI queueEnd = it->second.second.end ();
 
           if (it->second.first.m_inactivityEvent.IsRunning ())
             {
@@ -529,14 +481,20 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
 
           uint16_t currentStartingSeq = it->second.first.GetStartingSequence ();
           uint16_t currentSeq = SEQNO_SPACE_SIZE;   // invalid value
+          // in any case, the outstanding packets are no longer outstanding
+          std::vector<Ptr<WifiMacQueueItem>> mpdus;
+          std::vector<Ptr<WifiMacQueueItem>> lostMpdus;
 
           if (blockAck->IsBasic ())
             {
-              for (PacketQueueI queueIt = it->second.second.begin (); queueIt != queueEnd; )
+              mpdus.reserve (it->second.second.GetNSequenceNumbers ());
+              it->second.second.GetMpdus (currentStartingSeq, mpdus);
+              it->second.second.Clear ();
+              for (auto& mpdu : mpdus)
                 {
-                  currentSeq = (*queueIt)->GetHeader ().GetSequenceNumber ();
+                  currentSeq = mpdu->GetHeader ().GetSequenceNumber ();
                   if (blockAck->IsFragmentReceived (currentSeq,
-                                                    (*queueIt)->GetHeader ().GetFragmentNumber ()))
+                                                    mpdu->GetHeader ().GetFragmentNumber ()))
                     {
                       nSuccessfulMpdus++;
                     }
@@ -548,10 +506,8 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                           RemoveOldPackets (recipient, tid, currentSeq);
                         }
                       nFailedMpdus++;
-                      InsertInRetryQueue (*queueIt);
+                      lostMpdus.push_back (mpdu);
                     }
-                  // in any case, this packet is no longer outstanding
-                  queueIt = it->second.second.erase (queueIt);
                 }
               // If all frames were acknowledged, move the transmit window past the last one
               if (!foundFirstLost && currentSeq != SEQNO_SPACE_SIZE)
@@ -563,16 +519,37 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
           else if (blockAck->IsCompressed () || blockAck->IsExtendedCompressed () || blockAck->IsEdmgCompressed ())
           //// WIGIG ////
             {
-              for (PacketQueueI queueIt = it->second.second.begin (); queueIt != queueEnd; )
+              // test the outstanding packets against the bitmap of the BlockAck,
+              // made of words of 64 sequence numbers
+              uint64_t compressedBitmap = blockAck->GetCompressedBitmap ();
+              const uint64_t *bitmap = &compressedBitmap;
+              std::size_t bitmapSize = 64;
+              if (blockAck->IsExtendedCompressed ())
+                {
+                  bitmap = blockAck->GetExtendedCompressedBitmap ();
+                  bitmapSize = 256;
+                }
+              else if (blockAck->IsEdmgCompressed ())
+                {
+                  bitmap = blockAck->GetEdmgCompressedBitmap ();
+                  bitmapSize = 1024;
+                }
+              uint16_t bitmapStartingSeq = blockAck->GetStartingSequence ();
+
+              mpdus.reserve (it->second.second.GetNSequenceNumbers ());
+              it->second.second.GetMpdus (currentStartingSeq, mpdus);
+              it->second.second.Clear ();
+              for (auto& mpdu : mpdus)
                 {
-                  currentSeq = (*queueIt)->GetHeader ().GetSequenceNumber ();
-                  if (blockAck->IsPacketReceived (currentSeq))
+                  currentSeq = mpdu->GetHeader ().GetSequenceNumber ();
+                  std::size_t index = (currentSeq - bitmapStartingSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+                  if (index < bitmapSize && ((bitmap[index / 64] >> (index % 64)) & 1))
                     {
-                      it->second.first.NotifyAckedMpdu (*queueIt);
+                      it->second.first.NotifyAckedMpdu (mpdu);
                       nSuccessfulMpdus++;
                       if (!m_txOkCallback.IsNull ())
                         {
-                          m_txOkCallback ((*queueIt)->GetHeader ());
+                          m_txOkCallback (mpdu->GetHeader ());
                         }
                     }
                   else if (!QosUtilsIsOldPacket (currentStartingSeq, currentSeq))
@@ -580,14 +557,19 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                       nFailedMpdus++;
                       if (!m_txFailedCallback.IsNull ())
                         {
-                          m_txFailedCallback ((*queueIt)->GetHeader ());
+                          m_txFailedCallback (mpdu->GetHeader ());
                         }
-                      InsertInRetryQueue (*queueIt);
+                      lostMpdus.push_back (mpdu);
                     }
-                  // in any case, this packet is no longer outstanding
-                  queueIt = it->second.second.erase (queueIt);
                 }
             }
+          // the lost packets are sorted by sequence number, hence they are
+          // inserted in a single pass over the retransmission queue
+          WifiMacQueue::ConstIterator retryIt = m_retryPackets->PeekByTidAndAddress (tid, recipient);
+          for (auto& mpdu : lostMpdus)
+            {
+              InsertInRetryQueue (mpdu, retryIt);
+            }
           m_stationManager->ReportAmpduTxStatus (recipient, nSuccessfulMpdus, nFailedMpdus, rxSnr, dataSnr, dataTxVector);
         }
     }
@@ -605,14 +587,18 @@ BlockAckManager::NotifyMissedBlockAck (Mac48Address recipient, uint8_t tid)
   if (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED))
     {
       AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-      for (auto& item : it->second.second)
+      std::vector<Ptr<WifiMacQueueItem>> mpdus;
+      mpdus.reserve (it->second.second.GetNSequenceNumbers ());
+      it->second.second.GetMpdus (it->second.first.GetStartingSequence (), mpdus);
+      // remove all packets from the queue of outstanding packets (they will be
+      // re-inserted if retransmitted)
+      it->second.second.Clear ();
+      WifiMacQueue::ConstIterator retryIt = m_retryPackets->PeekByTidAndAddress (tid, recipient);
+      for (auto& item : mpdus)
         {
           // Queue previously transmitted packets that do not already exist in the retry queue.
-          InsertInRetryQueue (item);
+          InsertInRetryQueue (item, retryIt);
         }
-      // remove all packets from the queue of outstanding packets (they will be
-      // re-inserted if retransmitted)
-      it->second.second.clear ();
     }
 }
 
@@ -623,13 +609,13 @@ BlockAckManager::DiscardOutstandingMpdus (Mac48Address recipient, uint8_t tid)
   if (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED))
     {
       AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-      while (!it->second.second.empty ())
+      while (!it->second.second.IsEmpty ())
         {
-          Ptr<WifiMacQueueItem> mpdu = it->second.second.front ();
+          Ptr<WifiMacQueueItem> mpdu = it->second.second.Peek (it->second.first.GetStartingSequence ());
           if (it->second.first.GetDistance (mpdu->GetHeader ().GetSequenceNumber ()) >= SEQNO_SPACE_HALF_SIZE)
             {
               // old packet
-              it->second.second.pop_front ();
+              it->second.second.Remove (mpdu);
             }
           else
             {
@@ -837,7 +823,9 @@ bool BlockAckManager::NeedBarRetransmission (uint8_t tid, Mac48Address recipient
       NS_ASSERT (it != m_agreements.end ());
 
       // A BAR needs to be retransmitted if there is at least a non-expired outstanding MPDU
-      for (auto& mpdu : it->second.second)
+      std::vector<Ptr<WifiMacQueueItem>> mpdus;
+      it->second.second.GetMpdus (it->second.first.GetStartingSequence (), mpdus);
+      for (auto& mpdu : mpdus)
         {
           if (mpdu->GetTimeStamp () + m_queue->GetMaxDelay () > Simulator::Now ())
             {
@@ -908,21 +896,7 @@ BlockAckManager::RemoveOldPackets (Mac48Address recipient, uint8_t tid, uint16_t
   RemoveFromRetryQueue (recipient, tid, currStartingSeq, lastRemovedSeq);
 
   // remove packets that will become old from the queue of outstanding packets
-  PacketQueueI it = agreementIt->second.second.begin ();
-  while (it != agreementIt->second.second.end ())
-    {
-      uint16_t itSeq = (*it)->GetHeader ().GetSequenceNumber ();
-
-      if (agreementIt->second.first.GetDistance (itSeq) <= agreementIt->second.first.GetDistance (lastRemovedSeq))
-        {
-          NS_LOG_DEBUG ("Removing frame with seqnum = " << itSeq);
-          it = agreementIt->second.second.erase (it);
-        }
-      else
-        {
-          it++;
-        }
-    }
+  agreementIt->second.second.RemoveUpTo (currStartingSeq, lastRemovedSeq);
 }
 
 void
@@ -967,6 +941,14 @@ BlockAckManager::SetTxFailedCallback (TxFailed callback)
 
 void
 BlockAckManager::InsertInRetryQueue (Ptr<WifiMacQueueItem> mpdu)
+{
+  WifiMacQueue::ConstIterator it = m_retryPackets->PeekByTidAndAddress (mpdu->GetHeader ().GetQosTid (),
+                                                                        mpdu->GetHeader ().GetAddr1 ());
+  InsertInRetryQueue (mpdu, it);
+}
+
+void
+BlockAckManager::InsertInRetryQueue (Ptr<WifiMacQueueItem> mpdu, WifiMacQueue::ConstIterator &it)
 {
   NS_LOG_INFO ("Adding to retry queue " << *mpdu);
   NS_ASSERT (mpdu->GetHeader ().IsQosData ());
@@ -985,8 +967,6 @@ BlockAckManager::InsertInRetryQueue (Ptr<WifiMacQueueItem> mpdu)
       return;
     }
 
-  WifiMacQueue::ConstIterator it = m_retryPackets->PeekByTidAndAddress (tid, recipient);
-
   while (it != m_retryPackets->end ())
     {
       if (mpdu->GetHeader ().GetSequenceControl () == (*it)->GetHeader ().GetSequenceControl ())
@@ -1006,7 +986,13 @@ BlockAckManager::InsertInRetryQueue (Ptr<WifiMacQueueItem> mpdu)
       it = m_retryPackets->PeekByTidAndAddress (tid, recipient, ++it);
     }
   mpdu->GetHeader ().SetRetry ();
+  bool full = (m_retryPackets->GetNPackets () >= m_retryPackets->GetMaxSize ().GetValue ());
   m_retryPackets->Insert (it, mpdu);
+  if (full)
+    {
+      // the queue removed MPDUs to make room, which may include the one at the given position
+      it = m_retryPackets->PeekByTidAndAddress (tid, recipient);
+    }
 }
 
 uint16_t
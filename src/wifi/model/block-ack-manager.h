@@ -26,9 +26,11 @@
 #include "ns3/traced-callback.h"
 #include "wifi-mac-header.h"
 #include "originator-block-ack-agreement.h"
+#include "block-ack-scoreboard.h"
 #include "wifi-remote-station-manager.h"
 #include "block-ack-type.h"
 #include "wifi-mac-queue-item.h"
+#include "wifi-mac-queue.h"
 
 namespace ns3 {
 
@@ -38,7 +40,6 @@ class MgtAddBaRequestHeader;
 class CtrlBAckResponseHeader;
 class CtrlBAckRequestHeader;
 class MacTxMiddle;
-class WifiMacQueue;
 class WifiMode;
 class Packet;
 
@@ -441,32 +442,21 @@ private:
   void RemoveOldPackets (Mac48Address recipient, uint8_t tid, uint16_t startingSeq);
 
   /**
-   * typedef for a list of WifiMacQueueItem.
-   */
-  typedef std::list<Ptr<WifiMacQueueItem>> PacketQueue;
-  /**
-   * typedef for an iterator for PacketQueue.
-   */
-  typedef std::list<Ptr<WifiMacQueueItem>>::iterator PacketQueueI;
-  /**
-   * typedef for a const iterator for PacketQueue.
-   */
-  typedef std::list<Ptr<WifiMacQueueItem>>::const_iterator PacketQueueCI;
-  /**
-   * typedef for a map between MAC address and block ack agreement.
+   * typedef for a map between MAC address and block ack agreement, along
+   * with the MPDUs transmitted and not acknowledged yet.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> > Agreements;
+                   std::pair<OriginatorBlockAckAgreement, BlockAckScoreboard> > Agreements;
   /**
    * typedef for an iterator for Agreements.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> >::iterator AgreementsI;
+                   std::pair<OriginatorBlockAckAgreement, BlockAckScoreboard> >::iterator AgreementsI;
   /**
    * typedef for a const iterator for Agreements.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> >::const_iterator AgreementsCI;
+                   std::pair<OriginatorBlockAckAgreement, BlockAckScoreboard> >::const_iterator AgreementsCI;
 
   /**
    * \param mpdu the packet to insert in the retransmission queue
@@ -475,6 +465,16 @@ private:
    * This method ensures packets are retransmitted in the correct order.
    */
   void InsertInRetryQueue (Ptr<WifiMacQueueItem> mpdu);
+  /**
+   * Insert <i>mpdu</i> in retransmission queue, looking for its position
+   * from the given one, which is then set to the position following
+   * <i>mpdu</i>. Hence, a run of MPDUs sorted by sequence number is
+   * inserted in a single pass over the retransmission queue.
+   *
+   * \param mpdu the packet to insert in the retransmission queue
+   * \param pos the position of the retransmission queue to start from
+   */
+  void InsertInRetryQueue (Ptr<WifiMacQueueItem> mpdu, WifiMacQueue::ConstIterator &pos);
 
   /**
    * Remove an item from retransmission queue.
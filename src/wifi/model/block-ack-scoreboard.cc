@@ -0,0 +1,283 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "block-ack-scoreboard.h"
+#include "wifi-mac-queue-item.h"
+#include "wifi-utils.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("BlockAckScoreboard");
+
+/// the number of slots of a new scoreboard, which is also the number of bits in a word of the bitmap
+static const std::size_t BLOCK_ACK_SCOREBOARD_MIN_SLOTS = 64;
+
+/**
+ * \param seq a sequence number
+ * \param startingSeq the starting sequence number
+ * \return the distance of the sequence number from the starting sequence number
+ */
+static inline std::size_t
+GetSeqDistance (uint16_t seq, uint16_t startingSeq)
+{
+  return (seq - startingSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+}
+
+BlockAckScoreboard::BlockAckScoreboard ()
+  : m_slots (BLOCK_ACK_SCOREBOARD_MIN_SLOTS),
+    m_used (1, 0),
+    m_nUsed (0)
+{
+}
+
+void
+BlockAckScoreboard::Init (std::size_t winSize)
+{
+  NS_LOG_FUNCTION (this << winSize);
+  while (m_slots.size () < winSize && m_slots.size () < SEQNO_SPACE_SIZE)
+    {
+      Grow ();
+    }
+}
+
+std::size_t
+BlockAckScoreboard::GetSlot (uint16_t seq) const
+{
+  return seq & (m_slots.size () - 1);
+}
+
+bool
+BlockAckScoreboard::IsUsed (std::size_t slot) const
+{
+  return (m_used[slot / 64] >> (slot % 64)) & 1;
+}
+
+void
+BlockAckScoreboard::Free (std::size_t slot)
+{
+  m_slots[slot].clear ();
+  m_used[slot / 64] &= ~(uint64_t (1) << (slot % 64));
+  m_nUsed--;
+}
+
+void
+BlockAckScoreboard::Grow (void)
+{
+  NS_LOG_FUNCTION (this << m_slots.size ());
+  NS_ASSERT (m_slots.size () < SEQNO_SPACE_SIZE);
+
+  std::vector<std::vector<Ptr<WifiMacQueueItem>>> slots (m_slots.size () * 2);
+  std::vector<uint64_t> used (slots.size () / 64, 0);
+  for (std::size_t word = 0; word < m_used.size (); word++)
+    {
+      for (uint64_t bits = m_used[word]; bits != 0; bits &= bits - 1)
+        {
+          std::vector<Ptr<WifiMacQueueItem>> &mpdus = m_slots[word * 64 + __builtin_ctzll (bits)];
+          std::size_t slot = mpdus.front ()->GetHeader ().GetSequenceNumber () & (slots.size () - 1);
+          slots[slot].swap (mpdus);
+          used[slot / 64] |= uint64_t (1) << (slot % 64);
+        }
+    }
+  m_slots.swap (slots);
+  m_used.swap (used);
+}
+
+std::size_t
+BlockAckScoreboard::FindUsed (std::size_t slot, std::size_t count) const
+{
+  std::size_t skipped = 0;
+  while (skipped < count)
+    {
+      uint64_t bits = m_used[slot / 64] >> (slot % 64);
+      if (bits != 0)
+        {
+          return std::min (skipped + __builtin_ctzll (bits), count);
+        }
+      // go to the first slot of the next word
+      skipped += 64 - slot % 64;
+      slot = (slot - slot % 64 + 64) & (m_slots.size () - 1);
+    }
+  return count;
+}
+
+bool
+BlockAckScoreboard::Insert (Ptr<WifiMacQueueItem> mpdu, uint16_t startingSeq)
+{
+  NS_LOG_FUNCTION (this << *mpdu << startingSeq);
+  uint16_t seq = mpdu->GetHeader ().GetSequenceNumber ();
+  std::size_t distance = GetSeqDistance (seq, startingSeq);
+  NS_ASSERT (distance < SEQNO_SPACE_HALF_SIZE);
+
+  while (distance >= m_slots.size ())
+    {
+      Grow ();
+    }
+
+  std::size_t slot = GetSlot (seq);
+  while (IsUsed (slot) && m_slots[slot].front ()->GetHeader ().GetSequenceNumber () != seq)
+    {
+      // the slot holds MPDUs whose sequence number differs by a multiple of
+      // the number of slots: either they are old, and can no longer be
+      // acknowledged, or the starting sequence number moved back
+      if (GetSeqDistance (m_slots[slot].front ()->GetHeader ().GetSequenceNumber (), startingSeq)
+          >= SEQNO_SPACE_HALF_SIZE)
+        {
+          NS_LOG_DEBUG ("Drop the old MPDUs in the slot of " << seq);
+          Free (slot);
+        }
+      else
+        {
+          Grow ();
+          slot = GetSlot (seq);
+        }
+    }
+
+  std::vector<Ptr<WifiMacQueueItem>> &mpdus = m_slots[slot];
+  std::vector<Ptr<WifiMacQueueItem>>::iterator it = mpdus.begin ();
+  while (it != mpdus.end ()
+         && (*it)->GetHeader ().GetFragmentNumber () <= mpdu->GetHeader ().GetFragmentNumber ())
+    {
+      if ((*it)->GetHeader ().GetFragmentNumber () == mpdu->GetHeader ().GetFragmentNumber ())
+        {
+          return false;
+        }
+      it++;
+    }
+  if (mpdus.empty ())
+    {
+      m_used[slot / 64] |= uint64_t (1) << (slot % 64);
+      m_nUsed++;
+    }
+  mpdus.insert (it, mpdu);
+  return true;
+}
+
+void
+BlockAckScoreboard::Remove (uint16_t seq)
+{
+  NS_LOG_FUNCTION (this << seq);
+  std::size_t slot = GetSlot (seq);
+  if (IsUsed (slot) && m_slots[slot].front ()->GetHeader ().GetSequenceNumber () == seq)
+    {
+      Free (slot);
+    }
+}
+
+void
+BlockAckScoreboard::Remove (Ptr<const WifiMacQueueItem> mpdu)
+{
+  NS_LOG_FUNCTION (this << *mpdu);
+  std::size_t slot = GetSlot (mpdu->GetHeader ().GetSequenceNumber ());
+  if (!IsUsed (slot))
+    {
+      return;
+    }
+  std::vector<Ptr<WifiMacQueueItem>> &mpdus = m_slots[slot];
+  for (std::vector<Ptr<WifiMacQueueItem>>::iterator it = mpdus.begin (); it != mpdus.end (); it++)
+    {
+      if (*it == mpdu)
+        {
+          mpdus.erase (it);
+          if (mpdus.empty ())
+            {
+              Free (slot);
+            }
+          return;
+        }
+    }
+}
+
+void
+BlockAckScoreboard::RemoveUpTo (uint16_t startingSeq, uint16_t lastSeq)
+{
+  NS_LOG_FUNCTION (this << startingSeq << lastSeq);
+  std::size_t lastDistance = GetSeqDistance (lastSeq, startingSeq);
+  for (std::size_t word = 0; word < m_used.size (); word++)
+    {
+      for (uint64_t bits = m_used[word]; bits != 0; bits &= bits - 1)
+        {
+          std::size_t slot = word * 64 + __builtin_ctzll (bits);
+          if (GetSeqDistance (m_slots[slot].front ()->GetHeader ().GetSequenceNumber (), startingSeq)
+              <= lastDistance)
+            {
+              Free (slot);
+            }
+        }
+    }
+}
+
+void
+BlockAckScoreboard::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::size_t word = 0; word < m_used.size (); word++)
+    {
+      for (uint64_t bits = m_used[word]; bits != 0; bits &= bits - 1)
+        {
+          m_slots[word * 64 + __builtin_ctzll (bits)].clear ();
+        }
+      m_used[word] = 0;
+    }
+  m_nUsed = 0;
+}
+
+bool
+BlockAckScoreboard::IsEmpty (void) const
+{
+  return m_nUsed == 0;
+}
+
+std::size_t
+BlockAckScoreboard::GetNSequenceNumbers (void) const
+{
+  return m_nUsed;
+}
+
+std::size_t
+BlockAckScoreboard::GetNSlots (void) const
+{
+  return m_slots.size ();
+}
+
+Ptr<WifiMacQueueItem>
+BlockAckScoreboard::Peek (uint16_t startingSeq) const
+{
+  std::size_t slot = GetSlot (startingSeq);
+  std::size_t skipped = FindUsed (slot, m_slots.size ());
+  if (skipped == m_slots.size ())
+    {
+      return 0;
+    }
+  return m_slots[(slot + skipped) & (m_slots.size () - 1)].front ();
+}
+
+void
+BlockAckScoreboard::GetMpdus (uint16_t startingSeq, std::vector<Ptr<WifiMacQueueItem>> &mpdus) const
+{
+  std::size_t nSlots = m_slots.size ();
+  std::size_t slot = GetSlot (startingSeq);
+  for (std::size_t i = FindUsed (slot, nSlots); i < nSlots;
+       i += 1 + FindUsed ((slot + i + 1) & (nSlots - 1), nSlots - i - 1))
+    {
+      const std::vector<Ptr<WifiMacQueueItem>> &slotMpdus = m_slots[(slot + i) & (nSlots - 1)];
+      mpdus.insert (mpdus.end (), slotMpdus.begin (), slotMpdus.end ());
+    }
+}
+
+} //namespace ns3
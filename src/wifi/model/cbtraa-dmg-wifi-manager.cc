@@ -35,6 +35,7 @@ struct CbtraaDmgWifiRemoteStation : public WifiRemoteStation
 {
   double m_lastSnrCached;    //!< SNR most recently used to select a rate.
   WifiMode m_lastMode;       //!< Mode most recently used to the remote station.
+  WifiTxVector m_lastTxVector; //!< TXVECTOR most recently used to the remote station.
 };
 
 /// To avoid using the cache before a valid value has been cached
@@ -188,14 +189,18 @@ CbtraaDmgWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
   WifiTxVector txVector;
   WifiMode mode;
   uint64_t bestRate = 0;
-  if (station->m_lastSnrCached != CACHE_INITIAL_VALUE && station->m_lastSnrCached == station->m_state->m_linkSnr)
+  if (station->m_lastSnrCached != CACHE_INITIAL_VALUE && station->m_lastSnrCached == station->m_state->m_linkSnr
+      && station->m_lastTxVector.GetChannelWidth () == GetPhy ()->GetChannelWidth ()
+      && station->m_lastTxVector.GetTxPowerLevel () == GetDefaultTxPowerLevel ())
     {
-      // SNR has not changed, so skip the search and use the last
-      // mode selected
-      maxMode = station->m_lastMode;
-      NS_LOG_DEBUG ("Using cached mode = " << maxMode.GetUniqueName () <<
+      // Neither the SNR, the channel width nor the power level has changed,
+      // so skip the search and reuse the TXVECTOR built for the last mode
+      // selected
+      NS_LOG_DEBUG ("Using cached mode = " << station->m_lastMode.GetUniqueName () <<
                     " link SNR " << station->m_state->m_linkSnr <<
                     " cached " << station->m_lastSnrCached);
+      station->m_lastTxVector.SetAggregation (GetAggregation (station));
+      return station->m_lastTxVector;
     }
   else
     {
@@ -229,9 +234,10 @@ CbtraaDmgWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
         }
     }
   NS_LOG_DEBUG ("Found maxMode: " << maxMode);
-  return WifiTxVector (maxMode, GetDefaultTxPowerLevel (),
-                       GetPreambleForTransmission (maxMode.GetModulationClass (), false, false),
-                       GetPhy ()->GetChannelWidth (), GetAggregation (station));
+  station->m_lastTxVector = WifiTxVector (maxMode, GetDefaultTxPowerLevel (),
+                                          GetPreambleForTransmission (maxMode.GetModulationClass (), false, false),
+                                          GetPhy ()->GetChannelWidth (), GetAggregation (station));
+  return station->m_lastTxVector;
 }
 
 WifiTxVector
@@ -9,6 +9,7 @@
 #include "ns3/string.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
+#include "ns3/node.h"
 
 #include "amsdu-subframe-header.h"
 #include "channel-access-manager.h"
@@ -21,6 +22,7 @@
 #include "wifi-utils.h"
 #include "wifi-phy.h"
 #include "dmg-wifi-phy.h"
+#include "dmg-telemetry.h"
 
 namespace ns3 {
 
@@ -1461,6 +1463,20 @@ DmgApWifiMac::EndBeaconInterval (void)
 {
   NS_LOG_FUNCTION (this);
   NS_LOG_INFO ("DMG AP Ending BI at " << Simulator::Now ());
+  Ptr<DmgTelemetry> telemetry = GetDmgWifiPhy ()->GetTelemetry ();
+  if (telemetry != 0)
+    {
+      Time spDuration;
+      for (AllocationFieldList::const_iterator iter = m_allocationList.begin (); iter != m_allocationList.end (); ++iter)
+        {
+          if (iter->GetAllocationType () == SERVICE_PERIOD_ALLOCATION)
+            {
+              spDuration += MicroSeconds (iter->GetAllocationBlockDuration () * iter->GetNumberOfBlocks ());
+            }
+        }
+      telemetry->RecordBeaconInterval (GetDmgWifiPhy ()->GetDevice ()->GetNode ()->GetId (),
+                                       m_btiDuration, m_abftDuration, m_atiDuration, m_dtiDuration, spDuration);
+    }
   /* Cleanup non-static allocations */
   CleanupAllocations ();
   /** Reset SLS state machines **/
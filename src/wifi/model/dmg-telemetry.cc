@@ -0,0 +1,139 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ns3/log.h"
+#include "ns3/fatal-error.h"
+#include "ns3/abort.h"
+#include "dmg-telemetry.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DmgTelemetry");
+
+NS_OBJECT_ENSURE_REGISTERED (DmgTelemetry);
+
+static_assert (sizeof (DmgTelemetryRecord) == 64, "Telemetry records must be 64 bytes");
+static_assert (sizeof (DmgTelemetryFileHeader) == sizeof (DmgTelemetryRecord),
+               "The telemetry file header must have the size of one record");
+
+TypeId
+DmgTelemetry::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DmgTelemetry")
+    .SetParent<Object> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<DmgTelemetry> ()
+  ;
+  return tid;
+}
+
+DmgTelemetry::DmgTelemetry ()
+  : m_header (0),
+    m_records (0),
+    m_written (0),
+    m_mask (0),
+    m_mappedSize (0),
+    m_fd (-1)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DmgTelemetry::~DmgTelemetry ()
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+}
+
+void
+DmgTelemetry::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+  Object::DoDispose ();
+}
+
+void
+DmgTelemetry::Open (std::string fileName, uint32_t capacity)
+{
+  NS_LOG_FUNCTION (this << fileName << capacity);
+  NS_ASSERT (capacity > 0);
+  Close ();
+
+  uint64_t ringSize = 1;
+  while (ringSize < capacity)
+    {
+      ringSize <<= 1;
+    }
+  NS_ABORT_MSG_IF (ringSize > 0xffffffff, "Telemetry capacity too large: " << capacity);
+
+  m_fd = open (fileName.c_str (), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (m_fd < 0)
+    {
+      NS_FATAL_ERROR ("Unable to open telemetry file " << fileName << ": " << std::strerror (errno));
+    }
+  m_mappedSize = sizeof (DmgTelemetryFileHeader) + ringSize * sizeof (DmgTelemetryRecord);
+  if (ftruncate (m_fd, m_mappedSize) != 0)
+    {
+      NS_FATAL_ERROR ("Unable to size telemetry file " << fileName << ": " << std::strerror (errno));
+    }
+  void *base = mmap (0, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (base == MAP_FAILED)
+    {
+      NS_FATAL_ERROR ("Unable to map telemetry file " << fileName << ": " << std::strerror (errno));
+    }
+
+  m_header = static_cast<DmgTelemetryFileHeader *> (base);
+  m_header->magic = DMG_TELEMETRY_MAGIC;
+  m_header->version = DMG_TELEMETRY_VERSION;
+  m_header->recordSize = sizeof (DmgTelemetryRecord);
+  m_header->capacity = static_cast<uint32_t> (ringSize);
+  m_header->written.store (0, std::memory_order_release);
+  m_records = reinterpret_cast<DmgTelemetryRecord *> (m_header + 1);
+  m_written = 0;
+  m_mask = ringSize - 1;
+}
+
+void
+DmgTelemetry::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_header != 0)
+    {
+      msync (m_header, m_mappedSize, MS_SYNC);
+      munmap (m_header, m_mappedSize);
+      m_header = 0;
+      m_records = 0;
+    }
+  if (m_fd >= 0)
+    {
+      close (m_fd);
+      m_fd = -1;
+    }
+}
+
+uint64_t
+DmgTelemetry::GetNRecords (void) const
+{
+  return m_written;
+}
+
+} //namespace ns3
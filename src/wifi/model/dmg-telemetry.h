@@ -0,0 +1,299 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef DMG_TELEMETRY_H
+#define DMG_TELEMETRY_H
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include <atomic>
+#include <string>
+
+namespace ns3 {
+
+/**
+ * Type of a telemetry record.
+ */
+enum DmgTelemetryRecordType : uint8_t
+{
+  DMG_TELEMETRY_PPDU_TX = 0,        //!< A PPDU was handed to the channel
+  DMG_TELEMETRY_PPDU_RX = 1,        //!< The reception of a PPDU ended
+  DMG_TELEMETRY_CHANNEL = 2,        //!< The channel delivered a PPDU to a receiver
+  DMG_TELEMETRY_BEACON_INTERVAL = 3 //!< A beacon interval ended
+};
+
+/**
+ * One fixed-size telemetry record. The layout is part of the file format and
+ * is shared with the reader tool.
+ */
+struct DmgTelemetryRecord
+{
+  uint64_t timeNs;          //!< Simulation time of the record in nanoseconds
+  uint32_t nodeId;          //!< Node recording the event
+  uint8_t type;             //!< DmgTelemetryRecordType
+  uint8_t mcs;              //!< MCS index (PPDU records)
+  uint8_t sector;           //!< Active Tx or Rx sector (PPDU records)
+  uint8_t status;           //!< PER decision (PPDU_RX) or LoS class (CHANNEL)
+  uint64_t peer;            //!< Transmitter MAC address (PPDU_RX) or node ID (CHANNEL)
+  union
+  {
+    struct
+    {
+      double powerDbm;      //!< Tx power or received power in dBm
+      double sinrDb;        //!< SINR in dB (PPDU_RX)
+      uint64_t durationNs;  //!< PPDU duration in nanoseconds
+      uint64_t reserved[2]; //!< Reserved
+    } ppdu;                 //!< PPDU and channel records
+    struct
+    {
+      uint64_t btiNs;       //!< BTI duration in nanoseconds
+      uint64_t abftNs;      //!< A-BFT duration in nanoseconds
+      uint64_t atiNs;       //!< ATI duration in nanoseconds
+      uint64_t dtiNs;       //!< DTI duration in nanoseconds
+      uint64_t spNs;        //!< Total duration allocated to SPs in the DTI in nanoseconds
+    } bi;                   //!< Beacon interval records
+  };
+};
+
+/**
+ * Header at the beginning of a telemetry file.
+ */
+struct DmgTelemetryFileHeader
+{
+  uint32_t magic;                   //!< DMG_TELEMETRY_MAGIC
+  uint32_t version;                 //!< DMG_TELEMETRY_VERSION
+  uint32_t recordSize;              //!< sizeof (DmgTelemetryRecord)
+  uint32_t capacity;                //!< Number of records in the ring, a power of two
+  std::atomic<uint64_t> written;    //!< Total number of records written so far
+  uint8_t padding[40];              //!< Pad the header to one record
+};
+
+/// Magic number of telemetry files ("DMGT")
+static const uint32_t DMG_TELEMETRY_MAGIC = 0x544d4744;
+/// Version of the telemetry file format
+static const uint32_t DMG_TELEMETRY_VERSION = 1;
+
+/**
+ * \brief Binary per-frame telemetry of the DMG stack.
+ * \ingroup wifi
+ *
+ * Records are written to a fixed-size ring buffer mapped from a file, so
+ * that they survive the simulation and can be inspected while it runs. There
+ * is a single writer (the simulation thread), which publishes each record by
+ * advancing the counter in the file header with a release store; readers load
+ * the counter with acquire semantics and never block the writer. When the ring
+ * is full the oldest records are overwritten.
+ *
+ * Recording a sample is a handful of stores into the mapping, without any
+ * formatting or system call, so telemetry can stay enabled in long runs.
+ * Use the dmg-telemetry-reader utility to decode a file.
+ */
+class DmgTelemetry : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  DmgTelemetry ();
+  virtual ~DmgTelemetry ();
+
+  /**
+   * Create (or truncate) the telemetry file and map it.
+   *
+   * \param fileName the name of the telemetry file.
+   * \param capacity the number of records in the ring, rounded up to a power of two.
+   */
+  void Open (std::string fileName, uint32_t capacity);
+  /**
+   * Flush and unmap the telemetry file.
+   */
+  void Close (void);
+  /**
+   * \return the total number of records written, including overwritten ones.
+   */
+  uint64_t GetNRecords (void) const;
+
+  /**
+   * Record the transmission of a PPDU.
+   *
+   * \param nodeId the transmitting node.
+   * \param mcs the MCS of the PPDU.
+   * \param sector the active transmit sector.
+   * \param txPowerDbm the transmit power in dBm.
+   * \param duration the duration of the PPDU.
+   */
+  void RecordPpduTx (uint32_t nodeId, uint8_t mcs, uint8_t sector, double txPowerDbm, Time duration);
+  /**
+   * Record the end of the reception of a PPDU.
+   *
+   * \param nodeId the receiving node.
+   * \param transmitter the MAC address of the transmitter.
+   * \param mcs the MCS of the PPDU.
+   * \param sector the active receive sector.
+   * \param rxPowerDbm the received power in dBm.
+   * \param sinrDb the payload SINR in dB.
+   * \param success whether at least one MPDU was received correctly.
+   * \param duration the duration of the PPDU.
+   */
+  void RecordPpduRx (uint32_t nodeId, uint64_t transmitter, uint8_t mcs, uint8_t sector,
+                     double rxPowerDbm, double sinrDb, bool success, Time duration);
+  /**
+   * Record the delivery of a PPDU by the channel to a receiver.
+   *
+   * \param srcNode the transmitting node.
+   * \param dstNode the receiving node.
+   * \param rxPowerDbm the received power in dBm.
+   * \param losClass the LoS class of the link, or 0xff if the channel model does not compute it.
+   * \param duration the duration of the PPDU.
+   */
+  void RecordChannel (uint32_t srcNode, uint32_t dstNode, double rxPowerDbm, uint8_t losClass, Time duration);
+  /**
+   * Record the access periods of a completed beacon interval.
+   *
+   * \param nodeId the PCP/AP node.
+   * \param bti the BTI duration.
+   * \param abft the A-BFT duration.
+   * \param ati the ATI duration.
+   * \param dti the DTI duration.
+   * \param sp the total duration allocated to SPs in the DTI.
+   */
+  void RecordBeaconInterval (uint32_t nodeId, Time bti, Time abft, Time ati, Time dti, Time sp);
+
+private:
+  virtual void DoDispose (void);
+
+  /**
+   * \return the next slot of the ring, stamped with the current time.
+   */
+  DmgTelemetryRecord * NextRecord (void);
+  /**
+   * Publish the record returned by the last call to NextRecord.
+   */
+  void Commit (void);
+
+  DmgTelemetryFileHeader *m_header;   //!< Header of the mapped file
+  DmgTelemetryRecord *m_records;      //!< First record of the ring
+  uint64_t m_written;                 //!< Local copy of the published counter
+  uint64_t m_mask;                    //!< Capacity - 1
+  size_t m_mappedSize;                //!< Size of the mapping in bytes
+  int m_fd;                           //!< Descriptor of the telemetry file
+};
+
+inline DmgTelemetryRecord *
+DmgTelemetry::NextRecord (void)
+{
+  DmgTelemetryRecord *record = &m_records[m_written & m_mask];
+  record->timeNs = Simulator::Now ().GetNanoSeconds ();
+  return record;
+}
+
+inline void
+DmgTelemetry::Commit (void)
+{
+  m_header->written.store (++m_written, std::memory_order_release);
+}
+
+inline void
+DmgTelemetry::RecordPpduTx (uint32_t nodeId, uint8_t mcs, uint8_t sector, double txPowerDbm, Time duration)
+{
+  if (m_header == 0)
+    {
+      return;
+    }
+  DmgTelemetryRecord *record = NextRecord ();
+  record->nodeId = nodeId;
+  record->type = DMG_TELEMETRY_PPDU_TX;
+  record->mcs = mcs;
+  record->sector = sector;
+  record->status = 0;
+  record->peer = 0;
+  record->ppdu.powerDbm = txPowerDbm;
+  record->ppdu.sinrDb = 0;
+  record->ppdu.durationNs = duration.GetNanoSeconds ();
+  Commit ();
+}
+
+inline void
+DmgTelemetry::RecordPpduRx (uint32_t nodeId, uint64_t transmitter, uint8_t mcs, uint8_t sector,
+                            double rxPowerDbm, double sinrDb, bool success, Time duration)
+{
+  if (m_header == 0)
+    {
+      return;
+    }
+  DmgTelemetryRecord *record = NextRecord ();
+  record->nodeId = nodeId;
+  record->type = DMG_TELEMETRY_PPDU_RX;
+  record->mcs = mcs;
+  record->sector = sector;
+  record->status = success;
+  record->peer = transmitter;
+  record->ppdu.powerDbm = rxPowerDbm;
+  record->ppdu.sinrDb = sinrDb;
+  record->ppdu.durationNs = duration.GetNanoSeconds ();
+  Commit ();
+}
+
+inline void
+DmgTelemetry::RecordChannel (uint32_t srcNode, uint32_t dstNode, double rxPowerDbm, uint8_t losClass, Time duration)
+{
+  if (m_header == 0)
+    {
+      return;
+    }
+  DmgTelemetryRecord *record = NextRecord ();
+  record->nodeId = dstNode;
+  record->type = DMG_TELEMETRY_CHANNEL;
+  record->mcs = 0;
+  record->sector = 0;
+  record->status = losClass;
+  record->peer = srcNode;
+  record->ppdu.powerDbm = rxPowerDbm;
+  record->ppdu.sinrDb = 0;
+  record->ppdu.durationNs = duration.GetNanoSeconds ();
+  Commit ();
+}
+
+inline void
+DmgTelemetry::RecordBeaconInterval (uint32_t nodeId, Time bti, Time abft, Time ati, Time dti, Time sp)
+{
+  if (m_header == 0)
+    {
+      return;
+    }
+  DmgTelemetryRecord *record = NextRecord ();
+  record->nodeId = nodeId;
+  record->type = DMG_TELEMETRY_BEACON_INTERVAL;
+  record->mcs = 0;
+  record->sector = 0;
+  record->status = 0;
+  record->peer = 0;
+  record->bi.btiNs = bti.GetNanoSeconds ();
+  record->bi.abftNs = abft.GetNanoSeconds ();
+  record->bi.atiNs = ati.GetNanoSeconds ();
+  record->bi.dtiNs = dti.GetNanoSeconds ();
+  record->bi.spNs = sp.GetNanoSeconds ();
+  Commit ();
+}
+
+} // namespace ns3
+
+#endif /* DMG_TELEMETRY_H */
@@ -20,6 +20,8 @@
  */
 
 #include "ns3/simulator.h"
+#include "ns3/event-impl.h"
+#include "dmg-telemetry.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
 #include "ns3/net-device.h"
@@ -50,6 +52,212 @@ NS_LOG_COMPONENT_DEFINE ("DmgWifiChannel");
 
 NS_OBJECT_ENSURE_REGISTERED (DmgWifiChannel);
 
+/**
+ * \ingroup wifi
+ *
+ * Event delivering a PPDU or a TRN-Block subfield from a DmgWifiChannel
+ * to one of its receivers. The channel fans out one such event per
+ * receiver for every PLCP field, so instances are taken from and returned
+ * to a free list instead of going through the heap. The simulator releases
+ * the event after it has been invoked, which puts it back in the pool.
+ */
+class DmgWifiChannelDeliveryEvent : public EventImpl
+{
+public:
+  /** The kind of PLCP field delivered by the event. */
+  enum DeliveryType {
+    PPDU_DELIVERY = 0,
+    AGC_SUBFIELD_DELIVERY,
+    TRN_CE_SUBFIELD_DELIVERY,
+    TRN_SUBFIELD_DELIVERY,
+  };
+
+  /**
+   * Create an event delivering the first bit of a PPDU.
+   * \param receiver the receiving PHY.
+   * \param ppdu the copy of the PPDU handed over to the receiver.
+   * \param rxPowerDbm the received power in dBm.
+   */
+  DmgWifiChannelDeliveryEvent (Ptr<DmgWifiPhy> receiver, Ptr<WifiPpdu> ppdu, double rxPowerDbm);
+  /**
+   * Create an event delivering a TRN-Block subfield.
+   * \param type the type of the subfield.
+   * \param channel the channel the subfield is sent over.
+   * \param index the index of the receiver in the PHY list of the channel.
+   * \param sender the transmitting PHY.
+   * \param txVector the TXVECTOR of the packet.
+   * \param txPowerDbm the transmit power in dBm.
+   * \param txAntennaGainDbi the gain of the transmit antenna in dBi.
+   */
+  DmgWifiChannelDeliveryEvent (DeliveryType type, const DmgWifiChannel *channel, uint32_t index,
+                               Ptr<DmgWifiPhy> sender, const WifiTxVector &txVector,
+                               double txPowerDbm, double txAntennaGainDbi);
+  virtual ~DmgWifiChannelDeliveryEvent ();
+
+  /**
+   * Make sure at least the given number of events are available without allocation.
+   * \param count the number of events to keep in the free list.
+   */
+  static void Reserve (std::size_t count);
+
+  /**
+   * Take memory from the free list.
+   * \param size the size of the object being created.
+   * \return the memory for the new event.
+   */
+  static void *operator new (std::size_t size);
+  /**
+   * Return memory to the free list.
+   * \param p the memory of the released event.
+   */
+  static void operator delete (void *p);
+
+private:
+  virtual void Notify (void);
+
+  /**
+   * Free list of event-sized blocks. It is never destroyed, so that events
+   * released late, after Simulator::Destroy or during static destruction,
+   * can still be returned to it; Simulator::Destroy frees its blocks.
+   */
+  struct Pool
+  {
+    std::vector<void *> blocks;      //!< The free blocks.
+    bool releaseScheduled = false;   //!< Whether Simulator::Destroy frees the blocks.
+  };
+  /** \return the free list. */
+  static Pool &GetPool (void);
+  /** Make Simulator::Destroy free the blocks of the pool. */
+  static void ScheduleRelease (void);
+  /** Free the blocks of the pool. */
+  static void Release (void);
+
+  DeliveryType m_type;                //!< The kind of PLCP field delivered.
+  const DmgWifiChannel *m_channel;    //!< The channel delivering a subfield.
+  uint32_t m_index;                   //!< Index of the receiver in the PHY list.
+  Ptr<DmgWifiPhy> m_receiver;         //!< The receiver of a PPDU.
+  Ptr<DmgWifiPhy> m_sender;           //!< The sender of a subfield.
+  Ptr<WifiPpdu> m_ppdu;               //!< The delivered PPDU.
+  WifiTxVector m_txVector;            //!< The TXVECTOR of the subfield.
+  double m_powerDbm;                  //!< The received (PPDU) or transmitted (subfield) power in dBm.
+  double m_txAntennaGainDbi;          //!< The gain of the transmit antenna in dBi.
+};
+
+DmgWifiChannelDeliveryEvent::DmgWifiChannelDeliveryEvent (Ptr<DmgWifiPhy> receiver, Ptr<WifiPpdu> ppdu,
+                                                          double rxPowerDbm)
+  : m_type (PPDU_DELIVERY),
+    m_channel (0),
+    m_index (0),
+    m_receiver (receiver),
+    m_ppdu (ppdu),
+    m_powerDbm (rxPowerDbm),
+    m_txAntennaGainDbi (0)
+{
+}
+
+DmgWifiChannelDeliveryEvent::DmgWifiChannelDeliveryEvent (DeliveryType type, const DmgWifiChannel *channel,
+                                                          uint32_t index, Ptr<DmgWifiPhy> sender,
+                                                          const WifiTxVector &txVector,
+                                                          double txPowerDbm, double txAntennaGainDbi)
+  : m_type (type),
+    m_channel (channel),
+    m_index (index),
+    m_sender (sender),
+    m_txVector (txVector),
+    m_powerDbm (txPowerDbm),
+    m_txAntennaGainDbi (txAntennaGainDbi)
+{
+}
+
+DmgWifiChannelDeliveryEvent::~DmgWifiChannelDeliveryEvent ()
+{
+}
+
+DmgWifiChannelDeliveryEvent::Pool &
+DmgWifiChannelDeliveryEvent::GetPool (void)
+{
+  static Pool *pool = new Pool ();
+  return *pool;
+}
+
+void
+DmgWifiChannelDeliveryEvent::ScheduleRelease (void)
+{
+  Pool &pool = GetPool ();
+  if (!pool.releaseScheduled)
+    {
+      pool.releaseScheduled = true;
+      Simulator::ScheduleDestroy (&DmgWifiChannelDeliveryEvent::Release);
+    }
+}
+
+void
+DmgWifiChannelDeliveryEvent::Release (void)
+{
+  Pool &pool = GetPool ();
+  for (std::vector<void *>::iterator it = pool.blocks.begin (); it != pool.blocks.end (); it++)
+    {
+      ::operator delete (*it);
+    }
+  pool.blocks.clear ();
+  pool.releaseScheduled = false;
+}
+
+void
+DmgWifiChannelDeliveryEvent::Reserve (std::size_t count)
+{
+  ScheduleRelease ();
+  Pool &pool = GetPool ();
+  while (pool.blocks.size () < count)
+    {
+      pool.blocks.push_back (::operator new (sizeof (DmgWifiChannelDeliveryEvent)));
+    }
+}
+
+void *
+DmgWifiChannelDeliveryEvent::operator new (std::size_t size)
+{
+  NS_ASSERT (size == sizeof (DmgWifiChannelDeliveryEvent));
+  ScheduleRelease ();
+  Pool &pool = GetPool ();
+  if (pool.blocks.empty ())
+    {
+      return ::operator new (size);
+    }
+  void *p = pool.blocks.back ();
+  pool.blocks.pop_back ();
+  return p;
+}
+
+void
+DmgWifiChannelDeliveryEvent::operator delete (void *p)
+{
+  if (p != 0)
+    {
+      GetPool ().blocks.push_back (p);
+    }
+}
+
+void
+DmgWifiChannelDeliveryEvent::Notify (void)
+{
+  switch (m_type)
+    {
+    case PPDU_DELIVERY:
+      DmgWifiChannel::Receive (m_receiver, m_ppdu, m_powerDbm);
+      break;
+    case AGC_SUBFIELD_DELIVERY:
+      m_channel->ReceiveAgcSubfield (m_index, m_sender, m_txVector, m_powerDbm, m_txAntennaGainDbi);
+      break;
+    case TRN_CE_SUBFIELD_DELIVERY:
+      m_channel->ReceiveTrnCeSubfield (m_index, m_sender, m_txVector, m_powerDbm, m_txAntennaGainDbi);
+      break;
+    case TRN_SUBFIELD_DELIVERY:
+      m_channel->ReceiveTrnSubfield (m_index, m_sender, m_txVector, m_powerDbm, m_txAntennaGainDbi);
+      break;
+    }
+}
+
 TypeId
 DmgWifiChannel::GetTypeId (void)
 {
@@ -70,6 +278,12 @@ DmgWifiChannel::GetTypeId (void)
                      "Trace source for transmitting/receiving PLCP field (PHY Tracker).",
                      MakeTraceSourceAccessor (&DmgWifiChannel::m_phyActivityTrace),
                      "ns3::DmgWifiChannel::PhyActivityTracedCallback")
+    .AddAttribute ("CatchUpGainLifetime",
+                   "How long a link budget or a path gain computed while the simulation is behind "
+                   "real time can be reused.",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&DmgWifiChannel::m_catchUpGainLifetime),
+                   MakeTimeChecker ())
   ;
   return tid;
 }
@@ -85,7 +299,9 @@ DmgWifiChannel::DmgWifiChannel ()
     m_obsDensity (0),
     // m_itfFlag (0),
     m_adhocMode (false),
-    m_seq (false)
+    m_seq (false),
+    m_sendImpl (0),
+    m_catchUp (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -121,18 +337,60 @@ void
 DmgWifiChannel::SetScenarioModel (Ptr<Obstacle> scenario)
 {
   m_scenario = scenario;
+  m_sendImpl = 0;
+}
+
+Ptr<Obstacle>
+DmgWifiChannel::GetScenarioModel (void) const
+{
+  return m_scenario;
+}
+
+double
+DmgWifiChannel::GetScenarioGain (Vector senderPos, Vector receiverPos) const
+{
+  NS_LOG_FUNCTION (this << senderPos << receiverPos);
+  if (m_experimentalMode)
+    {
+      return 0;
+    }
+  else if (!m_adhocMode)
+    {
+      if (!m_SVChannel && !m_TGadChannel)
+        {
+          return m_scenario->checkLoS (senderPos, receiverPos).second;
+        }
+      else if (m_SVChannel != m_TGadChannel)
+        {
+          uint16_t channelStatus = m_scenario->GetMultiRoomFlag ()
+                                   ? m_scenario->checkLoS_withWall (senderPos, receiverPos).first
+                                   : m_scenario->checkLoS (senderPos, receiverPos).first;
+          if (channelStatus == LINE_OF_SIGHT)
+            {
+              return 0;
+            }
+          return (channelStatus == NON_LINE_OF_SIGHT) ? -20.0 : -1000.0;
+        }
+    }
+  else if (m_TGadChannel)
+    {
+      return (m_scenario->checkLoS (senderPos, receiverPos).first == NON_LINE_OF_SIGHT) ? -10.0 : 0;
+    }
+  return 0;
 }
 
 void 
 DmgWifiChannel::SetSVChannelEnabler (bool SVChannel)
 {
   m_SVChannel = SVChannel;
+  m_sendImpl = 0;
 }
 
 void 
 DmgWifiChannel::SetTGadChannelEnabler (bool TGadChannel)
 {
   m_TGadChannel = TGadChannel;
+  m_sendImpl = 0;
 }
 
 
@@ -153,6 +411,7 @@ void
 DmgWifiChannel::SetAdHocMode (bool adhocMode)
 {
   m_adhocMode = adhocMode;
+  m_sendImpl = 0;
 }
 
 void 
@@ -161,7 +420,71 @@ DmgWifiChannel::SetSeqSim (bool seq)
   m_seq = seq;
 }
 
+void
+DmgWifiChannel::SetLeakageCallback (LeakageCallback callback)
+{
+  NS_LOG_FUNCTION (this);
+  m_leakageCallback = callback;
+}
+
+void
+DmgWifiChannel::SetTelemetry (Ptr<DmgTelemetry> telemetry)
+{
+  NS_LOG_FUNCTION (this << telemetry);
+  m_telemetry = telemetry;
+}
+
+
+
+void
+DmgWifiChannel::SetCatchUp (bool catchUp)
+{
+  NS_LOG_FUNCTION (this << catchUp);
+  m_catchUp = catchUp;
+  if (!catchUp)
+    {
+      m_linkBudgetCache.clear ();
+      m_pathGainCache.clear ();
+    }
+}
+
+bool
+DmgWifiChannel::IsCatchingUp (void) const
+{
+  return m_catchUp;
+}
 
+bool
+DmgWifiChannel::DeliverSubfield (Ptr<DmgWifiPhy> receiver, const WifiTxVector &txVector) const
+{
+  return !m_catchUp || receiver->IsReceivingFrom (txVector.GetSender ());
+}
+
+double
+DmgWifiChannel::GetPathRxPower (Ptr<DmgWifiPhy> sender, Ptr<DmgWifiPhy> receiver, double txPowerDbm) const
+{
+  if (!m_catchUp)
+    {
+      return m_loss->CalcRxPower (txPowerDbm, sender->GetMobility (), receiver->GetMobility ());
+    }
+  /* Reuse the path gain while the positions do not change */
+  Time now = Simulator::Now ();
+  Ptr<MobilityModel> senderMobility = sender->GetMobility ();
+  Ptr<MobilityModel> receiverMobility = receiver->GetMobility ();
+  Vector senderPos = senderMobility->GetPosition ();
+  Vector receiverPos = receiverMobility->GetPosition ();
+  CachedPathGain &cached = m_pathGainCache[PhyPair (PeekPointer (sender), PeekPointer (receiver))];
+  if (!cached.valid || now - cached.time > m_catchUpGainLifetime
+      || cached.senderPos != senderPos || cached.receiverPos != receiverPos)
+    {
+      cached.valid = true;
+      cached.time = now;
+      cached.senderPos = senderPos;
+      cached.receiverPos = receiverPos;
+      cached.gainDb = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) - txPowerDbm;
+    }
+  return txPowerDbm + cached.gainDb;
+}
 
 void
 DmgWifiChannel::AddBlockage (double (*blockage)(), Ptr<DmgWifiPhy> srcWifiPhy, Ptr<DmgWifiPhy> dstWifiPhy)
@@ -199,6 +522,10 @@ void
 DmgWifiChannel::RecordPhyActivity (uint32_t srcID, uint32_t dstID, Time duration, double power,
                                    PLCP_FIELD_TYPE fieldType, ACTIVITY_TYPE activityType) const
 {
+  if (m_phyActivityTrace.IsEmpty ())
+    {
+      return;
+    }
   m_phyActivityTrace (srcID, dstID, duration, power, fieldType, activityType);
 }
 
@@ -220,6 +547,7 @@ DmgWifiChannel::LoadReceivedSignalStrengthFile (std::string fileName, Time updat
   file.close ();
   m_currentSignalStrengthIndex = 0;
   m_experimentalMode = true;
+  m_sendImpl = 0;
   m_updateFrequency = updateFreuqnecy;
   /* Schedule Update event */
   Simulator::Schedule (m_updateFrequency, &DmgWifiChannel::UpdateSignalStrengthValue, this);
@@ -1086,18 +1414,213 @@ DmgWifiChannel::SVChannelGain(int reflectorDenseMode, Ptr<DmgWifiPhy> sender, Pt
 
 
 
+/*
+ * Link-budget policies. Each policy computes the received power of one
+ * sender/receiver pair for one channel model; DoSend is instantiated once per
+ * policy so that the model choice is made when the channel is configured and
+ * not for every receiver of every PPDU.
+ */
+
+struct DmgWifiChannel::LinkContext
+{
+  Ptr<DmgWifiPhy> sender;               //!< Transmitting PHY
+  Ptr<DmgWifiPhy> receiver;             //!< Receiving PHY
+  Ptr<MobilityModel> senderMobility;    //!< Mobility of the transmitter
+  Ptr<MobilityModel> receiverMobility;  //!< Mobility of the receiver
+  Vector senderPos;                     //!< Position of the transmitter
+  Vector receiverPos;                   //!< Position of the receiver
+  double txPowerDbm;                    //!< Transmit power in dBm
+  double gtx;                           //!< Transmit antenna gain in dBi, may be overridden by the policy
+  double grx;                           //!< Receive antenna gain in dBi, may be overridden by the policy
+  uint8_t losClass;                     //!< LoS class reported to telemetry, when the model computes it
+};
+
+/// Received signal strength injected from a file
+struct DmgWifiChannel::TraceReplayLinkBudget
+{
+  static double RxPowerDbm (const DmgWifiChannel *channel, LinkContext &ctx)
+  {
+    return channel->m_receivedSignalStrength[channel->m_currentSignalStrengthIndex];
+  }
+};
+
+/// Jian-Liu channel (WiMove'21): propagation loss plus obstacle fading
+struct DmgWifiChannel::JianLiuLinkBudget
+{
+  static double RxPowerDbm (const DmgWifiChannel *channel, LinkContext &ctx)
+  {
+    std::pair<bool, double> losInfo = channel->m_scenario->checkLoS (ctx.senderPos, ctx.receiverPos);
+    ctx.losClass = losInfo.first;
+    return channel->m_loss->CalcRxPower (ctx.txPowerDbm, ctx.senderMobility, ctx.receiverMobility) +
+           ctx.gtx + ctx.grx + losInfo.second;
+  }
+};
+
+/// Saleh-Valenzuela 11ad channel, optionally blocked by the walls of a multi-room scenario
+template <bool MultiRoom>
+struct DmgWifiChannel::SalehValenzuelaLinkBudget
+{
+  static double RxPowerDbm (const DmgWifiChannel *channel, LinkContext &ctx)
+  {
+    bool channelStatus = channel->m_scenario->checkLoS (ctx.senderPos, ctx.receiverPos).first;
+    ctx.losClass = channelStatus;
+    uint16_t channelStatus_withWall = 0;
+    if (MultiRoom)
+      {
+        channelStatus_withWall = channel->m_scenario->checkLoS_withWall (ctx.senderPos, ctx.receiverPos).first;
+        ctx.losClass = channelStatus_withWall;
+      }
+    double G_sv_channel = channel->SVChannelGain (channel->m_reflectorDenseMode, ctx.sender, ctx.receiver,
+                                                  ctx.txPowerDbm, channel->m_obsDensity, channelStatus);
+    NS_LOG_INFO ("rxPowerDbm" << ctx.txPowerDbm + G_sv_channel << " fading " << G_sv_channel);
+    if (MultiRoom && channelStatus_withWall > 1)
+      {
+        return -1000.0; // zero the signal strength if blocked by the wall
+      }
+    return ctx.txPowerDbm + G_sv_channel;
+  }
+};
+
+/// TGad channel, optionally blocked by the walls of a multi-room scenario
+template <bool MultiRoom>
+struct DmgWifiChannel::TGadLinkBudget
+{
+  static double RxPowerDbm (const DmgWifiChannel *channel, LinkContext &ctx)
+  {
+    double additionalLoss;
+    if (MultiRoom)
+      {
+        uint16_t channelStatus_withWall = channel->m_scenario->checkLoS_withWall (ctx.senderPos, ctx.receiverPos).first;
+        ctx.losClass = channelStatus_withWall;
+        if (channelStatus_withWall == 0) // LoS
+          {
+            additionalLoss = 0;
+          }
+        else if (channelStatus_withWall == 1) // NLoS
+          {
+            additionalLoss = 20.0;
+          }
+        else // Wall_NLoS
+          {
+            additionalLoss = 1000.0; // zero down the signal strength
+          }
+      }
+    else
+      {
+        bool channelStatus = channel->m_scenario->checkLoS (ctx.senderPos, ctx.receiverPos).first;
+        ctx.losClass = channelStatus;
+        additionalLoss = (channelStatus == NON_LINE_OF_SIGHT) ? 20.0 : 0;
+      }
+    return channel->m_loss->CalcRxPower (ctx.txPowerDbm, ctx.senderMobility, ctx.receiverMobility) +
+           min (14.0, ctx.gtx) +                    // Sender's antenna gain.
+           min (14.0, ctx.grx) -                    // receiver's antenna gain
+           additionalLoss;                          // additional loss for NLoS case
+  }
+};
+
+/// TGad channel in ad-hoc mode: both ends use their maximum antenna gain
+struct DmgWifiChannel::TGadAdHocLinkBudget
+{
+  static double RxPowerDbm (const DmgWifiChannel *channel, LinkContext &ctx)
+  {
+    Ptr<Codebook> senderCodebook = ctx.sender->GetCodebook ();
+    uint8_t numTxSector = senderCodebook->GetTotalNumberOfTransmitSectors ();
+    uint8_t numRxSector = senderCodebook->GetTotalNumberOfReceiveSectors ();
+    uint8_t numAntenna = senderCodebook->GetTotalNumberOfAntennas ();
+    ctx.gtx = senderCodebook->GetMaxGainDbi (numTxSector, numAntenna);                  // Sender's antenna gain in dBi.
+    ctx.grx = ctx.receiver->GetCodebook ()->GetMaxGainDbi (numRxSector, numAntenna);     // Receiver's antenna gain in dBi.
+    bool channelStatus = channel->m_scenario->checkLoS (ctx.senderPos, ctx.receiverPos).first;
+    ctx.losClass = channelStatus;
+    double LoSSign = (channelStatus == NON_LINE_OF_SIGHT) ? 1.0 : 0;
+    return channel->m_loss->CalcRxPower (ctx.txPowerDbm, ctx.senderMobility, ctx.receiverMobility) +
+           min (14.0, ctx.gtx) +                    // Sender's antenna gain.
+           min (14.0, ctx.grx) +                    // receiver's antenna gain
+           LoSSign * (-1.0) * 10.0;                 // 10 dB additional loss for NLoS case
+  }
+};
+
+/// Default log-distance based channel, rarely used for DMG since no LoS/NLoS analysis is performed
+struct DmgWifiChannel::DefaultLinkBudget
+{
+  static double RxPowerDbm (const DmgWifiChannel *channel, LinkContext &ctx)
+  {
+    return channel->m_loss->CalcRxPower (ctx.txPowerDbm, ctx.senderMobility, ctx.receiverMobility) + ctx.gtx + ctx.grx;
+  }
+};
+
+void
+DmgWifiChannel::SelectLinkBudget (void) const
+{
+  NS_LOG_FUNCTION (this);
+  if (m_experimentalMode)
+    {
+      m_sendImpl = &DmgWifiChannel::DoSend<TraceReplayLinkBudget>;
+    }
+  else if (!m_adhocMode)
+    {
+      if (!m_SVChannel && !m_TGadChannel)
+        {
+          m_sendImpl = &DmgWifiChannel::DoSend<JianLiuLinkBudget>;
+        }
+      else if (m_SVChannel && !m_TGadChannel)
+        {
+          m_sendImpl = m_scenario->GetMultiRoomFlag () ? &DmgWifiChannel::DoSend<SalehValenzuelaLinkBudget<true> >
+                                                       : &DmgWifiChannel::DoSend<SalehValenzuelaLinkBudget<false> >;
+        }
+      else if (m_TGadChannel && !m_SVChannel)
+        {
+          m_sendImpl = m_scenario->GetMultiRoomFlag () ? &DmgWifiChannel::DoSend<TGadLinkBudget<true> >
+                                                       : &DmgWifiChannel::DoSend<TGadLinkBudget<false> >;
+        }
+      else
+        {
+          m_sendImpl = &DmgWifiChannel::DoSend<DefaultLinkBudget>;
+        }
+    }
+  else if (m_TGadChannel)
+    {
+      m_sendImpl = &DmgWifiChannel::DoSend<TGadAdHocLinkBudget>;
+    }
+  else
+    {
+      m_sendImpl = &DmgWifiChannel::DoSend<DefaultLinkBudget>;
+    }
+}
+
 void
 DmgWifiChannel::Send (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const
 {
   NS_LOG_FUNCTION (this << sender << ppdu << txPowerDbm);
+  if (m_sendImpl == 0)
+    {
+      SelectLinkBudget ();
+    }
+  (this->*m_sendImpl) (sender, ppdu, txPowerDbm);
+}
+
+template <class LinkBudget>
+void
+DmgWifiChannel::DoSend (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const
+{
   Ptr<MobilityModel> senderMobility = sender->GetMobility ();
   NS_ASSERT (senderMobility != 0);
+  if (!m_leakageCallback.IsNull ())
+    {
+      m_leakageCallback (sender, ppdu, txPowerDbm);
+    }
+  LinkContext ctx;
+  ctx.sender = sender;
+  ctx.senderMobility = senderMobility;
+  ctx.senderPos = senderMobility->GetPosition ();
+  ctx.txPowerDbm = txPowerDbm;
+  Ptr<Codebook> senderCodebook = sender->GetCodebook ();
+  uint16_t channelNumber = sender->GetChannelNumber ();
   for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
     {
       if (sender != (*i))
         {
           //For now don't account for inter channel interference nor channel bonding
-          if ((*i)->GetChannelNumber () != sender->GetChannelNumber ())
+          if ((*i)->GetChannelNumber () != channelNumber)
             {
               continue;
             }
@@ -1111,186 +1634,52 @@ DmgWifiChannel::Send (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double t
                 }
             }
 
-          Vector sender_pos = senderMobility->GetPosition ();
-          Ptr<Codebook> senderCodebook = sender->GetCodebook ();
-          Ptr<MobilityModel> receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
-          Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
-          double rxPowerDbm;
-          double azimuthTx = CalculateAzimuthAngle (sender_pos, receiverMobility->GetPosition ());
-          double azimuthRx = CalculateAzimuthAngle (receiverMobility->GetPosition (), sender_pos);
-          double gtx = senderCodebook->GetTxGainDbi (azimuthTx);        // Sender's antenna gain in dBi.
-          double grx = (*i)->GetCodebook ()->GetRxGainDbi (azimuthRx);  // Receiver's antenna gain in dBi.
+          ctx.receiver = *i;
+          ctx.receiverMobility = (*i)->GetMobility ();
+          ctx.receiverPos = ctx.receiverMobility->GetPosition ();
+          ctx.losClass = 0xff;
+          Time delay = m_delay->GetDelay (senderMobility, ctx.receiverMobility);
+          double azimuthTx = CalculateAzimuthAngle (ctx.senderPos, ctx.receiverPos);
+          double azimuthRx = CalculateAzimuthAngle (ctx.receiverPos, ctx.senderPos);
+          ctx.gtx = senderCodebook->GetTxGainDbi (azimuthTx);        // Sender's antenna gain in dBi.
+          ctx.grx = (*i)->GetCodebook ()->GetRxGainDbi (azimuthRx);  // Receiver's antenna gain in dBi.
 
           NS_LOG_DEBUG ("POWER: azimuthTx=" << azimuthTx
                         << ", azimuthRx=" << azimuthRx
                         << ", txPowerDbm=" << txPowerDbm
-                        << ", RxPower=" << m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility)
-                        << ", Gtx=" << gtx
-                        << ", Grx=" << grx);
+                        << ", RxPower=" << m_loss->CalcRxPower (txPowerDbm, senderMobility, ctx.receiverMobility)
+                        << ", Gtx=" << ctx.gtx
+                        << ", Grx=" << ctx.grx);
 
-          if (m_experimentalMode)
+          double rxPowerDbm;
+          if (m_catchUp && !m_experimentalMode)
             {
-              rxPowerDbm = m_receivedSignalStrength[m_currentSignalStrengthIndex];
+              /* Reuse the link budget while the beams and the positions do not change */
+              CachedLinkBudget &cached = m_linkBudgetCache[PhyPair (PeekPointer (sender), PeekPointer (*i))];
+              Time now = Simulator::Now ();
+              if (!cached.valid || now - cached.time > m_catchUpGainLifetime
+                  || cached.txPowerDbm != txPowerDbm || cached.gtx != ctx.gtx || cached.grx != ctx.grx
+                  || cached.senderPos != ctx.senderPos || cached.receiverPos != ctx.receiverPos)
+                {
+                  cached.valid = true;
+                  cached.time = now;
+                  cached.senderPos = ctx.senderPos;
+                  cached.receiverPos = ctx.receiverPos;
+                  cached.txPowerDbm = txPowerDbm;
+                  cached.gtx = ctx.gtx;
+                  cached.grx = ctx.grx;
+                  cached.rxPowerDbm = LinkBudget::RxPowerDbm (this, ctx);
+                  cached.policyGtx = ctx.gtx;
+                  cached.losClass = ctx.losClass;
+                }
+              rxPowerDbm = cached.rxPowerDbm;
+              ctx.gtx = cached.policyGtx;
+              ctx.losClass = cached.losClass;
             }
           else
             {
-              if (m_adhocMode == false)
-              	{
-                     if ((m_SVChannel == false) && (m_TGadChannel == false)) // Jian-Liu Channel (WiMove'21)
-                     {
-                        // do obstacle and LoS analysis first
-                        double fadingLoss = m_scenario->checkLoS(sender_pos, receiverMobility->GetPosition ()).second;
-                  	    rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +
-                                 gtx + grx + fadingLoss;
-                        // std::cerr << "path loss is: " << m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) << std::endl;
-						// NS_LOG_DEBUG ("rxPowerDbm" << rxPowerDbm << " fading " << m_scenario->GetFadingInfo(sender_pos, receiverMobility->GetPosition ()).second);
-                     }
-			         else if ((m_SVChannel == true) && (m_TGadChannel == false)) // S-V 11ad channel
-              	     {
-                        // do obstacle and LoS analysis first
-                        if (m_scenario->GetMultiRoomFlag() == false)
-                        {
-                          bool channelStatus = m_scenario->checkLoS(sender_pos, receiverMobility->GetPosition ()).first;						  
-						  Ptr<DmgWifiPhy> receiver = *i;
-				  		  double G_sv_channel = SVChannelGain(m_reflectorDenseMode, sender, receiver, txPowerDbm, m_obsDensity, channelStatus);
-				  		  rxPowerDbm = txPowerDbm + G_sv_channel;
-				  		  NS_LOG_INFO("rxPowerDbm" << rxPowerDbm << " fading " << G_sv_channel);
-						  // std::cerr << "rxPowerDbm" << rxPowerDbm << " fading " << G_sv_channel << std::endl;						  
-                        }
-						else
-						{
-						  uint16_t channelStatus_withWall = m_scenario->checkLoS_withWall(sender_pos, receiverMobility->GetPosition ()).first;						  
-                          bool channelStatus = m_scenario->checkLoS(sender_pos, receiverMobility->GetPosition ()).first;
-						  Ptr<DmgWifiPhy> receiver = *i;
-				  		  double G_sv_channel = SVChannelGain(m_reflectorDenseMode, sender, receiver, txPowerDbm, m_obsDensity, channelStatus);
-				  		  rxPowerDbm = txPowerDbm + G_sv_channel;
-						  if (channelStatus_withWall > 1)
-						  	rxPowerDbm = -1000.0; // zero the signal strength if blocked by the wall
-				  		  NS_LOG_INFO("rxPowerDbm" << rxPowerDbm << " fading " << G_sv_channel);
-						  // std::cerr << "rxPowerDbm" << rxPowerDbm << " fading " << G_sv_channel << std::endl;		
-						}
-              	     }
-                     else if ((m_TGadChannel == true) && (m_SVChannel == false)) // TGad channel
-				     {
-				  	    // double pathloss_db = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) - txPowerDbm;
-                        // pathloss_db = max(pathloss_db, -98.0); // based on TGad document
-                        // do obstacle and LoS analysis first
-                        if (m_scenario->GetMultiRoomFlag() == false)
-                        {
-                          bool channelStatus = m_scenario->checkLoS(sender_pos, receiverMobility->GetPosition ()).first;
-                          // double LoSSign =  m_scenario->GetFadingInfo(sender_pos, receiverMobility->GetPosition ()).first;
-						  double LoSSign = 0;
-						  if (channelStatus == NON_LINE_OF_SIGHT)
-						   {
-							 LoSSign = 1.0;
-						   }
-						  rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +                                   // propagation loss
-                                       min(14.0, gtx) +                            // Sender's antenna gain.
-                                       min(14.0, grx) +                            // receiver's antenna gain
-                                       LoSSign*(-1.0)*20.0;                        // 10 dB additional loss for NLoS case
-                          // rxPowerDbm = 10.3 - 81.5212;
-						  // std::cerr << "path loss is: " << m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) << std::endl;
-						  // std::cerr << "rxPowerDbm is: " << rxPowerDbm << std::endl; 
-						  // NS_LOG_DEBUG ("rxPowerDbm" << rxPowerDbm << " fading " << m_scenario->GetFadingInfo(sender_pos, receiverMobility->GetPosition ()).second);
-                        }
-						else
-						{
-						  uint16_t channelStatus_withWall = m_scenario->checkLoS_withWall(sender_pos, receiverMobility->GetPosition ()).first;
-						  if (channelStatus_withWall == 0) // LoS
-						   {
-							 rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +                                   // propagation loss
-                                       min(14.0, gtx) +                            // Sender's antenna gain.
-                                       min(14.0, grx);                            // receiver's antenna gain                                       
-						   }
-						  else if (channelStatus_withWall == 1) // NLoS
-						   {
-						     rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +                                   // propagation loss
-                                       min(14.0, gtx) +                            // Sender's antenna gain.
-                                       min(14.0, grx) +                            // receiver's antenna gain
-                                       (-1.0)*20.0;
-						   }
-						  else // Wall_NLoS
-						   {
-						     rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +                                   // propagation loss
-                                       min(14.0, gtx) +                            // Sender's antenna gain.
-                                       min(14.0, grx) +                            // receiver's antenna gain
-                                       (-1.0)*1000.0;                              // zero down the signal strength
-						   }
-						  // std::cerr << "rxPowerDbm: " << rxPowerDbm << std::endl;
-                          // rxPowerDbm = 10.3 - 81.5212;
-						  // std::cerr << "path loss is: " << m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) << std::endl;
-						  // std::cerr << "rxPowerDbm is: " << rxPowerDbm << std::endl; 
-						  // NS_LOG_DEBUG ("rxPowerDbm" << rxPowerDbm << " fading " << m_scenario->GetFadingInfo(sender_pos, receiverMobility->GetPosition ()).second);
-						}
-				     }
-			         else // default log-distance based channel, rarely used for dmg since no LoS/NloS analysis is performed
-			  	     {
-                        rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) + gtx + grx;
-			  	     }
-
-              	}
-			  else
-			  	{
-			  	     if (m_TGadChannel == true)
-			  	   	 {
-			  	   	    uint8_t numTxSector = senderCodebook->GetTotalNumberOfTransmitSectors();
-					    uint8_t numRxSector = senderCodebook->GetTotalNumberOfReceiveSectors();
-					    uint8_t numAntenna = senderCodebook->GetTotalNumberOfAntennas();
-			  	   	    gtx = senderCodebook->GetMaxGainDbi(numTxSector, numAntenna); // Sender's antenna gain in dBi.
-                        grx = (*i)->GetCodebook ()->GetMaxGainDbi(numRxSector, numAntenna);  // Receiver's antenna gain in dBi.
-			  	   	    // double LoSSign =  m_scenario->GetFadingInfo(sender_pos, receiverMobility->GetPosition ()).first;
-                        // do obstacle and LoS analysis first
-                        bool channelStatus = m_scenario->checkLoS(sender_pos, receiverMobility->GetPosition ()).first;
-                        double LoSSign = 0;
-						if (channelStatus == NON_LINE_OF_SIGHT)
-							{
-							  LoSSign = 1.0;
-							}
-						rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +                                   // propagation loss
-                                     min(14.0, gtx) +                            // Sender's antenna gain.
-                                     min(14.0, grx) +                            // receiver's antenna gain
-                                     LoSSign*(-1.0)*10.0;                        // 10 dB additional loss for NLoS case
-			  	   	  }
-				     else // default log-distance based channel, rarely used
-				   	  {
-				   	    rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) + gtx + grx;
-				   	  }
-			  	}
-			  /*
-			  // interference analysis, for the use in next interference calculation
-			  int16_t itfFlag_t = m_scenario->GetInterferenceInfo(sender_pos, receiverMobility->GetPosition ()).first;
-			  if (m_seq == true)
-			  	{
-			      if (itfFlag_t > 0) // suffer interference effects
-			  	  {
-				     double distToSrc = m_scenario->GetInterferenceInfo(sender_pos, receiverMobility->GetPosition ()).second;
-				     // assume log-distance path loss for interference calculation
-				     double itfPowerDbm = txPowerDbm + gtx + grx - (32.4 + 17.3*std::log10(distToSrc) + 20*std::log10(60.48));
-				     double itf_w = std::pow(10, itfPowerDbm/10.0) / 1000.0;
-				     double rx_w = std::pow(10, rxPowerDbm/10.0) / 1000.0;
-				     static const double BOLTZMANN = 1.3803e-23;
-                     uint16_t channelWidth = 1760; // MHz
-                     //Nt is the power of thermal noise in W
-                     double Nt = BOLTZMANN * 290 * channelWidth * 1e6;
-                     //receiver noise Floor (W) which accounts for thermal noise and non-idealities of the receiver
-                     double noiseFloor = 10 * Nt; // W
-                     double rxPower_modf = noiseFloor * rx_w / (noiseFloor + itf_w); // W
-                     rxPowerDbm = 10.0 * std::log10(rxPower_modf * 1000.0); // dBm, with interference effects
-			  	  }
-			      // m_itfFlag = itfFlag_t;
-			  	}
-			  else
-			  	{
-			  	  // for common or parallel cases
-			  	  m_itfFlag = itfFlag_t;
-			  	}
-              */
-			  
-			  // m_srcWifiPhy->SetItfFlag(itfFlag_t);
-			  // m_dstWifiPhy->SetItfFlag(itfFlag_t);
-			  // this->SetItfFlag(itfFlag_t);
-			  
-		  }
+              rxPowerDbm = LinkBudget::RxPowerDbm (this, ctx);
+            }
 
           /* External Attenuator */
           if (m_blockage &&
@@ -1302,7 +1691,7 @@ DmgWifiChannel::Send (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double t
             }
 
           NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
-                        "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
+                        "distance=" << senderMobility->GetDistanceFrom (ctx.receiverMobility) << "m, delay=" << delay);
           Ptr<WifiPpdu> copy = Copy (ppdu);
           Ptr<NetDevice> dstNetDevice = (*i)->GetDevice ();
           uint32_t dstNode;
@@ -1315,26 +1704,33 @@ DmgWifiChannel::Send (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double t
               dstNode = dstNetDevice->GetNode ()->GetId ();
             }
 
-          Simulator::ScheduleWithContext (dstNode,
-                                          delay, &DmgWifiChannel::Receive,
-                                          (*i), copy, rxPowerDbm);
+          Simulator::ScheduleWithContext (dstNode, delay,
+                                          new DmgWifiChannelDeliveryEvent ((*i), copy, rxPowerDbm));
+
+          if (m_telemetry != 0)
+            {
+              m_telemetry->RecordChannel (sender->GetDevice ()->GetNode ()->GetId (), dstNode, rxPowerDbm,
+                                          ctx.losClass, ppdu->GetTxDuration ());
+            }
 
           /* PHY Activity Monitor */
+          if (m_phyActivityTrace.IsEmpty ())
+            {
+              continue;
+            }
           uint32_t srcNode = sender->GetDevice ()->GetNode ()->GetId ();
           if (sender->GetStandard () == WIFI_PHY_STANDARD_80211ad)
             {
-              RecordPhyActivity (srcNode, dstNode, ppdu->GetTxDuration (), txPowerDbm + gtx, PLCP_80211AD_PREAMBLE_HDR_DATA, TX_ACTIVITY);
+              RecordPhyActivity (srcNode, dstNode, ppdu->GetTxDuration (), txPowerDbm + ctx.gtx, PLCP_80211AD_PREAMBLE_HDR_DATA, TX_ACTIVITY);
               Simulator::Schedule (delay, &DmgWifiChannel::RecordPhyActivity, this,
                                    srcNode, dstNode, ppdu->GetTxDuration (), rxPowerDbm, PLCP_80211AD_PREAMBLE_HDR_DATA, RX_ACTIVITY);
             }
           else if (sender->GetStandard () == WIFI_PHY_STANDARD_80211ay)
             {
-              RecordPhyActivity (srcNode, dstNode, ppdu->GetTxDuration (), txPowerDbm + gtx, PLCP_80211AY_PREAMBLE_HDR_DATA, TX_ACTIVITY);
+              RecordPhyActivity (srcNode, dstNode, ppdu->GetTxDuration (), txPowerDbm + ctx.gtx, PLCP_80211AY_PREAMBLE_HDR_DATA, TX_ACTIVITY);
               Simulator::Schedule (delay, &DmgWifiChannel::RecordPhyActivity, this,
                                    srcNode, dstNode, ppdu->GetTxDuration (), rxPowerDbm, PLCP_80211AY_PREAMBLE_HDR_DATA, RX_ACTIVITY);
             }
-
-
         }
     }
 }
@@ -1357,6 +1753,10 @@ DmgWifiChannel::SendAgcSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wifi
             {
               continue;
             }
+          if (!DeliverSubfield (*i, txVector))
+            {
+              continue;
+            }
 
           receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
           delay = m_delay->GetDelay (senderMobility, receiverMobility);
@@ -1378,8 +1778,9 @@ DmgWifiChannel::SendAgcSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wifi
           /* PHY Activity Monitor */
           RecordPhyActivity (sender->GetDevice ()->GetNode ()->GetId (), dstNode,
                              AGC_SF_DURATION, txPowerDbm + gtx, PLCP_80211AD_AGC_SF, TX_ACTIVITY);
-          Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveAgcSubfield, this, j,
-                                          sender, txVector, txPowerDbm, gtx);
+          Simulator::ScheduleWithContext (dstNode, delay,
+                                          new DmgWifiChannelDeliveryEvent (DmgWifiChannelDeliveryEvent::AGC_SUBFIELD_DELIVERY,
+                                                                           this, j, sender, txVector, txPowerDbm, gtx));
         }
     }
 }
@@ -1402,6 +1803,10 @@ DmgWifiChannel::SendTrnCeSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wi
             {
               continue;
             }
+          if (!DeliverSubfield (*i, txVector))
+            {
+              continue;
+            }
 
           receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
           delay = m_delay->GetDelay (senderMobility, receiverMobility);
@@ -1423,8 +1828,9 @@ DmgWifiChannel::SendTrnCeSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wi
           /* PHY Activity Monitor */
           RecordPhyActivity (sender->GetDevice ()->GetNode ()->GetId (), dstNode,
                              TRN_CE_DURATION, txPowerDbm + gtx, PLCP_80211AD_TRN_CE_SF, TX_ACTIVITY);
-          Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveTrnCeSubfield, this, j,
-                                          sender, txVector, txPowerDbm, gtx);
+          Simulator::ScheduleWithContext (dstNode, delay,
+                                          new DmgWifiChannelDeliveryEvent (DmgWifiChannelDeliveryEvent::TRN_CE_SUBFIELD_DELIVERY,
+                                                                           this, j, sender, txVector, txPowerDbm, gtx));
         }
     }
 }
@@ -1447,6 +1853,10 @@ DmgWifiChannel::SendTrnSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wifi
             {
               continue;
             }
+          if (!DeliverSubfield (*i, txVector))
+            {
+              continue;
+            }
 
           receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
           delay = m_delay->GetDelay (senderMobility, receiverMobility);
@@ -1477,8 +1887,9 @@ DmgWifiChannel::SendTrnSubfield (Ptr<DmgWifiPhy> sender, double txPowerDbm, Wifi
                                  txVector.edmgTrnSubfieldDuration, txPowerDbm + gtx, PLCP_80211AY_TRN_SF, TX_ACTIVITY);
             }
 
-          Simulator::ScheduleWithContext (dstNode, delay, &DmgWifiChannel::ReceiveTrnSubfield, this, j,
-                                          sender, txVector, txPowerDbm, gtx);
+          Simulator::ScheduleWithContext (dstNode, delay,
+                                          new DmgWifiChannelDeliveryEvent (DmgWifiChannelDeliveryEvent::TRN_SUBFIELD_DELIVERY,
+                                                                           this, j, sender, txVector, txPowerDbm, gtx));
         }
     }
 }
@@ -1515,7 +1926,7 @@ DmgWifiChannel::ReceiveSubfield (uint32_t i, Ptr<DmgWifiPhy> sender, WifiTxVecto
   NS_LOG_DEBUG ("POWER: Gtx=" << txAntennaGainDbi
                 << ", Grx=" << m_phyList[i]->GetCodebook ()->GetRxGainDbi (azimuthRx));
 
-  rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility) +
+  rxPowerDbm = GetPathRxPower (sender, m_phyList[i], txPowerDbm) +
                txAntennaGainDbi +                                           // Sender's antenna gain.
                m_phyList[i]->GetCodebook ()->GetRxGainDbi (azimuthRx);      // Receiver's antenna gain.
 
@@ -1599,6 +2010,8 @@ DmgWifiChannel::Add (Ptr<DmgWifiPhy> phy)
 {
   NS_LOG_FUNCTION (this << phy);
   m_phyList.push_back (phy);
+  /* Every PHY may receive a PPDU and a TRN subfield from each other PHY at once. */
+  DmgWifiChannelDeliveryEvent::Reserve (2 * m_phyList.size ());
 }
 
 int64_t
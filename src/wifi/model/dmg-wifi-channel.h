@@ -25,6 +25,9 @@
 #include "ns3/channel.h"
 #include "dmg-wifi-phy.h"
 #include "obstacle.h"
+#include "ns3/vector.h"
+#include <map>
+#include <utility>
 
 
 namespace ns3 {
@@ -34,6 +37,7 @@ class PropagationLossModel;
 class PropagationDelayModel;
 class Packet;
 class Time;
+class DmgTelemetry;
 class WifiPpdu;
 class WifiTxVector;
 
@@ -78,12 +82,62 @@ public:
   // Yuchen
   void SetChannelStatus (bool channelStatus);
   void SetScenarioModel (Ptr<Obstacle> scenario);
+  /**
+   * \return the scenario model describing the obstacles of the room.
+   */
+  Ptr<Obstacle> GetScenarioModel (void) const;
+  /**
+   * Return the gain that the obstacles of the scenario add to the link
+   * budget between two positions, as the link budget selected for this
+   * channel accounts for them: the fading loss of the obstacles crossed
+   * for the Jian-Liu channel, a flat penalty for NLoS (and for walls in a
+   * multi-room scenario) for the TGad channel. The Saleh-Valenzuela
+   * channel is approximated as the TGad channel.
+   *
+   * \param senderPos the position of the sender.
+   * \param receiverPos the position of the receiver.
+   * \return the gain in dB.
+   */
+  double GetScenarioGain (Vector senderPos, Vector receiverPos) const;
   void SetSVChannelEnabler (bool SVChannel);
   void SetTGadChannelEnabler (bool TGadChannel);
   void SetSVChannelReflectedMode (int reflectedMode);
   void SetObsDensity (double obsDensity);
   void SetAdHocMode (bool adhocMode);
   void SetSeqSim (bool seq);
+  /**
+   * Callback invoked once per transmitted PPDU, before it is delivered to the
+   * PHYs attached to this channel. Used to export the transmission to other
+   * rooms simulated in different logical processes.
+   */
+  typedef Callback<void, Ptr<DmgWifiPhy>, Ptr<const WifiPpdu>, double> LeakageCallback;
+  /**
+   * \param callback the callback to invoke for every PPDU sent on this channel.
+   */
+  void SetLeakageCallback (LeakageCallback callback);
+  /**
+   * \param telemetry the telemetry sink recording the delivery of each PPDU
+   * to each receiver, or 0 to disable telemetry.
+   */
+  void SetTelemetry (Ptr<DmgTelemetry> telemetry);
+  /**
+   * Switch the channel to cheaper abstractions while the simulation is
+   * behind real time, and back. While catching up, the channel reuses the
+   * link budget computed for a pair of PHYs (as long as the positions, the
+   * transmit power and the antenna gains towards each other are unchanged)
+   * and the path gain of the TRN subfields for up to CatchUpGainLifetime,
+   * and delivers the subfields of TRN fields only to the PHYs receiving
+   * from the sender; the PHY activity trace misses the subfields dropped
+   * by the other PHYs.
+   *
+   * \param catchUp true while the simulation is behind real time.
+   * \see DmgWifiChannelHelper::EnableRealtimeCatchUp
+   */
+  void SetCatchUp (bool catchUp);
+  /**
+   * \return true while the channel uses its catch-up abstractions.
+   */
+  bool IsCatchingUp (void) const;
 
   /* Saleh-Valenzuela Channel for 60 GHz indoor scenario */
   // default reflectorDenseMode is lower density, i.e., 1
@@ -107,6 +161,10 @@ public:
    * currently invoked only from DmgWifiPhy::StartTx.  The channel
    * attempts to deliver the PPDU to all other DmgWifiPhy objects
    * on the channel (except for the sender).
+   *
+   * The link budget of the configured channel model is selected on the first
+   * call, and again after any of the model setters is called. The multi-room
+   * flag of the scenario must therefore be set before the first transmission.
    */
   void Send (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const;
   /**
@@ -181,6 +239,8 @@ public:
 
   
 private:
+  friend class DmgWifiChannelDeliveryEvent;
+
   /**
    * A vector of pointers to DmgWifiPhy.
    */
@@ -235,6 +295,74 @@ private:
   void ReceiveTrnSubfield (uint32_t i, Ptr<DmgWifiPhy> sender, WifiTxVector txVector,
                            double txPowerDbm, double txAntennaGainDbi) const;
 
+  /// Per-receiver state shared by Send and the link-budget policies
+  struct LinkContext;
+  /// Link-budget policies, one per channel model
+  struct TraceReplayLinkBudget;
+  struct JianLiuLinkBudget;
+  template <bool MultiRoom> struct SalehValenzuelaLinkBudget;
+  template <bool MultiRoom> struct TGadLinkBudget;
+  struct TGadAdHocLinkBudget;
+  struct DefaultLinkBudget;
+
+  /// Send specialised for one channel model
+  typedef void (DmgWifiChannel::*SendImpl)(Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const;
+
+  /**
+   * Select the Send specialisation matching the configured channel model.
+   */
+  void SelectLinkBudget (void) const;
+  /**
+   * Deliver a PPDU to all the other PHYs on the channel, computing the
+   * received power with the given link-budget policy.
+   *
+   * \param sender the PHY object from which the packet is originating.
+   * \param ppdu the PPDU to send
+   * \param txPowerDbm the TX power associated to the packet, in dBm
+   */
+  template <class LinkBudget>
+  void DoSend (Ptr<DmgWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const;
+  /**
+   * Check whether a subfield of a TRN field must be delivered to a PHY.
+   * \param receiver the receiving PHY.
+   * \param txVector the TXVECTOR of the subfield.
+   * \return false if the channel is catching up and the receiver would drop the subfield.
+   */
+  bool DeliverSubfield (Ptr<DmgWifiPhy> receiver, const WifiTxVector &txVector) const;
+  /**
+   * \param sender the transmitting PHY.
+   * \param receiver the receiving PHY.
+   * \param txPowerDbm the TX power, in dBm.
+   * \return the received power without antenna gains, cached while catching up.
+   */
+  double GetPathRxPower (Ptr<DmgWifiPhy> sender, Ptr<DmgWifiPhy> receiver, double txPowerDbm) const;
+
+  /// A pair of PHYs, transmitter first
+  typedef std::pair<const DmgWifiPhy *, const DmgWifiPhy *> PhyPair;
+  /// A link budget computed while catching up
+  struct CachedLinkBudget
+  {
+    bool valid = false;    //!< Whether the entry holds a link budget
+    Time time;             //!< Time of the computation
+    Vector senderPos;      //!< Position of the transmitter
+    Vector receiverPos;    //!< Position of the receiver
+    double txPowerDbm;     //!< Transmit power in dBm
+    double gtx;            //!< Transmit antenna gain towards the receiver, in dBi
+    double grx;            //!< Receive antenna gain towards the transmitter, in dBi
+    double rxPowerDbm;     //!< Received power in dBm
+    double policyGtx;      //!< Transmit antenna gain reported by the link budget, in dBi
+    uint8_t losClass;      //!< LoS class reported by the link budget
+  };
+  /// A path gain computed while catching up
+  struct CachedPathGain
+  {
+    bool valid = false;    //!< Whether the entry holds a path gain
+    Time time;             //!< Time of the computation
+    Vector senderPos;      //!< Position of the transmitter
+    Vector receiverPos;    //!< Position of the receiver
+    double gainDb;         //!< Received power minus transmit power, in dB
+  };
+
   PhyList m_phyList;                   //!< List of DmgWifiPhys connected to this DmgWifiChannel
   Ptr<PropagationLossModel> m_loss;    //!< Propagation loss model
   Ptr<PropagationDelayModel> m_delay;  //!< Propagation delay model
@@ -257,6 +385,13 @@ private:
   double m_obsDensity;
   bool m_adhocMode;
   bool m_seq;
+  LeakageCallback m_leakageCallback;  //!< Cross-room leakage export
+  Ptr<DmgTelemetry> m_telemetry;      //!< Per-frame telemetry sink
+  mutable SendImpl m_sendImpl;        //!< Send specialisation of the channel model, 0 until selected
+  bool m_catchUp;                     //!< Use the catch-up abstractions
+  Time m_catchUpGainLifetime;         //!< Longest reuse of a cached gain while catching up
+  mutable std::map<PhyPair, CachedLinkBudget> m_linkBudgetCache;  //!< Link budgets cached while catching up
+  mutable std::map<PhyPair, CachedPathGain> m_pathGainCache;      //!< Path gains cached while catching up
   // int16_t m_itfFlag;
 
   /**
@@ -9,6 +9,8 @@
 #include "ns3/simulator.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/queue-item.h"
 
 #include "dmg-wifi-mac.h"
 #include "dmg-wifi-phy.h"
@@ -210,6 +212,7 @@ DmgWifiMac::GetTypeId (void)
 DmgWifiMac::DmgWifiMac ()
   : m_maxSnr (0.0),
     m_recordTrnSnrValues (false),
+    m_nextSpQueue (0),
     m_restartISSEvent (),
     m_sswFbckTimeout (),
     m_sswAckTimeoutEvent (),
@@ -263,6 +266,8 @@ DmgWifiMac::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
   m_dmgAtiTxop = 0;
+  m_queueInterface = 0;
+  m_activeSpQueue = 0;
   m_codebook->Dispose ();
   m_codebook = 0;
   RegularWifiMac::DoDispose ();
@@ -633,11 +638,78 @@ DmgWifiMac::StartServicePeriod (AllocationID allocationID, Time length, uint8_t
           m_currentLinkMaintained = false;
         }
 
+      /* Release the traffic held back for the peer, mapping it to a service
+       * period queue the first time we serve it if there is one left */
+      if (m_queueInterface)
+        {
+          auto queue = m_spQueues.find (peerAddress);
+          if (queue == m_spQueues.end () && m_nextSpQueue < m_queueInterface->GetNTxQueues ())
+            {
+              queue = m_spQueues.insert ({peerAddress, m_nextSpQueue++}).first;
+            }
+          if (queue != m_spQueues.end ())
+            {
+              m_activeSpQueue = m_queueInterface->GetTxQueue (queue->second);
+              UpdateServicePeriodQueue (0);
+            }
+        }
+
       /* Start data transmission */
       m_edca[AC_BE]->InitiateServicePeriodTransmission ();
     }
 }
 
+void
+DmgWifiMac::ConfigureServicePeriodQueues (Ptr<NetDeviceQueueInterface> ndqi, std::size_t first)
+{
+  NS_LOG_FUNCTION (this << ndqi << first);
+  NS_ASSERT (first <= ndqi->GetNTxQueues ());
+  m_queueInterface = ndqi;
+  m_nextSpQueue = first;
+  m_spQueues.clear ();
+  /* The traffic of the service periods goes through the MAC queue of AC_BE */
+  Ptr<WifiMacQueue> queue = m_edca[AC_BE]->GetWifiMacQueue ();
+  queue->TraceConnectWithoutContext ("Enqueue", MakeCallback (&DmgWifiMac::UpdateServicePeriodQueue, this));
+  queue->TraceConnectWithoutContext ("Dequeue", MakeCallback (&DmgWifiMac::UpdateServicePeriodQueue, this));
+}
+
+std::size_t
+DmgWifiMac::SelectServicePeriodQueue (Ptr<QueueItem> item, std::size_t queue) const
+{
+  if (m_spQueues.empty ())
+    {
+      return queue;
+    }
+  Ptr<QueueDiscItem> qdItem = DynamicCast<QueueDiscItem> (item);
+  if (qdItem == 0 || !Mac48Address::IsMatchingType (qdItem->GetAddress ()))
+    {
+      return queue;
+    }
+  auto it = m_spQueues.find (Mac48Address::ConvertFrom (qdItem->GetAddress ()));
+  return (it == m_spQueues.end () ? queue : it->second);
+}
+
+void
+DmgWifiMac::UpdateServicePeriodQueue (Ptr<const WifiMacQueueItem> item)
+{
+  NS_LOG_FUNCTION (this << item);
+  if (m_activeSpQueue == 0)
+    {
+      return;
+    }
+  /* As the flow control of the access category queues, stop the queue while
+   * the MAC queue cannot hold another packet of the maximum size */
+  Ptr<WifiMacQueue> queue = m_edca[AC_BE]->GetWifiMacQueue ();
+  if (queue->GetCurrentSize () + Create<Packet> (GetDevice ()->GetMtu ()) > queue->GetMaxSize ())
+    {
+      m_activeSpQueue->Stop ();
+    }
+  else
+    {
+      m_activeSpQueue->Wake ();
+    }
+}
+
 void
 DmgWifiMac::ResumeServicePeriodTransmission (void)
 {
@@ -662,6 +734,12 @@ DmgWifiMac::EndServicePeriod (void)
   NS_LOG_FUNCTION (this);
   NS_ASSERT_MSG (m_currentAllocation == SERVICE_PERIOD_ALLOCATION, "The current allocation is not SP");
   m_servicePeriodEndedCallback (GetAddress (), m_peerStationAddress);
+  if (m_activeSpQueue)
+    {
+      /* Hold back the traffic of the peer until its next service period */
+      m_activeSpQueue->Stop ();
+      m_activeSpQueue = 0;
+    }
   m_edca[AC_BE]->EndAllocationPeriod ();
   /* Inform MacLow to store parameters related to this service period (MPDU/A-MPDU) */
   m_low->EndAllocationPeriod ();
@@ -275,6 +275,9 @@ enum DATA_COMMUNICATION_MODE {
 };
 
 class BeamRefinementElement;
+class NetDeviceQueue;
+class NetDeviceQueueInterface;
+class QueueItem;
 class DmgWifiPhy;
 
 /**
@@ -313,6 +316,26 @@ public:
    * \param stationManager the station manager attached to this MAC.
    */
   virtual void SetWifiRemoteStationManager(Ptr<WifiRemoteStationManager> stationManager);
+  /**
+   * Dedicate device transmission queues to the peers of our service periods.
+   * The first service period in which we are the source towards a peer maps
+   * the peer to one of these queues, which is then woken at the start of each
+   * of its service periods and stopped at their end, so that a multi-queue
+   * aware queue disc holds back the traffic of the peer outside its service
+   * periods instead of letting it block the head of the MAC queues. The peers
+   * beyond the number of dedicated queues keep using the access category queues.
+   * \param ndqi The transmission queue interface aggregated to the device.
+   * \param first The index of the first transmission queue dedicated to service periods.
+   */
+  void ConfigureServicePeriodQueues (Ptr<NetDeviceQueueInterface> ndqi, std::size_t first);
+  /**
+   * Select the transmission queue of a packet, that is the queue of its
+   * destination if the latter is mapped to a service period queue.
+   * \param item The packet to transmit.
+   * \param queue The transmission queue selected from the access category of the packet.
+   * \return The index of the transmission queue of the packet.
+   */
+  std::size_t SelectServicePeriodQueue (Ptr<QueueItem> item, std::size_t queue) const;
   /**
    * Steer the directional antenna towards specific station for transmission.
    * \param address The MAC address of the peer station.
@@ -1345,6 +1368,12 @@ protected:
    * \param isSource Whether we are the initiator of the service period.
    */
   void StartServicePeriod (AllocationID allocationID, Time length, uint8_t peerAid, Mac48Address peerStation, bool isSource);
+  /**
+   * Stop or wake the queue of the current service period, depending on
+   * whether the MAC queue of the service periods can hold another packet.
+   * \param item The packet enqueued into or dequeued from the MAC queue.
+   */
+  void UpdateServicePeriodQueue (Ptr<const WifiMacQueueItem> item);
   /**
    * Resume transmission for the current service period.
    */
@@ -1550,6 +1579,10 @@ protected:
   Mac48Address m_peerStationAddress;            //!< The MAC address of the peer DMG STA in the current SP.
   Time m_suspendedPeriodDuration;               //!< The remaining duration of the suspended SP.
   bool m_spSource;                              //!< Flag to indicate if we are the source of the SP.
+  Ptr<NetDeviceQueueInterface> m_queueInterface; //!< The transmission queues of the device.
+  std::size_t m_nextSpQueue;                    //!< The index of the next free service period queue.
+  std::map<Mac48Address, std::size_t> m_spQueues; //!< The service period queue of each peer.
+  Ptr<NetDeviceQueue> m_activeSpQueue;          //!< The service period queue of the current SP, if any.
 
   /* DMG Beamforming Variables */
   Ptr<Codebook> m_codebook;                     //!< Pointer to the beamforming codebook.
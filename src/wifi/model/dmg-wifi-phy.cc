@@ -30,6 +30,7 @@
 #include "ampdu-tag.h"
 #include "dmg-wifi-phy.h"
 #include "dmg-wifi-channel.h"
+#include "dmg-telemetry.h"
 #include "wifi-utils.h"
 #include "frame-capture-model.h"
 #include "preamble-detection-model.h"
@@ -40,6 +41,7 @@
 #include "wifi-psdu.h"
 #include "wifi-ppdu.h"
 #include <algorithm>
+#include <cstring>
 
 namespace ns3 {
 
@@ -107,6 +109,15 @@ DmgWifiPhy::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&DmgWifiPhy::m_muMimoSupported),
                    MakeBooleanChecker ())
+    /* Reception Abstraction */
+    .AddAttribute ("FrameLevelAbstraction",
+                   "If enabled, PPDUs without TRN fields are received using a single end-of-PPDU event: "
+                   "the PHY header is evaluated once at the start of the PPDU and the payload SINR is mapped "
+                   "through the error model when the last symbol arrives, instead of scheduling separate "
+                   "preamble, header and payload events. CCA busy/idle notifications are preserved.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&DmgWifiPhy::m_frameLevelAbstraction),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -170,6 +181,7 @@ DmgWifiPhy::DmgWifiPhy ()
   m_suMimoBeamformingTraining = false;
   m_muMimoBeamformingTraining = false;
   m_recordSnrValues = true;
+  m_frameLevelAbstraction = false;
 }
 
 DmgWifiPhy::~DmgWifiPhy ()
@@ -216,6 +228,19 @@ DmgWifiPhy::SetChannel (const Ptr<DmgWifiChannel> channel)
   m_channel->Add (this);
 }
 
+void
+DmgWifiPhy::SetTelemetry (Ptr<DmgTelemetry> telemetry)
+{
+  NS_LOG_FUNCTION (this << telemetry);
+  m_telemetry = telemetry;
+}
+
+Ptr<DmgTelemetry>
+DmgWifiPhy::GetTelemetry (void) const
+{
+  return m_telemetry;
+}
+
 void
 DmgWifiPhy::ActivateRdsOpereation (uint8_t srcSector, uint8_t srcAntenna,
                                    uint8_t dstSector, uint8_t dstAntenna)
@@ -582,7 +607,13 @@ DmgWifiPhy::StartTx (Ptr<WifiPpdu> ppdu)
   NS_LOG_FUNCTION (this << ppdu);
   WifiTxVector txVector = ppdu->GetTxVector ();
   NS_LOG_DEBUG ("Start transmission: signal power before antenna gain=" << GetPowerDbm (txVector.GetTxPowerLevel ()) << "dBm");
-  m_channel->Send (this, ppdu, GetTxPowerForTransmission (txVector) + GetTxGain ());
+  double txPowerDbm = GetTxPowerForTransmission (txVector) + GetTxGain ();
+  if (m_telemetry != 0)
+    {
+      m_telemetry->RecordPpduTx (GetDevice ()->GetNode ()->GetId (), txVector.GetMode ().GetMcsValue (),
+                                 m_codebook->GetActiveTxSectorID (), txPowerDbm, ppdu->GetTxDuration ());
+    }
+  m_channel->Send (this, ppdu, txPowerDbm);
 }
 
 void
@@ -1416,6 +1447,12 @@ DmgWifiPhy::StartRx (Ptr<Event> event, double rxPowerW)
       //// WIGIG ////
       m_currentSender = event->GetTxVector ().GetSender ();
       //// WIGIG ////
+      if (m_frameLevelAbstraction && !HasTrnField (event->GetTxVector ()))
+        {
+          m_currentEvent = event;
+          StartReceiveAbstractPpdu (event);
+          return;
+        }
       Time startOfPreambleDuration = GetPreambleDetectionDuration ();
       Time remainingRxDuration = event->GetDuration () - startOfPreambleDuration;
       m_endPreambleDetectionEvent = Simulator::Schedule (startOfPreambleDuration, &DmgWifiPhy::StartReceiveHeader, this, event);
@@ -1443,6 +1480,90 @@ DmgWifiPhy::StartRx (Ptr<Event> event, double rxPowerW)
   m_currentEvent = event;
 }
 
+bool
+DmgWifiPhy::HasTrnField (const WifiTxVector &txVector) const
+{
+  return (txVector.GetTrainngFieldLength () > 0) || (txVector.GetEDMGTrainingFieldLength () > 0);
+}
+
+void
+DmgWifiPhy::StartReceiveAbstractPpdu (Ptr<Event> event)
+{
+  NS_LOG_FUNCTION (this << *event);
+  NS_ASSERT (m_endPhyRxEvent.IsExpired ());
+  NS_ASSERT (m_endRxEvent.IsExpired ());
+  WifiTxVector txVector = event->GetTxVector ();
+  WifiMode txMode = txVector.GetMode ();
+  Ptr<const WifiPsdu> psdu = event->GetPsdu ();
+
+  /* Preamble detection and PHY header decoding are collapsed into a single decision taken
+   * with the interference known at the start of the PPDU. */
+  InterferenceHelper::SnrPer snrPer = m_interference.CalculateDmgPhyHeaderSnrPer (event);
+  NS_LOG_DEBUG ("snr(dB)=" << RatioToDb (snrPer.snr) << ", per=" << snrPer.per);
+  WifiPhyRxfailureReason reason = UNKNOWN;
+  if (m_preambleDetectionModel && !m_preambleDetectionModel->IsPreambleDetected (event->GetRxPowerW (), snrPer.snr, m_channelWidth))
+    {
+      NS_LOG_DEBUG ("Drop packet because PHY preamble detection failed");
+      reason = PREAMBLE_DETECT_FAILURE;
+    }
+  else if (m_random->GetValue () <= snrPer.per)
+    {
+      NS_LOG_DEBUG ("Abort reception because DMG PHY header reception failed");
+      NotifyRxBegin (psdu);
+      reason = DMG_HEADER_FAILURE;
+    }
+  else if ((txVector.GetNss () > GetMaxSupportedRxSpatialStreams ())
+           || ((txVector.GetChannelWidth () >= 2160) && (txVector.GetChannelWidth () > GetChannelWidth ()))
+           || (!IsModeSupported (txMode) && !IsMcsSupported (txMode)))
+    {
+      NS_LOG_DEBUG ("Drop packet because it was sent using unsupported settings (" << txMode << ")");
+      NotifyRxBegin (psdu);
+      reason = UNSUPPORTED_SETTINGS;
+    }
+
+  if (reason != UNKNOWN)
+    {
+      NotifyRxDrop (psdu, reason);
+      m_interference.NotifyRxEnd ();
+      m_currentEvent = 0;
+      m_psduSuccess = false;
+      if (reason == DMG_HEADER_FAILURE)
+        {
+          m_state->SwitchMaybeToCcaBusy (GetPhyPreambleDuration (txVector) + GetPhyHeaderDuration (txVector));
+        }
+      else if (reason == UNSUPPORTED_SETTINGS)
+        {
+          m_state->SwitchMaybeToCcaBusy (event->GetEndTime () - Simulator::Now ());
+        }
+      MaybeCcaBusyDuration ();
+      return;
+    }
+
+  NotifyRxBegin (psdu);
+  m_timeLastPreambleDetected = Simulator::Now ();
+  double powerdBm = WToDbm (event->GetRxPowerW ());
+  if ((powerdBm < 0.0) && (powerdBm > -110.0))
+    {
+      m_lastRcpiValue = uint8_t ((powerdBm + 110) * 2);
+    }
+  else if (powerdBm >= 0)
+    {
+      m_lastRcpiValue = 220;
+    }
+  else
+    {
+      m_lastRcpiValue = 0;
+    }
+
+  /* The medium is reported busy (RX) for the whole PPDU and the PSDU is evaluated once at its end. */
+  Time remainingRxDuration = event->GetEndTime () - Simulator::Now ();
+  m_state->SwitchToRx (remainingRxDuration);
+  m_endRxEvent = Simulator::Schedule (remainingRxDuration, &DmgWifiPhy::EndReceive, this, event);
+  /* PHY-RXSTART is indicated at the start of the PPDU, so the MAC must wait for the preamble and the
+   * header as well as for the PSDU before its response timeouts expire. */
+  m_phyRxPayloadBeginTrace (txVector, remainingRxDuration);
+}
+
 void
 DmgWifiPhy::StartReceiveHeader (Ptr<Event> event)
 {
@@ -1692,6 +1813,18 @@ DmgWifiPhy::GetTRN_Field_Duration (WifiTxVector &txVector)
   return trnFieldDuration;
 }
 
+void
+DmgWifiPhy::ReceiveForeignSignal (Time duration, double rxPowerDbm)
+{
+  NS_LOG_FUNCTION (this << duration << rxPowerDbm);
+  if (m_state->IsStateOff () || m_state->IsStateSleep ())
+    {
+      return;
+    }
+  m_interference.AddForeignSignal (duration, DbmToW (rxPowerDbm));
+  MaybeCcaBusyDuration ();
+}
+
 void
 DmgWifiPhy::StartReceivePreamble (Ptr<WifiPpdu> ppdu, std::vector<double> rxPowerList)
 {
@@ -2024,6 +2157,18 @@ DmgWifiPhy::EndReceive (Ptr<Event> event)
   //// WIGIG: Note Check this in the old code
   NotifyRxEnd (psdu);
 
+  if (m_telemetry != 0)
+    {
+      uint8_t transmitter[8] = {0};
+      psdu->GetAddr2 ().CopyTo (transmitter);
+      uint64_t transmitterId;
+      std::memcpy (&transmitterId, transmitter, sizeof (transmitterId));
+      m_telemetry->RecordPpduRx (GetDevice ()->GetNode ()->GetId (), transmitterId,
+                                 txVector.GetMode ().GetMcsValue (), m_codebook->GetActiveRxSectorID (),
+                                 WToDbm (event->GetRxPowerW ()), RatioToDb (snr), receptionOkAtLeastForOneMpdu,
+                                 event->GetEndTime () - event->GetStartTime ());
+    }
+
   //// WIGIG ////
   if ((txVector.GetTrainngFieldLength () > 0) || (txVector.GetEDMGTrainingFieldLength () > 0))
     {
@@ -2167,6 +2312,12 @@ DmgWifiPhy::IsReceivingTRNField (void) const
   return m_receivingTRNfield;
 }
 
+bool
+DmgWifiPhy::IsReceivingFrom (Mac48Address sender) const
+{
+  return m_state->IsStateRx () && m_currentSender == sender;
+}
+
 Time
 DmgWifiPhy::GetDelayUntilEndRx (void)
 {
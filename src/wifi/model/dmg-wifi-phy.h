@@ -27,6 +27,7 @@
 namespace ns3 {
 
 class DmgWifiChannel;
+class DmgTelemetry;
 
 typedef uint8_t TimeBlockMeasurement;                                         /* Typedef for Time Block Measurement for SPSH. */
 typedef std::list<TimeBlockMeasurement> TimeBlockMeasurementList;             /* Typedef for List of Time Block Measurements. */
@@ -103,6 +104,15 @@ public:
    * \param channel the DmgWifiChannel this DmgWifiPhy is to be connected to
    */
   void SetChannel (const Ptr<DmgWifiChannel> channel);
+  /**
+   * Set the telemetry sink recording the PPDUs transmitted and received by this PHY.
+   * \param telemetry the telemetry sink, or 0 to disable telemetry.
+   */
+  void SetTelemetry (Ptr<DmgTelemetry> telemetry);
+  /**
+   * \return the telemetry sink of this PHY, or 0 if telemetry is disabled.
+   */
+  Ptr<DmgTelemetry> GetTelemetry (void) const;
   /**
    * This method is called at initialization to specify whether the node is an AP or not
    * \param ap True if the node is an AP, false otherwise.
@@ -358,6 +368,15 @@ public:
    * \param rxPowerList a list of receive power in W between each pair of active Tx and Rx antennas (has size 1 for SISO, > 1 for MIMO)
    */
   void StartReceivePreamble (Ptr<WifiPpdu> ppdu, std::vector<double> rxPowerList);
+  /**
+   * Account for energy that cannot be decoded by this PHY (e.g. leakage from a
+   * neighbouring room simulated in another logical process). The signal only
+   * contributes to interference and CCA.
+   *
+   * \param duration the duration of the signal
+   * \param rxPowerDbm the received power in dBm
+   */
+  void ReceiveForeignSignal (Time duration, double rxPowerDbm);
 
   /**
    * Start receiving the PHY header of a PPDU (i.e. after the end of receiving the preamble).
@@ -1030,6 +1049,12 @@ protected:
    * \return True if the node is receiving a TRN field, false otherwise.
    */
   bool IsReceivingTRNField (void) const;
+  /**
+   * Returns whether the PHY layer is currently receiving a PPDU, and its TRN field, from a station.
+   * \param sender the MAC address of the station.
+   * \return True if the PHY is receiving from the sender, false if it drops the subfields of the sender.
+   */
+  bool IsReceivingFrom (Mac48Address sender) const;
   /**
    * Starting receiving the PPDU after having detected the medium is idle or after a reception switch.
    *
@@ -1037,6 +1062,18 @@ protected:
    * \param rxPowerW the receive power in W
    */
   virtual void StartRx (Ptr<Event> event, double rxPowerW);
+  /**
+   * Receive a PPDU using the frame-level abstraction: the PHY header outcome is decided immediately
+   * and a single event is scheduled at the end of the PPDU to evaluate the PSDU.
+   *
+   * \param event the event holding incoming PPDU's information
+   */
+  void StartReceiveAbstractPpdu (Ptr<Event> event);
+  /**
+   * \param txVector the TXVECTOR of the PPDU.
+   * \return True if the PPDU has DMG or EDMG TRN subfields appended to it, false otherwise.
+   */
+  bool HasTrnField (const WifiTxVector &txVector) const;
 
 protected:
   /* EDMG PHY Layer Information */
@@ -1079,6 +1116,7 @@ private:
 private:
   Ptr<DmgWifiChannel> m_channel;          //!< Poiner to the DmgWifiChannel class that this DmgWifiPhy is connected to.
   Ptr<Codebook> m_codebook;               //!< Pointer to the beamforming codebook.
+  Ptr<DmgTelemetry> m_telemetry;          //!< Per-frame telemetry sink.
 
   /* DMG Relay Variables */
   bool m_rdsActivated;                    //!< Flag to indicate if RDS is activated.
@@ -1092,6 +1130,7 @@ private:
 
   /* Reception status variables */
   bool m_psduSuccess;                     //!< Flag to indicate if the PSDU has been received successfully.
+  bool m_frameLevelAbstraction;           //!< Flag to indicate if PPDUs without TRN fields are received using a single end-of-PPDU event.
 
   /* Channel Measurements Variables */
   uint16_t m_measurementUnit;
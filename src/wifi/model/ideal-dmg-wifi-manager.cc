@@ -37,6 +37,7 @@ struct IdealDmgWifiRemoteStation : public WifiRemoteStation
   double m_lastSnrObserved;  //!< SNR of most recently reported packet sent to the remote station
   double m_lastSnrCached;    //!< SNR most recently used to select a rate
   WifiMode m_lastMode;       //!< Mode most recently used to the remote station
+  WifiTxVector m_lastTxVector; //!< TXVECTOR most recently used to the remote station.
 };
 
 /// To avoid using the cache before a valid value has been cached
@@ -226,14 +227,18 @@ IdealDmgWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
   WifiTxVector txVector;
   WifiMode mode;
   uint64_t bestRate = 0;
-  if (station->m_lastSnrCached != CACHE_INITIAL_VALUE && station->m_lastSnrObserved == station->m_lastSnrCached)
+  if (station->m_lastSnrCached != CACHE_INITIAL_VALUE && station->m_lastSnrObserved == station->m_lastSnrCached
+      && station->m_lastTxVector.GetChannelWidth () == GetPhy ()->GetChannelWidth ()
+      && station->m_lastTxVector.GetTxPowerLevel () == GetDefaultTxPowerLevel ())
     {
-      // SNR has not changed, so skip the search and use the last
-      // mode selected
-      maxMode = station->m_lastMode;
-      NS_LOG_DEBUG ("Using cached mode = " << maxMode.GetUniqueName () <<
+      // Neither the SNR, the channel width nor the power level has changed,
+      // so skip the search and reuse the TXVECTOR built for the last mode
+      // selected
+      NS_LOG_DEBUG ("Using cached mode = " << station->m_lastMode.GetUniqueName () <<
                     " last snr observed " << station->m_lastSnrObserved <<
                     " cached " << station->m_lastSnrCached);
+      station->m_lastTxVector.SetAggregation (GetAggregation (station));
+      return station->m_lastTxVector;
     }
   else
     {
@@ -258,9 +263,9 @@ IdealDmgWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
               bestRate = dataRate;
               maxMode = mode;
             }
-          NS_LOG_DEBUG ("Updating cached SNR value for station to " << station->m_lastSnrObserved);
-          station->m_lastSnrCached = station->m_lastSnrObserved;
         }
+      NS_LOG_DEBUG ("Updating cached SNR value for station to " << station->m_lastSnrObserved);
+      station->m_lastSnrCached = station->m_lastSnrObserved;
       if (station->m_lastMode.GetMcsValue () != maxMode.GetMcsValue ())
         {
           NS_LOG_DEBUG ("Updating MCS value for station to " <<  maxMode.GetUniqueName ());
@@ -269,9 +274,10 @@ IdealDmgWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
         }
     }
   NS_LOG_DEBUG ("Found maxMode: " << maxMode);
-  return WifiTxVector (maxMode, GetDefaultTxPowerLevel (),
-                       GetPreambleForTransmission (maxMode.GetModulationClass (), false, false),
-                       GetPhy ()->GetChannelWidth (), GetAggregation (station));
+  station->m_lastTxVector = WifiTxVector (maxMode, GetDefaultTxPowerLevel (),
+                                          GetPreambleForTransmission (maxMode.GetModulationClass (), false, false),
+                                          GetPhy ()->GetChannelWidth (), GetAggregation (station));
+  return station->m_lastTxVector;
 }
 
 WifiTxVector
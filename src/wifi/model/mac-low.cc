@@ -47,6 +47,7 @@
 #include "wifi-net-device.h"
 #include "wifi-mac.h"
 #include <algorithm>
+#include <limits>
 #include "wifi-ack-policy-selector.h"
 #include "control-trailer.h"
 
@@ -147,6 +148,7 @@ MacLow::MacLow ()
     m_servingMimoBFT (false)
 {
   NS_LOG_FUNCTION (this);
+  m_ampduBatch.active = false;
 }
 
 MacLow::~MacLow ()
@@ -1063,6 +1065,24 @@ MacLow::IsWithinSizeAndTimeLimits (uint32_t mpduSize, Mac48Address receiver, uin
 
   WifiModulationClass modulation = txVector.GetMode ().GetModulationClass ();
 
+  if (m_ampduBatch.active && receiver == m_ampduBatch.receiver && tid == m_ampduBatch.tid
+      && ppduDurationLimit == m_ampduBatch.ppduDurationLimit
+      && txVector.GetMode () == m_ampduBatch.txVector.GetMode ()
+      && txVector.GetChannelWidth () == m_ampduBatch.txVector.GetChannelWidth ()
+      && txVector.GetPreambleType () == m_ampduBatch.txVector.GetPreambleType ()
+      && txVector.GetGuardInterval () == m_ampduBatch.txVector.GetGuardInterval ()
+      && txVector.GetNss () == m_ampduBatch.txVector.GetNss ()
+      && txVector.GetTrainngFieldLength () == m_ampduBatch.txVector.GetTrainngFieldLength ())
+    {
+      uint32_t ppduPayloadSize = mpduSize;
+      if (ampduSize > 0 || modulation >= WIFI_MOD_CLASS_VHT)
+        {
+          ppduPayloadSize = MpduAggregator::GetSizeIfAggregated (mpduSize, ampduSize);
+        }
+      return ppduPayloadSize <= m_ampduBatch.maxAmpduSize
+             && ppduPayloadSize <= m_ampduBatch.maxPpduPayloadSize;
+    }
+
   uint32_t maxAmpduSize = 0;
   if (GetMpduAggregator ())
     {
@@ -1101,6 +1121,70 @@ MacLow::IsWithinSizeAndTimeLimits (uint32_t mpduSize, Mac48Address receiver, uin
   return true;
 }
 
+void
+MacLow::StartAmpduBatch (Mac48Address receiver, uint8_t tid, WifiTxVector txVector,
+                         Time ppduDurationLimit)
+{
+  NS_LOG_FUNCTION (this << receiver << +tid << txVector << ppduDurationLimit);
+  NS_ASSERT (GetMpduAggregator ());
+
+  m_ampduBatch.active = false;
+  if (ppduDurationLimit != Time::Min () && ppduDurationLimit.IsNegative ())
+    {
+      return;
+    }
+
+  m_ampduBatch.maxAmpduSize = GetMpduAggregator ()->GetMaxAmpduSize (receiver, tid,
+                                                                     txVector.GetMode ().GetModulationClass ());
+  if (m_ampduBatch.maxAmpduSize == 0)
+    {
+      return;
+    }
+
+  // the tightest of the limits on the PPDU duration, if any
+  Time maxPpduDuration = GetPpduMaxTime (txVector.GetPreambleType ());
+  if (ppduDurationLimit.IsStrictlyPositive ()
+      && (!maxPpduDuration.IsStrictlyPositive () || ppduDurationLimit < maxPpduDuration))
+    {
+      maxPpduDuration = ppduDurationLimit;
+    }
+
+  m_ampduBatch.maxPpduPayloadSize = std::numeric_limits<uint32_t>::max ();
+  if (maxPpduDuration.IsStrictlyPositive ())
+    {
+      // the PPDU duration grows with the payload size, hence look for the
+      // largest payload which meets the limit by bisection
+      uint32_t low = 0;
+      uint32_t high = m_ampduBatch.maxAmpduSize;
+      while (low < high)
+        {
+          uint32_t size = low + (high - low + 1) / 2;
+          if (m_phy->CalculateTxDuration (size, txVector, m_phy->GetFrequency ()) > maxPpduDuration)
+            {
+              high = size - 1;
+            }
+          else
+            {
+              low = size;
+            }
+        }
+      m_ampduBatch.maxPpduPayloadSize = low;
+    }
+
+  m_ampduBatch.active = true;
+  m_ampduBatch.receiver = receiver;
+  m_ampduBatch.tid = tid;
+  m_ampduBatch.txVector = txVector;
+  m_ampduBatch.ppduDurationLimit = ppduDurationLimit;
+}
+
+void
+MacLow::EndAmpduBatch (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_ampduBatch.active = false;
+}
+
 void
 MacLow::RxStartIndication (WifiTxVector txVector, Time psduDuration)
 {
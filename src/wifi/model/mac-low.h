@@ -359,6 +359,24 @@ public:
    */
   bool IsWithinSizeAndTimeLimits (uint32_t mpduSize, Mac48Address receiver, uint8_t tid,
                                   WifiTxVector txVector, uint32_t ampduSize, Time ppduDurationLimit);
+  /**
+   * Start building an A-MPDU destined to the given receiver and belonging to
+   * the given TID. Until EndAmpduBatch is called, IsWithinSizeAndTimeLimits
+   * checks the MPDUs of this A-MPDU against a maximum A-MPDU size and a
+   * maximum PPDU payload size computed once here, instead of looking up the
+   * maximum A-MPDU size and computing the PPDU duration for each MPDU.
+   *
+   * \param receiver the receiver
+   * \param tid the TID
+   * \param txVector the TX vector used to transmit the A-MPDU
+   * \param ppduDurationLimit the limit on the PPDU duration
+   */
+  void StartAmpduBatch (Mac48Address receiver, uint8_t tid, WifiTxVector txVector,
+                        Time ppduDurationLimit);
+  /**
+   * Stop using the limits computed by StartAmpduBatch.
+   */
+  void EndAmpduBatch (void);
   /**
    * \param packet to send (does not include the 802.11 MAC header and checksum)
    * \param hdr header associated to the packet to send.
@@ -1160,6 +1178,19 @@ private:
   Ptr<MsduAggregator> m_msduAggregator;             //!< A-MSDU aggregator
   Ptr<MpduAggregator> m_mpduAggregator;             //!< A-MPDU aggregator
 
+  /// The limits on the A-MPDU being built, computed by StartAmpduBatch
+  struct AmpduBatch
+  {
+    bool active;                  //!< whether an A-MPDU is being built
+    Mac48Address receiver;        //!< the receiver of the A-MPDU
+    uint8_t tid;                  //!< the TID of the A-MPDU
+    WifiTxVector txVector;        //!< the TX vector used to transmit the A-MPDU
+    Time ppduDurationLimit;       //!< the limit on the PPDU duration
+    uint32_t maxAmpduSize;        //!< the maximum A-MPDU size
+    uint32_t maxPpduPayloadSize;  //!< the largest PPDU payload sent within the duration limits
+  };
+  AmpduBatch m_ampduBatch;                          //!< the limits on the A-MPDU being built
+
   EventId m_normalAckTimeoutEvent;      //!< Normal Ack timeout event
   EventId m_blockAckTimeoutEvent;       //!< BlockAck timeout event
   EventId m_ctsTimeoutEvent;            //!< CTS timeout event
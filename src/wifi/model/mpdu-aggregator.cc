@@ -77,6 +77,29 @@ MpduAggregator::Aggregate (Ptr<const WifiMacQueueItem> mpdu, Ptr<Packet> ampdu,
   // if isSingle is true, then ampdu must be empty
   NS_ASSERT (!isSingle || ampdu->GetSize () == 0);
 
+  AddSubframe (mpdu, ampdu, isSingle, Create<Packet> ());
+}
+
+void
+MpduAggregator::Aggregate (const std::vector<Ptr<WifiMacQueueItem>> &mpduList, Ptr<Packet> ampdu)
+{
+  NS_LOG_FUNCTION (mpduList.size () << ampdu);
+  NS_ASSERT (ampdu);
+
+  Ptr<Packet> headers = Create<Packet> ();
+  for (auto& mpdu : mpduList)
+    {
+      AddSubframe (mpdu, ampdu, false, headers);
+    }
+}
+
+void
+MpduAggregator::AddSubframe (Ptr<const WifiMacQueueItem> mpdu, Ptr<Packet> ampdu, bool isSingle,
+                             Ptr<Packet> headers)
+{
+  NS_LOG_FUNCTION (mpdu << ampdu << isSingle);
+  NS_ASSERT (headers->GetSize () == 0);
+
   // pad the previous A-MPDU subframe if the A-MPDU is not empty
   if (ampdu->GetSize () > 0)
     {
@@ -84,21 +107,21 @@ MpduAggregator::Aggregate (Ptr<const WifiMacQueueItem> mpdu, Ptr<Packet> ampdu,
 
       if (padding)
         {
-          Ptr<Packet> pad = Create<Packet> (padding);
-          ampdu->AddAtEnd (pad);
+          ampdu->AddPaddingAtEnd (padding);
         }
     }
 
-  // add MPDU header and trailer
-  Ptr<Packet> tmp = mpdu->GetPacket ()->Copy ();
-  tmp->AddHeader (mpdu->GetHeader ());
-  AddWifiMacTrailer (tmp);
-
-  // add A-MPDU subframe header and MPDU to the A-MPDU
-  AmpduSubframeHeader hdr = GetAmpduSubframeHeader (static_cast<uint16_t> (tmp->GetSize ()), isSingle);
-
-  tmp->AddHeader (hdr);
-  ampdu->AddAtEnd (tmp);
+  // serialize the A-MPDU subframe header and the MAC header in one packet,
+  // then add the MSDU and the trailer to the A-MPDU, so that the MSDU is
+  // not copied to add the headers first
+  headers->AddHeader (mpdu->GetHeader ());
+  uint32_t mpduSize = headers->GetSize () + mpdu->GetPacket ()->GetSize () + WIFI_MAC_FCS_LENGTH;
+  headers->AddHeader (GetAmpduSubframeHeader (static_cast<uint16_t> (mpduSize), isSingle));
+
+  ampdu->AddAtEnd (headers);
+  ampdu->AddAtEnd (mpdu->GetPacket ());
+  AddWifiMacTrailer (ampdu);
+  headers->RemoveAtStart (headers->GetSize ());
 }
 
 uint32_t
@@ -254,9 +277,13 @@ MpduAggregator::GetNextAmpdu (Ptr<const WifiMacQueueItem> mpdu, WifiTxVector txV
       Ptr<WifiMacQueueItem> nextMpdu;
       uint16_t maxMpdus = edcaIt->second->GetBaBufferSize (recipient, tid);
       uint32_t currentAmpduSize = 0;
+      Ptr<MacLow> low = edcaIt->second->GetLow ();
+      mpduList.reserve (maxMpdus);
+      // resolve the limits on the A-MPDU once for all the MPDUs
+      low->StartAmpduBatch (recipient, tid, txVector, ppduDurationLimit);
 
       // check if the received MPDU meets the size and duration constraints
-      if (edcaIt->second->GetLow ()->IsWithinSizeAndTimeLimits (mpdu, txVector, 0, ppduDurationLimit))
+      if (low->IsWithinSizeAndTimeLimits (mpdu, txVector, 0, ppduDurationLimit))
         {
           // MPDU can be aggregated
           nextMpdu = Copy (mpdu);
@@ -285,7 +312,11 @@ MpduAggregator::GetNextAmpdu (Ptr<const WifiMacQueueItem> mpdu, WifiTxVector txV
 
           mpduList.push_back (nextMpdu);
 
-          // If allowed by the BA agreement, get the next MPDU
+          // If allowed by the BA agreement, get the next MPDU. The MPDUs are
+          // dequeued one at a time: each one may be a retransmission from the
+          // BA manager queue, gets its sequence number and may become an
+          // A-MSDU when dequeued, and the A-MPDU size so far decides whether
+          // it fits.
           nextMpdu = 0;
 
           Ptr<const WifiMacQueueItem> peekedMpdu;
@@ -305,6 +336,8 @@ MpduAggregator::GetNextAmpdu (Ptr<const WifiMacQueueItem> mpdu, WifiTxVector txV
                 }
             }
         }
+      low->EndAmpduBatch ();
+
       if (mpduList.size () == 1)
         {
           // return an empty vector if it was not possible to aggregate at least two MPDUs
@@ -65,6 +65,16 @@ public:
    */
   static void Aggregate (Ptr<const WifiMacQueueItem> mpdu, Ptr<Packet> ampdu, bool isSingle);
 
+  /**
+   * Aggregate a run of MPDUs to an A-MPDU. The headers of all the A-MPDU
+   * subframes are serialized in the same buffer, which is equivalent to,
+   * and faster than, calling Aggregate for each MPDU in turn.
+   *
+   * \param mpduList the MPDUs.
+   * \param ampdu the A-MPDU.
+   */
+  static void Aggregate (const std::vector<Ptr<WifiMacQueueItem>> &mpduList, Ptr<Packet> ampdu);
+
   /**
    * Compute the size of the A-MPDU resulting from the aggregation of an MPDU of
    * size <i>mpduSize</i> and an A-MPDU of size <i>ampduSize</i>.
@@ -146,6 +156,18 @@ public:
   static AmpduSubframeHeader GetAmpduSubframeHeader (uint16_t mpduSize, bool isSingle);
 
 private:
+  /**
+   * Add an A-MPDU subframe carrying the given MPDU to an A-MPDU.
+   *
+   * \param mpdu the MPDU.
+   * \param ampdu the A-MPDU.
+   * \param isSingle whether it is a single MPDU.
+   * \param headers an empty packet, used to serialize the subframe headers,
+   *        which is empty again when this method returns.
+   */
+  static void AddSubframe (Ptr<const WifiMacQueueItem> mpdu, Ptr<Packet> ampdu, bool isSingle,
+                           Ptr<Packet> headers);
+
   EdcaQueues m_edca;   //!< the map of EDCA queues
 };
 
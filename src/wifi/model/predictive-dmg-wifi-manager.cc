@@ -0,0 +1,474 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/mobility-model.h"
+#include "ns3/net-device.h"
+#include "ns3/node.h"
+#include "predictive-dmg-wifi-manager.h"
+#include "dmg-wifi-channel.h"
+#include "dmg-wifi-mac.h"
+#include "wifi-phy.h"
+#include "wifi-utils.h"
+#include <cmath>
+
+namespace ns3 {
+
+/**
+ * \brief hold per-remote-station state for the Predictive DMG Wifi manager.
+ *
+ * This struct extends from WifiRemoteStation struct to hold additional
+ * information required by the Predictive DMG Wifi manager
+ */
+struct PredictiveDmgWifiRemoteStation : public WifiRemoteStation
+{
+  double m_lastSnrObserved;       //!< SNR of most recently reported packet sent to the remote station
+  double m_lastSnrCached;         //!< SNR most recently used to select a rate
+  double m_snrDrop;               //!< Worst drop of the link budget predicted over the horizon, in dB
+  double m_snrDropCached;         //!< Drop of the link budget most recently used to select a rate
+  WifiMode m_lastMode;            //!< Mode most recently used to the remote station
+  WifiTxVector m_lastTxVector;    //!< TXVECTOR most recently used to the remote station.
+  Time m_nextPrediction;          //!< Time at which the prediction is to be updated
+  Time m_lastRetraining;          //!< Time of the last beam re-training with the remote station
+  bool m_retrained;               //!< Whether a beam re-training with the remote station has been started
+  bool m_blockage;                //!< Whether a blockage of the link is predicted
+  bool m_mobilityLookedUp;        //!< Whether the mobility model of the remote station has been looked up
+  Ptr<MobilityModel> m_mobility;  //!< Mobility model of the remote station
+};
+
+/// To avoid using the cache before a valid value has been cached
+static const double CACHE_INITIAL_VALUE = -100;
+
+NS_OBJECT_ENSURE_REGISTERED (PredictiveDmgWifiManager);
+
+NS_LOG_COMPONENT_DEFINE ("PredictiveDmgWifiManager");
+
+TypeId
+PredictiveDmgWifiManager::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::PredictiveDmgWifiManager")
+    .SetParent<WifiRemoteStationManager> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<PredictiveDmgWifiManager> ()
+    .AddAttribute ("BerThreshold",
+                   "The maximum Bit Error Rate acceptable at any transmission mode",
+                   DoubleValue (1e-6),
+                   MakeDoubleAccessor (&PredictiveDmgWifiManager::m_ber),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("PredictionHorizon",
+                   "How far ahead the link budget with a remote station is predicted.",
+                   TimeValue (MilliSeconds (20)),
+                   MakeTimeAccessor (&PredictiveDmgWifiManager::m_horizon),
+                   MakeTimeChecker ())
+    .AddAttribute ("PredictionSteps",
+                   "The number of instants of the horizon at which the link budget is predicted. "
+                   "The prediction is updated every PredictionHorizon/PredictionSteps.",
+                   UintegerValue (4),
+                   MakeUintegerAccessor (&PredictiveDmgWifiManager::m_steps),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("BlockageThreshold",
+                   "The drop of the link budget, in dB, from which the link is considered blocked. "
+                   "It is kept below the 10 dB NLoS loss of the TGad ad-hoc channel, since the free space "
+                   "loss may decrease when a station walks into a blockage.",
+                   DoubleValue (5.0),
+                   MakeDoubleAccessor (&PredictiveDmgWifiManager::m_blockageThreshold),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("BeamRetraining",
+                   "Whether to start a TXSS with a remote station when a blockage of the link is predicted.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&PredictiveDmgWifiManager::m_beamRetraining),
+                   MakeBooleanChecker ())
+    .AddAttribute ("RetrainingHoldOff",
+                   "The minimum time between two beam re-trainings with the same remote station.",
+                   TimeValue (MilliSeconds (100)),
+                   MakeTimeAccessor (&PredictiveDmgWifiManager::m_retrainingHoldOff),
+                   MakeTimeChecker ())
+    .AddTraceSource ("Rate",
+                     "Traced value for MCS changes",
+                     MakeTraceSourceAccessor (&PredictiveDmgWifiManager::m_mcsChanged),
+                     "ns3::IdealDmgWifiManager::McsChangedTracedCallback")
+    .AddTraceSource ("BlockagePredicted",
+                     "A blockage of the link with a remote station is predicted",
+                     MakeTraceSourceAccessor (&PredictiveDmgWifiManager::m_blockagePredicted),
+                     "ns3::PredictiveDmgWifiManager::BlockagePredictedCallback")
+  ;
+  return tid;
+}
+
+PredictiveDmgWifiManager::PredictiveDmgWifiManager ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+PredictiveDmgWifiManager::~PredictiveDmgWifiManager ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+PredictiveDmgWifiManager::SetupPhy (const Ptr<WifiPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  WifiRemoteStationManager::SetupPhy (phy);
+}
+
+void
+PredictiveDmgWifiManager::DoInitialize ()
+{
+  NS_LOG_FUNCTION (this);
+  WifiMode mode;
+  WifiTxVector txVector;
+  uint8_t nModes = GetPhy ()->GetNModes ();
+  for (uint8_t i = 1; i < nModes; i++)
+    {
+      mode = GetPhy ()->GetMode (i);
+      txVector.SetChannelWidth (GetPhy ()->GetChannelWidth ());
+      txVector.SetMode (mode);
+      NS_LOG_DEBUG ("Initialize, adding mode = " << mode.GetUniqueName ());
+      AddSnrThreshold (txVector, GetPhy ()->CalculateSnr (txVector, m_ber));
+    }
+  m_channel = DynamicCast<DmgWifiChannel> (GetPhy ()->GetChannel ());
+}
+
+void
+PredictiveDmgWifiManager::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_channel = 0;
+  WifiRemoteStationManager::DoDispose ();
+}
+
+double
+PredictiveDmgWifiManager::GetSnrThreshold (WifiTxVector &txVector) const
+{
+  NS_LOG_FUNCTION (this << txVector.GetMode ().GetUniqueName ());
+  for (Thresholds::const_iterator i = m_thresholds.begin (); i != m_thresholds.end (); i++)
+    {
+      if (txVector.GetMode () == i->second.GetMode ())
+        {
+          return i->first;
+        }
+    }
+  NS_ASSERT (false);
+  return 0.0;
+}
+
+void
+PredictiveDmgWifiManager::AddSnrThreshold (WifiTxVector txVector, double snr)
+{
+  NS_LOG_FUNCTION (this << txVector.GetMode ().GetUniqueName () << snr);
+  m_thresholds.push_back (std::make_pair (snr, txVector));
+}
+
+WifiRemoteStation *
+PredictiveDmgWifiManager::DoCreateStation (void) const
+{
+  NS_LOG_FUNCTION (this);
+  PredictiveDmgWifiRemoteStation *station = new PredictiveDmgWifiRemoteStation ();
+  station->m_mobilityLookedUp = false;
+  station->m_lastRetraining = Seconds (0);
+  station->m_retrained = false;
+  Reset (station);
+  return station;
+}
+
+void
+PredictiveDmgWifiManager::Reset (WifiRemoteStation *station) const
+{
+  NS_LOG_FUNCTION (this << station);
+  PredictiveDmgWifiRemoteStation *st = static_cast<PredictiveDmgWifiRemoteStation*> (station);
+  st->m_lastSnrObserved = 0.0;
+  st->m_lastSnrCached = CACHE_INITIAL_VALUE;
+  st->m_snrDrop = 0.0;
+  st->m_snrDropCached = 0.0;
+  st->m_lastMode = GetDefaultMode ();
+  st->m_nextPrediction = Seconds (0);
+  st->m_blockage = false;
+}
+
+Ptr<MobilityModel>
+PredictiveDmgWifiManager::LookupMobility (PredictiveDmgWifiRemoteStation *station) const
+{
+  NS_LOG_FUNCTION (this << station);
+  for (std::size_t i = 0; i < m_channel->GetNDevices (); i++)
+    {
+      Ptr<NetDevice> device = m_channel->GetDevice (i);
+      if (device != 0 && device->GetAddress () == station->m_state->m_address)
+        {
+          return device->GetNode ()->GetObject<MobilityModel> ();
+        }
+    }
+  return 0;
+}
+
+double
+PredictiveDmgWifiManager::GetLinkBudget (Vector a, Vector b) const
+{
+  double distance = std::max (CalculateDistance (a, b), 0.1);
+  return -20 * std::log10 (distance) + m_channel->GetScenarioGain (a, b);
+}
+
+void
+PredictiveDmgWifiManager::UpdatePrediction (PredictiveDmgWifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+  Time now = Simulator::Now ();
+  station->m_nextPrediction = now + m_horizon / m_steps;
+  station->m_snrDrop = 0.0;
+  if (m_channel == 0)
+    {
+      return;
+    }
+  if (!station->m_mobilityLookedUp)
+    {
+      station->m_mobility = LookupMobility (station);
+      station->m_mobilityLookedUp = true;
+    }
+  Ptr<MobilityModel> mobility = GetPhy ()->GetMobility ();
+  if (mobility == 0 || station->m_mobility == 0)
+    {
+      return;
+    }
+
+  Vector a = mobility->GetPosition ();
+  Vector b = station->m_mobility->GetPosition ();
+  Vector va = mobility->GetVelocity ();
+  Vector vb = station->m_mobility->GetVelocity ();
+  if (va.GetLength () == 0 && vb.GetLength () == 0)
+    {
+      // the link budget does not change while neither end moves
+      station->m_blockage = false;
+      return;
+    }
+  double budget = GetLinkBudget (a, b);
+  Time delay;
+  for (uint32_t k = 1; k <= m_steps; k++)
+    {
+      double t = m_horizon.GetSeconds () * k / m_steps;
+      Vector at (a.x + va.x * t, a.y + va.y * t, a.z + va.z * t);
+      Vector bt (b.x + vb.x * t, b.y + vb.y * t, b.z + vb.z * t);
+      double drop = budget - GetLinkBudget (at, bt);
+      if (drop > station->m_snrDrop)
+        {
+          station->m_snrDrop = drop;
+          delay = Seconds (t);
+        }
+    }
+  NS_LOG_DEBUG ("Predicted drop of " << station->m_snrDrop << " dB in " << delay.As (Time::MS)
+                << " to " << station->m_state->m_address);
+
+  if (station->m_snrDrop < m_blockageThreshold)
+    {
+      station->m_blockage = false;
+      return;
+    }
+  if (station->m_blockage)
+    {
+      return;
+    }
+  station->m_blockage = true;
+  m_blockagePredicted (station->m_state->m_address, station->m_snrDrop, delay);
+  if (m_beamRetraining
+      && (!station->m_retrained || now - station->m_lastRetraining >= m_retrainingHoldOff))
+    {
+      station->m_lastRetraining = now;
+      station->m_retrained = true;
+      // the MAC may be about to use the TXVECTOR requested, so start the
+      // re-training once it is done with it
+      Simulator::ScheduleNow (&PredictiveDmgWifiManager::StartBeamRetraining, this,
+                              station->m_state->m_address);
+    }
+}
+
+void
+PredictiveDmgWifiManager::StartBeamRetraining (Mac48Address address)
+{
+  NS_LOG_FUNCTION (this << address);
+  Ptr<DmgWifiMac> mac = DynamicCast<DmgWifiMac> (GetMac ());
+  if (mac != 0)
+    {
+      mac->Perform_TXSS_TXOP (address);
+    }
+}
+
+void
+PredictiveDmgWifiManager::DoReportRxOk (WifiRemoteStation *station, double rxSnr, WifiMode txMode)
+{
+  NS_LOG_FUNCTION (this << station << rxSnr << txMode);
+}
+
+void
+PredictiveDmgWifiManager::DoReportRtsFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+}
+
+void
+PredictiveDmgWifiManager::DoReportDataFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+}
+
+void
+PredictiveDmgWifiManager::DoReportRtsOk (WifiRemoteStation *st,
+                                         double ctsSnr, WifiMode ctsMode, double rtsSnr)
+{
+  NS_LOG_FUNCTION (this << st << ctsSnr << ctsMode.GetUniqueName () << rtsSnr);
+  PredictiveDmgWifiRemoteStation *station = static_cast<PredictiveDmgWifiRemoteStation*> (st);
+  station->m_lastSnrObserved = rtsSnr;
+}
+
+void
+PredictiveDmgWifiManager::DoReportDataOk (WifiRemoteStation *st, double ackSnr, WifiMode ackMode,
+                                          double dataSnr, uint16_t dataChannelWidth, uint8_t dataNss)
+{
+  NS_LOG_FUNCTION (this << st << ackSnr << ackMode.GetUniqueName () << dataSnr << dataChannelWidth << +dataNss);
+  PredictiveDmgWifiRemoteStation *station = static_cast<PredictiveDmgWifiRemoteStation*> (st);
+  if (dataSnr == 0)
+    {
+      NS_LOG_WARN ("DataSnr reported to be zero; not saving this report.");
+      return;
+    }
+  station->m_lastSnrObserved = dataSnr;
+}
+
+void
+PredictiveDmgWifiManager::DoReportAmpduTxStatus (WifiRemoteStation *st, uint8_t nSuccessfulMpdus,
+                                                 uint8_t nFailedMpdus, double rxSnr, double dataSnr, uint16_t dataChannelWidth, uint8_t dataNss)
+{
+  NS_LOG_FUNCTION (this << st << +nSuccessfulMpdus << +nFailedMpdus << rxSnr << dataSnr << dataChannelWidth << +dataNss);
+  PredictiveDmgWifiRemoteStation *station = static_cast<PredictiveDmgWifiRemoteStation*> (st);
+  if (dataSnr == 0)
+    {
+      NS_LOG_WARN ("DataSnr reported to be zero; not saving this report.");
+      return;
+    }
+  station->m_lastSnrObserved = dataSnr;
+}
+
+void
+PredictiveDmgWifiManager::DoReportFinalRtsFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+  Reset (station);
+  m_mcsChanged (station->m_state->m_address, GetDefaultMode ().GetMcsValue ());
+}
+
+void
+PredictiveDmgWifiManager::DoReportFinalDataFailed (WifiRemoteStation *station)
+{
+  NS_LOG_FUNCTION (this << station);
+  Reset (station);
+  m_mcsChanged (station->m_state->m_address, GetDefaultMode ().GetMcsValue ());
+}
+
+WifiTxVector
+PredictiveDmgWifiManager::DoGetDataTxVector (WifiRemoteStation *st)
+{
+  NS_LOG_FUNCTION (this << st);
+  PredictiveDmgWifiRemoteStation *station = static_cast<PredictiveDmgWifiRemoteStation*> (st);
+  if (Simulator::Now () >= station->m_nextPrediction)
+    {
+      UpdatePrediction (station);
+    }
+  if (station->m_lastSnrCached != CACHE_INITIAL_VALUE
+      && station->m_lastSnrObserved == station->m_lastSnrCached
+      && station->m_snrDrop == station->m_snrDropCached
+      && station->m_lastTxVector.GetChannelWidth () == GetPhy ()->GetChannelWidth ()
+      && station->m_lastTxVector.GetTxPowerLevel () == GetDefaultTxPowerLevel ())
+    {
+      // neither the SNR, the prediction, the channel width nor the power
+      // level has changed, so skip the search and reuse the TXVECTOR built
+      // for the last mode selected
+      station->m_lastTxVector.SetAggregation (GetAggregation (station));
+      return station->m_lastTxVector;
+    }
+  //We search within the Supported rate set the mode with the
+  //highest data rate for which the SNR threshold is smaller than the
+  //worst SNR predicted over the horizon.
+  double snr = station->m_lastSnrObserved * DbToRatio (-station->m_snrDrop);
+  WifiMode maxMode = GetDefaultMode ();
+  WifiTxVector txVector;
+  WifiMode mode;
+  uint64_t bestRate = 0;
+  for (uint8_t i = 1; i < GetNSupported (station); i++)
+    {
+      mode = GetSupported (station, i);
+      txVector.SetMode (mode);
+      txVector.SetChannelWidth (GetPhy ()->GetChannelWidth ());
+      double threshold = GetSnrThreshold (txVector);
+      uint64_t dataRate = mode.GetDmgDataRate ();
+      if (dataRate > bestRate && threshold < snr)
+        {
+          bestRate = dataRate;
+          maxMode = mode;
+        }
+    }
+  NS_LOG_DEBUG ("Found maxMode: " << maxMode << " for predicted snr " << snr
+                << " (last snr observed " << station->m_lastSnrObserved << ")");
+  station->m_lastSnrCached = station->m_lastSnrObserved;
+  station->m_snrDropCached = station->m_snrDrop;
+  if (station->m_lastMode.GetMcsValue () != maxMode.GetMcsValue ())
+    {
+      station->m_lastMode = maxMode;
+      m_mcsChanged (station->m_state->m_address, maxMode.GetMcsValue ());
+    }
+  station->m_lastTxVector = WifiTxVector (maxMode, GetDefaultTxPowerLevel (),
+                                          GetPreambleForTransmission (maxMode.GetModulationClass (), false, false),
+                                          GetPhy ()->GetChannelWidth (), GetAggregation (station));
+  return station->m_lastTxVector;
+}
+
+WifiTxVector
+PredictiveDmgWifiManager::DoGetRtsTxVector (WifiRemoteStation *st)
+{
+  NS_LOG_FUNCTION (this << st);
+  PredictiveDmgWifiRemoteStation *station = static_cast<PredictiveDmgWifiRemoteStation*> (st);
+  //We search within the Basic rate set the mode with the highest
+  //SNR threshold possible which is smaller than the predicted SNR to
+  //ensure correct packet delivery.
+  double snr = station->m_lastSnrObserved * DbToRatio (-station->m_snrDrop);
+  double maxThreshold = 0.0;
+  WifiTxVector txVector;
+  WifiMode mode;
+  WifiMode maxMode = GetDefaultMode ();
+  for (uint8_t i = 0; i < GetNBasicModes (); i++)
+    {
+      mode = GetBasicMode (i);
+      txVector.SetMode (mode);
+      txVector.SetChannelWidth (GetPhy ()->GetChannelWidth ());
+      double threshold = GetSnrThreshold (txVector);
+      if (threshold > maxThreshold && threshold < snr)
+        {
+          maxThreshold = threshold;
+          maxMode = mode;
+        }
+    }
+  return WifiTxVector (maxMode, GetDefaultTxPowerLevel (), GetPreambleForTransmission (maxMode.GetModulationClass (), false, false),
+                       GetPhy ()->GetChannelWidth (), GetAggregation (station));
+}
+
+bool
+PredictiveDmgWifiManager::IsLowLatency (void) const
+{
+  return true;
+}
+
+} //namespace ns3
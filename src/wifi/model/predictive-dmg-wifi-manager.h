@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PREDICTIVE_DMG_WIFI_MANAGER_H
+#define PREDICTIVE_DMG_WIFI_MANAGER_H
+
+#include "ns3/traced-value.h"
+#include "ns3/nstime.h"
+#include "ns3/vector.h"
+#include "wifi-remote-station-manager.h"
+
+namespace ns3 {
+
+class DmgWifiChannel;
+class MobilityModel;
+struct PredictiveDmgWifiRemoteStation;
+
+/**
+ * \brief Environment-aware predictive rate control algorithm for DMG/EDMG stations.
+ * \ingroup wifi
+ *
+ * This class selects the transmission mode as IdealDmgWifiManager does,
+ * from the SNR reported by the receiver, but against the SNR predicted
+ * over the next PredictionHorizon rather than the last SNR observed.
+ *
+ * The obstacles of the room are known to the DmgWifiChannel (see
+ * DmgWifiChannel::SetScenarioModel). The manager moves both ends of the
+ * link along their current velocity, at PredictionSteps instants of the
+ * horizon, and asks the channel for the gain of the obstacles in the way
+ * (DmgWifiChannel::GetScenarioGain), to which it adds the change of the
+ * free space loss. The worst drop of the link budget over the horizon is
+ * applied to the SNR observed, so that the MCS is lowered before a human
+ * or a piece of furniture blocks the link, rather than after the retries
+ * and the Block Ack failures it causes. A predicted improvement is not
+ * applied: the MCS is raised when the receiver reports a better SNR.
+ *
+ * When the drop exceeds BlockageThreshold, the beam is likely to be lost
+ * altogether. The manager then fires the BlockagePredicted trace and, if
+ * BeamRetraining is enabled, starts a TXSS in a TXOP with the peer to look
+ * for a reflected path, at most once per RetrainingHoldOff.
+ *
+ * Without a mobility model on either end, or without obstacles in the
+ * scenario, the manager behaves as IdealDmgWifiManager.
+ */
+class PredictiveDmgWifiManager : public WifiRemoteStationManager
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  PredictiveDmgWifiManager ();
+  virtual ~PredictiveDmgWifiManager ();
+
+  void SetupPhy (const Ptr<WifiPhy> phy);
+
+  /**
+   * TracedCallback signature for the prediction of a blockage.
+   *
+   * \param address the MAC address of the remote station.
+   * \param drop the predicted drop of the link budget in dB.
+   * \param delay the time until the predicted drop.
+   */
+  typedef void (* BlockagePredictedCallback)(Mac48Address address, double drop, Time delay);
+
+
+private:
+  //overridden from base class
+  void DoInitialize (void);
+  void DoDispose (void);
+  WifiRemoteStation* DoCreateStation (void) const;
+  void DoReportRxOk (WifiRemoteStation *station,
+                     double rxSnr, WifiMode txMode);
+  void DoReportRtsFailed (WifiRemoteStation *station);
+  void DoReportDataFailed (WifiRemoteStation *station);
+  void DoReportRtsOk (WifiRemoteStation *station,
+                      double ctsSnr, WifiMode ctsMode, double rtsSnr);
+  void DoReportDataOk (WifiRemoteStation *station, double ackSnr, WifiMode ackMode,
+                       double dataSnr, uint16_t dataChannelWidth, uint8_t dataNss);
+  void DoReportAmpduTxStatus (WifiRemoteStation *station,
+                              uint8_t nSuccessfulMpdus, uint8_t nFailedMpdus,
+                              double rxSnr, double dataSnr, uint16_t dataChannelWidth, uint8_t dataNss);
+  void DoReportFinalRtsFailed (WifiRemoteStation *station);
+  void DoReportFinalDataFailed (WifiRemoteStation *station);
+  WifiTxVector DoGetDataTxVector (WifiRemoteStation *station);
+  WifiTxVector DoGetRtsTxVector (WifiRemoteStation *station);
+  bool IsLowLatency (void) const;
+
+  /**
+   * Reset the station, invoked if the maximum amount of retries has failed.
+   */
+  void Reset (WifiRemoteStation *station) const;
+
+  /**
+   * Return the minimum SNR needed to successfully transmit
+   * data with this WifiTxVector at the specified BER.
+   *
+   * \param txVector WifiTxVector (containing valid mode, and width)
+   *
+   * \return the minimum SNR for the given WifiTxVector in linear scale
+   */
+  double GetSnrThreshold (WifiTxVector &txVector) const;
+  /**
+   * Adds a pair of WifiTxVector and the minimum SNR for that given vector
+   * to the list.
+   *
+   * \param txVector the WifiTxVector storing mode, and channel width.
+   * \param snr the minimum SNR for the given txVector in linear scale
+   */
+  void AddSnrThreshold (WifiTxVector txVector, double snr);
+
+  /**
+   * Find the mobility model of the remote station among the devices
+   * attached to the channel.
+   *
+   * \param station the remote station.
+   * \return the mobility model of the remote station, or 0 if none.
+   */
+  Ptr<MobilityModel> LookupMobility (PredictiveDmgWifiRemoteStation *station) const;
+  /**
+   * Return the link budget between two positions, up to a constant: the
+   * free space gain relative to one meter plus the gain of the obstacles.
+   *
+   * \param a the position of one end of the link.
+   * \param b the position of the other end of the link.
+   * \return the link budget in dB.
+   */
+  double GetLinkBudget (Vector a, Vector b) const;
+  /**
+   * Predict the worst drop of the link budget with the remote station over
+   * the prediction horizon, and prepare a beam re-training if the link is
+   * about to be blocked.
+   *
+   * \param station the remote station.
+   */
+  void UpdatePrediction (PredictiveDmgWifiRemoteStation *station);
+  /**
+   * Start a TXSS with the remote station, if the MAC is a DMG MAC.
+   *
+   * \param address the address of the remote station.
+   */
+  void StartBeamRetraining (Mac48Address address);
+
+  /**
+   * A vector of <snr, WifiTxVector> pair holding the minimum SNR for the
+   * WifiTxVector
+   */
+  typedef std::vector<std::pair<double, WifiTxVector> > Thresholds;
+
+  double m_ber;                   //!< The maximum Bit Error Rate acceptable at any transmission mode
+  Thresholds m_thresholds;        //!< List of WifiTxVector and the minimum SNR pair
+  Time m_horizon;                 //!< How far ahead the link budget is predicted
+  uint32_t m_steps;               //!< Number of instants of the horizon at which the link budget is predicted
+  double m_blockageThreshold;     //!< Drop of the link budget, in dB, taken for a blockage
+  bool m_beamRetraining;          //!< Whether to re-train the beam when a blockage is predicted
+  Time m_retrainingHoldOff;       //!< Minimum time between two re-trainings with the same station
+  Ptr<DmgWifiChannel> m_channel;  //!< The channel, aware of the obstacles of the room
+  /**
+   * Trace callback for rate change with particular remote station.
+   * \param Mac48Address The MAC address of the remote station.
+   * \param Mcs The new MCS index to use with the remote station for data coomunication.
+   */
+  TracedCallback<Mac48Address, uint16_t> m_mcsChanged;
+  /**
+   * Trace callback for the prediction of a blockage of the link with a
+   * particular remote station.
+   */
+  TracedCallback<Mac48Address, double, Time> m_blockagePredicted;
+};
+
+} //namespace ns3
+
+#endif /* PREDICTIVE_DMG_WIFI_MANAGER_H */
@@ -955,6 +955,27 @@ RegularWifiMac::Enqueue (Ptr<Packet> packet,
                                       << ") does not support Enqueue() with from address");
 }
 
+void
+RegularWifiMac::EnqueueBurst (const std::vector<Ptr<Packet> > &packets, Mac48Address to)
+{
+  NS_LOG_FUNCTION (this << packets.size () << to);
+  // request the channel access once all the packets are queued
+  m_txop->StartBurst ();
+  for (EdcaQueues::const_iterator i = m_edca.begin (); i != m_edca.end (); ++i)
+    {
+      i->second->StartBurst ();
+    }
+  for (const auto &packet : packets)
+    {
+      Enqueue (packet, to);
+    }
+  m_txop->EndBurst ();
+  for (EdcaQueues::const_iterator i = m_edca.begin (); i != m_edca.end (); ++i)
+    {
+      i->second->EndBurst ();
+    }
+}
+
 bool
 RegularWifiMac::SupportsSendFrom (void) const
 {
@@ -152,6 +152,7 @@ public:
 
   // Should be implemented by child classes
   virtual void Enqueue (Ptr<Packet> packet, Mac48Address to) = 0;
+  virtual void EnqueueBurst (const std::vector<Ptr<Packet> > &packets, Mac48Address to);
 
   /**
    * Enable or disable CTS-to-self feature.
@@ -90,6 +90,8 @@ Txop::Txop ()
     m_cw (0),
     m_backoff (0),
     m_accessRequested (false),
+    m_burst (false),
+    m_burstQueued (false),
     m_backoffSlots (0),
     m_backoffStart (Seconds (0.0)),
     //// WIGIG ////
@@ -397,9 +399,34 @@ Txop::Queue (Ptr<Packet> packet, const WifiMacHeader &hdr)
       GenerateBackoff ();
     }
   m_queue->Enqueue (Create<WifiMacQueueItem> (packet, hdr));
+  if (m_burst)
+    {
+      m_burstQueued = true;
+      return;
+    }
   StartAccessIfNeeded ();
 }
 
+void
+Txop::StartBurst (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_burst = true;
+  m_burstQueued = false;
+}
+
+void
+Txop::EndBurst (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_burst = false;
+  if (m_burstQueued)
+    {
+      m_burstQueued = false;
+      StartAccessIfNeeded ();
+    }
+}
+
 int64_t
 Txop::AssignStreams (int64_t stream)
 {
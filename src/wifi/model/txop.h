@@ -253,6 +253,16 @@ public:
    * can be sent safely.
    */
   virtual void Queue (Ptr<Packet> packet, const WifiMacHeader &hdr);
+  /**
+   * Start a burst of packets: until EndBurst is called, Queue only stores
+   * the packets, without requesting the channel access.
+   */
+  void StartBurst (void);
+  /**
+   * End a burst of packets, and request the channel access if packets
+   * have been queued since StartBurst was called.
+   */
+  void EndBurst (void);
 
   /**
    * Sends CF frame to STA with address <i>addr</i>.
@@ -593,6 +603,8 @@ TxOk m_txOkNoAckCallback; 							//!< the transmit OK No ACK callback
   uint32_t m_cw;           //!< the current contention window
   uint32_t m_backoff;      //!< the current backoff
   bool m_accessRequested;  //!< flag whether channel access is already requested
+  bool m_burst;            //!< flag whether a burst of packets is being queued
+  bool m_burstQueued;      //!< flag whether packets have been queued during the burst
   uint32_t m_backoffSlots; //!< the number of backoff slots
   /**
    * the backoffStart variable is used to keep track of the
@@ -61,8 +61,15 @@ WifiMacQueue::GetTypeId (void)
   return tid;
 }
 
+/// The order of the first item inserted in an empty queue
+static const uint64_t WIFI_MAC_QUEUE_ORDER_START = uint64_t (1) << 62;
+/// The distance between the orders of the items at the ends of the queue
+static const uint64_t WIFI_MAC_QUEUE_ORDER_STEP = uint64_t (1) << 20;
+
 WifiMacQueue::WifiMacQueue ()
-  : m_expiredPacketsPresent (false),
+  : m_frontOrder (WIFI_MAC_QUEUE_ORDER_START),
+    m_backOrder (WIFI_MAC_QUEUE_ORDER_START),
+    m_expiredPacketsPresent (false),
     NS_LOG_TEMPLATE_DEFINE ("WifiMacQueue")
 {
 }
@@ -106,6 +113,132 @@ WifiMacQueue::TtlExceeded (ConstIterator &it)
   return false;
 }
 
+bool
+WifiMacQueue::DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item)
+{
+  if (!Queue<WifiMacQueueItem>::DoEnqueue (pos, item))
+    {
+      return false;
+    }
+  AddToIndex (std::prev (pos));
+  return true;
+}
+
+Ptr<WifiMacQueueItem>
+WifiMacQueue::DoDequeue (ConstIterator pos)
+{
+  if (QueueBase::GetNPackets () > 0)
+    {
+      RemoveFromIndex (pos);
+    }
+  return Queue<WifiMacQueueItem>::DoDequeue (pos);
+}
+
+Ptr<WifiMacQueueItem>
+WifiMacQueue::DoRemove (ConstIterator pos)
+{
+  if (QueueBase::GetNPackets () > 0)
+    {
+      RemoveFromIndex (pos);
+    }
+  return Queue<WifiMacQueueItem>::DoRemove (pos);
+}
+
+void
+WifiMacQueue::AddToIndex (ConstIterator it)
+{
+  // give the item an order between the orders of its neighbours
+  uint64_t order;
+  if (m_orders.empty ())
+    {
+      order = m_frontOrder = m_backOrder = WIFI_MAC_QUEUE_ORDER_START;
+    }
+  else if (std::next (it) == end ())
+    {
+      if (m_backOrder > UINT64_MAX - WIFI_MAC_QUEUE_ORDER_STEP)
+        {
+          Renumber ();
+        }
+      order = m_backOrder += WIFI_MAC_QUEUE_ORDER_STEP;
+    }
+  else if (it == begin ())
+    {
+      if (m_frontOrder < WIFI_MAC_QUEUE_ORDER_STEP)
+        {
+          Renumber ();
+        }
+      order = m_frontOrder -= WIFI_MAC_QUEUE_ORDER_STEP;
+    }
+  else
+    {
+      if (GetOrder (std::next (it)) - GetOrder (std::prev (it)) < 2)
+        {
+          Renumber ();
+        }
+      order = GetOrder (std::prev (it)) + (GetOrder (std::next (it)) - GetOrder (std::prev (it))) / 2;
+    }
+  m_orders[&*it] = order;
+
+  const WifiMacHeader &hdr = (*it)->GetHeader ();
+  if (hdr.IsQosData ())
+    {
+      m_subQueues[QueueId (hdr.GetAddr1 (), hdr.GetQosTid ())][order] = it;
+    }
+}
+
+void
+WifiMacQueue::RemoveFromIndex (ConstIterator it)
+{
+  auto order = m_orders.find (&*it);
+  NS_ASSERT (order != m_orders.end ());
+  const WifiMacHeader &hdr = (*it)->GetHeader ();
+  if (hdr.IsQosData ())
+    {
+      m_subQueues[QueueId (hdr.GetAddr1 (), hdr.GetQosTid ())].erase (order->second);
+    }
+  m_orders.erase (order);
+}
+
+void
+WifiMacQueue::Renumber (void)
+{
+  NS_LOG_FUNCTION (this);
+  // the items being inserted are not in the index yet, and are numbered later
+  m_frontOrder = m_backOrder = WIFI_MAC_QUEUE_ORDER_START;
+  for (auto &subQueue : m_subQueues)
+    {
+      subQueue.second.clear ();
+    }
+  bool first = true;
+  for (ConstIterator it = begin (); it != end (); it++)
+    {
+      auto order = m_orders.find (&*it);
+      if (order == m_orders.end ())
+        {
+          continue;
+        }
+      if (!first)
+        {
+          m_backOrder += WIFI_MAC_QUEUE_ORDER_STEP;
+        }
+      first = false;
+      order->second = m_backOrder;
+      const WifiMacHeader &hdr = (*it)->GetHeader ();
+      if (hdr.IsQosData ())
+        {
+          m_subQueues[QueueId (hdr.GetAddr1 (), hdr.GetQosTid ())][m_backOrder] = it;
+        }
+    }
+}
+
+uint64_t
+WifiMacQueue::GetOrder (ConstIterator it) const
+{
+  auto order = m_orders.find (&*it);
+  NS_ASSERT (order != m_orders.end ());
+  return order->second;
+}
+
 bool
 WifiMacQueue::Enqueue (Ptr<WifiMacQueueItem> item)
 {
@@ -344,24 +477,26 @@ WifiMacQueue::ConstIterator
 WifiMacQueue::PeekByTidAndAddress (uint8_t tid, Mac48Address dest, ConstIterator pos) const
 {
   NS_LOG_FUNCTION (this << +tid << dest);
-  ConstIterator it = (pos != EMPTY ? pos : begin ());
-  while (it != end ())
+  auto subQueue = m_subQueues.find (QueueId (dest, tid));
+  if (subQueue == m_subQueues.end () || pos == end ())
+    {
+      NS_LOG_DEBUG ("The queue is empty");
+      return end ();
+    }
+  // the sub-queue holds the QoS data frames for the given receiver and TID
+  // in their order in the queue, so search from the order of the given position
+  SubQueue::const_iterator it = (pos != EMPTY ? subQueue->second.lower_bound (GetOrder (pos))
+                                              : subQueue->second.begin ());
+  while (it != subQueue->second.end ())
     {
       // skip packets that stayed in the queue for too long. They will be
       // actually removed from the queue by the next call to a non-const method
-      if (Simulator::Now () <= (*it)->GetTimeStamp () + m_maxDelay)
+      if (Simulator::Now () <= (*it->second)->GetTimeStamp () + m_maxDelay)
         {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
-              && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              return it;
-            }
-        }
-      else
-        {
-          // signal the presence of expired packets
-          m_expiredPacketsPresent = true;
+          return it->second;
         }
+      // signal the presence of expired packets
+      m_expiredPacketsPresent = true;
       it++;
     }
   NS_LOG_DEBUG ("The queue is empty");
@@ -494,20 +629,19 @@ uint32_t
 WifiMacQueue::GetNPacketsByTidAndAddress (uint8_t tid, Mac48Address dest)
 {
   NS_LOG_FUNCTION (this << dest);
-  uint32_t nPackets = 0;
-  for (ConstIterator it = begin (); it != end (); )
+  auto subQueue = m_subQueues.find (QueueId (dest, tid));
+  if (subQueue == m_subQueues.end ())
     {
-      if (!TtlExceeded (it))
-        {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
-              && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              nPackets++;
-            }
-
-          it++;
-        }
+      NS_LOG_DEBUG ("returns 0");
+      return 0;
+    }
+  // remove the packets of the sub-queue that stayed in the queue for too long
+  for (SubQueue::iterator it = subQueue->second.begin (); it != subQueue->second.end (); )
+    {
+      ConstIterator item = (it++)->second;
+      TtlExceeded (item);
     }
+  uint32_t nPackets = subQueue->second.size ();
   NS_LOG_DEBUG ("returns " << nPackets);
   return nPackets;
 }
@@ -26,6 +26,8 @@
 
 #include "wifi-mac-queue-item.h"
 #include "ns3/queue.h"
+#include <map>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -53,6 +55,11 @@ extern template class Queue<WifiMacQueueItem>;
  * to verify whether or not it should be dropped. If
  * dot11EDCATableMSDULifetime has elapsed, it is dropped.
  * Otherwise, it is returned to the caller.
+ *
+ * Besides the FIFO order of all the items, which the lifetime and the
+ * drop policy use, the queue indexes the QoS data frames by receiver
+ * address and TID, so that the frames for the peer of a service period
+ * are found without scanning the frames for the other stations.
  */
 class WifiMacQueue : public Queue<WifiMacQueueItem>
 {
@@ -313,6 +320,61 @@ private:
    */
   bool TtlExceeded (ConstIterator &it);
 
+  /// The receiver address and the TID of the QoS data frames in a sub-queue
+  typedef std::pair<Mac48Address, uint8_t> QueueId;
+  /// The items of a sub-queue, by their order in the queue
+  typedef std::map<uint64_t, ConstIterator> SubQueue;
+
+  /**
+   * Insert an item in the queue and in its sub-queue.
+   *
+   * \param pos the position before which the item is to be inserted
+   * \param item the item
+   * \return true if success, false if the packet has been dropped
+   */
+  bool DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item);
+  /**
+   * Dequeue the item at the given position from the queue and from its sub-queue.
+   *
+   * \param pos the position of the item
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> DoDequeue (ConstIterator pos);
+  /**
+   * Remove the item at the given position from the queue and from its sub-queue.
+   *
+   * \param pos the position of the item
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> DoRemove (ConstIterator pos);
+  /**
+   * Add the item at the given position to the index.
+   *
+   * \param it the position of the item
+   */
+  void AddToIndex (ConstIterator it);
+  /**
+   * Remove the item at the given position from the index.
+   *
+   * \param it the position of the item
+   */
+  void RemoveFromIndex (ConstIterator it);
+  /**
+   * Number the items in their FIFO order again, when no order is left
+   * between two items.
+   */
+  void Renumber (void);
+  /**
+   * \param it the position of an item
+   * \return the order of the item in the queue
+   */
+  uint64_t GetOrder (ConstIterator it) const;
+
+  std::unordered_map<const Ptr<WifiMacQueueItem> *, uint64_t> m_orders; //!< The order of each item, by position
+  std::map<QueueId, SubQueue> m_subQueues;                               //!< The QoS data frames by receiver and TID
+  uint64_t m_frontOrder;                                                 //!< The order of the first item
+  uint64_t m_backOrder;                                                  //!< The order of the last item
+
   Time m_maxDelay;                          //!< Time to live for packets in the queue
   DropPolicy m_dropPolicy;                  //!< Drop behavior of queue
   mutable bool m_expiredPacketsPresent;     //!< True if expired packets are in the queue
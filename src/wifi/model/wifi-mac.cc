@@ -237,6 +237,16 @@ WifiMac::GetMaxPropagationDelay (void) const
   return m_maxPropagationDelay;
 }
 
+void
+WifiMac::EnqueueBurst (const std::vector<Ptr<Packet> > &packets, Mac48Address to)
+{
+  NS_LOG_FUNCTION (this << packets.size () << to);
+  for (const auto &packet : packets)
+    {
+      Enqueue (packet, to);
+    }
+}
+
 void
 WifiMac::NotifyTx (Ptr<const Packet> packet)
 {
@@ -192,6 +192,15 @@ public:
    * access it granted to this MAC.
    */
   virtual void Enqueue (Ptr<Packet> packet, Mac48Address to) = 0;
+  /**
+   * \param packets the packets to send, in order.
+   * \param to the address to which the packets should be sent.
+   *
+   * Enqueue a burst of packets as Enqueue does for each of them. The
+   * default implementation calls Enqueue for each packet; a MAC may
+   * request the channel access once for the whole burst.
+   */
+  virtual void EnqueueBurst (const std::vector<Ptr<Packet> > &packets, Mac48Address to);
   /**
    * \return if this MAC supports sending from arbitrary address.
    *
@@ -24,6 +24,7 @@
 #include "ns3/log.h"
 #include "ns3/node.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "wifi-net-device.h"
 #include "wifi-phy.h"
 #include "wifi-mac.h"
@@ -83,12 +84,20 @@ WifiNetDevice::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&WifiNetDevice::GetHeConfiguration),
                    MakePointerChecker<HeConfiguration> ())
+    .AddAttribute ("BurstPacketTraces",
+                   "Whether the MacTx trace of the MAC fires for each packet of "
+                   "a burst sent with SendBurst. Disabling it saves a trace "
+                   "call per packet on saturated links.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&WifiNetDevice::m_burstPacketTraces),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
 
 WifiNetDevice::WifiNetDevice ()
-  : m_configComplete (false)
+  : m_configComplete (false),
+    m_burstPacketTraces (true)
 {
   NS_LOG_FUNCTION_NOARGS ();
 }
@@ -335,6 +344,29 @@ WifiNetDevice::Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolN
   return true;
 }
 
+uint32_t
+WifiNetDevice::SendBurst (const std::vector<Ptr<Packet> > &packets, const Address& dest, uint16_t protocolNumber)
+{
+  NS_LOG_FUNCTION (this << packets.size () << dest << protocolNumber);
+  NS_ASSERT (Mac48Address::IsMatchingType (dest));
+
+  Mac48Address realTo = Mac48Address::ConvertFrom (dest);
+
+  LlcSnapHeader llc;
+  llc.SetType (protocolNumber);
+  for (const auto &packet : packets)
+    {
+      packet->AddHeader (llc);
+      if (m_burstPacketTraces)
+        {
+          m_mac->NotifyTx (packet);
+        }
+    }
+
+  m_mac->EnqueueBurst (packets, realTo);
+  return packets.size ();
+}
+
 Ptr<Node>
 WifiNetDevice::GetNode (void) const
 {
@@ -129,6 +129,7 @@ public:
   bool IsPointToPoint (void) const;
   bool IsBridge (void) const;
   bool Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber);
+  uint32_t SendBurst (const std::vector<Ptr<Packet> > &packets, const Address& dest, uint16_t protocolNumber);
   Ptr<Node> GetNode (void) const;
   void SetNode (const Ptr<Node> node);
   bool NeedsArp (void) const;
@@ -204,6 +205,7 @@ private:
   TracedCallback<> m_linkChanges; //!< link change callback
   mutable uint16_t m_mtu; //!< MTU
   bool m_configComplete; //!< configuration complete
+  bool m_burstPacketTraces; //!< whether the MacTx trace fires for each packet of a burst
 
   
   //yubing: pkt identifier
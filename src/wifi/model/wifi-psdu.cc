@@ -112,10 +112,7 @@ WifiPsdu::GetPacket (void) const
     }
   else
     {
-      for (auto& mpdu : m_mpduList)
-        {
-          MpduAggregator::Aggregate (mpdu, packet, false);
-        }
+      MpduAggregator::Aggregate (m_mpduList, packet);
     }
   return packet;
 }
@@ -22,6 +22,7 @@
 #define WIFI_REMOTE_STATION_MANAGER_H
 
 #include <array>
+#include <unordered_map>
 #include "ns3/traced-callback.h"
 #include "ns3/object.h"
 #include "ns3/data-rate.h"
@@ -160,13 +161,13 @@ public:
   };
 
   /**
-   * A vector of WifiRemoteStations
+   * A hash table of WifiRemoteStations, indexed by their address
    */
-  typedef std::vector <WifiRemoteStation *> Stations;
+  typedef std::unordered_map <Mac48Address, WifiRemoteStation *, Mac48AddressHash> Stations;
   /**
-   * A vector of WifiRemoteStationStates
+   * A hash table of WifiRemoteStationStates, indexed by their address
    */
-  typedef std::vector <WifiRemoteStationState *> StationStates;
+  typedef std::unordered_map <Mac48Address, WifiRemoteStationState *, Mac48AddressHash> StationStates;
 
   /**
    * Set up PHY associated with this device since it is the object that
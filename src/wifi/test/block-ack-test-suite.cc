@@ -22,6 +22,7 @@
 #include "ns3/string.h"
 #include "ns3/qos-utils.h"
 #include "ns3/ctrl-headers.h"
+#include "ns3/block-ack-scoreboard.h"
 #include "ns3/packet.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/ap-wifi-mac.h"
@@ -546,6 +547,120 @@ OriginatorBlockAckWindowTest::DoRun (void)
 }
 
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test for the scoreboard of the MPDUs waiting for a block ack
+ */
+class BlockAckScoreboardTest : public TestCase
+{
+public:
+  BlockAckScoreboardTest ();
+private:
+  virtual void DoRun ();
+  /**
+   * Create a QoS data frame.
+   * \param seq the sequence number
+   * \param frag the fragment number
+   * \return the MPDU
+   */
+  Ptr<WifiMacQueueItem> CreateMpdu (uint16_t seq, uint8_t frag = 0) const;
+  /**
+   * Check the sequence numbers of the MPDUs in the scoreboard, in order.
+   * \param scoreboard the scoreboard
+   * \param startingSeq the starting sequence number
+   * \param expected the expected sequence numbers
+   * \param step the name of the step of the test
+   */
+  void Check (const BlockAckScoreboard &scoreboard, uint16_t startingSeq,
+              std::vector<uint16_t> expected, std::string step);
+};
+
+BlockAckScoreboardTest::BlockAckScoreboardTest ()
+  : TestCase ("Check the correctness of the scoreboard of the block ack originator")
+{
+}
+
+Ptr<WifiMacQueueItem>
+BlockAckScoreboardTest::CreateMpdu (uint16_t seq, uint8_t frag) const
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetSequenceNumber (seq);
+  hdr.SetFragmentNumber (frag);
+  return Create<WifiMacQueueItem> (Create<Packet> (), hdr);
+}
+
+void
+BlockAckScoreboardTest::Check (const BlockAckScoreboard &scoreboard, uint16_t startingSeq,
+                               std::vector<uint16_t> expected, std::string step)
+{
+  std::vector<Ptr<WifiMacQueueItem>> mpdus;
+  scoreboard.GetMpdus (startingSeq, mpdus);
+  NS_TEST_ASSERT_MSG_EQ (mpdus.size (), expected.size (), step << ": wrong number of MPDUs");
+  for (std::size_t i = 0; i < mpdus.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (mpdus[i]->GetHeader ().GetSequenceNumber (), expected[i],
+                             step << ": wrong MPDU at position " << i);
+    }
+  if (!expected.empty ())
+    {
+      NS_TEST_EXPECT_MSG_EQ (scoreboard.Peek (startingSeq)->GetHeader ().GetSequenceNumber (), expected[0],
+                             step << ": wrong first MPDU");
+    }
+}
+
+void
+BlockAckScoreboardTest::DoRun (void)
+{
+  uint16_t startingSeq = 4090;
+  BlockAckScoreboard scoreboard;
+  scoreboard.Init (16);
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.GetNSlots (), 64, "Wrong number of slots");
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.IsEmpty (), true, "The scoreboard must be empty");
+  NS_TEST_EXPECT_MSG_EQ ((scoreboard.Peek (startingSeq) == 0), true, "No MPDU expected");
+
+  // store MPDUs out of order, across the end of the sequence number space
+  uint16_t seqs[] = {2, 4090, 4095, 0, 4093};
+  for (uint16_t seq : seqs)
+    {
+      NS_TEST_EXPECT_MSG_EQ (scoreboard.Insert (CreateMpdu (seq), startingSeq), true, "MPDU " << seq << " not stored");
+    }
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.Insert (CreateMpdu (4095), startingSeq), false, "Duplicate MPDU stored");
+  Check (scoreboard, startingSeq, {4090, 4093, 4095, 0, 2}, "Insert");
+
+  // the fragments of an MSDU are sorted by fragment number and count as one packet
+  scoreboard.Insert (CreateMpdu (4093, 2), startingSeq);
+  scoreboard.Insert (CreateMpdu (4093, 1), startingSeq);
+  Check (scoreboard, startingSeq, {4090, 4093, 4093, 4093, 4095, 0, 2}, "Fragments");
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.GetNSequenceNumbers (), 5, "Wrong number of packets");
+
+  scoreboard.Remove (4093);
+  Check (scoreboard, startingSeq, {4090, 4095, 0, 2}, "Remove");
+
+  // an MPDU beyond the last slot doubles the number of slots
+  scoreboard.Insert (CreateMpdu ((startingSeq + 100) % SEQNO_SPACE_SIZE), startingSeq);
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.GetNSlots (), 128, "Wrong number of slots");
+  Check (scoreboard, startingSeq, {4090, 4095, 0, 2, 94}, "Grow");
+
+  scoreboard.RemoveUpTo (startingSeq, 0);
+  Check (scoreboard, startingSeq, {2, 94}, "RemoveUpTo");
+
+  // the MPDUs which became old leave room for new ones
+  scoreboard.Remove (94);
+  startingSeq = 1000;
+  scoreboard.Insert (CreateMpdu (1026), startingSeq);
+  scoreboard.Insert (CreateMpdu (1000), startingSeq);
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.GetNSlots (), 128, "Wrong number of slots");
+  Check (scoreboard, startingSeq, {1000, 1026}, "Replace old MPDUs");
+
+  scoreboard.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (scoreboard.IsEmpty (), true, "The scoreboard must be empty");
+  Check (scoreboard, startingSeq, {}, "Clear");
+}
+
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -950,6 +1065,7 @@ BlockAckTestSuite::BlockAckTestSuite ()
   AddTestCase (new PacketBufferingCaseA, TestCase::QUICK);
   AddTestCase (new PacketBufferingCaseB, TestCase::QUICK);
   AddTestCase (new OriginatorBlockAckWindowTest, TestCase::QUICK);
+  AddTestCase (new BlockAckScoreboardTest, TestCase::QUICK);
   AddTestCase (new CtrlBAckResponseHeaderTest, TestCase::QUICK);
   AddTestCase (new BlockAckAggregationDisabledTest (false), TestCase::QUICK);
   AddTestCase (new BlockAckAggregationDisabledTest (true), TestCase::QUICK);
@@ -0,0 +1,403 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/dmg-wifi-helper.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/dmg-wifi-channel.h"
+#include "ns3/obstacle.h"
+#include "ns3/codebook-analytical.h"
+#include "ns3/node-container.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * Add the DMG SC modes, from MCS1 to MCS12, to the modes supported by a
+ * remote station, the way the DMG MAC does once it knows the capabilities
+ * of the station.
+ * \param device the device of the remote station manager
+ * \param address the address of the remote station
+ */
+static void
+AddScSupportedModes (Ptr<WifiNetDevice> device, Mac48Address address)
+{
+  for (uint8_t mcs = 1; mcs <= 12; mcs++)
+    {
+      device->GetRemoteStationManager ()->AddSupportedMode (address, device->GetPhy ()->GetMode (mcs));
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief DMG TXVECTOR Cache Test
+ *
+ * The DMG rate managers return the TXVECTOR they built last while the SNR
+ * of the link does not change. Check that it matches the TXVECTOR built
+ * for a new remote station, which the manager has not cached yet, as the
+ * SNR and the default power level change.
+ */
+class DmgTxVectorCacheTest : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param manager the type of the remote station manager
+   */
+  DmgTxVectorCacheTest (std::string manager);
+
+  virtual void DoRun (void);
+private:
+  /**
+   * Report the SNR of the link with a remote station, the way the manager
+   * under test learns it.
+   * \param manager the remote station manager
+   * \param address the address of the remote station
+   * \param snr the SNR, in linear scale
+   */
+  void ReportSnr (Ptr<WifiRemoteStationManager> manager, Mac48Address address, double snr);
+  /**
+   * Get the TXVECTOR of a data frame to a remote station.
+   * \param manager the remote station manager
+   * \param address the address of the remote station
+   * \return the TXVECTOR
+   */
+  WifiTxVector GetDataTxVector (Ptr<WifiRemoteStationManager> manager, Mac48Address address);
+  /**
+   * Report an SNR to a station cached since the start of the test and to a
+   * new station, and check that both get the same TXVECTOR.
+   * \param device the device of the remote station manager
+   * \param cached the address of the remote station cached
+   * \param snr the SNR, in linear scale
+   */
+  void CheckTxVector (Ptr<WifiNetDevice> device, Mac48Address cached, double snr);
+  /**
+   * Run the checks once the device is initialized.
+   * \param device the device of the remote station manager
+   */
+  void RunChecks (Ptr<WifiNetDevice> device);
+
+  std::string m_manager; ///< the type of the remote station manager
+};
+
+DmgTxVectorCacheTest::DmgTxVectorCacheTest (std::string manager)
+  : TestCase ("Check the TXVECTOR cached by " + manager),
+    m_manager (manager)
+{
+}
+
+void
+DmgTxVectorCacheTest::ReportSnr (Ptr<WifiRemoteStationManager> manager, Mac48Address address, double snr)
+{
+  if (m_manager == "ns3::CbtraaDmgWifiManager")
+    {
+      manager->RecordLinkSnr (address, snr);
+      return;
+    }
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetAddr1 (address);
+  hdr.SetQosTid (0);
+  WifiTxVector txVector = GetDataTxVector (manager, address);
+  manager->ReportDataOk (address, &hdr, snr, txVector.GetMode (), snr, txVector, 1000);
+}
+
+WifiTxVector
+DmgTxVectorCacheTest::GetDataTxVector (Ptr<WifiRemoteStationManager> manager, Mac48Address address)
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetAddr1 (address);
+  hdr.SetQosTid (0);
+  return manager->GetDataTxVector (hdr);
+}
+
+void
+DmgTxVectorCacheTest::CheckTxVector (Ptr<WifiNetDevice> device, Mac48Address cached, double snr)
+{
+  Ptr<WifiRemoteStationManager> manager = device->GetRemoteStationManager ();
+  ReportSnr (manager, cached, snr);
+  // twice, so that the second one comes from the cache
+  GetDataTxVector (manager, cached);
+  WifiTxVector txVector = GetDataTxVector (manager, cached);
+
+  Mac48Address fresh = Mac48Address::Allocate ();
+  AddScSupportedModes (device, fresh);
+  ReportSnr (manager, fresh, snr);
+  WifiTxVector expected = GetDataTxVector (manager, fresh);
+
+  NS_TEST_EXPECT_MSG_EQ (txVector.GetMode (), expected.GetMode (), "Unexpected mode for SNR " << snr);
+  NS_TEST_EXPECT_MSG_EQ (+txVector.GetTxPowerLevel (), +expected.GetTxPowerLevel (), "Unexpected power level for SNR " << snr);
+  NS_TEST_EXPECT_MSG_EQ (txVector.GetChannelWidth (), expected.GetChannelWidth (), "Unexpected channel width for SNR " << snr);
+  NS_TEST_EXPECT_MSG_EQ (txVector.GetPreambleType (), expected.GetPreambleType (), "Unexpected preamble for SNR " << snr);
+}
+
+void
+DmgTxVectorCacheTest::RunChecks (Ptr<WifiNetDevice> device)
+{
+  Ptr<WifiRemoteStationManager> manager = device->GetRemoteStationManager ();
+  Mac48Address cached = Mac48Address::Allocate ();
+  AddScSupportedModes (device, cached);
+
+  // from a high SNR down to a low one and back, with repetitions for the cache
+  double snrs[] = {1000.0, 1000.0, 30.0, 30.0, 3.0, 1000.0, 3.0, 3.0};
+  for (double snr : snrs)
+    {
+      CheckTxVector (device, cached, snr);
+    }
+
+  // a change of the power level invalidates the TXVECTOR cached
+  uint8_t level = manager->GetDefaultTxPowerLevel ();
+  manager->SetDefaultTxPowerLevel (level + 1);
+  CheckTxVector (device, cached, 3.0);
+  NS_TEST_EXPECT_MSG_EQ (+GetDataTxVector (manager, cached).GetTxPowerLevel (), level + 1,
+                         "The TXVECTOR cached ignores the power level");
+}
+
+void
+DmgTxVectorCacheTest::DoRun (void)
+{
+  DmgWifiHelper wifi;
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+  wifi.SetRemoteStationManager (m_manager);
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac");
+
+  NodeContainer nodes;
+  nodes.Create (1);
+  NetDeviceContainer devices = wifi.Install (wifiPhy, wifiMac, nodes);
+  Ptr<WifiNetDevice> device = DynamicCast<WifiNetDevice> (devices.Get (0));
+
+  // the manager is initialized with the node
+  Simulator::Schedule (Seconds (0), &DmgTxVectorCacheTest::RunChecks, this, device);
+  Simulator::Stop (MilliSeconds (1));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Predictive DMG Rate Adaptation Test
+ *
+ * A station moves behind a panel of the room, which will block its link
+ * with a static station within the prediction horizon. Check that the
+ * predictive manager of the static station fires BlockagePredicted and
+ * selects a lower MCS than the ideal manager for the same SNR while the
+ * link is still in line of sight.
+ */
+class PredictiveDmgWifiManagerTest : public TestCase
+{
+public:
+  PredictiveDmgWifiManagerTest ();
+
+  virtual void DoRun (void);
+private:
+  /**
+   * Record a predicted blockage.
+   * \param address the MAC address of the remote station
+   * \param drop the predicted drop of the link budget in dB
+   * \param delay the time until the predicted drop
+   */
+  void BlockagePredicted (Mac48Address address, double drop, Time delay);
+  /**
+   * Report the same SNR to both managers and compare the MCS they select.
+   */
+  void RunChecks (void);
+
+  Ptr<WifiNetDevice> m_predictive;    ///< the static device, with the predictive manager
+  Ptr<WifiNetDevice> m_ideal;         ///< the moving device, with the ideal manager
+  Ptr<DmgWifiChannel> m_channel;      ///< the channel, aware of the obstacles
+  uint32_t m_blockages;               ///< the number of blockages predicted
+  double m_drop;                      ///< the last drop predicted, in dB
+  Time m_delay;                       ///< the time until the last drop predicted
+};
+
+PredictiveDmgWifiManagerTest::PredictiveDmgWifiManagerTest ()
+  : TestCase ("Check that the predictive manager lowers the MCS before a blockage"),
+    m_blockages (0),
+    m_drop (0)
+{
+}
+
+void
+PredictiveDmgWifiManagerTest::BlockagePredicted (Mac48Address address, double drop, Time delay)
+{
+  NS_TEST_EXPECT_MSG_EQ (address, Mac48Address::ConvertFrom (m_ideal->GetAddress ()), "Blockage predicted for an unexpected station");
+  m_blockages++;
+  m_drop = drop;
+  m_delay = delay;
+}
+
+void
+PredictiveDmgWifiManagerTest::RunChecks (void)
+{
+  Vector position = m_predictive->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
+  Vector remote = m_ideal->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
+  NS_TEST_ASSERT_MSG_EQ (m_channel->GetScenarioGain (position, remote), 0,
+                         "The link should still be in line of sight");
+
+  // the same SNR on both links, 20 dB
+  double snr = 100;
+  Ptr<WifiRemoteStationManager> predictive = m_predictive->GetRemoteStationManager ();
+  Ptr<WifiRemoteStationManager> ideal = m_ideal->GetRemoteStationManager ();
+  Mac48Address predictiveAddress = Mac48Address::ConvertFrom (m_predictive->GetAddress ());
+  Mac48Address idealAddress = Mac48Address::ConvertFrom (m_ideal->GetAddress ());
+  AddScSupportedModes (m_predictive, idealAddress);
+  AddScSupportedModes (m_ideal, predictiveAddress);
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetQosTid (0);
+  hdr.SetAddr1 (idealAddress);
+  WifiTxVector predictiveTxVector = predictive->GetDataTxVector (hdr);
+  predictive->ReportDataOk (idealAddress, &hdr, snr, predictiveTxVector.GetMode (), snr, predictiveTxVector, 1000);
+  predictiveTxVector = predictive->GetDataTxVector (hdr);
+  hdr.SetAddr1 (predictiveAddress);
+  WifiTxVector idealTxVector = ideal->GetDataTxVector (hdr);
+  ideal->ReportDataOk (predictiveAddress, &hdr, snr, idealTxVector.GetMode (), snr, idealTxVector, 1000);
+  idealTxVector = ideal->GetDataTxVector (hdr);
+
+  NS_TEST_EXPECT_MSG_EQ (m_blockages, 1, "One blockage should have been predicted");
+  NS_TEST_EXPECT_MSG_GT (m_drop, 5, "The drop predicted should exceed the blockage threshold");
+  NS_TEST_EXPECT_MSG_GT (m_delay, Seconds (0), "The blockage should be predicted ahead");
+  NS_TEST_EXPECT_MSG_LT_OR_EQ (m_delay, MilliSeconds (200), "The blockage should be predicted within the horizon");
+  NS_TEST_EXPECT_MSG_LT (predictiveTxVector.GetMode ().GetMcsValue (), idealTxVector.GetMode ().GetMcsValue (),
+                         "The predictive manager should select a lower MCS before the blockage");
+}
+
+void
+PredictiveDmgWifiManagerTest::DoRun (void)
+{
+  // a panel halfway between the stations, which the moving station is about to hide behind
+  std::vector<Box> obstacles;
+  obstacles.push_back (Box (1.9, 2.1, 0.0, 1.0, 0.0, 3.0));
+  Ptr<Obstacle> room = CreateObject<Obstacle> ();
+  room->SetObstacleNumber (obstacles.size ());
+  room->SetPenetrationLossMode (room->m_obstaclePenetrationLoss_medium);
+  // AllocateObstacle_KnownBox dumps the obstacles to obstacleList.txt in the
+  // working directory, so put back the file found there, if any
+  std::ifstream previous ("obstacleList.txt");
+  bool existed = previous.is_open ();
+  std::stringstream saved;
+  if (existed)
+    {
+      saved << previous.rdbuf ();
+      previous.close ();
+    }
+  room->AllocateObstacle_KnownBox (obstacles);
+  if (existed)
+    {
+      std::ofstream restored ("obstacleList.txt");
+      restored << saved.str ();
+    }
+  else
+    {
+      std::remove ("obstacleList.txt");
+    }
+
+  DmgWifiHelper wifi;
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  m_channel = wifiChannel.Create ();
+  m_channel->SetScenarioModel (room);
+  m_channel->SetAdHocMode (true);
+  m_channel->SetTGadChannelEnabler (true);
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (m_channel);
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac");
+
+  NodeContainer nodes;
+  nodes.Create (2);
+  wifi.SetRemoteStationManager ("ns3::PredictiveDmgWifiManager",
+                                "PredictionHorizon", TimeValue (MilliSeconds (200)),
+                                "PredictionSteps", UintegerValue (4),
+                                "BlockageThreshold", DoubleValue (5),
+                                "BeamRetraining", BooleanValue (false));
+  m_predictive = DynamicCast<WifiNetDevice> (wifi.Install (wifiPhy, wifiMac, nodes.Get (0)).Get (0));
+  wifi.SetRemoteStationManager ("ns3::IdealDmgWifiManager");
+  m_ideal = DynamicCast<WifiNetDevice> (wifi.Install (wifiPhy, wifiMac, nodes.Get (1)).Get (0));
+
+  // the moving station crosses the shadow of the panel at 10 m/s, from 150 ms
+  Ptr<ConstantPositionMobilityModel> position = CreateObject<ConstantPositionMobilityModel> ();
+  position->SetPosition (Vector (0.0, 0.5, 1.0));
+  nodes.Get (0)->AggregateObject (position);
+  Ptr<ConstantVelocityMobilityModel> velocity = CreateObject<ConstantVelocityMobilityModel> ();
+  velocity->SetPosition (Vector (4.0, -1.5, 1.0));
+  velocity->SetVelocity (Vector (0.0, 10.0, 0.0));
+  nodes.Get (1)->AggregateObject (velocity);
+
+  m_predictive->GetRemoteStationManager ()->TraceConnectWithoutContext ("BlockagePredicted",
+    MakeCallback (&PredictiveDmgWifiManagerTest::BlockagePredicted, this));
+
+  Simulator::Schedule (Seconds (0), &PredictiveDmgWifiManagerTest::RunChecks, this);
+  Simulator::Stop (MilliSeconds (1));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief DMG Rate Adaptation Test Suite
+ */
+class DmgRateAdaptationTestSuite : public TestSuite
+{
+public:
+  DmgRateAdaptationTestSuite ();
+};
+
+DmgRateAdaptationTestSuite::DmgRateAdaptationTestSuite ()
+  : TestSuite ("wifi-dmg-rate-adaptation", UNIT)
+{
+  AddTestCase (new DmgTxVectorCacheTest ("ns3::IdealDmgWifiManager"), TestCase::QUICK);
+  AddTestCase (new DmgTxVectorCacheTest ("ns3::CbtraaDmgWifiManager"), TestCase::QUICK);
+  AddTestCase (new PredictiveDmgWifiManagerTest, TestCase::QUICK);
+}
+
+static DmgRateAdaptationTestSuite g_dmgRateAdaptationTestSuite; ///< the test suite
@@ -0,0 +1,275 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/dmg-wifi-helper.h"
+#include "ns3/dmg-ap-wifi-mac.h"
+#include "ns3/dmg-sta-wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/codebook-analytical.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/queue-item.h"
+#include "ns3/node-container.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/ssid.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Service Period Queue Test Item
+ */
+class ServicePeriodQueueTestItem : public QueueDiscItem
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param p the packet stored in this item
+   * \param addr the destination MAC address
+   */
+  ServicePeriodQueueTestItem (Ptr<Packet> p, const Address &addr);
+  virtual void AddHeader (void);
+  virtual bool Mark (void);
+};
+
+ServicePeriodQueueTestItem::ServicePeriodQueueTestItem (Ptr<Packet> p, const Address &addr)
+  : QueueDiscItem (p, addr, 0)
+{
+}
+
+void
+ServicePeriodQueueTestItem::AddHeader (void)
+{
+}
+
+bool
+ServicePeriodQueueTestItem::Mark (void)
+{
+  return false;
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief DMG Service Period Queue Test
+ *
+ * A DMG PCP/AP with one service period queue allocates a service period
+ * to the first of its two DMG STAs. Check that the PCP/AP maps the first
+ * STA to the service period queue when the service period starts, that it
+ * wakes this queue at the start of each service period and stops it at
+ * the end, and that the traffic of the second STA, sent in CBAP, keeps
+ * going through an access category queue which is not stopped with it.
+ */
+class DmgServicePeriodQueueTest : public TestCase
+{
+public:
+  DmgServicePeriodQueueTest ();
+
+  virtual void DoRun (void);
+private:
+  /**
+   * Allocate the service period once the first STA is associated.
+   * \param address the address of the PCP/AP
+   * \param aid the AID of the first STA
+   */
+  void StationAssociated (Mac48Address address, uint16_t aid);
+  /**
+   * A service period of the PCP/AP has started.
+   * \param source the address of the source of the service period
+   * \param destination the address of the destination of the service period
+   */
+  void ServicePeriodStarted (Mac48Address source, Mac48Address destination);
+  /**
+   * A service period of the PCP/AP has ended.
+   * \param source the address of the source of the service period
+   * \param destination the address of the destination of the service period
+   */
+  void ServicePeriodEnded (Mac48Address source, Mac48Address destination);
+  /**
+   * Check the transmission queues of the PCP/AP, once it is done with the
+   * start or the end of a service period.
+   * \param start whether the service period has started
+   */
+  void CheckQueues (bool start);
+  /**
+   * Select the transmission queue of a packet to a STA.
+   * \param sta the device of the STA
+   * \return the index of the transmission queue
+   */
+  std::size_t SelectQueue (Ptr<WifiNetDevice> sta) const;
+
+  Ptr<WifiNetDevice> m_ap;                 ///< the device of the PCP/AP
+  Ptr<WifiNetDevice> m_spSta;              ///< the device of the STA of the service period
+  Ptr<WifiNetDevice> m_cbapSta;            ///< the device of the STA served in CBAP
+  Ptr<NetDeviceQueueInterface> m_ndqi;     ///< the queue interface of the PCP/AP
+  uint32_t m_spStarted;                    ///< the number of service periods started
+  uint32_t m_spEnded;                      ///< the number of service periods ended
+};
+
+DmgServicePeriodQueueTest::DmgServicePeriodQueueTest ()
+  : TestCase ("Check the transmission queues dedicated to the peers of the service periods"),
+    m_spStarted (0),
+    m_spEnded (0)
+{
+}
+
+std::size_t
+DmgServicePeriodQueueTest::SelectQueue (Ptr<WifiNetDevice> sta) const
+{
+  Ptr<QueueItem> item = Create<ServicePeriodQueueTestItem> (Create<Packet> (1000), sta->GetAddress ());
+  return m_ndqi->GetSelectQueueCallback () (item);
+}
+
+void
+DmgServicePeriodQueueTest::StationAssociated (Mac48Address address, uint16_t aid)
+{
+  // the STA is only mapped to the service period queue once it is served
+  NS_TEST_EXPECT_MSG_LT (SelectQueue (m_spSta), 4, "The STA should not be mapped before its service period");
+  Ptr<DmgApWifiMac> apMac = DynamicCast<DmgApWifiMac> (m_ap->GetMac ());
+  apMac->AllocateSingleContiguousBlock (1, SERVICE_PERIOD_ALLOCATION, true, AID_AP, aid, 0, 3200);
+}
+
+void
+DmgServicePeriodQueueTest::ServicePeriodStarted (Mac48Address source, Mac48Address destination)
+{
+  NS_TEST_EXPECT_MSG_EQ (destination, Mac48Address::ConvertFrom (m_spSta->GetAddress ()), "Unexpected peer of the service period");
+  // the MAC maps the peer and wakes its queue after the trace
+  Simulator::ScheduleNow (&DmgServicePeriodQueueTest::CheckQueues, this, true);
+}
+
+void
+DmgServicePeriodQueueTest::ServicePeriodEnded (Mac48Address source, Mac48Address destination)
+{
+  NS_TEST_EXPECT_MSG_EQ (destination, Mac48Address::ConvertFrom (m_spSta->GetAddress ()), "Unexpected peer of the service period");
+  // the MAC stops the queue of the peer after the trace
+  Simulator::ScheduleNow (&DmgServicePeriodQueueTest::CheckQueues, this, false);
+}
+
+void
+DmgServicePeriodQueueTest::CheckQueues (bool start)
+{
+  NS_TEST_EXPECT_MSG_EQ (SelectQueue (m_spSta), 4, "The STA of the service period should be mapped to its queue");
+  std::size_t cbapQueue = SelectQueue (m_cbapSta);
+  NS_TEST_EXPECT_MSG_LT (cbapQueue, 4, "The STA served in CBAP should use an access category queue");
+  NS_TEST_EXPECT_MSG_EQ (m_ndqi->GetTxQueue (cbapQueue)->IsStopped (), false,
+                         "The traffic in CBAP should not be held back with the service period traffic");
+  if (start)
+    {
+      m_spStarted++;
+      NS_TEST_EXPECT_MSG_EQ (m_ndqi->GetTxQueue (4)->IsStopped (), false,
+                             "The queue should be woken at the start of the service period");
+    }
+  else
+    {
+      m_spEnded++;
+      NS_TEST_EXPECT_MSG_EQ (m_ndqi->GetTxQueue (4)->IsStopped (), true,
+                             "The queue should be stopped outside the service period");
+    }
+}
+
+void
+DmgServicePeriodQueueTest::DoRun (void)
+{
+  DmgWifiHelper wifi;
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211ad);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "DataMode", StringValue ("DMG_MCS12"));
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  wifiPhy.Set ("TxPowerStart", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerEnd", DoubleValue (10.0));
+  wifiPhy.Set ("TxPowerLevels", UintegerValue (1));
+  wifiPhy.Set ("ChannelNumber", UintegerValue (2));
+
+  NodeContainer nodes;
+  nodes.Create (3);
+
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  Ssid ssid = Ssid ("ServicePeriodQueue");
+  wifiMac.SetType ("ns3::DmgApWifiMac",
+                   "Ssid", SsidValue (ssid),
+                   "SSSlotsPerABFT", UintegerValue (8), "SSFramesPerSlot", UintegerValue (8),
+                   "BeaconInterval", TimeValue (MicroSeconds (102400)));
+  wifi.SetServicePeriodQueues (1);
+  m_ap = DynamicCast<WifiNetDevice> (wifi.Install (wifiPhy, wifiMac, nodes.Get (0)).Get (0));
+  wifi.SetServicePeriodQueues (0);
+  wifiMac.SetType ("ns3::DmgStaWifiMac",
+                   "Ssid", SsidValue (ssid), "ActiveProbing", BooleanValue (false));
+  m_spSta = DynamicCast<WifiNetDevice> (wifi.Install (wifiPhy, wifiMac, nodes.Get (1)).Get (0));
+  m_cbapSta = DynamicCast<WifiNetDevice> (wifi.Install (wifiPhy, wifiMac, nodes.Get (2)).Get (0));
+
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (1.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (0.0, 1.0, 0.0));
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  m_ndqi = m_ap->GetObject<NetDeviceQueueInterface> ();
+  NS_TEST_ASSERT_MSG_EQ (m_ndqi->GetNTxQueues (), 5, "Four access category queues and one service period queue expected");
+
+  m_spSta->GetMac ()->TraceConnectWithoutContext ("Assoc",
+    MakeCallback (&DmgServicePeriodQueueTest::StationAssociated, this));
+  m_ap->GetMac ()->TraceConnectWithoutContext ("ServicePeriodStarted",
+    MakeCallback (&DmgServicePeriodQueueTest::ServicePeriodStarted, this));
+  m_ap->GetMac ()->TraceConnectWithoutContext ("ServicePeriodEnded",
+    MakeCallback (&DmgServicePeriodQueueTest::ServicePeriodEnded, this));
+
+  Simulator::Stop (Seconds (1));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_GT (m_spStarted, 1, "The service periods should have started");
+  NS_TEST_EXPECT_MSG_GT (m_spEnded, 1, "The service periods should have ended");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief DMG Service Period Queue Test Suite
+ */
+class DmgServicePeriodQueueTestSuite : public TestSuite
+{
+public:
+  DmgServicePeriodQueueTestSuite ();
+};
+
+DmgServicePeriodQueueTestSuite::DmgServicePeriodQueueTestSuite ()
+  : TestSuite ("wifi-dmg-service-period-queue", UNIT)
+{
+  AddTestCase (new DmgServicePeriodQueueTest, TestCase::QUICK);
+}
+
+static DmgServicePeriodQueueTestSuite g_dmgServicePeriodQueueTestSuite; ///< the test suite
@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-mac-queue.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the lookups by receiver address and TID find the
+ * same frames as a scan of the whole queue, whichever way the frames
+ * are inserted and removed.
+ */
+class WifiMacQueueIndexTest : public TestCase
+{
+public:
+  WifiMacQueueIndexTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Create a queue item.
+   * \param dest the receiver address
+   * \param tid the TID
+   * \param qos whether the frame is a QoS data frame
+   * \return the item
+   */
+  Ptr<WifiMacQueueItem> CreateItem (Mac48Address dest, uint8_t tid, bool qos = true) const;
+  /**
+   * Find the first QoS data frame with the given receiver and TID by scanning the queue.
+   * \param tid the TID
+   * \param dest the receiver address
+   * \param pos the position the search starts from
+   * \return the position of the frame
+   */
+  WifiMacQueue::ConstIterator Scan (uint8_t tid, Mac48Address dest, WifiMacQueue::ConstIterator pos) const;
+  /**
+   * Compare the lookups of the queue with a scan of the queue.
+   * \param step the name of the step of the test
+   */
+  void Check (std::string step);
+
+  Ptr<WifiMacQueue> m_queue;           ///< the queue
+  std::vector<Mac48Address> m_dests;   ///< the receivers
+};
+
+WifiMacQueueIndexTest::WifiMacQueueIndexTest ()
+  : TestCase ("Look up the frames by receiver and TID")
+{
+}
+
+Ptr<WifiMacQueueItem>
+WifiMacQueueIndexTest::CreateItem (Mac48Address dest, uint8_t tid, bool qos) const
+{
+  WifiMacHeader hdr;
+  hdr.SetType (qos ? WIFI_MAC_QOSDATA : WIFI_MAC_DATA);
+  hdr.SetAddr1 (dest);
+  if (qos)
+    {
+      hdr.SetQosTid (tid);
+    }
+  return Create<WifiMacQueueItem> (Create<Packet> (100), hdr);
+}
+
+WifiMacQueue::ConstIterator
+WifiMacQueueIndexTest::Scan (uint8_t tid, Mac48Address dest, WifiMacQueue::ConstIterator pos) const
+{
+  for (WifiMacQueue::ConstIterator it = pos; it != m_queue->end (); it++)
+    {
+      if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
+          && (*it)->GetHeader ().GetQosTid () == tid)
+        {
+          return it;
+        }
+    }
+  return m_queue->end ();
+}
+
+void
+WifiMacQueueIndexTest::Check (std::string step)
+{
+  for (uint8_t tid = 0; tid < 3; tid++)
+    {
+      for (auto dest : m_dests)
+        {
+          WifiMacQueue::ConstIterator first = Scan (tid, dest, m_queue->begin ());
+          NS_TEST_EXPECT_MSG_EQ ((m_queue->PeekByTidAndAddress (tid, dest) == first), true,
+                                 step << ": wrong first frame for " << dest << " TID " << +tid);
+          uint32_t nPackets = 0;
+          for (WifiMacQueue::ConstIterator pos = m_queue->begin (); pos != m_queue->end (); pos++)
+            {
+              NS_TEST_EXPECT_MSG_EQ ((m_queue->PeekByTidAndAddress (tid, dest, pos) == Scan (tid, dest, pos)), true,
+                                     step << ": wrong next frame for " << dest << " TID " << +tid);
+              if (Scan (tid, dest, pos) == pos)
+                {
+                  nPackets++;
+                }
+            }
+          NS_TEST_EXPECT_MSG_EQ ((m_queue->PeekByTidAndAddress (tid, dest, m_queue->end ()) == m_queue->end ()), true,
+                                 step << ": frame found past the end");
+          NS_TEST_EXPECT_MSG_EQ (m_queue->GetNPacketsByTidAndAddress (tid, dest), nPackets,
+                                 step << ": wrong number of frames for " << dest << " TID " << +tid);
+        }
+    }
+}
+
+void
+WifiMacQueueIndexTest::DoRun (void)
+{
+  m_queue = CreateObject<WifiMacQueue> ();
+  m_queue->SetMaxSize (QueueSize ("1000p"));
+  m_queue->SetMaxDelay (Seconds (10));
+  m_dests.push_back (Mac48Address ("00:00:00:00:00:01"));
+  m_dests.push_back (Mac48Address ("00:00:00:00:00:02"));
+
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      m_queue->Enqueue (CreateItem (m_dests[i % 2], i % 3));
+    }
+  Check ("Enqueue");
+
+  m_queue->PushFront (CreateItem (m_dests[0], 1));
+  m_queue->Enqueue (CreateItem (m_dests[1], 0, false));
+  Check ("PushFront");
+
+  // insert many frames at the same position, so that the queue has to
+  // number its items again
+  for (uint32_t i = 0; i < 50; i++)
+    {
+      WifiMacQueue::ConstIterator pos = m_queue->begin ();
+      std::advance (pos, 3);
+      m_queue->Insert (pos, CreateItem (m_dests[i % 2], 2));
+    }
+  Check ("Insert");
+
+  NS_TEST_EXPECT_MSG_NE (m_queue->DequeueByTidAndAddress (1, m_dests[0]), 0, "No frame dequeued");
+  Check ("DequeueByTidAndAddress");
+
+  WifiMacQueue::ConstIterator pos = m_queue->begin ();
+  std::advance (pos, 7);
+  m_queue->Remove (pos);
+  Check ("Remove");
+
+  while (m_queue->GetNPackets () > 30)
+    {
+      m_queue->Dequeue ();
+    }
+  Check ("Dequeue");
+
+  while (!m_queue->IsEmpty ())
+    {
+      m_queue->Remove ();
+    }
+  Check ("Flush");
+
+  m_queue->Enqueue (CreateItem (m_dests[0], 2));
+  Check ("Enqueue after flush");
+
+  m_queue = 0;
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi MAC Queue Test Suite
+ */
+class WifiMacQueueTestSuite : public TestSuite
+{
+public:
+  WifiMacQueueTestSuite ();
+};
+
+WifiMacQueueTestSuite::WifiMacQueueTestSuite ()
+  : TestSuite ("wifi-mac-queue", UNIT)
+{
+  AddTestCase (new WifiMacQueueIndexTest, TestCase::QUICK);
+}
+
+static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the construction of A-MPDUs by the MAC, without
+// PHY or channel: the MPDUs of each A-MPDU are serialized one at a time,
+// as MpduAggregator::Aggregate does, and in one batch, as WifiPsdu does.
+// Sample usage:  ./waf --run 'bench-ampdu-aggregation --mpdus=64 --size=1500'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Print the rate of the MPDUs aggregated.
+ *
+ * \param method the name of the aggregation method.
+ * \param mpdus the number of MPDUs aggregated.
+ * \param elapsed the wall-clock time, in milliseconds.
+ */
+static void
+Report (std::string method, uint64_t mpdus, int64_t elapsed)
+{
+  std::cout << std::left << std::setw (10) << method
+            << std::right << std::setw (10) << mpdus << " MPDUs"
+            << std::setw (10) << elapsed << "ms"
+            << std::setw (16) << (elapsed > 0 ? mpdus * 1000.0 / elapsed : 0) << " MPDUs/s"
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t mpdus = 64;
+  uint32_t size = 1500;
+  uint32_t ampdus = 5000;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("mpdus", "Number of MPDUs per A-MPDU", mpdus);
+  cmd.AddValue ("size", "Size of the MSDUs, in bytes", size);
+  cmd.AddValue ("ampdus", "Number of A-MPDUs built", ampdus);
+  cmd.Parse (argc, argv);
+
+  std::vector<Ptr<WifiMacQueueItem>> mpduList;
+  for (uint32_t i = 0; i < mpdus; i++)
+    {
+      WifiMacHeader hdr;
+      hdr.SetType (WIFI_MAC_QOSDATA);
+      hdr.SetAddr1 (Mac48Address ("00:00:00:00:00:01"));
+      hdr.SetQosTid (0);
+      hdr.SetSequenceNumber (i);
+      mpduList.push_back (Create<WifiMacQueueItem> (Create<Packet> (size), hdr));
+    }
+
+  std::cout << "mpdus=" << mpdus << ", size=" << size << ", ampdus=" << ampdus << std::endl;
+
+  SystemWallClockMs time;
+  time.Start ();
+  uint32_t ampduSize = 0;
+  for (uint32_t n = 0; n < ampdus; n++)
+    {
+      Ptr<Packet> ampdu = Create<Packet> ();
+      for (auto& mpdu : mpduList)
+        {
+          MpduAggregator::Aggregate (mpdu, ampdu, false);
+        }
+      ampduSize = ampdu->GetSize ();
+    }
+  Report ("per-mpdu", uint64_t (mpdus) * ampdus, time.End ());
+
+  time.Start ();
+  for (uint32_t n = 0; n < ampdus; n++)
+    {
+      Ptr<WifiPsdu> psdu = Create<WifiPsdu> (mpduList);
+      Ptr<const Packet> ampdu = psdu->GetPacket ();
+      NS_ABORT_MSG_IF (ampdu->GetSize () != ampduSize, "The A-MPDUs differ in size");
+    }
+  Report ("batch", uint64_t (mpdus) * ampdus, time.End ());
+
+  return 0;
+}
@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the processing of the BlockAck frames by the
+// originator of a Block Ack agreement with a large transmit window: each
+// round transmits the lost MPDUs again along with new ones until the
+// window is full, then processes an EDMG compressed BlockAck which
+// acknowledges each MPDU with the given probability.
+// Sample usage:  ./waf --run 'bench-block-ack --window=1024 --loss=0.3'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * The transmission queue of the recipient is never blocked in this program.
+ *
+ * \param recipient the recipient.
+ * \param tid the TID.
+ */
+static void
+BlockDestination (Mac48Address recipient, uint8_t tid)
+{
+}
+
+/**
+ * Create a QoS data frame.
+ *
+ * \param dest the receiver.
+ * \param seq the sequence number.
+ * \return the queue item.
+ */
+static Ptr<WifiMacQueueItem>
+CreateItem (Mac48Address dest, uint16_t seq)
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetAddr1 (dest);
+  hdr.SetQosTid (0);
+  hdr.SetQosAckPolicy (WifiMacHeader::BLOCK_ACK);
+  hdr.SetSequenceNumber (seq);
+  return Create<WifiMacQueueItem> (Create<Packet> (1400), hdr);
+}
+
+/**
+ * Run the rounds of transmissions and BlockAck frames, and report the rate
+ * of the MPDUs processed. Runs as a simulation event, as the MAC does.
+ *
+ * \param manager the Block Ack manager of the originator.
+ * \param recipient the recipient.
+ * \param window the size of the transmit window.
+ * \param loss the probability that an MPDU is not acknowledged.
+ * \param rounds the number of BlockAck frames.
+ */
+static void
+Bench (Ptr<BlockAckManager> manager, Mac48Address recipient, uint16_t window, double loss, uint32_t rounds)
+{
+  Ptr<WifiMacQueue> retryQueue = manager->GetRetransmitQueue ();
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  uint16_t nextSeq = manager->GetOriginatorStartingSequence (recipient, 0);
+  std::vector<uint16_t> transmitted;
+  uint64_t mpdus = 0;
+
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t r = 0; r < rounds; r++)
+    {
+      uint16_t startingSeq = manager->GetOriginatorStartingSequence (recipient, 0);
+      transmitted.clear ();
+      // the lost MPDUs first, then the new ones up to the end of the window
+      while (Ptr<WifiMacQueueItem> mpdu = retryQueue->DequeueByTidAndAddress (0, recipient))
+        {
+          transmitted.push_back (mpdu->GetHeader ().GetSequenceNumber ());
+          manager->StorePacket (mpdu);
+        }
+      while ((nextSeq - startingSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE < window)
+        {
+          transmitted.push_back (nextSeq);
+          manager->StorePacket (CreateItem (recipient, nextSeq));
+          nextSeq = (nextSeq + 1) % SEQNO_SPACE_SIZE;
+        }
+
+      CtrlBAckResponseHeader blockAck;
+      blockAck.SetType (EDMG_COMPRESSED_BLOCK_ACK);
+      blockAck.SetCompresssedBlockAckSize (EDMG_COMPRESSED_BLOCK_ACK_BITMAP_1024);
+      blockAck.SetTidInfo (0);
+      blockAck.SetStartingSequence (startingSeq);
+      for (uint16_t seq : transmitted)
+        {
+          if (random->GetValue () >= loss)
+            {
+              blockAck.SetReceivedPacket (seq);
+            }
+        }
+      manager->NotifyGotBlockAck (&blockAck, recipient, 0, 0, WifiTxVector ());
+      mpdus += transmitted.size ();
+    }
+  int64_t elapsed = time.End ();
+  std::cout << std::setw (10) << mpdus << " MPDUs"
+            << std::setw (10) << elapsed << "ms"
+            << std::setw (16) << (elapsed > 0 ? mpdus * 1000.0 / elapsed : 0) << " MPDUs/s"
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint16_t window = 1024;
+  double loss = 0.3;
+  uint32_t rounds = 2000;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("window", "Size of the transmit window (at most 1024)", window);
+  cmd.AddValue ("loss", "Probability that an MPDU is not acknowledged", loss);
+  cmd.AddValue ("rounds", "Number of BlockAck frames", rounds);
+  cmd.Parse (argc, argv);
+  NS_ABORT_MSG_IF (window == 0 || window > 1024, "The transmit window must hold 1 to 1024 MPDUs");
+
+  Ptr<WifiPhy> phy = CreateObject<YansWifiPhy> ();
+  phy->ConfigureStandard (WIFI_PHY_STANDARD_80211ac);
+  Ptr<WifiRemoteStationManager> stationManager = CreateObject<ConstantRateWifiManager> ();
+  stationManager->SetupPhy (phy);
+
+  Ptr<WifiMacQueue> queue = CreateObject<WifiMacQueue> ();
+  queue->SetMaxSize (QueueSize (QueueSizeUnit::PACKETS, 2 * window));
+  Ptr<BlockAckManager> manager = CreateObject<BlockAckManager> ();
+  manager->SetWifiRemoteStationManager (stationManager);
+  manager->SetTxMiddle (Create<MacTxMiddle> ());
+  manager->SetQueue (queue);
+  manager->SetBlockDestinationCallback (MakeCallback (&BlockDestination));
+  manager->SetUnblockDestinationCallback (MakeCallback (&BlockDestination));
+
+  Mac48Address recipient = Mac48Address::Allocate ();
+  MgtAddBaRequestHeader reqHdr;
+  reqHdr.SetImmediateBlockAck ();
+  reqHdr.SetTid (0);
+  reqHdr.SetBufferSize (window - 1);
+  reqHdr.SetTimeout (0);
+  reqHdr.SetStartingSequence (0);
+  manager->CreateAgreement (&reqHdr, recipient);
+  MgtAddBaResponseHeader respHdr;
+  respHdr.SetStatusCode (StatusCode ());
+  respHdr.SetImmediateBlockAck ();
+  respHdr.SetTid (0);
+  respHdr.SetBufferSize (window - 1);
+  respHdr.SetTimeout (0);
+  manager->UpdateAgreement (&respHdr, recipient);
+
+  std::cout << "window=" << window << ", loss=" << loss << ", rounds=" << rounds << std::endl;
+  Simulator::ScheduleNow (&Bench, manager, recipient, window, loss, rounds);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return 0;
+}
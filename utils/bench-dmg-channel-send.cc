@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the throughput of DmgWifiChannel::Send, in
+// frames x receivers per second, for each link-budget policy of the channel.
+// Sample usage:  ./waf --run 'bench-dmg-channel-send --nodes=16 --frames=20000'
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Send frames from every node in turn and report the channel throughput.
+ * Runs as a simulation event, as the PHY does, so that Time objects are not
+ * tracked for resolution changes.
+ *
+ * \param policy the name of the link-budget policy under test.
+ * \param channel the channel.
+ * \param phys the PHYs attached to the channel.
+ * \param ppdu the PPDU to send.
+ * \param frames the number of frames to send.
+ */
+static void
+Bench (std::string policy, Ptr<DmgWifiChannel> channel, std::vector<Ptr<DmgWifiPhy> > phys,
+       Ptr<const WifiPpdu> ppdu, uint32_t frames)
+{
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < frames; i++)
+    {
+      channel->Send (phys[i % phys.size ()], ppdu, 10.0);
+    }
+  int64_t elapsed = time.End ();
+  double deliveries = double (frames) * (phys.size () - 1);
+  std::cout << std::left << std::setw (14) << policy
+            << std::right << std::setw (10) << elapsed << "ms"
+            << std::setw (16) << (elapsed > 0 ? deliveries * 1000.0 / elapsed : 0) << " deliveries/s"
+            << std::endl;
+  /* Drop the pending deliveries, only the cost of Send is of interest */
+  Simulator::Stop ();
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t nodes = 16;
+  uint32_t frames = 20000;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("nodes", "Number of PHYs on the channel", nodes);
+  cmd.AddValue ("frames", "Number of frames sent per policy", frames);
+  cmd.Parse (argc, argv);
+
+  DmgWifiHelper wifi;
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  Ptr<DmgWifiChannel> channel = DynamicCast<DmgWifiChannel> (wifiChannel.Create ());
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (channel);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "DataMode", StringValue ("DMG_MCS12"));
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac");
+
+  NodeContainer wifiNodes;
+  wifiNodes.Create (nodes);
+  NetDeviceContainer devices = wifi.Install (wifiPhy, wifiMac, wifiNodes);
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (1.0),
+                                 "DeltaY", DoubleValue (1.0),
+                                 "GridWidth", UintegerValue (4));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (wifiNodes);
+
+  std::vector<Ptr<DmgWifiPhy> > phys;
+  for (NetDeviceContainer::Iterator i = devices.Begin (); i != devices.End (); i++)
+    {
+      phys.push_back (DynamicCast<DmgWifiPhy> (DynamicCast<WifiNetDevice> (*i)->GetPhy ()));
+    }
+
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  Ptr<WifiPsdu> psdu = Create<WifiPsdu> (Create<Packet> (1400), hdr);
+  WifiTxVector txVector;
+  txVector.SetMode (WifiMode ("DMG_MCS12"));
+  Ptr<const WifiPpdu> ppdu = Create<WifiPpdu> (psdu, txVector, MicroSeconds (10), 60480);
+
+  std::cout << "nodes=" << nodes << ", frames=" << frames << std::endl;
+  struct
+  {
+    const char *name;
+    bool sv;
+    bool tgad;
+    bool adhoc;
+  } policies[] = {
+    { "jian-liu", false, false, false },
+    { "sv", true, false, false },
+    { "tgad", false, true, false },
+    { "log-distance", true, true, false },
+    { "tgad-adhoc", false, true, true },
+  };
+  for (uint32_t p = 0; p < sizeof (policies) / sizeof (policies[0]); p++)
+    {
+      channel->SetSVChannelEnabler (policies[p].sv);
+      channel->SetTGadChannelEnabler (policies[p].tgad);
+      channel->SetAdHocMode (policies[p].adhoc);
+      Simulator::ScheduleNow (&Bench, policies[p].name, channel, phys, ppdu, frames);
+      Simulator::Run ();
+    }
+
+  /* Trace replay cannot be disabled once enabled, so it runs last */
+  std::string traceFile = "bench-dmg-channel-send.txt";
+  std::ofstream trace (traceFile.c_str ());
+  trace << -60.0 << std::endl;
+  trace.close ();
+  channel->LoadReceivedSignalStrengthFile (traceFile, Seconds (1));
+  Simulator::ScheduleNow (&Bench, "trace-replay", channel, phys, ppdu, frames);
+  Simulator::Run ();
+  std::remove (traceFile.c_str ());
+
+  Simulator::Destroy ();
+  return 0;
+}
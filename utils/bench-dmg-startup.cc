@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the startup time of a scenario with many DMG
+// nodes: the creation of the nodes, of a SimpleNetDevice per node (one at
+// a time and with a bulk ObjectFactory::Create), of their WifiNetDevice
+// stacks and of their mobility models.
+// Sample usage:  ./waf --run 'bench-dmg-startup --nodes=1000,10000'
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * Print the duration of a startup phase.
+ *
+ * \param phase the name of the phase.
+ * \param nodes the number of nodes.
+ * \param elapsed the wall-clock time of the phase, in milliseconds.
+ */
+static void
+Report (std::string phase, uint32_t nodes, int64_t elapsed)
+{
+  std::cout << std::left << std::setw (12) << phase
+            << std::right << std::setw (8) << nodes << " nodes"
+            << std::setw (10) << elapsed << "ms"
+            << std::setw (12) << (nodes > 0 ? elapsed * 1000.0 / nodes : 0) << " us/node"
+            << std::endl;
+}
+
+/**
+ * Build a scenario with the given number of DMG nodes.
+ *
+ * \param nodes the number of nodes.
+ */
+static void
+Bench (uint32_t nodes)
+{
+  DmgWifiHelper wifi;
+  DmgWifiChannelHelper wifiChannel;
+  wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  wifiChannel.AddPropagationLoss ("ns3::FriisPropagationLossModel", "Frequency", DoubleValue (60.48e9));
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager", "DataMode", StringValue ("DMG_MCS12"));
+  wifi.SetCodebook ("ns3::CodebookAnalytical",
+                    "CodebookType", EnumValue (SIMPLE_CODEBOOK),
+                    "Antennas", UintegerValue (1),
+                    "Sectors", UintegerValue (8));
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac");
+
+  SystemWallClockMs total;
+  total.Start ();
+
+  SystemWallClockMs time;
+  time.Start ();
+  NodeContainer wifiNodes;
+  wifiNodes.Create (nodes);
+  Report ("nodes", nodes, time.End ());
+
+  time.Start ();
+  ObjectFactory simpleFactory;
+  simpleFactory.SetTypeId (SimpleNetDevice::GetTypeId ());
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      wifiNodes.Get (i)->AddDevice (simpleFactory.Create<SimpleNetDevice> ());
+    }
+  Report ("simple", nodes, time.End ());
+
+  time.Start ();
+  std::vector<Ptr<SimpleNetDevice> > simpleDevices = simpleFactory.Create<SimpleNetDevice> (nodes);
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      wifiNodes.Get (i)->AddDevice (simpleDevices[i]);
+    }
+  Report ("simple-bulk", nodes, time.End ());
+
+  time.Start ();
+  NetDeviceContainer devices = wifi.Install (wifiPhy, wifiMac, wifiNodes);
+  Report ("devices", nodes, time.End ());
+
+  time.Start ();
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (1.0),
+                                 "DeltaY", DoubleValue (1.0),
+                                 "GridWidth", UintegerValue (100));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (wifiNodes);
+  Report ("mobility", nodes, time.End ());
+
+  Report ("total", nodes, total.End ());
+
+  time.Start ();
+  Simulator::Destroy ();
+  Report ("destroy", nodes, time.End ());
+}
+
+int main (int argc, char *argv[])
+{
+  std::string nodes = "1000,10000";
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("nodes", "Comma-separated numbers of nodes to build", nodes);
+  cmd.Parse (argc, argv);
+
+  std::istringstream sizes (nodes);
+  std::string size;
+  while (std::getline (sizes, size, ','))
+    {
+      Bench (std::stoul (size));
+    }
+  return 0;
+}
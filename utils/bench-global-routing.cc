@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the computation of the global routes of a campus
+// backhaul: a grid of core routers, and access points with a single link
+// to the core and a stub network each.  The routes are computed from
+// scratch, then updated after an access point loses its link, as after a
+// failover, and after the link is restored.
+// Sample usage:  ./waf --run 'bench-global-routing --routers=10000 --threads=8'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Run a computation of the routes and report its duration.
+ *
+ * \param name the name of the computation.
+ * \param compute the computation.
+ * \return the duration in milliseconds.
+ */
+static int64_t
+Bench (std::string name, void (*compute)(void))
+{
+  SystemWallClockMs time;
+  time.Start ();
+  compute ();
+  int64_t elapsed = time.End ();
+  std::cout << std::left << std::setw (24) << name << std::right
+            << std::setw (10) << elapsed << "ms" << std::endl;
+  return elapsed;
+}
+
+/**
+ * Set the interface of a device up or down.
+ *
+ * \param device the device.
+ * \param up whether to set the interface up.
+ */
+static void
+SetInterface (Ptr<NetDevice> device, bool up)
+{
+  Ptr<Ipv4> ipv4 = device->GetNode ()->GetObject<Ipv4> ();
+  int32_t interface = ipv4->GetInterfaceForDevice (device);
+  if (up)
+    {
+      ipv4->SetUp (interface);
+    }
+  else
+    {
+      ipv4->SetDown (interface);
+    }
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t routers = 1000;
+  uint32_t core = 0;
+  uint32_t threads = 1;
+  uint32_t failovers = 4;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("routers", "Number of routers, core and access points", routers);
+  cmd.AddValue ("core", "Number of core routers, one tenth of the routers if zero", core);
+  cmd.AddValue ("threads", "Number of threads running the SPF calculations", threads);
+  cmd.AddValue ("failovers", "Number of access points failing over", failovers);
+  cmd.Parse (argc, argv);
+
+  if (core == 0)
+    {
+      core = std::max<uint32_t> (routers / 10, 1);
+    }
+  core = std::min (core, routers);
+  Config::SetGlobal ("GlobalRoutingSpfThreads", UintegerValue (threads));
+
+  NodeContainer coreNodes;
+  coreNodes.Create (core);
+  NodeContainer apNodes;
+  apNodes.Create (routers - core);
+  InternetStackHelper internet;
+  Ipv4GlobalRoutingHelper globalRouting;
+  internet.SetRoutingHelper (globalRouting);
+  internet.Install (coreNodes);
+  internet.Install (apNodes);
+
+  SimpleNetDeviceHelper p2p;
+  p2p.SetNetDevicePointToPointMode (true);
+  SimpleNetDeviceHelper lan;
+  Ipv4AddressHelper links ("10.0.0.0", "255.255.255.252");
+  Ipv4AddressHelper stubs ("172.16.0.0", "255.255.255.0");
+  // the core is a grid, with several shortest paths between most routers
+  uint32_t side = static_cast<uint32_t> (std::ceil (std::sqrt (core)));
+  for (uint32_t i = 0; i < core; i++)
+    {
+      if ((i + 1) % side != 0 && i + 1 < core)
+        {
+          links.Assign (p2p.Install (NodeContainer (coreNodes.Get (i), coreNodes.Get (i + 1))));
+          links.NewNetwork ();
+        }
+      if (i + side < core)
+        {
+          links.Assign (p2p.Install (NodeContainer (coreNodes.Get (i), coreNodes.Get (i + side))));
+          links.NewNetwork ();
+        }
+    }
+  // each access point has an uplink to the core and a stub network
+  NetDeviceContainer uplinks;
+  for (uint32_t i = 0; i < apNodes.GetN (); i++)
+    {
+      NetDeviceContainer uplink = p2p.Install (NodeContainer (apNodes.Get (i), coreNodes.Get (i % core)));
+      links.Assign (uplink);
+      links.NewNetwork ();
+      uplinks.Add (uplink.Get (0));
+      stubs.Assign (lan.Install (apNodes.Get (i)));
+      stubs.NewNetwork ();
+    }
+  failovers = std::min (failovers, uplinks.GetN ());
+
+  std::cout << "routers=" << routers << ", core=" << core << ", threads=" << threads
+            << ", failovers=" << failovers << std::endl;
+  Bench ("populate", &Ipv4GlobalRoutingHelper::PopulateRoutingTables);
+  int64_t recompute = Bench ("recompute", &Ipv4GlobalRoutingHelper::RecomputeRoutingTables);
+  Bench ("update, no change", &Ipv4GlobalRoutingHelper::UpdateRoutingTables);
+
+  int64_t down = 0;
+  int64_t up = 0;
+  for (uint32_t i = 0; i < failovers; i++)
+    {
+      Ptr<NetDevice> uplink = uplinks.Get (i * uplinks.GetN () / failovers);
+      SetInterface (uplink, false);
+      down += Bench ("update, uplink down", &Ipv4GlobalRoutingHelper::UpdateRoutingTables);
+      SetInterface (uplink, true);
+      up += Bench ("update, uplink up", &Ipv4GlobalRoutingHelper::UpdateRoutingTables);
+    }
+  if (failovers > 0)
+    {
+      std::cout << "mean update after a failover: " << (down + up) / failovers
+                << "ms, against " << 2 * recompute << "ms to recompute twice" << std::endl;
+    }
+
+  Simulator::Destroy ();
+  return 0;
+}
@@ -18,9 +18,11 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include <atomic>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <thread>
 #include <vector>
 #include <string.h>
 
@@ -39,6 +41,40 @@ std::string g_me;
 // Output field width
 int g_fwidth = 6;
 
+// Producer threads keep running while this is true
+std::atomic<bool> g_producing (false);
+// Events scheduled by the producer threads and not run yet
+std::atomic<int64_t> g_outstanding (0);
+// Maximum number of outstanding events per producer thread
+const int64_t g_maxOutstanding = 1000;
+
+/// Event scheduled by the producer threads
+void
+ForeignEvent (void)
+{
+  g_outstanding--;
+}
+
+/**
+ * Schedule events from a foreign thread, as an emulated device would,
+ * until g_producing is cleared.
+ * \param producers the number of producer threads
+ */
+void
+Produce (uint32_t producers)
+{
+  while (g_producing)
+    {
+      if (g_outstanding >= g_maxOutstanding * producers)
+        {
+          std::this_thread::yield ();
+          continue;
+        }
+      g_outstanding++;
+      Simulator::ScheduleWithContext (0, NanoSeconds (0), &ForeignEvent);
+    }
+}
+
 /// Bench class
 class Bench
 {
@@ -51,8 +87,18 @@ public:
   Bench (const uint32_t population, const uint32_t total)
     : m_population (population),
       m_total (total),
-      m_count (0)
+      m_count (0),
+      m_producers (0)
+  {
+  }
+
+  /**
+   * Set the number of threads scheduling events concurrently
+   * \param producers the number of producer threads
+   */
+  void SetProducers (const uint32_t producers)
   {
+    m_producers = producers;
   }
 
   /**
@@ -87,11 +133,15 @@ public:
 private:
   /// callback function
   void Cb (void);
+  /// Start the producer threads, once the simulation runs
+  void StartProducers (void);
 
   Ptr<RandomVariableStream> m_rand; ///< random variable
   uint32_t m_population; ///< population
   uint32_t m_total; ///< total
   uint32_t m_count; ///< count 
+  uint32_t m_producers; ///< number of producer threads
+  std::vector<std::thread> m_threads; ///< producer threads
 };
 
 void
@@ -115,11 +165,19 @@ Bench::RunBench (void)
   DEB ("initialization took " << init << "s");
 
   DEB ("running");
+  uint64_t events = Simulator::GetEventCount ();
+  Simulator::ScheduleNow (&Bench::StartProducers, this);
   time.Start ();
   Simulator::Run ();
   simu = time.End ();
   simu /= 1000;
   DEB ("run took " << simu << "s");
+  for (std::vector<std::thread>::iterator it = m_threads.begin (); it != m_threads.end (); ++it)
+    {
+      it->join ();
+    }
+  m_threads.clear ();
+  events = Simulator::GetEventCount () - events;
 
   LOG (std::setw (g_fwidth) << init <<
        std::setw (g_fwidth) << (m_population / init) <<
@@ -127,6 +185,11 @@ Bench::RunBench (void)
        std::setw (g_fwidth) << simu <<
        std::setw (g_fwidth) << (m_count / simu) <<
        std::setw (g_fwidth) << (simu / m_count));
+  if (m_producers > 0)
+    {
+      LOGME ((events - m_count) << " events from " << m_producers
+             << " producer threads, " << (events / simu) << " ev/s in total");
+    }
 
 }
 
@@ -135,6 +198,7 @@ Bench::Cb (void)
 {
   if (m_count >= m_total)
     {
+      g_producing = false;
       return;
     }
   DEB ("event at " << Simulator::Now ().GetSeconds () << "s");
@@ -144,6 +208,18 @@ Bench::Cb (void)
   ++m_count;
 }
 
+void
+Bench::StartProducers (void)
+{
+  // Time objects are safe to create from other threads once the
+  // simulation runs.
+  g_producing = (m_producers > 0);
+  for (uint32_t i = 0; i < m_producers; ++i)
+    {
+      m_threads.push_back (std::thread (&Produce, m_producers));
+    }
+}
+
 
 Ptr<RandomVariableStream>
 GetRandomStream (std::string filename)
@@ -179,8 +255,7 @@ GetRandomStream (std::string filename)
         {
           if (*input >> value)
             {
-              uint64_t ns = (uint64_t) (value * 1000000000);
-              nsValues.push_back (ns);
+              nsValues.push_back (value);
             }
           else
             {
@@ -198,6 +273,27 @@ GetRandomStream (std::string filename)
   return stream;
 }
 
+/**
+ * Get a stream of inter-event times typical of a DMG network: mostly
+ * short inter-frame spaces and TRN subfields, sector sweep slots, with a
+ * few events at the scale of the beacon interval.
+ *
+ * \return the random stream, in ns.
+ */
+Ptr<RandomVariableStream>
+GetDmgRandomStream (void)
+{
+  LOGME ("using a mix of DMG inter-event times");
+  //                          TRN   SBIFS  SIFS  SSW slot  SP    BI
+  double values[] =     { 100, 291,  1000,  3000, 15800,    1e6,  102.4e6 };
+  double cumulative[] = { 0.0, 0.30, 0.45,  0.80, 0.95,     0.99, 1.0 };
+  Ptr<EmpiricalRandomVariable> erv = CreateObject<EmpiricalRandomVariable> ();
+  for (uint32_t i = 0; i < sizeof (values) / sizeof (values[0]); i++)
+    {
+      erv->CDF (values[i], cumulative[i]);
+    }
+  return erv;
+}
 
 
 int main (int argc, char *argv[])
@@ -208,10 +304,13 @@ int main (int argc, char *argv[])
   bool schedList          = false;
   bool schedMap           = true;
   bool schedPriorityQueue = false;
+  bool schedRadixHeap     = false;
+  bool dmg                = false;
 
   uint32_t pop   =  100000;
   uint32_t total = 1000000;
   uint32_t runs  =       1;
+  uint32_t producers =    0;
   std::string filename = "";
 
   CommandLine cmd (__FILE__);
@@ -219,19 +318,26 @@ int main (int argc, char *argv[])
              "\n"
              "Event intervals are taken from one of:\n"
              "  an exponential distribution, with mean 100 ns,\n"
+             "  a mix of DMG inter-event times, with the --dmg argument,\n"
              "  an ascii file, given by the --file=\"<filename>\" argument,\n"
              "  or standard input, by the argument --file=\"-\"\n"
              "In the case of either --file form, the input is expected\n"
-             "to be ascii, giving the relative event times in ns.");
+             "to be ascii, giving the relative event times in ns.\n"
+             "Event times recorded from a DMG run (for instance the\n"
+             "differences between successive TIME_NS values decoded by\n"
+             "dmg-telemetry-reader) can be replayed this way.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
   cmd.AddValue ("pri",   "use PriorityQueue",             schedPriorityQueue);
+  cmd.AddValue ("radix", "use RadixHeapScheduler",        schedRadixHeap);
+  cmd.AddValue ("dmg",   "use a mix of DMG inter-event times", dmg);
   cmd.AddValue ("debug", "enable debugging output",       g_debug);
   cmd.AddValue ("pop",   "event population size (default 1E5)",         pop);
   cmd.AddValue ("total", "total number of events to run (default 1E6)", total);
   cmd.AddValue ("runs",  "number of runs (default 1)",    runs);
+  cmd.AddValue ("producers", "number of threads scheduling events concurrently (default 0)", producers);
   cmd.AddValue ("file",  "file of relative event times",  filename);
   cmd.AddValue ("prec",  "printed output precision",      g_fwidth);
   cmd.Parse (argc, argv);
@@ -255,6 +361,10 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::PriorityQueueScheduler");
     }
+  if (schedRadixHeap)
+    {
+      factory.SetTypeId ("ns3::RadixHeapScheduler");
+    }
       
   Simulator::SetScheduler (factory);
 
@@ -265,9 +375,11 @@ int main (int argc, char *argv[])
   LOGME ("population: " << pop);
   LOGME ("total events: " << total);
   LOGME ("runs: " << runs);
+  LOGME ("producer threads: " << producers);
 
   Bench *bench = new Bench (pop, total);
-  bench->SetRandomStream (GetRandomStream (filename));
+  bench->SetProducers (producers);
+  bench->SetRandomStream (dmg ? GetDmgRandomStream () : GetRandomStream (filename));
 
   // table header
   LOG ("");
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the lookups of the WifiMacQueue of an AP with a
+// saturated downlink to many STAs: each service period serves one STA, and
+// takes the frames for that STA from a queue holding the frames for all.
+// Sample usage:  ./waf --run 'bench-wifi-mac-queue --stas=32 --depth=64'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Create a QoS data frame.
+ *
+ * \param dest the receiver.
+ * \param tid the TID.
+ * \return the queue item.
+ */
+static Ptr<WifiMacQueueItem>
+CreateItem (Mac48Address dest, uint8_t tid)
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetAddr1 (dest);
+  hdr.SetQosTid (tid);
+  return Create<WifiMacQueueItem> (Create<Packet> (1400), hdr);
+}
+
+/**
+ * Serve the STAs in turn, as the service periods of a DMG AP do, and
+ * report the rate of the frames taken from the queue. Runs as a
+ * simulation event, as the MAC does.
+ *
+ * \param queue the queue.
+ * \param stas the receivers.
+ * \param periods the number of service periods.
+ * \param mpdus the number of frames sent per service period.
+ */
+static void
+Bench (Ptr<WifiMacQueue> queue, std::vector<Mac48Address> stas, uint32_t periods, uint32_t mpdus)
+{
+  SystemWallClockMs time;
+  time.Start ();
+  uint64_t frames = 0;
+  for (uint32_t p = 0; p < periods; p++)
+    {
+      Mac48Address peer = stas[p % stas.size ()];
+      // the frames of the A-MPDU, then refill the queue
+      WifiMacQueue::ConstIterator it = queue->PeekByTidAndAddress (0, peer);
+      for (uint32_t i = 0; i < mpdus && it != queue->end (); i++)
+        {
+          it = queue->PeekByTidAndAddress (0, peer, ++it);
+        }
+      for (uint32_t i = 0; i < mpdus; i++)
+        {
+          if (queue->GetNPacketsByTidAndAddress (0, peer) > 0)
+            {
+              queue->DequeueByTidAndAddress (0, peer);
+              queue->Enqueue (CreateItem (peer, 0));
+              frames++;
+            }
+        }
+    }
+  int64_t elapsed = time.End ();
+  std::cout << std::setw (10) << frames << " frames"
+            << std::setw (10) << elapsed << "ms"
+            << std::setw (16) << (elapsed > 0 ? frames * 1000.0 / elapsed : 0) << " frames/s"
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t stas = 32;
+  uint32_t depth = 64;
+  uint32_t periods = 2000;
+  uint32_t mpdus = 16;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("stas", "Number of associated STAs", stas);
+  cmd.AddValue ("depth", "Number of frames queued per STA", depth);
+  cmd.AddValue ("periods", "Number of service periods", periods);
+  cmd.AddValue ("mpdus", "Number of frames sent per service period", mpdus);
+  cmd.Parse (argc, argv);
+
+  Ptr<WifiMacQueue> queue = CreateObject<WifiMacQueue> ();
+  queue->SetMaxSize (QueueSize (QueueSizeUnit::PACKETS, stas * depth));
+  std::vector<Mac48Address> addresses;
+  for (uint32_t i = 0; i < stas; i++)
+    {
+      addresses.push_back (Mac48Address::Allocate ());
+    }
+  // the frames for the STAs are interleaved, as with a saturated downlink
+  for (uint32_t d = 0; d < depth; d++)
+    {
+      for (uint32_t i = 0; i < stas; i++)
+        {
+          queue->Enqueue (CreateItem (addresses[i], 0));
+        }
+    }
+
+  std::cout << "stas=" << stas << ", depth=" << depth << ", periods=" << periods
+            << ", mpdus=" << mpdus << std::endl;
+  Simulator::ScheduleNow (&Bench, queue, addresses, periods, mpdus);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return 0;
+}
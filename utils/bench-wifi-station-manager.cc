@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program measures the station lookups of the remote station manager
+// of a DMG AP with many associated STAs: for each MPDU sent to a STA, the
+// MAC asks for the TXVECTOR and whether to protect the MPDU, then reports
+// its acknowledgment, with an SNR that changes from time to time.
+// Sample usage:  ./waf --run 'bench-wifi-station-manager --stas=128 --manager=ns3::CbtraaDmgWifiManager'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+#include <iomanip>
+#include <iostream>
+
+using namespace ns3;
+
+/**
+ * Send MPDUs to the STAs in turn and report the rate at which the
+ * remote station manager handles them. Runs as a simulation event,
+ * once the manager has been initialized.
+ *
+ * \param manager the remote station manager.
+ * \param stas the receivers.
+ * \param mpdus the number of MPDUs.
+ * \param period the number of MPDUs sent to a STA between SNR changes.
+ */
+static void
+Bench (Ptr<WifiRemoteStationManager> manager, std::vector<Mac48Address> stas,
+       uint32_t mpdus, uint32_t period)
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetQosTid (0);
+  uint32_t size = 1400;
+
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < mpdus; i++)
+    {
+      Mac48Address peer = stas[i % stas.size ()];
+      hdr.SetAddr1 (peer);
+      WifiTxVector txVector = manager->GetDataTxVector (hdr);
+      manager->NeedRts (hdr, size);
+      double snr = 1000.0 + (i / stas.size () / period) % 2;
+      manager->RecordLinkSnr (peer, snr);
+      manager->ReportDataOk (peer, &hdr, snr, txVector.GetMode (), snr, txVector, size);
+    }
+  int64_t elapsed = time.End ();
+  std::cout << std::left << std::setw (32) << manager->GetInstanceTypeId ().GetName ()
+            << std::right << std::setw (6) << stas.size () << " STAs"
+            << std::setw (10) << elapsed << "ms"
+            << std::setw (12) << (elapsed > 0 ? mpdus / 1000.0 / elapsed : 0) << " MMPDU/s"
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t stas = 128;
+  uint32_t mpdus = 2000000;
+  uint32_t period = 64;
+  std::string manager = "ns3::IdealDmgWifiManager";
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("stas", "Number of associated STAs", stas);
+  cmd.AddValue ("mpdus", "Number of MPDUs sent", mpdus);
+  cmd.AddValue ("period", "Number of MPDUs sent to a STA between SNR changes", period);
+  cmd.AddValue ("manager", "Type of the remote station manager", manager);
+  cmd.Parse (argc, argv);
+
+  DmgWifiHelper wifi;
+  DmgWifiChannelHelper wifiChannel = DmgWifiChannelHelper::Default ();
+  DmgWifiPhyHelper wifiPhy = DmgWifiPhyHelper::Default ();
+  wifiPhy.SetChannel (wifiChannel.Create ());
+  wifi.SetRemoteStationManager (manager);
+  DmgWifiMacHelper wifiMac = DmgWifiMacHelper::Default ();
+  wifiMac.SetType ("ns3::DmgAdhocWifiMac");
+  NodeContainer nodes;
+  nodes.Create (1);
+  NetDeviceContainer devices = wifi.Install (wifiPhy, wifiMac, nodes);
+  Ptr<WifiRemoteStationManager> stationManager =
+    DynamicCast<WifiNetDevice> (devices.Get (0))->GetRemoteStationManager ();
+
+  std::vector<Mac48Address> addresses;
+  for (uint32_t i = 0; i < stas; i++)
+    {
+      Mac48Address address = Mac48Address::Allocate ();
+      stationManager->AddAllSupportedModes (address);
+      stationManager->RecordGotAssocTxOk (address);
+      addresses.push_back (address);
+    }
+
+  Simulator::Schedule (Seconds (0), &Bench, stationManager, addresses, mpdus, std::max<uint32_t> (period, 1));
+  Simulator::Stop (Seconds (0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return 0;
+}
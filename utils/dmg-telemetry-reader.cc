@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program decodes a DMG telemetry file (see ns3::DmgTelemetry) to CSV.
+// The file may be read while the simulation is still writing it.
+// Sample usage:  ./waf --run 'dmg-telemetry-reader --file=dmg-telemetry.bin'
+//
+// It can also measure the cost of recording a sample:
+//   ./waf --run 'dmg-telemetry-reader --bench=10000000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/simulator.h"
+#include "ns3/mac48-address.h"
+#include "ns3/dmg-telemetry.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * Print one record as a CSV line.
+ *
+ * \param os the output stream.
+ * \param r the record.
+ */
+static void
+PrintRecord (std::ostream &os, const DmgTelemetryRecord &r)
+{
+  switch (r.type)
+    {
+    case DMG_TELEMETRY_PPDU_TX:
+      os << r.timeNs << ",TX," << r.nodeId << ",,"
+         << +r.mcs << "," << +r.sector << "," << r.ppdu.powerDbm << ",,,"
+         << r.ppdu.durationNs << std::endl;
+      break;
+    case DMG_TELEMETRY_PPDU_RX:
+      {
+        uint8_t address[8];
+        std::memcpy (address, &r.peer, sizeof (address));
+        Mac48Address transmitter;
+        transmitter.CopyFrom (address);
+        os << r.timeNs << ",RX," << r.nodeId << "," << transmitter << ","
+           << +r.mcs << "," << +r.sector << "," << r.ppdu.powerDbm << ","
+           << r.ppdu.sinrDb << "," << (r.status ? "OK" : "ERROR") << ","
+           << r.ppdu.durationNs << std::endl;
+        break;
+      }
+    case DMG_TELEMETRY_CHANNEL:
+      os << r.timeNs << ",CHANNEL," << r.nodeId << "," << r.peer << ",,,"
+         << r.ppdu.powerDbm << ",,";
+      if (r.status != 0xff)
+        {
+          os << +r.status;
+        }
+      os << "," << r.ppdu.durationNs << std::endl;
+      break;
+    case DMG_TELEMETRY_BEACON_INTERVAL:
+      os << r.timeNs << ",BI," << r.nodeId
+         << ",BTI=" << r.bi.btiNs << ",ABFT=" << r.bi.abftNs << ",ATI=" << r.bi.atiNs
+         << ",DTI=" << r.bi.dtiNs << ",SP=" << r.bi.spNs;
+      if (r.bi.dtiNs > 0)
+        {
+          os << ",SP_UTILIZATION=" << double (r.bi.spNs) / r.bi.dtiNs;
+        }
+      os << std::endl;
+      break;
+    default:
+      os << r.timeNs << ",UNKNOWN," << r.nodeId << std::endl;
+    }
+}
+
+/**
+ * Decode a telemetry file to the standard output.
+ *
+ * \param fileName the telemetry file.
+ * \return the exit status.
+ */
+static int
+Decode (std::string fileName)
+{
+  int fd = open (fileName.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      std::cerr << "Unable to open " << fileName << std::endl;
+      return 1;
+    }
+  struct stat st;
+  fstat (fd, &st);
+  if (st.st_size < (off_t) sizeof (DmgTelemetryFileHeader))
+    {
+      std::cerr << fileName << " is not a DMG telemetry file" << std::endl;
+      close (fd);
+      return 1;
+    }
+  void *base = mmap (0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  if (base == MAP_FAILED)
+    {
+      std::cerr << "Unable to map " << fileName << std::endl;
+      return 1;
+    }
+  const DmgTelemetryFileHeader *header = static_cast<const DmgTelemetryFileHeader *> (base);
+  if (header->magic != DMG_TELEMETRY_MAGIC || header->version != DMG_TELEMETRY_VERSION
+      || header->recordSize != sizeof (DmgTelemetryRecord)
+      || (uint64_t) st.st_size < sizeof (DmgTelemetryFileHeader) + (uint64_t) header->capacity * sizeof (DmgTelemetryRecord))
+    {
+      std::cerr << fileName << " is not a DMG telemetry file of version " << DMG_TELEMETRY_VERSION << std::endl;
+      munmap (base, st.st_size);
+      return 1;
+    }
+  const DmgTelemetryRecord *records = reinterpret_cast<const DmgTelemetryRecord *> (header + 1);
+  uint64_t capacity = header->capacity;
+
+  /* Snapshot the ring, then drop the records the writer overwrote meanwhile */
+  uint64_t end = header->written.load (std::memory_order_acquire);
+  uint64_t begin = (end > capacity) ? end - capacity : 0;
+  std::vector<DmgTelemetryRecord> snapshot;
+  snapshot.reserve (end - begin);
+  for (uint64_t i = begin; i < end; i++)
+    {
+      snapshot.push_back (records[i & (capacity - 1)]);
+    }
+  /* The writer fills the slot of record "written" before publishing it, and
+     that slot also holds record "written - capacity": it may be half written */
+  uint64_t written = header->written.load (std::memory_order_acquire);
+  uint64_t firstValid = (written + 1 > capacity) ? written + 1 - capacity : 0;
+
+  std::cout << "TIME_NS,TYPE,NODE,PEER,MCS,SECTOR,POWER_DBM,SINR_DB,STATUS,DURATION_NS" << std::endl;
+  for (uint64_t i = std::max (begin, firstValid); i < end; i++)
+    {
+      PrintRecord (std::cout, snapshot[i - begin]);
+    }
+  if (firstValid > begin)
+    {
+      std::cerr << (firstValid - begin) << " records overwritten while reading" << std::endl;
+    }
+  munmap (base, st.st_size);
+  return 0;
+}
+
+/**
+ * Record samples and report the cost per record. Runs as a simulation event,
+ * as the probes do, so that Time objects are not tracked for resolution changes.
+ *
+ * \param telemetry the telemetry sink.
+ * \param n the number of samples to record.
+ */
+static void
+Bench (Ptr<DmgTelemetry> telemetry, uint64_t n)
+{
+  Time duration = MicroSeconds (10);
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint64_t i = 0; i < n; i++)
+    {
+      telemetry->RecordPpduRx (i & 0xff, i, 12, 3, -55.0, 20.0, true, duration);
+    }
+  int64_t elapsed = time.End ();
+  std::cout << "records=" << n << ", elapsed=" << elapsed << "ms, "
+            << double (elapsed) * 1e6 / n << "ns/record" << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  std::string fileName = "dmg-telemetry.bin";
+  uint64_t bench = 0;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("file", "Telemetry file to decode (or to write with --bench)", fileName);
+  cmd.AddValue ("bench", "Record this many samples and report the cost per record", bench);
+  cmd.Parse (argc, argv);
+
+  if (bench > 0)
+    {
+      Ptr<DmgTelemetry> telemetry = CreateObject<DmgTelemetry> ();
+      telemetry->Open (fileName, 1 << 20);
+      Simulator::ScheduleNow (&Bench, telemetry, bench);
+      Simulator::Run ();
+      Simulator::Destroy ();
+      telemetry->Dispose ();
+      return 0;
+    }
+  return Decode (fileName);
+}